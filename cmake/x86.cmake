@@ -43,6 +43,10 @@ if(USE_X86_OMP)
     endif()
 endif()
 
+# worker threads of the async executor
+find_package(Threads REQUIRED)
+list(APPEND PPLCV_LINK_LIBRARIES Threads::Threads)
+
 list(APPEND PPLCV_SRC ${PPLCV_X86_SRC})
 
 # glog benchmark and unittest sources
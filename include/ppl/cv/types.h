@@ -111,6 +111,30 @@ enum
     INTER_LANCZOS4  =4
 };
 
+/** Contour retrieval modes for FindContours */
+enum ContourRetrievalModes {
+    RETR_EXTERNAL = 0, //!< retrieves only the extreme outer contours
+    RETR_TREE     = 3  //!< retrieves all contours and reconstructs the full hierarchy of nested contours
+};
+
+/** Contour approximation methods for FindContours */
+enum ContourApproximationModes {
+    CHAIN_APPROX_NONE   = 1, //!< stores all the contour points
+    CHAIN_APPROX_SIMPLE = 2  //!< compresses horizontal, vertical and diagonal segments and leaves only their end points
+};
+
+/** Radius scales for WarpPolar */
+enum WarpPolarMode {
+    WARP_POLAR_LINEAR = 0, //!< the radius grows linearly along the polar image's rows
+    WARP_POLAR_LOG    = 1  //!< the radius grows exponentially along the polar image's rows (log-polar)
+};
+
+/** 2D point with integer coordinates */
+struct Point2i {
+    int32_t x;
+    int32_t y;
+};
+
 typedef unsigned char uchar;   //!< Type alias. For some code backward compatibility.
 typedef unsigned short ushort; //!< Type alias. For some code backward compatibility.
 
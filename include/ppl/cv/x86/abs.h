@@ -26,7 +26,8 @@ namespace x86 {
 
 /**
 * @brief Calculates an absolute value of each matrix element.
-* @tparam T The data type of input and output image, currently only \a float is supported.
+* @tparam T The data type of input and output image, currently \a float, \a int8_t and \a int16_t are supported.
+*           Integer results saturate, so the most negative value maps to the largest positive one.
 * @tparam nc The number of channels of input image and output image, 1, 3 and 4 are supported.
 * @param height            input image's height
 * @param width             input image's width
@@ -41,6 +42,12 @@ namespace x86 {
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
+* <tr><td>int8_t<td>1
+* <tr><td>int8_t<td>3
+* <tr><td>int8_t<td>4
+* <tr><td>int16_t<td>1
+* <tr><td>int16_t<td>3
+* <tr><td>int16_t<td>4
 * </table>
 * <table>
 * <caption align="left">Requirements</caption>
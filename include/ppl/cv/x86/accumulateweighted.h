@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_ACCUMULATEWEIGHTED_H_
+#define __ST_HPC_PPL_CV_X86_ACCUMULATEWEIGHTED_H_
+
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Updates a running average, acc = (1 - alpha) * acc + alpha * src.
+* @tparam T The data type of input image, currently \a uint8_t and \a float are supported.
+* @tparam nc The number of channels of input image and accumulator, 1, 3 and 4 are supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * nc`
+* @param inData            input image data
+* @param alpha             weight of the input image, in [0, 1]
+* @param accWidthStride    accumulator's width stride in floats, usually it equals to `width * nc`
+* @param accData           float accumulator, updated in place
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Rows are processed in parallel.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/accumulateweighted.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/accumulateweighted.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     float* dev_acc = (float*)calloc(W * H * C, sizeof(float));
+*
+*     ppl::cv::x86::AccumulateWeighted<uint8_t, 3>(H, W, W * C, dev_iImage, 0.05f, W * C, dev_acc);
+*
+*     free(dev_iImage);
+*     free(dev_acc);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t nc>
+::ppl::common::RetCode AccumulateWeighted(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    float alpha,
+    int32_t accWidthStride,
+    float *accData);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_ACCUMULATEWEIGHTED_H_
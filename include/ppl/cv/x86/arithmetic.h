@@ -26,7 +26,8 @@ namespace x86 {
 
 /**
 * @brief Calculates the per-element sum of two arrays
-* @tparam T The data type of input and output image, currently \a float and \a uint8_t are supported.
+* @tparam T The data type of input and output image, currently \a float, \a uint8_t and \a int16_t are supported,
+*           integer results saturate.
 * @tparam nc The number of channels of input image and output image, 1, 3 and 4 are supported.
 * @param height            input image's height
 * @param width             input image's width
@@ -43,7 +44,12 @@ namespace x86 {
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
+* <tr><td>int16_t<td>1
+* <tr><td>int16_t<td>3
+* <tr><td>int16_t<td>4
 * </table>
+* @remark The operation is element-wise, so it may run in place: outData may equal inData0 or inData1 when
+*         the two share the same width stride.
 * <table>
 * <caption align="left">Requirements</caption>
 * <tr><td>X86 platforms supported<td> All
@@ -84,7 +90,8 @@ template <typename T, int32_t channels>
 
 /**
 * @brief Calculates the per-element multiply of two arrays
-* @tparam T The data type of input and output image, currently \a float and \a uint8_t are supported.
+* @tparam T The data type of input and output image, currently \a float, \a uint8_t and \a int16_t are supported,
+*           integer results saturate.
 * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
 * @param height            input image's height
 * @param width             input image's width
@@ -102,7 +109,12 @@ template <typename T, int32_t channels>
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
+* <tr><td>int16_t<td>1
+* <tr><td>int16_t<td>3
+* <tr><td>int16_t<td>4
 * </table>
+* @remark The operation is element-wise, so it may run in place: outData may equal inData0 or inData1 when
+*         the two share the same width stride.
 * <table>
 * <caption align="left">Requirements</caption>
 * <tr><td>X86 platforms supported<td> All
@@ -162,6 +174,8 @@ template <typename T, int32_t channels>
 * <tr><td>float<td>3
 * <tr><td>float<td>4
 * </table>
+* @remark The operation is element-wise, so it may run in place: outData may equal inData0 or inData1 when
+*         the two share the same width stride.
 * <table>
 * <caption align="left">Requirements</caption>
 * <tr><td>X86 platforms supported<td> All
@@ -219,6 +233,8 @@ template <typename T, int32_t channels>
 * <tr><td>float<td>3
 * <tr><td>float<td>4
 * </table>
+* @remark The operation is element-wise, so it may run in place: outData may equal inData0 or inData1 when
+*         the two share the same width stride.
 * <table>
 * <caption align="left">Requirements</caption>
 * <tr><td>X86 platforms supported<td> All
@@ -277,6 +293,8 @@ template <typename T, int32_t channels>
 * <tr><td>float<td>3
 * <tr><td>float<td>4
 * </table>
+* @remark The operation is element-wise, so it may run in place: outData may equal inData0 or inData1 when
+*         the two share the same width stride.
 * <table>
 * <caption align="left">Requirements</caption>
 * <tr><td>X86 platforms supported<td> All
@@ -316,7 +334,8 @@ template <typename T, int32_t channels>
 
 /**
 * @brief Calculates the per-element difference between array and a scalar.
-* @tparam T The data type of input and output image, currently \a float and \a uint8_t are supported.
+* @tparam T The data type of input and output image, currently \a float, \a uint8_t and \a int16_t are supported,
+*           integer results saturate.
 * @tparam nc The number of channels of input image and output image, 1, 3 and 4 are supported.
 * @param height            input image's height
 * @param width             input image's width
@@ -335,7 +354,12 @@ template <typename T, int32_t channels>
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
+* <tr><td>int16_t<td>1
+* <tr><td>int16_t<td>3
+* <tr><td>int16_t<td>4
 * </table>
+* @remark The operation is element-wise, so it may run in place: outData may equal inData when the two share
+*         the same width stride.
 * <table>
 * <caption align="left">Requirements</caption>
 * <tr><td>X86 platforms supported<td> All
@@ -372,6 +396,72 @@ template <typename T, int32_t channels>
     int32_t outWidthStride,
     T *outData);
 
+/**
+* @brief Calculates the per-element absolute difference between two arrays.
+* @tparam T The data type of input and output image, currently \a float, \a uint8_t and \a int16_t are supported,
+*           integer results saturate.
+* @tparam nc The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride0    first input image's width stride, usually it equals to `width * nc`
+* @param inData0           first input image data
+* @param inWidthStride1    second input image's width stride, usually it equals to `width * nc`
+* @param inData1           second input image data
+* @param outWidthStride    output image's width stride, usually it equals to `width * nc`
+* @param outData           output image data
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uint8_t)<td>1
+* <tr><td>uint8_t(uint8_t)<td>3
+* <tr><td>uint8_t(uint8_t)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* <tr><td>int16_t<td>1
+* <tr><td>int16_t<td>3
+* <tr><td>int16_t<td>4
+* </table>
+* @remark The operation is element-wise, so it may run in place: outData may equal inData0 or inData1 when
+*         the two share the same width stride.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/arithmetic.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/arithmetic.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage0 = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_iImage1 = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*
+*     ppl::cv::x86::AbsDiff<uint8_t, 3>(H, W, W * C, dev_iImage0, W * C, dev_iImage1, W * C, dev_oImage);
+*
+*     free(dev_iImage0);
+*     free(dev_iImage1);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode AbsDiff(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const T *inData0,
+    int32_t inWidthStride1,
+    const T *inData1,
+    int32_t outWidthStride,
+    T *outData);
+
 
 } //! namespace x86
 } //! namespace cv
@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_ASYNC_H_
+#define __ST_HPC_PPL_CV_X86_ASYNC_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+#include "ppl/cv/x86/opgraph.h"
+#include <stddef.h>
+#include <functional>
+#include <memory>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/** A submitted task, usually a lambda calling a public operation */
+typedef std::function<::ppl::common::RetCode()> AsyncTask;
+
+struct AsyncEventState;
+
+/**
+* @brief Completion of a submitted task. Events are cheap to copy, all copies refer to the same task, and stay
+* valid after the executor is destroyed.
+*/
+class AsyncEvent {
+public:
+    /** An empty event, which is never waited for */
+    AsyncEvent();
+
+    /** False for empty events, for instance the ones of a full AsyncExecutor::TrySubmit() */
+    bool Valid() const { return static_cast<bool>(state_); }
+
+    /** True once the task has run, or has been skipped because one of its dependencies failed */
+    bool Ready() const;
+
+    /**
+    * @brief Blocks until the task is done.
+    * @return the result of the task, or the error of the first failed dependency when it has not run,
+    *         RC_INVALID_VALUE for empty events
+    */
+    ::ppl::common::RetCode Wait() const;
+
+private:
+    friend class AsyncExecutor;
+    explicit AsyncEvent(const std::shared_ptr<AsyncEventState>& state);
+
+    std::shared_ptr<AsyncEventState> state_;
+};
+
+/** Parameters of AsyncExecutor */
+struct AsyncExecutorParams {
+    int32_t workers;     //!< threads running the tasks, at least 1, every task still parallelizes itself with OpenMP
+    int32_t maxInFlight; //!< submitted tasks which are not done yet, at least 1, Submit() blocks beyond
+
+    AsyncExecutorParams()
+        : workers(1)
+        , maxInFlight(16) {}
+};
+
+struct AsyncExecutorImpl;
+
+/**
+* @brief Runs operations asynchronously: Submit() queues a task and returns at once with an event.
+* @warning Buffers of a task must stay valid until its event is ready.
+* @remark A task starts when all the events it depends on are ready. If one of them failed, the task is not run
+*         and its event reports that error, so a failure skips the rest of its chain. Ready tasks run in
+*         submission order. The number of tasks in flight is bounded by maxInFlight: Submit() waits for a
+*         task to finish when the bound is reached, which throttles a producer running ahead of its consumer,
+*         and TrySubmit() returns an empty event instead. Tasks must not call Submit() on their own executor.
+*         With the default single worker, every task gets all the OpenMP threads, and the worker overlaps
+*         the library with the submitting thread. More workers only help with many small independent tasks,
+*         and should come with a lower OMP_NUM_THREADS.
+*         The destructor waits for all submitted tasks.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/async.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/async.h>
+* #include <ppl/cv/x86/cvtcolor.h>
+* #include <ppl/cv/x86/resize.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 1920;
+*     const int32_t H = 1080;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * 3 / 2 * sizeof(uint8_t));
+*     uint8_t* dev_bgr = (uint8_t*)malloc(W * H * 3 * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W / 2 * H / 2 * 3 * sizeof(uint8_t));
+*
+*     ppl::cv::x86::AsyncExecutor executor;
+*     ppl::cv::x86::AsyncEvent converted = executor.Submit([=]() {
+*         return ppl::cv::x86::NV122BGR<uint8_t>(H, W, W, dev_iImage, W * 3, dev_bgr);
+*     });
+*     ppl::cv::x86::AsyncEvent resized = executor.Submit([=]() {
+*         return ppl::cv::x86::ResizeLinear<uint8_t, 3>(H, W, W * 3, dev_bgr, H / 2, W / 2, W / 2 * 3, dev_oImage);
+*     }, &converted, 1);
+*     // ... other work ...
+*     resized.Wait();
+*
+*     free(dev_iImage);
+*     free(dev_bgr);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+class AsyncExecutor {
+public:
+    AsyncExecutor(const AsyncExecutorParams& params = AsyncExecutorParams());
+    ~AsyncExecutor();
+
+    /**
+    * @brief Queues a task, blocks while maxInFlight tasks are in flight.
+    * @param task              the operation, for instance a lambda calling it
+    * @param deps              events the task waits for, from any executor, empty events are ignored
+    * @param numDeps           number of events in deps
+    */
+    AsyncEvent Submit(const AsyncTask& task, const AsyncEvent* deps = NULL, int32_t numDeps = 0);
+
+    /** Like Submit(), but returns an empty event without queueing the task when maxInFlight tasks are in flight */
+    AsyncEvent TrySubmit(const AsyncTask& task, const AsyncEvent* deps = NULL, int32_t numDeps = 0);
+
+    /**
+    * @brief Queues OpGraph::Execute(), the graph must stay alive and unchanged until the event is ready.
+    */
+    AsyncEvent Submit(
+        const OpGraph& graph,
+        int32_t inWidthStride,
+        const void* inData,
+        int32_t outWidthStride,
+        void* outData,
+        const AsyncEvent* deps = NULL,
+        int32_t numDeps        = 0);
+
+    /** Blocks until every submitted task is done */
+    void WaitAll();
+
+    /** Number of submitted tasks which are not done yet */
+    int32_t InFlight() const;
+
+private:
+    AsyncExecutor(const AsyncExecutor&);
+    AsyncExecutor& operator=(const AsyncExecutor&);
+
+    AsyncExecutorImpl* impl_;
+};
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_ASYNC_H_
@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_BACKGROUNDSUBTRACTOR_H_
+#define __ST_HPC_PPL_CV_X86_BACKGROUNDSUBTRACTOR_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+enum BackgroundModelPrecision {
+    BACKGROUND_MODEL_FLOAT32 = 0, //!< model parameters stored as 32-bit floats
+    BACKGROUND_MODEL_FIXED16 = 1, //!< model parameters stored as 16-bit fixed-point numbers, half the memory
+};
+
+/** Parameters of BackgroundSubtractorMOG2, the defaults are the same as OpenCV's */
+struct BackgroundSubtractorMOG2Params {
+    int32_t history;            //!< number of frames the learning rate is derived from
+    int32_t nmixtures;          //!< maximum number of Gaussians per pixel, in [1, 8]
+    float varThreshold;         //!< squared Mahalanobis distance under which a pixel matches a background mode
+    float varThresholdGen;      //!< squared Mahalanobis distance under which a pixel updates an existing mode
+    float backgroundRatio;      //!< total weight of the modes that make up the background
+    float varInit;              //!< variance of new modes
+    float varMin;               //!< lower bound of the mode variances
+    float varMax;               //!< upper bound of the mode variances, below 256 with BACKGROUND_MODEL_FIXED16
+    float complexityReduction;  //!< prior that removes modes not supported by the data
+    bool detectShadows;         //!< mark shadows with shadowValue instead of treating them as foreground
+    uint8_t shadowValue;        //!< mask value of shadow pixels
+    float shadowThreshold;      //!< a shadow is at most this much darker than the background, in (0, 1)
+    BackgroundModelPrecision precision; //!< storage of the per-pixel model
+
+    BackgroundSubtractorMOG2Params()
+        : history(500)
+        , nmixtures(5)
+        , varThreshold(16.f)
+        , varThresholdGen(9.f)
+        , backgroundRatio(0.9f)
+        , varInit(15.f)
+        , varMin(4.f)
+        , varMax(75.f)
+        , complexityReduction(0.05f)
+        , detectShadows(true)
+        , shadowValue(127)
+        , shadowThreshold(0.5f)
+        , precision(BACKGROUND_MODEL_FLOAT32) {}
+};
+
+struct BackgroundModelBuffers;
+
+/**
+* @brief Segments foreground from background with an adaptive Gaussian mixture model per pixel (Zivkovic's MOG2).
+* The model is allocated when the subtractor is created, Apply() allocates nothing.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Every pixel has up to nmixtures Gaussians with a weight, a mean and a single variance. Each frame matches
+*         the pixel against its modes, updates the matched one and creates or recycles a mode when none matches.
+*         The parameters are stored as structure of arrays, one plane per mode and component, so that 4 pixels
+*         are updated together with SSE. The modes are not kept sorted, their order is recomputed from the
+*         weights by comparisons. With BACKGROUND_MODEL_FIXED16 weights are stored with 16 fractional bits and
+*         means and variances with 8, which halves the memory of a stream at the cost of slightly slower
+*         adaptation of very light modes.
+*         Rows are processed in parallel.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/backgroundsubtractor.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/backgroundsubtractor.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_frame = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_mask = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*
+*     ppl::cv::x86::BackgroundSubtractorMOG2Params params;
+*     params.precision = ppl::cv::x86::BACKGROUND_MODEL_FIXED16;
+*     ppl::cv::x86::BackgroundSubtractorMOG2 subtractor(H, W, C, params);
+*     // for every frame
+*     subtractor.Apply(W * C, dev_frame, W, dev_mask);
+*
+*     free(dev_frame);
+*     free(dev_mask);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+class BackgroundSubtractorMOG2 {
+public:
+    /**
+    * @param height            height of the frames
+    * @param width             width of the frames
+    * @param channels          number of channels of the frames, 1 or 3
+    * @param params            model parameters, validated by Apply()
+    */
+    BackgroundSubtractorMOG2(int32_t height, int32_t width, int32_t channels, const BackgroundSubtractorMOG2Params& params);
+    ~BackgroundSubtractorMOG2();
+
+    /**
+    * @param inWidthStride     frame's width stride, usually it equals to `width * channels`
+    * @param inData            input frame
+    * @param maskWidthStride   the width stride of the mask, usually it equals to `width`
+    * @param maskData          output foreground mask, 0 for background, 255 for foreground and shadowValue for shadows
+    * @param learningRate      rate of adaptation in [0, 1], a negative value derives it from the history
+    */
+    ::ppl::common::RetCode Apply(
+        int32_t inWidthStride,
+        const uint8_t* inData,
+        int32_t maskWidthStride,
+        uint8_t* maskData,
+        float learningRate = -1.f);
+
+    /**
+    * @param outWidthStride    the width stride of the background image, usually it equals to `width * channels`
+    * @param outData           output background image, the weighted mean of the background modes of every pixel
+    */
+    ::ppl::common::RetCode GetBackgroundImage(int32_t outWidthStride, uint8_t* outData) const;
+
+private:
+    BackgroundSubtractorMOG2(const BackgroundSubtractorMOG2&);
+    BackgroundSubtractorMOG2& operator=(const BackgroundSubtractorMOG2&);
+
+    int32_t height_;
+    int32_t width_;
+    int32_t channels_;
+    int32_t nframes_;
+    BackgroundSubtractorMOG2Params params_;
+    BackgroundModelBuffers* buffers_;
+};
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_BACKGROUNDSUBTRACTOR_H_
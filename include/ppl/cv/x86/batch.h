@@ -0,0 +1,369 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_BATCH_H_
+#define __ST_HPC_PPL_CV_X86_BATCH_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+#include <stddef.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/** One image of a batch, strides are in elements */
+struct BatchImage {
+    int32_t height;      //!< image height
+    int32_t width;       //!< image width
+    int32_t widthStride; //!< row stride, at least `width * channels`
+    void* data;          //!< pixels, the luma plane of NV12 images
+    int32_t uvStride;    //!< row stride of the interleaved chroma plane of NV12 images
+    void* uvData;        //!< chroma plane of NV12 images, NULL if it follows the luma plane at `widthStride`
+
+    BatchImage()
+        : height(0)
+        , width(0)
+        , widthStride(0)
+        , data(NULL)
+        , uvStride(0)
+        , uvData(NULL) {}
+    BatchImage(int32_t height_, int32_t width_, int32_t widthStride_, void* data_)
+        : height(height_)
+        , width(width_)
+        , widthStride(widthStride_)
+        , data(data_)
+        , uvStride(0)
+        , uvData(NULL) {}
+};
+
+enum BatchTensorLayout {
+    BATCH_TENSOR_NHWC = 0, //!< one interleaved image after the other
+    BATCH_TENSOR_NCHW = 1, //!< one plane per channel, the planes of an image are contiguous
+};
+
+/** A dense batch tensor of `batchSize` images of height x width pixels */
+struct BatchTensor {
+    int32_t height;           //!< height of every image
+    int32_t width;            //!< width of every image
+    BatchTensorLayout layout; //!< element order
+    float scale;              //!< every value is multiplied by scale when it is stored
+    void* data;               //!< batchSize * channels * height * width elements
+
+    BatchTensor()
+        : height(0)
+        , width(0)
+        , layout(BATCH_TENSOR_NHWC)
+        , scale(1.f)
+        , data(NULL) {}
+    BatchTensor(int32_t height_, int32_t width_, BatchTensorLayout layout_, void* data_, float scale_ = 1.f)
+        : height(height_)
+        , width(width_)
+        , layout(layout_)
+        , scale(scale_)
+        , data(data_) {}
+};
+
+/**
+* @brief Converts a batch of NV12 images to BGR.
+* @tparam T The data type of input and output images, currently only uint8_t is supported.
+* @param batchSize         number of images
+* @param src               input images with even height and width
+* @param dst               output images of the same sizes as the input ones, 3 channels
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The arguments are validated once and the images are cut into bands of rows, which are spread over
+*         the threads together, so that a batch of small images keeps all cores busy. The result is the one
+*         of NV122BGR on every image.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/batch.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/batch.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 1920;
+*     const int32_t H = 1080;
+*     const int32_t N = 16;
+*     std::vector<uint8_t> nv12(N * H * 3 / 2 * W), bgr(N * H * W * 3);
+*     ppl::cv::x86::BatchImage src[N], dst[N];
+*     for (int32_t i = 0; i < N; ++i) {
+*         src[i] = ppl::cv::x86::BatchImage(H, W, W, &nv12[i * H * 3 / 2 * W]);
+*         dst[i] = ppl::cv::x86::BatchImage(H, W, W * 3, &bgr[i * H * W * 3]);
+*     }
+*     ppl::cv::x86::NV122BGRBatch<uint8_t>(N, src, dst);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode NV122BGRBatch(
+    int32_t batchSize,
+    const BatchImage* src,
+    const BatchImage* dst);
+
+/**
+* @brief Converts a batch of NV12 images to BGR and stores them into one batch tensor.
+* @tparam T The data type of input images, currently only uint8_t is supported.
+* @tparam TDst The data type of the tensor, uint8_t and float are supported.
+* @param batchSize         number of images
+* @param src               input images of dst.height x dst.width pixels, both even
+* @param dst               the tensor, 3 channels, values are multiplied by dst.scale
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Every band is converted into a per-thread buffer which is still in cache when it is scaled and
+*         scattered into the tensor, so no intermediate BGR images go through memory. Values converted to
+*         uint8_t are rounded to the nearest integer and saturated.
+* <table>
+* <tr><th>Data type(T)<th>Data type(TDst)
+* <tr><td>uint8_t<td>uint8_t
+* <tr><td>uint8_t<td>float
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/batch.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/batch.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t N = 16;
+*     std::vector<uint8_t> nv12(N * H * 3 / 2 * W);
+*     std::vector<float> tensor(N * 3 * H * W);
+*     ppl::cv::x86::BatchImage src[N];
+*     for (int32_t i = 0; i < N; ++i) {
+*         src[i] = ppl::cv::x86::BatchImage(H, W, W, &nv12[i * H * 3 / 2 * W]);
+*     }
+*     ppl::cv::x86::BatchTensor dst(H, W, ppl::cv::x86::BATCH_TENSOR_NCHW, tensor.data(), 1.f / 255);
+*     ppl::cv::x86::NV122BGRBatch<uint8_t, float>(N, src, dst);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, typename TDst>
+::ppl::common::RetCode NV122BGRBatch(
+    int32_t batchSize,
+    const BatchImage* src,
+    const BatchTensor& dst);
+
+/**
+* @brief Bilinear resize of a batch of images.
+* @tparam T The data type of input and output images, currently only uint8_t and float are supported.
+* @tparam channels The number of channels of the images, 1, 3 and 4 are supported.
+* @param batchSize         number of images
+* @param src               input images
+* @param dst               output images, their sizes select the scale of every image
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The interpolation tables are computed once for every distinct pair of input and output sizes and
+*         shared by the images which have them. Bands of output rows of all images are resized in parallel.
+*         The result is the one of ResizeLinear on every image, float results may differ in the last bits
+*         because the rows at the beginning of a band are not reused from the previous band.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/batch.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/batch.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t N = 16;
+*     std::vector<uint8_t> in(N * 1080 * 1920 * 3), out(N * 360 * 640 * 3);
+*     ppl::cv::x86::BatchImage src[N], dst[N];
+*     for (int32_t i = 0; i < N; ++i) {
+*         src[i] = ppl::cv::x86::BatchImage(1080, 1920, 1920 * 3, &in[i * 1080 * 1920 * 3]);
+*         dst[i] = ppl::cv::x86::BatchImage(360, 640, 640 * 3, &out[i * 360 * 640 * 3]);
+*     }
+*     ppl::cv::x86::ResizeLinearBatch<uint8_t, 3>(N, src, dst);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode ResizeLinearBatch(
+    int32_t batchSize,
+    const BatchImage* src,
+    const BatchImage* dst);
+
+/**
+* @brief Bilinear resize of a batch of images to the size of a batch tensor, into the tensor.
+* @tparam T The data type of input images, currently only uint8_t and float are supported.
+* @tparam channels The number of channels of the images, 1, 3 and 4 are supported.
+* @tparam TDst The data type of the tensor, uint8_t and float are supported.
+* @param batchSize         number of images
+* @param src               input images, of any size
+* @param dst               the tensor, every image is resized to dst.height x dst.width and multiplied by dst.scale
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Bands are resized into a per-thread buffer and scattered into the tensor, or straight into it when it
+*         is NHWC of type T and dst.scale is 1.
+* <table>
+* <tr><th>Data type(T)<th>channels<th>Data type(TDst)
+* <tr><td>uint8_t<td>1, 3, 4<td>uint8_t
+* <tr><td>uint8_t<td>1, 3, 4<td>float
+* <tr><td>float<td>1, 3, 4<td>float
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/batch.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/batch.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t N = 16;
+*     std::vector<uint8_t> in(N * 1080 * 1920 * 3);
+*     std::vector<float> tensor(N * 3 * 224 * 224);
+*     ppl::cv::x86::BatchImage src[N];
+*     for (int32_t i = 0; i < N; ++i) {
+*         src[i] = ppl::cv::x86::BatchImage(1080, 1920, 1920 * 3, &in[i * 1080 * 1920 * 3]);
+*     }
+*     ppl::cv::x86::BatchTensor dst(224, 224, ppl::cv::x86::BATCH_TENSOR_NCHW, tensor.data(), 1.f / 255);
+*     ppl::cv::x86::ResizeLinearBatch<uint8_t, 3, float>(N, src, dst);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels, typename TDst>
+::ppl::common::RetCode ResizeLinearBatch(
+    int32_t batchSize,
+    const BatchImage* src,
+    const BatchTensor& dst);
+
+/**
+* @brief Converts the data type of a batch of images, dst = src * scale.
+* @tparam TSrc The data type of input images.
+* @tparam channels The number of channels of the images, 1, 3 and 4 are supported.
+* @tparam TDst The data type of output images.
+* @param batchSize         number of images
+* @param src               input images
+* @param scale             scale factor
+* @param dst               output images of the same sizes as the input ones
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The result is the one of ConvertTo on every image.
+* <table>
+* <tr><th>Data type(TSrc)<th>channels<th>Data type(TDst)
+* <tr><td>uint8_t<td>1, 3, 4<td>float
+* <tr><td>float<td>1, 3, 4<td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/batch.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/batch.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t N = 16;
+*     std::vector<uint8_t> in(N * H * W * 3);
+*     std::vector<float> out(N * H * W * 3);
+*     ppl::cv::x86::BatchImage src[N], dst[N];
+*     for (int32_t i = 0; i < N; ++i) {
+*         src[i] = ppl::cv::x86::BatchImage(H, W, W * 3, &in[i * H * W * 3]);
+*         dst[i] = ppl::cv::x86::BatchImage(H, W, W * 3, &out[i * H * W * 3]);
+*     }
+*     ppl::cv::x86::ConvertToBatch<uint8_t, 3, float>(N, src, 1.f / 255, dst);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename TSrc, int32_t channels, typename TDst>
+::ppl::common::RetCode ConvertToBatch(
+    int32_t batchSize,
+    const BatchImage* src,
+    float scale,
+    const BatchImage* dst);
+
+/**
+* @brief Converts a batch of images into one batch tensor, which also changes the layout to NCHW if requested.
+* @tparam TSrc The data type of input images.
+* @tparam channels The number of channels of the images, 1, 3 and 4 are supported.
+* @tparam TDst The data type of the tensor.
+* @param batchSize         number of images
+* @param src               input images of dst.height x dst.width pixels
+* @param dst               the tensor, values are multiplied by dst.scale
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Values converted to uint8_t are rounded to the nearest integer and saturated.
+* <table>
+* <tr><th>Data type(TSrc)<th>channels<th>Data type(TDst)
+* <tr><td>uint8_t<td>1, 3, 4<td>uint8_t
+* <tr><td>uint8_t<td>1, 3, 4<td>float
+* <tr><td>float<td>1, 3, 4<td>uint8_t
+* <tr><td>float<td>1, 3, 4<td>float
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/batch.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/batch.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 224;
+*     const int32_t H = 224;
+*     const int32_t N = 16;
+*     std::vector<uint8_t> in(N * H * W * 3);
+*     std::vector<float> tensor(N * 3 * H * W);
+*     ppl::cv::x86::BatchImage src[N];
+*     for (int32_t i = 0; i < N; ++i) {
+*         src[i] = ppl::cv::x86::BatchImage(H, W, W * 3, &in[i * H * W * 3]);
+*     }
+*     ppl::cv::x86::BatchTensor dst(H, W, ppl::cv::x86::BATCH_TENSOR_NCHW, tensor.data(), 1.f / 255);
+*     ppl::cv::x86::ConvertToBatch<uint8_t, 3, float>(N, src, dst);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename TSrc, int32_t channels, typename TDst>
+::ppl::common::RetCode ConvertToBatch(
+    int32_t batchSize,
+    const BatchImage* src,
+    const BatchTensor& dst);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_BATCH_H_
@@ -50,6 +50,10 @@ namespace x86 {
 * <tr><td>float<td>3
 * <tr><td>float<td>4
 * </table>
+* @remark In-place filtering is supported: outData may equal inData when outWidthStride equals inWidthStride.
+*         The image is then filtered in bands of rows and only O(kernely_len) rows of scratch memory are used.
+*         For float the running column sums restart at every band, so in-place results can differ from the
+*         out-of-place ones by float rounding (a few 1e-6 relative); uint8_t results are identical.
 * <table>
 * <caption align="left">Requirements</caption>
 * <tr><td>x86 platforms supported<td> All 
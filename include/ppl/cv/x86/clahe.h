@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_CLAHE_H_
+#define __ST_HPC_PPL_CV_X86_CLAHE_H_
+
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Equalizes the histogram of a grayscale image using Contrast Limited Adaptive Histogram Equalization.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            input image data
+* @param outWidthStride    output image's width stride, usually it equals to `width`
+* @param outData           output image data
+* @param clipLimit         threshold for contrast limiting, relative to the mean count of a tile histogram bin,
+*                          0 disables clipping
+* @param tilesX            number of tiles in a row of the tile grid
+* @param tilesY            number of tiles in a column of the tile grid
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark If either side of the image is not a multiple of the tile grid, both sides are extended by
+*         BORDER_TYPE_REFLECT_101 to compute the histograms of the last tiles, as OpenCV does: a side which is
+*         a multiple grows by a whole tile row or column.
+*         Tile histograms are computed in parallel, and every pixel is mapped by the bilinear blend of the
+*         look-up tables of its four nearest tiles. On CPUs with FMA the blend gathers the look-up tables with AVX2
+*         and uses fused multiply-add, so a few pixels may differ from OpenCV by 1.
+*         The following table show which data type is supported.
+* <table>
+* <tr><th>Data type
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/clahe.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/clahe.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*
+*     ppl::cv::x86::CLAHE(H, W, W, dev_iImage, W, dev_oImage, 40.0, 8, 8);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode CLAHE(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    double clipLimit = 40.0,
+    int32_t tilesX = 8,
+    int32_t tilesY = 8);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_CLAHE_H_
@@ -26,9 +26,9 @@ namespace x86 {
 
 /**
 * @brief Calculates the per-element sum of two arrays
-* @tparam Tsrc The data type of input image, currently only \a uint8 and \a float are supported.
+* @tparam Tsrc The data type of input image, currently \a uint8, \a int16_t and \a float are supported.
 * @tparam nc The number of channels of input image and output image, 1, 3 and 4 are supported.
-* @tparam Tdst The data type of output image, currently only \a float and \a uint8 are supported.
+* @tparam Tdst The data type of output image, currently \a float, \a int16_t and \a uint8 are supported.
 * @param height            input image's height
 * @param width             input image's width
 * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
@@ -46,7 +46,25 @@ namespace x86 {
 * <tr><td>uint8_t<td>1<td>float
 * <tr><td>uint8_t<td>3<td>float
 * <tr><td>uint8_t<td>4<td>float
+* <tr><td>float<td>1<td>float
+* <tr><td>float<td>3<td>float
+* <tr><td>float<td>4<td>float
+* <tr><td>uint8_t<td>1<td>uint8_t
+* <tr><td>uint8_t<td>3<td>uint8_t
+* <tr><td>uint8_t<td>4<td>uint8_t
+* <tr><td>int16_t<td>1<td>uint8_t
+* <tr><td>int16_t<td>3<td>uint8_t
+* <tr><td>int16_t<td>4<td>uint8_t
+* <tr><td>int16_t<td>1<td>float
+* <tr><td>int16_t<td>3<td>float
+* <tr><td>int16_t<td>4<td>float
+* <tr><td>float<td>1<td>int16_t
+* <tr><td>float<td>3<td>int16_t
+* <tr><td>float<td>4<td>int16_t
 * </table>
+* @remark When TSrc and TDst are the same type the conversion may run in place: inData may equal outData
+*         as long as inWidthStride equals outWidthStride. uint8_t and int16_t results are rounded to the nearest
+*         integer and saturated.
 * <table>
 * <caption align="left">Requirements</caption>
 * <tr><td>X86 platforms supported<td> All
@@ -81,6 +99,46 @@ template <typename TSrc, int32_t channels, typename TDst>
     int32_t outWidthStride,
     TDst* outData);
 
+
+/**
+* @brief Scales, takes the absolute value and converts to uint8_t: outData = saturate(|inData * scale + delta|),
+*        e.g. to display the int16_t gradients of Sobel.
+* @tparam TSrc The data type of input image, currently \a int16_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param scale             coeffcient to mutiply
+* @param delta             value added to the scaled values
+* @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+* @param outData           output image data
+* @remark The fllowing table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(TSrc)<th>channels
+* <tr><td>int16_t<td>1
+* <tr><td>int16_t<td>3
+* <tr><td>int16_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* ###Example
+* @code{.cpp}
+* ppl::cv::x86::ConvertScaleAbs<int16_t, 1>(H, W, W, dev_iGradient, 1.0f, 0.0f, W, dev_oImage);
+* @endcode
+***************************************************************************************************/
+template <typename TSrc, int32_t channels>
+::ppl::common::RetCode ConvertScaleAbs(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const TSrc* inData,
+    float scale,
+    float delta,
+    int32_t outWidthStride,
+    uint8_t* outData);
+
 }
 }
 } // namespace ppl::cv::x86
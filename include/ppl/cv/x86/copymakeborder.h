@@ -25,7 +25,7 @@ namespace cv {
 namespace x86 {
 /**
  * @brief Copy the source image into the middle of dest image, and make border pixels according to specific border type.
- * @tparam T The data type of input image, currently \a float and \a uint8_t are supported.
+ * @tparam T The data type of input image, currently \a float, \a uint8_t and \a uint16_t are supported.
  * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
  * @param srcHeight         input image's height
  * @param srcWidth          input image's width need to be processed
@@ -44,6 +44,9 @@ namespace x86 {
  * <tr><td>uint8_t(uint8_t)<td>1
  * <tr><td>uint8_t(uint8_t)<td>3
  * <tr><td>uint8_t(uint8_t)<td>4
+ * <tr><td>uint16_t<td>1
+ * <tr><td>uint16_t<td>3
+ * <tr><td>uint16_t<td>4
  * </table>
  * <table>
  * <caption align="left">Requirements</caption>
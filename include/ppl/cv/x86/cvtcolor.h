@@ -450,6 +450,203 @@ template <typename T>
     int32_t outWidthStride,
     T* outData);
 
+//BGR_RGB
+/**
+ * @brief Convert BGR images to RGB images by swapping the first and the third channel
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark The fllowing table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * @remark The conversion may run in place: outData may equal inData when outWidthStride equals inWidthStride.
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> all
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t channels = 3;
+ *     uint8_t* image = (uint8_t*)malloc(W * H * channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGR2RGB<uint8_t>(H, W, W * channels, image, W * channels, image);
+ *
+ *     free(image);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGR2RGB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGB images to BGR images by swapping the first and the third channel
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark The fllowing table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * @remark The conversion may run in place: outData may equal inData when outWidthStride equals inWidthStride.
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> all
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t channels = 3;
+ *     uint8_t* image = (uint8_t*)malloc(W * H * channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGB2BGR<uint8_t>(H, W, W * channels, image, W * channels, image);
+ *
+ *     free(image);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGB2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGRA images to RGBA images by swapping the first and the third channel
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark The fllowing table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>4
+ * <tr><td>float<td>4<td>4
+ * </table>
+ * @remark The conversion may run in place: outData may equal inData when outWidthStride equals inWidthStride.
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> all
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t channels = 4;
+ *     uint8_t* image = (uint8_t*)malloc(W * H * channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGRA2RGBA<uint8_t>(H, W, W * channels, image, W * channels, image);
+ *
+ *     free(image);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGRA2RGBA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGBA images to BGRA images by swapping the first and the third channel
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark The fllowing table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>4
+ * <tr><td>float<td>4<td>4
+ * </table>
+ * @remark The conversion may run in place: outData may equal inData when outWidthStride equals inWidthStride.
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> all
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t channels = 4;
+ *     uint8_t* image = (uint8_t*)malloc(W * H * channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGBA2BGRA<uint8_t>(H, W, W * channels, image, W * channels, image);
+ *
+ *     free(image);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGBA2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
 //BGR_I420
 /**
  * @brief Convert BGR images to I420 images
@@ -3848,6 +4045,449 @@ template <typename T>
     int32_t outStrideV,
     T* outDataV);
 
+//Bayer
+/**
+ * @brief Interpolation methods of the Bayer demosaicing conversions.
+ */
+enum BayerDemosaicType {
+    /** averages of the nearest samples of each color, the same as OpenCV */
+    BAYER_DEMOSAIC_BILINEAR = 0,
+    /** gradient corrected linear interpolation of Malvar, He and Cutler */
+    BAYER_DEMOSAIC_EDGE_AWARE = 1,
+};
+
+/**
+ * @brief Convert BayerBG raw images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a uint16_t are supported.
+ * @param height            input image's height, at least 3
+ * @param width             input image's width need to be processed, at least 3
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw image data, whose first row starts with R G as in OpenCV's BayerBG pattern
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @param type              interpolation method
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Rows are interpolated in parallel bands, each band widens its input rows once into a ring of 5 rows.
+ *         The bilinear mode gives the same result as cv::cvtColor with COLOR_BayerBG2BGR.
+ *         The following table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>1<td>3
+ * <tr><td>uint16_t(uint16_t)<td>1<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BayerBG2BGR<uint8_t>(H, W, W, iImage, W * output_channels, oImage, ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BayerBG2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BayerDemosaicType type = BAYER_DEMOSAIC_BILINEAR);
+
+/**
+ * @brief Convert BayerBG raw images to GRAY images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a uint16_t are supported.
+ * @param height            input image's height, at least 3
+ * @param width             input image's width need to be processed, at least 3
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw image data, whose first row starts with R G as in OpenCV's BayerBG pattern
+ * @param outWidthStride    the width stride of output image, usually it equals to `width`
+ * @param outData           output image data
+ * @param type              interpolation method
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Rows are interpolated in parallel bands, each band widens its input rows once into a ring of 5 rows.
+ *         The bilinear mode gives the same result as cv::cvtColor with COLOR_BayerBG2GRAY.
+ *         The following table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>1<td>1
+ * <tr><td>uint16_t(uint16_t)<td>1<td>1
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 1;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BayerBG2GRAY<uint8_t>(H, W, W, iImage, W * output_channels, oImage, ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BayerBG2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BayerDemosaicType type = BAYER_DEMOSAIC_BILINEAR);
+
+/**
+ * @brief Convert BayerGB raw images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a uint16_t are supported.
+ * @param height            input image's height, at least 3
+ * @param width             input image's width need to be processed, at least 3
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw image data, whose first row starts with G R as in OpenCV's BayerGB pattern
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @param type              interpolation method
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Rows are interpolated in parallel bands, each band widens its input rows once into a ring of 5 rows.
+ *         The bilinear mode gives the same result as cv::cvtColor with COLOR_BayerGB2BGR.
+ *         The following table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>1<td>3
+ * <tr><td>uint16_t(uint16_t)<td>1<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BayerGB2BGR<uint8_t>(H, W, W, iImage, W * output_channels, oImage, ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BayerGB2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BayerDemosaicType type = BAYER_DEMOSAIC_BILINEAR);
+
+/**
+ * @brief Convert BayerGB raw images to GRAY images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a uint16_t are supported.
+ * @param height            input image's height, at least 3
+ * @param width             input image's width need to be processed, at least 3
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw image data, whose first row starts with G R as in OpenCV's BayerGB pattern
+ * @param outWidthStride    the width stride of output image, usually it equals to `width`
+ * @param outData           output image data
+ * @param type              interpolation method
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Rows are interpolated in parallel bands, each band widens its input rows once into a ring of 5 rows.
+ *         The bilinear mode gives the same result as cv::cvtColor with COLOR_BayerGB2GRAY.
+ *         The following table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>1<td>1
+ * <tr><td>uint16_t(uint16_t)<td>1<td>1
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 1;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BayerGB2GRAY<uint8_t>(H, W, W, iImage, W * output_channels, oImage, ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BayerGB2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BayerDemosaicType type = BAYER_DEMOSAIC_BILINEAR);
+
+/**
+ * @brief Convert BayerRG raw images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a uint16_t are supported.
+ * @param height            input image's height, at least 3
+ * @param width             input image's width need to be processed, at least 3
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw image data, whose first row starts with B G as in OpenCV's BayerRG pattern
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @param type              interpolation method
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Rows are interpolated in parallel bands, each band widens its input rows once into a ring of 5 rows.
+ *         The bilinear mode gives the same result as cv::cvtColor with COLOR_BayerRG2BGR.
+ *         The following table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>1<td>3
+ * <tr><td>uint16_t(uint16_t)<td>1<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BayerRG2BGR<uint8_t>(H, W, W, iImage, W * output_channels, oImage, ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BayerRG2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BayerDemosaicType type = BAYER_DEMOSAIC_BILINEAR);
+
+/**
+ * @brief Convert BayerRG raw images to GRAY images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a uint16_t are supported.
+ * @param height            input image's height, at least 3
+ * @param width             input image's width need to be processed, at least 3
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw image data, whose first row starts with B G as in OpenCV's BayerRG pattern
+ * @param outWidthStride    the width stride of output image, usually it equals to `width`
+ * @param outData           output image data
+ * @param type              interpolation method
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Rows are interpolated in parallel bands, each band widens its input rows once into a ring of 5 rows.
+ *         The bilinear mode gives the same result as cv::cvtColor with COLOR_BayerRG2GRAY.
+ *         The following table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>1<td>1
+ * <tr><td>uint16_t(uint16_t)<td>1<td>1
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 1;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BayerRG2GRAY<uint8_t>(H, W, W, iImage, W * output_channels, oImage, ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BayerRG2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BayerDemosaicType type = BAYER_DEMOSAIC_BILINEAR);
+
+/**
+ * @brief Convert BayerGR raw images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a uint16_t are supported.
+ * @param height            input image's height, at least 3
+ * @param width             input image's width need to be processed, at least 3
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw image data, whose first row starts with G B as in OpenCV's BayerGR pattern
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @param type              interpolation method
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Rows are interpolated in parallel bands, each band widens its input rows once into a ring of 5 rows.
+ *         The bilinear mode gives the same result as cv::cvtColor with COLOR_BayerGR2BGR.
+ *         The following table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>1<td>3
+ * <tr><td>uint16_t(uint16_t)<td>1<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BayerGR2BGR<uint8_t>(H, W, W, iImage, W * output_channels, oImage, ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BayerGR2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BayerDemosaicType type = BAYER_DEMOSAIC_BILINEAR);
+
+/**
+ * @brief Convert BayerGR raw images to GRAY images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a uint16_t are supported.
+ * @param height            input image's height, at least 3
+ * @param width             input image's width need to be processed, at least 3
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw image data, whose first row starts with G B as in OpenCV's BayerGR pattern
+ * @param outWidthStride    the width stride of output image, usually it equals to `width`
+ * @param outData           output image data
+ * @param type              interpolation method
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Rows are interpolated in parallel bands, each band widens its input rows once into a ring of 5 rows.
+ *         The bilinear mode gives the same result as cv::cvtColor with COLOR_BayerGR2GRAY.
+ *         The following table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>1<td>1
+ * <tr><td>uint16_t(uint16_t)<td>1<td>1
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 1;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BayerGR2GRAY<uint8_t>(H, W, W, iImage, W * output_channels, oImage, ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BayerGR2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BayerDemosaicType type = BAYER_DEMOSAIC_BILINEAR);
+
 }
 }
 } // namespace ppl::cv::x86
@@ -50,6 +50,9 @@ namespace x86 {
  * <tr><td>float<td>3
  * <tr><td>float<td>4
  * </table>
+ * @remark In-place filtering is supported: outData may equal inData when outWidthStride equals inWidthStride.
+ *         The image is then filtered in bands of rows and only O(max(kernelx_len, kernely_len)) rows of scratch
+ *         memory are used.
  * <table>
  * <caption align="left">Requirements</caption>
  * <tr><td>X86 platforms supported<td> All
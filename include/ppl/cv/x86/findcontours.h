@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_FINDCONTOURS_H_
+#define __ST_HPC_PPL_CV_X86_FINDCONTOURS_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+#include <vector>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Topology information of one contour, the same layout as the hierarchy of OpenCV.
+* Every field is an index into the contour list, or -1 if there is no such contour.
+*/
+struct ContourHierarchy {
+    int32_t next;       //!< next contour at the same hierarchical level
+    int32_t previous;   //!< previous contour at the same hierarchical level
+    int32_t firstChild; //!< first nested contour
+    int32_t parent;     //!< enclosing contour
+};
+
+/**
+* @brief Finds contours in a binary image with the border following algorithm of Suzuki85.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            input data, non-zero pixels are treated as 1's and zero pixels remain 0's
+* @param contours          detected contours, each contour is stored as a vector of points
+* @param hierarchy         [optional] topology of the contours, it has as many elements as contours
+* @param mode              contour retrieval mode, RETR_EXTERNAL or RETR_TREE
+* @param method            contour approximation method, CHAIN_APPROX_NONE or CHAIN_APPROX_SIMPLE
+* @param offsetX           optional offset by which every contour point is shifted in horizontal direction
+* @param offsetY           optional offset by which every contour point is shifted in vertical direction
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Pixels outside the image are treated as 0's, so contours touching the image border are found too.
+*         Rows containing no foreground pixel split the image into independent bands which are traced in parallel.
+*         The following table show which data type is supported.
+* <table>
+* <tr><th>Data type
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/findcontours.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/findcontours.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     std::vector<std::vector<ppl::cv::Point2i> > contours;
+*     std::vector<ppl::cv::x86::ContourHierarchy> hierarchy;
+*
+*     ppl::cv::x86::FindContours(H, W, W, dev_iImage, contours, &hierarchy,
+*                                ppl::cv::RETR_TREE, ppl::cv::CHAIN_APPROX_SIMPLE);
+*
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode FindContours(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    std::vector<std::vector<Point2i> >& contours,
+    std::vector<ContourHierarchy>* hierarchy,
+    ContourRetrievalModes mode,
+    ContourApproximationModes method,
+    int32_t offsetX = 0,
+    int32_t offsetY = 0);
+
+/**
+* @brief Approximates a polygonal curve with the specified precision (Douglas-Peucker algorithm).
+* @param count             number of points of the input curve
+* @param curve             input curve, such as a contour returned by FindContours
+* @param epsilon           maximum distance between the original curve and its approximation
+* @param closed            if true, the curve is closed (its first and last vertices are connected)
+* @param approxCurve       result of the approximation
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/findcontours.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/findcontours.h>
+* int32_t main(int32_t argc, char** argv) {
+*     std::vector<std::vector<ppl::cv::Point2i> > contours;
+*     // ... FindContours(...)
+*     std::vector<ppl::cv::Point2i> polygon;
+*     ppl::cv::x86::ApproxPolyDP(contours[0].size(), contours[0].data(), 3.0, true, polygon);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode ApproxPolyDP(
+    int32_t count,
+    const Point2i* curve,
+    double epsilon,
+    bool closed,
+    std::vector<Point2i>& approxCurve);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_FINDCONTOURS_H_
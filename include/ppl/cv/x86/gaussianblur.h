@@ -27,7 +27,7 @@ namespace x86 {
 
 /**
  * @brief Denoise or obscure an image with gaussian alogrithm.
- * @tparam T The data type of input image, currently only \a uint8_t(uchar) and \a float are supported.
+ * @tparam T The data type of input image, currently only \a uint8_t(uchar), \a uint16_t and \a float are supported.
  * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
  * @param height            input image's height
  * @param width             input image's width need to be processed
@@ -38,7 +38,7 @@ namespace x86 {
  * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
  * @param outData           output image data
  * @param border_type       ways to deal with border. For float, only BORDER_TYPE_REFLECT_101 or BORDER_TYPE_DEFAULT are supported now.
- *                          For uchar, all BORDER_TYPE are supported.
+ *                          For uchar and uint16_t, all BORDER_TYPE are supported.
  * @warning All input parameters must be valid, or undefined behaviour may occur.
  * @remark The fllowing table show which data type and channels are supported.
  * <table>
@@ -46,10 +46,15 @@ namespace x86 {
  * <tr><td>uint8_t(uchar)<td>1
  * <tr><td>uint8_t(uchar)<td>3
  * <tr><td>uint8_t(uchar)<td>4
+ * <tr><td>uint16_t<td>1
+ * <tr><td>uint16_t<td>3
+ * <tr><td>uint16_t<td>4
  * <tr><td>float<td>1
  * <tr><td>float<td>3
  * <tr><td>float<td>4
  * </table>
+ * @remark In-place filtering is supported: outData may equal inData when outWidthStride equals inWidthStride.
+ *         The image is then blurred in bands of rows and only O(kernel_len) rows of scratch memory are used.
  * <table>
  * <caption align="left">Requirements</caption>
  * <tr><td>X86 platforms supported<td> All 
@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_HOUGH_H_
+#define __ST_HPC_PPL_CV_X86_HOUGH_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+#include <vector>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/** A line in polar form, `x * cos(theta) + y * sin(theta) = rho` */
+struct HoughLine {
+    float rho;
+    float theta;
+};
+
+/** A line segment from (x1, y1) to (x2, y2) */
+struct HoughSegment {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+};
+
+/** A circle centered at (x, y) */
+struct HoughCircle {
+    float x;
+    float y;
+    float radius;
+};
+
+/**
+* @brief Finds lines in a binary image using the standard Hough transform.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            input 8-bit single-channel binary image, such as the edge map of an image
+* @param lines             detected lines, sorted by the number of votes in descending order
+* @param rho               distance resolution of the accumulator in pixels
+* @param theta             angle resolution of the accumulator in radians
+* @param threshold         only lines that get more than `threshold` votes are returned
+* @param minTheta          minimum angle to check for lines, between 0 and maxTheta
+* @param maxTheta          maximum angle to check for lines, between minTheta and CV_PI
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The accumulator is split by angle among threads, so no merging is needed.
+*         The following table show which data type is supported.
+* <table>
+* <tr><th>Data type
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/hough.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/hough.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     std::vector<ppl::cv::x86::HoughLine> lines;
+*
+*     ppl::cv::x86::HoughLines(H, W, W, dev_iImage, lines, 1.f, 3.1415926f / 180, 150);
+*
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode HoughLines(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    std::vector<HoughLine>& lines,
+    float rho,
+    float theta,
+    int32_t threshold,
+    double minTheta = 0,
+    double maxTheta = 3.1415926535897932384626433832795);
+
+/**
+* @brief Finds line segments in a binary image using the progressive probabilistic Hough transform.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            input 8-bit single-channel binary image, such as the edge map of an image
+* @param lines             detected line segments
+* @param rho               distance resolution of the accumulator in pixels
+* @param theta             angle resolution of the accumulator in radians
+* @param threshold         only lines that get more than `threshold` votes are returned
+* @param minLineLength     line segments shorter than that are rejected
+* @param maxLineGap        maximum allowed gap between points on the same line to link them
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Points are visited in the same pseudo random order as OpenCV, so the result is reproducible.
+*         The following table show which data type is supported.
+* <table>
+* <tr><th>Data type
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/hough.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/hough.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     std::vector<ppl::cv::x86::HoughSegment> segments;
+*
+*     ppl::cv::x86::HoughLinesP(H, W, W, dev_iImage, segments, 1.f, 3.1415926f / 180, 50, 50, 10);
+*
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode HoughLinesP(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    std::vector<HoughSegment>& lines,
+    float rho,
+    float theta,
+    int32_t threshold,
+    double minLineLength = 0,
+    double maxLineGap = 0);
+
+/**
+* @brief Finds circles in a grayscale image using the Hough gradient method.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            input 8-bit single-channel grayscale image
+* @param circles           detected circles, sorted by the number of votes of their centers in descending order
+* @param dp                inverse ratio of the accumulator resolution to the image resolution
+* @param minDist           minimum distance between the centers of the detected circles
+* @param param1            higher threshold of the edge detector, the lower one is twice smaller
+* @param param2            accumulator threshold for the circle centers
+* @param minRadius         minimum circle radius
+* @param maxRadius         maximum circle radius, if <= 0, the maximum image dimension is used
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The Sobel gradients are taken with replicated borders as in OpenCV. Edge pixels only vote along
+*         their gradient direction, and votes are accumulated into per-thread accumulators which are merged
+*         afterwards.
+*         The following table show which data type is supported.
+* <table>
+* <tr><th>Data type
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/hough.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/hough.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     std::vector<ppl::cv::x86::HoughCircle> circles;
+*
+*     ppl::cv::x86::HoughCircles(H, W, W, dev_iImage, circles, 1.0, H / 8.0, 100, 30, 5, 100);
+*
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode HoughCircles(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    std::vector<HoughCircle>& circles,
+    double dp,
+    double minDist,
+    double param1 = 100,
+    double param2 = 100,
+    int32_t minRadius = 0,
+    int32_t maxRadius = 0);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_HOUGH_H_
@@ -0,0 +1,246 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_IMAGEQUALITY_H_
+#define __ST_HPC_PPL_CV_X86_IMAGEQUALITY_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+enum SSIMWindowType {
+    SSIM_WINDOW_GAUSSIAN = 0,
+    SSIM_WINDOW_BOX      = 1,
+};
+
+/** Parameters of SSIM and MS-SSIM, the defaults are the ones of Wang et al. */
+struct SSIMParams {
+    SSIMWindowType windowType; //!< weighting of the local statistics window
+    int32_t windowSize;        //!< side of the square window, odd
+    float sigma;               //!< standard deviation of the gaussian window
+    float K1;                  //!< luminance stabilizer, C1 = (K1 * dynamicRange)^2
+    float K2;                  //!< contrast stabilizer, C2 = (K2 * dynamicRange)^2
+    float dynamicRange;        //!< range of the pixel values, 255 for 8-bit images and usually 1 for float images
+
+    SSIMParams()
+        : windowType(SSIM_WINDOW_GAUSSIAN)
+        , windowSize(11)
+        , sigma(1.5f)
+        , K1(0.01f)
+        , K2(0.03f)
+        , dynamicRange(255.f) {}
+};
+
+/**
+* @brief Computes the peak signal-to-noise ratio between two images, 20 * log10(maxValue / RMSE) over all channels.
+* @tparam T The data type of input images, currently only uint8_t and float are supported.
+* @tparam channels The number of channels of input images, 1, 3 and 4 are supported.
+* @param height            input images' height
+* @param width             input images' width need to be processed
+* @param inWidthStride0    first image's width stride, usually it equals to `width * channels`
+* @param inData0           first input image
+* @param inWidthStride1    second image's width stride, usually it equals to `width * channels`
+* @param inData1           second input image
+* @param psnr              the resulting PSNR in dB, like OpenCV it is finite for identical images
+* @param maxValue          the peak value of the pixels
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The squared differences are summed per row and the row sums are reduced in row order.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/imagequality.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/imagequality.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage0 = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_iImage1 = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     double psnr;
+*
+*     ppl::cv::x86::PSNR<uint8_t, 3>(H, W, W * C, dev_iImage0, W * C, dev_iImage1, &psnr);
+*
+*     free(dev_iImage0);
+*     free(dev_iImage1);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode PSNR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const T* inData0,
+    int32_t inWidthStride1,
+    const T* inData1,
+    double* psnr,
+    double maxValue = 255.0);
+
+/**
+* @brief Computes the mean structural similarity index of two images, per channel.
+* @tparam T The data type of input images, currently only uint8_t and float are supported.
+* @tparam channels The number of channels of input images, 1, 3 and 4 are supported.
+* @param height            input images' height, at least params.windowSize
+* @param width             input images' width need to be processed, at least params.windowSize
+* @param inWidthStride0    first image's width stride, usually it equals to `width * channels`
+* @param inData0           first input image
+* @param inWidthStride1    second image's width stride, usually it equals to `width * channels`
+* @param inData1           second input image
+* @param ssim              the mean SSIM of every channel, `channels` values
+* @param params            window and stabilizing constants
+* @param mapWidthStride    the width stride of the SSIM map in elements
+* @param mapData           optional SSIM map of (height - windowSize + 1) x (width - windowSize + 1) pixels with
+*                          `channels` floats each, NULL if it is not needed
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Like the reference implementation, only the windows which lie entirely inside the images are used.
+*         The five window statistics (both means, both variances and the covariance) are gathered in one
+*         separable pass: every output row sums the window rows vertically, then horizontally, and the
+*         index is reduced on the fly, so no statistics map is stored. Output rows are processed in parallel.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/imagequality.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/imagequality.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     float* dev_iImage0 = (float*)malloc(W * H * sizeof(float));
+*     float* dev_iImage1 = (float*)malloc(W * H * sizeof(float));
+*     double ssim;
+*
+*     ppl::cv::x86::SSIMParams params;
+*     params.dynamicRange = 1.f;
+*     ppl::cv::x86::SSIM<float, 1>(H, W, W, dev_iImage0, W, dev_iImage1, &ssim, params);
+*
+*     free(dev_iImage0);
+*     free(dev_iImage1);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode SSIM(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const T* inData0,
+    int32_t inWidthStride1,
+    const T* inData1,
+    double* ssim,
+    const SSIMParams& params = SSIMParams(),
+    int32_t mapWidthStride   = 0,
+    float* mapData           = NULL);
+
+/**
+* @brief Computes the multi-scale structural similarity index of two images, per channel.
+* @tparam T The data type of input images, currently only uint8_t and float are supported.
+* @tparam channels The number of channels of input images, 1, 3 and 4 are supported.
+* @param height            input images' height, at least params.windowSize * 2^(scales - 1)
+* @param width             input images' width need to be processed, at least params.windowSize * 2^(scales - 1)
+* @param inWidthStride0    first image's width stride, usually it equals to `width * channels`
+* @param inData0           first input image
+* @param inWidthStride1    second image's width stride, usually it equals to `width * channels`
+* @param inData1           second input image
+* @param msssim            the MS-SSIM of every channel, `channels` values
+* @param params            window and stabilizing constants, the same at every scale
+* @param scales            number of scales in [1, 5], the weights of Wang et al. are renormalized when it is less
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The contrast-structure term is taken at every scale and the luminance term at the coarsest one,
+*         each scale is half the size of the previous one by 2x2 averaging (an odd last row or column is dropped).
+*         Negative contrast-structure terms are clamped to 0 before the weighted product.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/imagequality.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/imagequality.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage0 = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_iImage1 = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     double msssim;
+*
+*     ppl::cv::x86::MSSSIM<uint8_t, 1>(H, W, W, dev_iImage0, W, dev_iImage1, &msssim);
+*
+*     free(dev_iImage0);
+*     free(dev_iImage1);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode MSSSIM(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const T* inData0,
+    int32_t inWidthStride1,
+    const T* inData1,
+    double* msssim,
+    const SSIMParams& params = SSIMParams(),
+    int32_t scales           = 5);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_IMAGEQUALITY_H_
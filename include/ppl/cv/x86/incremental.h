@@ -0,0 +1,189 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_INCREMENTAL_H_
+#define __ST_HPC_PPL_CV_X86_INCREMENTAL_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/opgraph.h"
+#include "ppl/common/retcode.h"
+#include <vector>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Finds the blocks of an image which differ between two frames.
+* @tparam T The data type of input image, currently only \a uint8_t and \a float are supported.
+* @tparam nc The number of channels of input image, 1, 3 and 4 are supported.
+* @param height            input images' height
+* @param width             input images' width need to be processed
+* @param prevWidthStride   previous frame's width stride, in elements
+* @param prevData          previous frame data
+* @param curWidthStride    current frame's width stride, in elements
+* @param curData           current frame data
+* @param blockSize         side of the compared blocks, the last blocks of a row or a column can be smaller
+* @param dirtyRects        receives the rectangles of pixels which hold every changed block, it is cleared first
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The blocks are compared bitwise, 16 bytes at a time, and the comparison of a block stops at its first
+*         difference. The changed blocks of a block row are merged into runs, and the runs which continue the
+*         same run of the block row above are merged into one rectangle, so a changed area gives a few large
+*         rectangles rather than one per block. The rectangles do not overlap.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/incremental.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/incremental.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage0 = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_iImage1 = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*
+*     std::vector<ppl::cv::x86::OpRect> dirty;
+*     ppl::cv::x86::DiffBlocks<uint8_t, 3>(H, W, W * C, dev_iImage0, W * C, dev_iImage1, 16, &dirty);
+*
+*     free(dev_iImage0);
+*     free(dev_iImage1);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t nc>
+::ppl::common::RetCode DiffBlocks(
+    int32_t height,
+    int32_t width,
+    int32_t prevWidthStride,
+    const T* prevData,
+    int32_t curWidthStride,
+    const T* curData,
+    int32_t blockSize,
+    std::vector<OpRect>* dirtyRects);
+
+/** Parameters of IncrementalGraph */
+struct IncrementalGraphParams {
+    int32_t blockSize;   //!< side of the input blocks compared by Update() without dirty rectangles
+    int32_t cellSize;    //!< side of the output cells, a cell is recomputed whole when one of its pixels is affected
+    int32_t maxTileSize; //!< affected cells are grouped into tiles of at most maxTileSize x maxTileSize pixels
+
+    IncrementalGraphParams()
+        : blockSize(16)
+        , cellSize(32)
+        , maxTileSize(256) {}
+};
+
+struct IncrementalGraphState;
+
+/**
+* @brief Keeps the output of an op graph up to date with a video stream, only the output regions which depend
+* on changed input pixels are recomputed.
+* @remark Reset() runs the whole graph on a frame into an output buffer owned by the object, and keeps a copy of
+*         the frame, the first Update() does the same. Update() with dirty rectangles recomputes the output
+*         pixels which depend on them, Update() without them first finds the changed blocks with DiffBlocks
+*         against the kept frame. The rectangles are mapped forward through the operations: filters grow them
+*         by their radius, NV122BGR aligns them to 2x2 blocks, and resizes and warps map their corners with the
+*         inverse matrix, with one more input pixel for the interpolation and one more output pixel for the
+*         rounding. Where a warp with BORDER_TYPE_REPLICATE samples outside of the image, its output depends on
+*         the edge pixels, so a rectangle on an edge also reaches that part.
+*         The affected output pixels are rounded up to cells of cellSize x cellSize, the cells are grouped into
+*         tiles which the tile executor of the graph recomputes in parallel into the kept output, the other
+*         output pixels keep the values of the previous frames.
+*         With static cameras most of a frame is unchanged, so the cost of a frame follows the moving area plus
+*         the halos rather than the frame size. Filters give the same results as Execute() of the graph on the
+*         whole frame, resizes and warps can differ by 1 each for uint8_t like between two tilings.
+*         For graphs which start with NV122BGR the frame has the height x width Y plane followed by the UV plane
+*         with the same stride, DiffBlocks compares both planes and dirty rectangles are given in Y plane
+*         coordinates, their chroma is taken into account.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/incremental.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/incremental.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 1920;
+*     const int32_t H = 1080;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*
+*     ppl::cv::x86::OpGraph graph(H, W, C, ppl::cv::x86::OP_DATA_UINT8);
+*     graph.AddGaussianBlur(5, 1.2f);
+*     graph.AddResizeLinear(H / 2, W / 2);
+*     graph.AddBGR2GRAY();
+*
+*     ppl::cv::x86::IncrementalGraph incremental(graph);
+*     incremental.Reset(W * C, dev_iImage);
+*     for (int32_t frame = 0; frame < 100; ++frame) {
+*         // ... the camera writes the next frame into dev_iImage
+*         incremental.Update(W * C, dev_iImage);
+*         const uint8_t* gray = (const uint8_t*)incremental.OutputData();
+*     }
+*
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+class IncrementalGraph {
+public:
+    explicit IncrementalGraph(const OpGraph& graph, const IncrementalGraphParams& params = IncrementalGraphParams());
+    ~IncrementalGraph();
+
+    /** runs the whole graph on a frame, inWidthStride in elements of the input data type */
+    ::ppl::common::RetCode Reset(int32_t inWidthStride, const void* inData);
+    /** recomputes the output of the blocks of a frame which differ from the previous one */
+    ::ppl::common::RetCode Update(int32_t inWidthStride, const void* inData);
+    /** recomputes the output of the given input rectangles of a frame, the other pixels must be unchanged */
+    ::ppl::common::RetCode Update(int32_t inWidthStride, const void* inData, const OpRect* dirtyRects, int32_t numRects);
+
+    /** output of the last frame, OutputWidthStride() in elements of the output data type */
+    const void* OutputData() const;
+    int32_t OutputWidthStride() const;
+    /** output rectangles recomputed by the last call, they do not overlap */
+    const std::vector<OpRect>& UpdatedRects() const;
+
+private:
+    IncrementalGraph(const IncrementalGraph&);
+    IncrementalGraph& operator=(const IncrementalGraph&);
+
+    OpGraph graph_;
+    IncrementalGraphParams params_;
+    IncrementalGraphState* state_;
+};
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_INCREMENTAL_H_
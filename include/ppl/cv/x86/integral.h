@@ -41,7 +41,9 @@ namespace x86 {
  * @note 1 There are 2 implementation, in version 1 the input&output have the 
  *         same size; in version 2 outHeight = inHeight + 1 && outWidth = 
  *         inWidth + 1. Version 2 is compatible with integral() in OpenCV 4.1.
- * @remark The fllowing table show which data type and channels are supported.
+ * @remark Rows and then column strips are summed in parallel, every output adds the same terms in the same
+ *         order for any number of threads, so float results are bit-exact across thread counts.
+ *         The fllowing table show which data type and channels are supported.
  * <table>
  * <tr><th>TSrc type<th>TDst type<th>channels
  * <tr><td>float<td>float<td>1
@@ -88,6 +88,48 @@ template <typename T, int32_t nc>
     double delta           = 0.0,
     BorderType border_type = BORDER_TYPE_DEFAULT);
 
+
+/**
+ * @brief Calculates the Laplacian of an 8-bit image into signed 16-bit output, which keeps the sign
+ *        that the saturated uint8_t result loses at half the bandwidth of float.
+ * @tparam Tsrc The data type of input image, currently only \a uint8_t is supported.
+ * @tparam Tdst The data type of output image, currently only \a int16_t is supported.
+ * @tparam nc The number of channels of input image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @param ksize             the length of kernel, 1, 3, 5 and 7 are supported.
+ * @param scale             optional scale factor for the computed derivative values; by default, no scaling is applied.
+ * @param delta             optional delta value that is added to the results prior to storing them in dst.
+ * @param border_type       ways to deal with border. Only BORDER_TYPE_REFLECT_101 or BORDER_TYPE_DEFAULT are supported now.
+ * @remark The fllowing table show which data type and channels are supported.
+ * <table>
+ * <tr><th>Data type(Tsrc)<th>Data type(Tdst)<th>channels
+ * <tr><td>uint8_t(uchar)<td>int16_t<td>1
+ * <tr><td>uint8_t(uchar)<td>int16_t<td>3
+ * <tr><td>uint8_t(uchar)<td>int16_t<td>4
+ * </table>
+ * ###Example
+ * @code{.cpp}
+ * ppl::cv::x86::Laplacian<uint8_t, int16_t, 3>(H, W, W * C, src, W * C, dst, 3);
+ * @endcode
+ ***************************************************************************************************/
+template <typename Tsrc, typename Tdst, int32_t nc>
+::ppl::common::RetCode Laplacian(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const Tsrc *inData,
+    int32_t outWidthStride,
+    Tdst *outData,
+    int32_t ksize,
+    double scale           = 1.0,
+    double delta           = 0.0,
+    BorderType border_type = BORDER_TYPE_DEFAULT);
+
 }
 }
 } // namespace ppl::cv::x86
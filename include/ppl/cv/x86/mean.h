@@ -20,6 +20,7 @@
 
 #include "ppl/common/retcode.h"
 #include "ppl/cv/types.h"
+#include "ppl/cv/x86/reduction.h"
 
 namespace ppl {
 namespace cv {
@@ -36,8 +37,10 @@ namespace x86 {
 * @param outMeanData       output mean data, its size depends on channel wise, 1 or channel
 * @param inMaskStride      width stride of mask, usually equals to width
 * @param inMask            mask to determine whether to include this pixel for computation, if NULL, all pixels will be included
+* @param mode              how the parallel sums are split and combined, see ReductionMode
 * @warning All input parameters must be valid, or undefined behaviour may occur.
-* @remark The fllowing table show which data type and channels are supported.
+* @remark Rows are summed in parallel, float sums are bit-exact across thread counts in REDUCTION_MODE_REPRODUCIBLE.
+*         The fllowing table show which data type and channels are supported.
 * <table>
  * <tr><th>Data type(T)<th>channels
  * <tr><td>uint8_t(uchar)<td>1
@@ -78,7 +81,8 @@ template <typename T, int32_t c>
     const T* inData,
     float* outMeanData,
     int32_t inMaskStride = 0,
-    uint8_t* inMask = NULL);
+    uint8_t* inMask = NULL,
+    ReductionMode mode = REDUCTION_MODE_DEFAULT);
 
 }
 }
@@ -20,6 +20,7 @@
 
 #include "ppl/common/retcode.h"
 #include "ppl/cv/types.h"
+#include "ppl/cv/x86/reduction.h"
 
 namespace ppl {
 namespace cv {
@@ -37,8 +38,11 @@ namespace x86 {
  * @param stddev            output parameter: calculateded standard deviation of each channel
  * @param maskStride        input mask's width stride,  usually it equals to `width`
  * @param mask              input mask data
+ * @param mode              how the parallel sums are split and combined, see ReductionMode
  * @warning All input parameters must be valid, or undefined behaviour may occur.
- * @remark The fllowing table show which data type and channels are supported.
+ * @remark Rows are summed in parallel in double precision, float results are bit-exact across thread counts in
+ *         REDUCTION_MODE_REPRODUCIBLE.
+ *         The fllowing table show which data type and channels are supported.
  * <table>
  * <tr><th>Data type(T)<th>channels
  * <tr><td>uint8_t(uchar)<td>1
@@ -82,7 +86,8 @@ template <typename T, int32_t c>
     float* mean,
     float* stddev,
     int32_t maskStride     = 0,
-    const uint8_t* ptrMask = nullptr);
+    const uint8_t* ptrMask = nullptr,
+    ReductionMode mode     = REDUCTION_MODE_DEFAULT);
 
 }
 }
@@ -27,7 +27,7 @@ namespace x86 {
 
 /**
  * @brief Denoise or obscure an image with medianblur alogrithm.
- * @tparam T The data type of input image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type of input image, currently only \a uint8_t, \a uint16_t and \a float are supported.
  * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
  * @param height            input image's height
  * @param width             input image's width need to be processed
@@ -44,10 +44,15 @@ namespace x86 {
  * <tr><td>uint8_t(uchar)<td>1
  * <tr><td>uint8_t(uchar)<td>3
  * <tr><td>uint8_t(uchar)<td>4
+ * <tr><td>uint16_t<td>1
+ * <tr><td>uint16_t<td>3
+ * <tr><td>uint16_t<td>4
  * <tr><td>float<td>1
  * <tr><td>float<td>3
  * <tr><td>float<td>4
  * </table>
+ * @remark In-place filtering is supported: outData may equal inData when outWidthStride equals inWidthStride.
+ *         The image is then filtered in bands of rows and only O(ksize) rows of scratch memory are used.
  * <table>
  * <caption align="left">Requirements</caption>
  * <tr><td>x86 platforms supported<td> All
@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_MULTIOUTPUT_H_
+#define __ST_HPC_PPL_CV_X86_MULTIOUTPUT_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief The outputs of BGR2Multi and NV122Multi, an output whose pointer is NULL is not computed.
+*/
+struct MultiColorOutputs {
+    uint8_t* gray;              //!< full resolution GRAY, as BGR2GRAY
+    int32_t grayWidthStride;    //!< row stride of gray
+    uint8_t* y;                 //!< full resolution Y plane, as the luma plane of BGR2NV12
+    int32_t yWidthStride;       //!< row stride of y
+    uint8_t* resized;           //!< BGR resized to resizedHeight x resizedWidth, as ResizeLinear<uint8_t, 3>
+    int32_t resizedHeight;      //!< height of resized
+    int32_t resizedWidth;       //!< width of resized
+    int32_t resizedWidthStride; //!< row stride of resized, at least `resizedWidth * 3`
+    int32_t* hist;              //!< 256 bins of the GRAY values, as CalcHist
+
+    MultiColorOutputs()
+        : gray(NULL)
+        , grayWidthStride(0)
+        , y(NULL)
+        , yWidthStride(0)
+        , resized(NULL)
+        , resizedHeight(0)
+        , resizedWidth(0)
+        , resizedWidthStride(0)
+        , hist(NULL) {}
+};
+
+/**
+* @brief Computes any subset of full resolution GRAY, Y plane, histogram and a bilinear resized copy of a BGR
+*        image in one pass over the input.
+* @tparam T The data type of input and output image, currently only uint8_t is supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * 3`
+* @param inData            input image data
+* @param outputs           the requested outputs, at least one of them
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The resized rows are cut into bands which run in parallel. A band converts the input rows it owns to
+*         GRAY and Y, counts the histogram and resizes a few output rows at a time, so every input row is read
+*         from memory once and reused from the cache by the resize. Every output is identical to the one of the
+*         single-output function named in MultiColorOutputs, the histogram is the one of the GRAY values.
+* <table>
+* <tr><th>Data type(T)
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/multioutput.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/multioutput.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 1920;
+*     const int32_t H = 1080;
+*     std::vector<uint8_t> src(H * W * 3), gray(H * W), small(384 * 640 * 3);
+*     ppl::cv::x86::MultiColorOutputs outputs;
+*     outputs.gray               = gray.data();
+*     outputs.grayWidthStride    = W;
+*     outputs.resized            = small.data();
+*     outputs.resizedHeight      = 384;
+*     outputs.resizedWidth       = 640;
+*     outputs.resizedWidthStride = 640 * 3;
+*     ppl::cv::x86::BGR2Multi<uint8_t>(H, W, W * 3, src.data(), outputs);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGR2Multi(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    const MultiColorOutputs& outputs);
+
+/**
+* @brief Computes any subset of full resolution GRAY, Y plane, histogram and a bilinear resized BGR copy of an
+*        NV12 image in one pass over the input.
+* @tparam T The data type of input and output image, currently only uint8_t is supported.
+* @param height            input image's height, must be even
+* @param width             input image's width, must be even
+* @param inYStride         row stride of the luma plane
+* @param inY               luma plane
+* @param inUVStride        row stride of the interleaved chroma plane
+* @param inUV              interleaved chroma plane
+* @param outputs           the requested outputs, at least one of them
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark GRAY and Y are copies of the luma plane and the histogram is the one of the luma plane. The resized
+*         output converts only the rows a band needs, as NV122BGR, into a small buffer of every thread and
+*         resizes them while they are in the cache, so the full resolution BGR image is never written.
+* <table>
+* <tr><th>Data type(T)
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/multioutput.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/multioutput.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 1920;
+*     const int32_t H = 1080;
+*     std::vector<uint8_t> src(H * W * 3 / 2), small(384 * 640 * 3);
+*     int32_t hist[256];
+*     ppl::cv::x86::MultiColorOutputs outputs;
+*     outputs.resized            = small.data();
+*     outputs.resizedHeight      = 384;
+*     outputs.resizedWidth       = 640;
+*     outputs.resizedWidthStride = 640 * 3;
+*     outputs.hist               = hist;
+*     ppl::cv::x86::NV122Multi<uint8_t>(H, W, W, src.data(), W, src.data() + H * W, outputs);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode NV122Multi(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const T* inY,
+    int32_t inUVStride,
+    const T* inUV,
+    const MultiColorOutputs& outputs);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_MULTIOUTPUT_H_
@@ -18,6 +18,7 @@
 #ifndef __ST_HPC_PPL_CV_X86_NORM_H_
 #define __ST_HPC_PPL_CV_X86_NORM_H_
 #include "ppl/cv/types.h"
+#include "ppl/cv/x86/reduction.h"
 #include "ppl/common/retcode.h"
 
 namespace ppl {
@@ -26,7 +27,8 @@ namespace x86 {
 
 /**
  * @brief Calculates the absolute norm of an image.
- * @tparam T The data type, used for input image, currently only uchar and float are supported.
+ * @tparam T The data type, used for input image, currently uchar, int16_t and float are supported. int16_t
+ *           sums are exact.
  * @tparam c The number of channels of input image, 1, 3 and 4 is supported for now.
  * @param inHeight      input image's height.
  * @param inWidth       input image's width need to be processed.
@@ -37,9 +39,11 @@ namespace x86 {
  * @param maskStride    the width stride of input image in bytes, similar to inStride.
  * @param mask          optional operation mask; it must have the same size as 
  *                        inData and CV_8UC1 type.
+ * @param mode          how the parallel sums are split and combined, see ReductionMode.
  * @return the absolute norm of an image in double type.
  * @note Multi-channel input arrays are treated as single-channel arrays, that 
- *       is, the results for all channels are combined. 
+ *       is, the results for all channels are combined. Rows are summed in parallel, float sums are
+ *       bit-exact across thread counts in REDUCTION_MODE_REPRODUCIBLE.
  * * <table>
  * <tr><th>Data type(T)<th>channels
  * <tr><td>float<td>1
@@ -48,6 +52,9 @@ namespace x86 {
  * <tr><td>uchar<td>1
  * <tr><td>uchar<td>3
  * <tr><td>uchar<td>4
+ * <tr><td>int16_t<td>1
+ * <tr><td>int16_t<td>3
+ * <tr><td>int16_t<td>4
  * </table>
  * * <table>
  * <caption align="left">Requirements</caption>
@@ -78,7 +85,8 @@ double Norm(int inHeight,
             const T* inData,
             NormTypes normType = NORM_L2,
             int maskStride     = 0,
-            const uchar* mask  = NULL);
+            const uchar* mask  = NULL,
+            ReductionMode mode = REDUCTION_MODE_DEFAULT);
 
 }
 }
@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_OPGRAPH_H_
+#define __ST_HPC_PPL_CV_X86_OPGRAPH_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+#include <vector>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+enum OpDataType {
+    OP_DATA_UINT8   = 0,
+    OP_DATA_FLOAT32 = 1,
+    OP_DATA_INT16   = 2,
+};
+
+enum OpType {
+    OP_GAUSSIAN_BLUR       = 0,
+    OP_BOX_FILTER          = 1,
+    OP_RESIZE_LINEAR       = 2,
+    OP_WARP_AFFINE_LINEAR  = 3,
+    OP_BGR2GRAY            = 4,
+    OP_GRAY2BGR            = 5,
+    OP_SOBEL               = 6,
+    OP_THRESHOLD           = 7,
+    OP_NV122BGR            = 8,
+    OP_CONVERT_TO          = 9,
+};
+
+/** A rectangle of pixels */
+struct OpRect {
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+};
+
+/** One recorded operation, its input is the output of the previous one */
+struct OpNode {
+    OpType type;
+    int32_t inHeight;
+    int32_t inWidth;
+    int32_t inChannels;
+    OpDataType inType;
+    int32_t outHeight;
+    int32_t outWidth;
+    int32_t outChannels;
+    OpDataType outType;
+    int32_t kernelSize;  //!< filters and sobel
+    float sigma;         //!< gaussian blur
+    double affine[6];    //!< resize and warps, maps output coordinates to input coordinates
+    int32_t dx;          //!< sobel
+    int32_t dy;          //!< sobel
+    double scale;        //!< sobel and convertto
+    double delta;        //!< sobel
+    float threshold;     //!< threshold
+    float maxValue;      //!< threshold
+    BorderType border;
+    float borderValue;
+};
+
+/**
+* @brief A chain of operations which can be executed on any rectangle of its output, the input rectangle each
+* operation needs is derived from its kernel radius or from its coordinate mapping.
+* @remark Only operations whose value at an output pixel depends on a bounded input window are recorded, and
+*         every operation is computed by the existing ppl.cv x86 function: filters run on the needed input
+*         rectangle with their halo, so that their results do not depend on the tiling, resizes and warps run
+*         with their matrix translated to the tile, which can change the coordinates by float rounding.
+*         ResizeLinear is recorded as the equivalent affine warp with BORDER_TYPE_REPLICATE, downscale tiles
+*         whose ends fall on input pixels are resized directly.
+*         Execute() cuts the output into tiles whose intermediate images fit in the L2 cache and runs the
+*         whole chain on one tile before the next one, so that intermediate images never go to memory.
+*         Each thread owns two scratch buffers: every intermediate image is dead as soon as the next operation
+*         has read it, so consecutive operations alternate between them, and the last operation writes into
+*         the output directly when it produces exactly the tile.
+*         The following table show which data type is supported by each operation.
+* <table>
+* <tr><th>Operation<th>Input data type<th>Output data type
+* <tr><td>GaussianBlur, BoxFilter, ResizeLinear, WarpAffineLinear, BGR2GRAY, GRAY2BGR<td>uint8_t, float<td>same
+* <tr><td>Sobel<td>uint8_t<td>int16_t
+* <tr><td>Sobel<td>float<td>float
+* <tr><td>Threshold<td>uint8_t, int16_t, float<td>same
+* <tr><td>NV122BGR<td>uint8_t<td>uint8_t
+* <tr><td>ConvertTo<td>uint8_t, float<td>float, uint8_t
+* <tr><td>ConvertTo<td>int16_t<td>uint8_t, float
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/opgraph.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/opgraph.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 1920;
+*     const int32_t H = 1080;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * 3 / 2 * sizeof(uint8_t));
+*     float* dev_oImage = (float*)malloc(W / 2 * H / 2 * 3 * sizeof(float));
+*
+*     ppl::cv::x86::OpGraph graph(H, W, 1, ppl::cv::x86::OP_DATA_UINT8);
+*     graph.AddNV122BGR();
+*     graph.AddResizeLinear(H / 2, W / 2);
+*     graph.AddConvertTo(ppl::cv::x86::OP_DATA_FLOAT32, 1.f / 255);
+*     graph.Execute(W, dev_iImage, W / 2 * 3, dev_oImage);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+class OpGraph {
+public:
+    /**
+    * @param height            height of the input image
+    * @param width             width of the input image
+    * @param channels          channels of the input image, 1, 3 or 4
+    * @param type              data type of the input image, OP_DATA_UINT8 or OP_DATA_FLOAT32
+    */
+    OpGraph(int32_t height, int32_t width, int32_t channels, OpDataType type);
+
+    /** GaussianBlur with a square kernel, odd kernelSize */
+    ::ppl::common::RetCode AddGaussianBlur(int32_t kernelSize, float sigma, BorderType border = BORDER_TYPE_DEFAULT);
+    /** normalized BoxFilter with a square kernel, odd kernelSize */
+    ::ppl::common::RetCode AddBoxFilter(int32_t kernelSize, BorderType border = BORDER_TYPE_DEFAULT);
+    /** ResizeLinear to outHeight x outWidth */
+    ::ppl::common::RetCode AddResizeLinear(int32_t outHeight, int32_t outWidth);
+    /** WarpAffineLinear, affineMatrix maps output coordinates to input coordinates like WarpAffineLinear's,
+     *  BORDER_TYPE_CONSTANT and BORDER_TYPE_REPLICATE are supported */
+    ::ppl::common::RetCode AddWarpAffineLinear(
+        int32_t outHeight,
+        int32_t outWidth,
+        const double* affineMatrix,
+        BorderType border = BORDER_TYPE_CONSTANT,
+        float borderValue = 0.f);
+    /** BGR2GRAY, the current image must have 3 channels */
+    ::ppl::common::RetCode AddBGR2GRAY();
+    /** GRAY2BGR, the current image must have 1 channel */
+    ::ppl::common::RetCode AddGRAY2BGR();
+    /** Sobel with the parameters of Sobel, uint8_t images become int16_t */
+    ::ppl::common::RetCode AddSobel(
+        int32_t dx,
+        int32_t dy,
+        int32_t ksize = 3,
+        double scale = 1.0,
+        double delta = 0.0,
+        BorderType border = BORDER_TYPE_DEFAULT);
+    /** binary threshold: maxValue where the value is greater than threshold, 0 elsewhere */
+    ::ppl::common::RetCode AddThreshold(float threshold, float maxValue);
+    /** NV122BGR, only as the first operation of an uint8_t graph with 1 channel and an even size. The UV plane
+     *  follows the Y plane in the input buffer, with the same stride */
+    ::ppl::common::RetCode AddNV122BGR();
+    /** ConvertTo the given data type, the values are multiplied by scale */
+    ::ppl::common::RetCode AddConvertTo(OpDataType type, float scale = 1.f);
+
+    /**
+    * @brief Runs the graph on a whole image in memory, tile by tile.
+    * @param inWidthStride     input image's width stride, in elements of the input data type
+    * @param inData            input image data
+    * @param outWidthStride    output image's width stride, in elements of the output data type
+    * @param outData           output image data, must not overlap the input
+    * @param tileSize          side of the output tiles, 0 picks the largest tiles whose intermediate images
+    *                          fit in the L2 cache
+    * @return RC_OUT_OF_MEMORY when the per-thread scratch area of the tiles cannot be allocated.
+    */
+    ::ppl::common::RetCode Execute(
+        int32_t inWidthStride,
+        const void* inData,
+        int32_t outWidthStride,
+        void* outData,
+        int32_t tileSize = 0) const;
+
+    int32_t InputHeight() const { return height_; }
+    int32_t InputWidth() const { return width_; }
+    int32_t InputChannels() const { return channels_; }
+    OpDataType InputDataType() const { return type_; }
+    int32_t OutputHeight() const { return nodes_.empty() ? height_ : nodes_.back().outHeight; }
+    int32_t OutputWidth() const { return nodes_.empty() ? width_ : nodes_.back().outWidth; }
+    int32_t OutputChannels() const { return nodes_.empty() ? channels_ : nodes_.back().outChannels; }
+    OpDataType OutputDataType() const { return nodes_.empty() ? type_ : nodes_.back().outType; }
+    const std::vector<OpNode>& Nodes() const { return nodes_; }
+
+private:
+    OpNode NextNode(OpType type) const;
+
+    int32_t height_;
+    int32_t width_;
+    int32_t channels_;
+    OpDataType type_;
+    std::vector<OpNode> nodes_;
+};
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_OPGRAPH_H_
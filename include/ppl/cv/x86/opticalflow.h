@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_OPTICALFLOW_H_
+#define __ST_HPC_PPL_CV_X86_OPTICALFLOW_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/** Parameters of DISOpticalFlow, the defaults are close to OpenCV's MEDIUM preset */
+struct DISOpticalFlowParams {
+    int32_t finestScale;                     //!< finest pyramid level the flow is searched on, upsampled from there
+    int32_t patchSize;                       //!< side of the square patches, a multiple of 4 in [4, 32]
+    int32_t patchStride;                     //!< distance between neighbouring patches, in [1, patchSize]
+    int32_t gradientDescentIterations;       //!< inverse search iterations of each patch
+    int32_t variationalRefinementIterations; //!< fixed point iterations of the refinement, 0 disables it
+    float variationalRefinementAlpha;        //!< weight of the smoothness term
+    float variationalRefinementDelta;        //!< weight of the color constancy term
+    float variationalRefinementGamma;        //!< weight of the gradient constancy term
+    bool useMeanNormalization;               //!< compare patches after subtracting their means
+    bool useSpatialPropagation;              //!< start patches from the better of their neighbours' flow
+
+    DISOpticalFlowParams()
+        : finestScale(1)
+        , patchSize(8)
+        , patchStride(4)
+        , gradientDescentIterations(16)
+        , variationalRefinementIterations(5)
+        , variationalRefinementAlpha(20.f)
+        , variationalRefinementDelta(5.f)
+        , variationalRefinementGamma(10.f)
+        , useMeanNormalization(true)
+        , useSpatialPropagation(true) {}
+};
+
+/**
+* @brief Computes dense optical flow with DIS (dense inverse search).
+* @param height            input images' height
+* @param width             input images' width
+* @param prevWidthStride   first image's width stride, usually it equals to `width`
+* @param prevData          first 8-bit single-channel image
+* @param nextWidthStride   second image's width stride, usually it equals to `width`
+* @param nextData          second 8-bit single-channel image
+* @param flowWidthStride   the width stride of the flow field in floats, usually it equals to `width * 2`
+* @param flowData          output flow field, (dx, dy) pairs such that prev(y, x) ~ next(y + dy, x + dx)
+* @param params            algorithm parameters
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @note Both height and width must be at least params.patchSize + 2, smaller images are rejected with
+*       RC_INVALID_VALUE instead of shrinking the patches as OpenCV does.
+* @remark The images are processed coarse to fine on a PyrDown pyramid. On every level the patches are aligned by
+*         inverse compositional Gauss-Newton search, densified, and refined variationally.
+*         Rows of patches are searched in parallel.
+*         The following table show which data type is supported.
+* <table>
+* <tr><th>Data type
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/opticalflow.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/opticalflow.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_prev = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_next = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     float* dev_flow = (float*)malloc(W * H * 2 * sizeof(float));
+*
+*     ppl::cv::x86::DISOpticalFlow(H, W, W, dev_prev, W, dev_next, W * 2, dev_flow);
+*
+*     free(dev_prev);
+*     free(dev_next);
+*     free(dev_flow);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode DISOpticalFlow(
+    int32_t height,
+    int32_t width,
+    int32_t prevWidthStride,
+    const uint8_t* prevData,
+    int32_t nextWidthStride,
+    const uint8_t* nextData,
+    int32_t flowWidthStride,
+    float* flowData,
+    const DISOpticalFlowParams& params = DISOpticalFlowParams());
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_OPTICALFLOW_H_
@@ -0,0 +1,219 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_PLANAR_H_
+#define __ST_HPC_PPL_CV_X86_PLANAR_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Gaussian blur of a planar (CHW) image, one plane per channel.
+* @tparam T The data type of the planes, uint8_t, uint16_t and float are supported.
+* @tparam numPlanes The number of planes, 1, 3 and 4 are supported.
+* @param height            image height
+* @param width             image width
+* @param inWidthStrides    numPlanes row strides of the input planes, in elements
+* @param inPlanes          numPlanes input planes
+* @param kernel_len        the length of mask, only odd num is supported.
+* @param sigma             standard deviation
+* @param outWidthStrides   numPlanes row strides of the output planes, in elements
+* @param outPlanes         numPlanes output planes
+* @param border_type       ways to deal with border, as for GaussianBlur
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Every plane is blurred by the single-channel kernel of GaussianBlur and the planes run in parallel,
+*         so the result is the one of GaussianBlur<T, 1> on every plane, without merging the planes into an
+*         interleaved image first. A plane may be blurred in place.
+* <table>
+* <tr><th>Data type(T)<th>numPlanes
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>uint16_t<td>1
+* <tr><td>uint16_t<td>3
+* <tr><td>uint16_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/planar.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/planar.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     std::vector<float> src(3 * H * W), dst(3 * H * W);
+*     const float* in[3] = {&src[0], &src[H * W], &src[2 * H * W]};
+*     float* out[3]      = {&dst[0], &dst[H * W], &dst[2 * H * W]};
+*     int32_t strides[3] = {W, W, W};
+*     ppl::cv::x86::GaussianBlurPlanar<float, 3>(H, W, strides, in, 5, 1.2f, strides, out);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t numPlanes>
+::ppl::common::RetCode GaussianBlurPlanar(
+    int32_t height,
+    int32_t width,
+    const int32_t* inWidthStrides,
+    const T* const* inPlanes,
+    int32_t kernel_len,
+    float sigma,
+    const int32_t* outWidthStrides,
+    T* const* outPlanes,
+    BorderType border_type = ppl::cv::BORDER_TYPE_DEFAULT);
+
+/**
+* @brief Affine transformation with linear interpolation of a planar (CHW) image, one plane per channel.
+* @tparam T The data type of the planes, uint8_t and float are supported.
+* @tparam numPlanes The number of planes, 1, 3 and 4 are supported.
+* @param inHeight          input image height
+* @param inWidth           input image width
+* @param inWidthStrides    numPlanes row strides of the input planes, in elements
+* @param inPlanes          numPlanes input planes
+* @param outHeight         output image height
+* @param outWidth          output image width
+* @param outWidthStrides   numPlanes row strides of the output planes, in elements
+* @param outPlanes         numPlanes output planes
+* @param affineMatrix      the inverse affine matrix, 2x3 doubles, as for WarpAffineLinear
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT/ppl::cv::BORDER_TYPE_REPLICATE/ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param border_value      border value for BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The source coordinates and the four weights of an output row are computed once and applied to every
+*         plane with a single-channel kernel, four pixels at a time. Bands of output rows run in parallel.
+*         Results are within 1 of WarpAffineLinear<T, 1> on every plane, the difference coming from how the
+*         source coordinates are rounded.
+* <table>
+* <tr><th>Data type(T)<th>numPlanes
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/planar.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/planar.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     std::vector<uint8_t> src(3 * H * W), dst(3 * H * W);
+*     const uint8_t* in[3] = {&src[0], &src[H * W], &src[2 * H * W]};
+*     uint8_t* out[3]      = {&dst[0], &dst[H * W], &dst[2 * H * W]};
+*     int32_t strides[3]   = {W, W, W};
+*     double M[6]          = {0.9, 0.1, 10.0, -0.1, 0.9, 20.0};
+*     ppl::cv::x86::WarpAffineLinearPlanar<uint8_t, 3>(H, W, strides, in, H, W, strides, out, M);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t numPlanes>
+::ppl::common::RetCode WarpAffineLinearPlanar(
+    int32_t inHeight,
+    int32_t inWidth,
+    const int32_t* inWidthStrides,
+    const T* const* inPlanes,
+    int32_t outHeight,
+    int32_t outWidth,
+    const int32_t* outWidthStrides,
+    T* const* outPlanes,
+    const double* affineMatrix,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T border_value = 0);
+
+/**
+* @brief Bilinear resize of a planar (CHW) image, one plane per channel.
+* @tparam T The data type of the planes, uint8_t and float are supported.
+* @tparam numPlanes The number of planes, 1, 3 and 4 are supported.
+* @param inHeight          input image height
+* @param inWidth           input image width
+* @param inWidthStrides    numPlanes row strides of the input planes, in elements
+* @param inPlanes          numPlanes input planes
+* @param outHeight         output image height
+* @param outWidth          output image width
+* @param outWidthStrides   numPlanes row strides of the output planes, in elements
+* @param outPlanes         numPlanes output planes
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The interpolation tables are computed once for all planes, and bands of output rows of all planes
+*         are resized in parallel by the single-channel kernel. The result is the one of ResizeLinear<T, 1>
+*         on every plane, float results may differ in the last bits as for ResizeLinearBatch.
+* <table>
+* <tr><th>Data type(T)<th>numPlanes
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/planar.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/planar.h>
+* #include <vector>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 1920;
+*     const int32_t H = 1080;
+*     std::vector<float> src(3 * H * W), dst(3 * 224 * 224);
+*     const float* in[3]    = {&src[0], &src[H * W], &src[2 * H * W]};
+*     float* out[3]         = {&dst[0], &dst[224 * 224], &dst[2 * 224 * 224]};
+*     int32_t inStrides[3]  = {W, W, W};
+*     int32_t outStrides[3] = {224, 224, 224};
+*     ppl::cv::x86::ResizeLinearPlanar<float, 3>(H, W, inStrides, in, 224, 224, outStrides, out);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t numPlanes>
+::ppl::common::RetCode ResizeLinearPlanar(
+    int32_t inHeight,
+    int32_t inWidth,
+    const int32_t* inWidthStrides,
+    const T* const* inPlanes,
+    int32_t outHeight,
+    int32_t outWidth,
+    const int32_t* outWidthStrides,
+    T* const* outPlanes);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_PLANAR_H_
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_REDUCTION_H_
+#define __ST_HPC_PPL_CV_X86_REDUCTION_H_
+
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief How Mean, MeanStdDev and Norm split and combine their parallel sums.
+* @remark In the fast mode every thread sums a contiguous part of the rows and the partial sums are added in
+*         thread order, so floating point results change with the number of threads.
+*         In the reproducible mode the rows are cut into blocks whose size only depends on the image width, the
+*         blocks are summed in any order and combined by a pairwise tree in block order. Inside a row, elements
+*         are summed in 12 lanes in double precision, whatever the instruction set of the machine. The results
+*         are then bit-exact for every number of threads and on every x86 machine.
+*         Integer sums are exact in both modes. Integral has no mode, each of its outputs is summed in the
+*         same order by any number of threads.
+*/
+enum ReductionMode {
+    REDUCTION_MODE_DEFAULT      = 0, //!< the mode set by SetReductionMode
+    REDUCTION_MODE_FAST         = 1, //!< partial sums per thread, the initial global mode
+    REDUCTION_MODE_REPRODUCIBLE = 2, //!< fixed blocks and a pairwise tree, independent of the thread count
+};
+
+/** Sets the mode of the calls made with REDUCTION_MODE_DEFAULT, REDUCTION_MODE_DEFAULT restores the fast mode */
+void SetReductionMode(ReductionMode mode);
+
+/** The mode of the calls made with REDUCTION_MODE_DEFAULT */
+ReductionMode GetReductionMode();
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_REDUCTION_H_
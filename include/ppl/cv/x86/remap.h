@@ -26,7 +26,7 @@ namespace x86 {
 
 /**
 * @brief Remap of coordinate map with linear interpolation method.
-* @tparam T The data type of input image, currently only \a uint8_t and \a float is supported.
+* @tparam T The data type of input image, currently only \a uint8_t, \a uint16_t and \a float are supported.
 * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
 * @param inHeight          input image's height
 * @param inWidth           input image's width need to be processed
@@ -47,6 +47,9 @@ namespace x86 {
 * <tr><td>uint8_t(uchar)<td>1
 * <tr><td>uint8_t(uchar)<td>3
 * <tr><td>uint8_t(uchar)<td>4
+* <tr><td>uint16_t<td>1
+* <tr><td>uint16_t<td>3
+* <tr><td>uint16_t<td>4
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
@@ -168,7 +171,7 @@ template <typename T>
 
 /**
 * @brief Remap of coordinate map with nearest interpolation method.
-* @tparam T The data type of input image, currently only \a uint8_t and \a float is supported.
+* @tparam T The data type of input image, currently only \a uint8_t, \a uint16_t and \a float are supported.
 * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
 * @param inHeight          input image's height
 * @param inWidth           input image's width need to be processed
@@ -189,6 +192,9 @@ template <typename T>
 * <tr><td>uint8_t(uchar)<td>1
 * <tr><td>uint8_t(uchar)<td>3
 * <tr><td>uint8_t(uchar)<td>4
+* <tr><td>uint16_t<td>1
+* <tr><td>uint16_t<td>3
+* <tr><td>uint16_t<td>4
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
@@ -27,9 +27,9 @@ namespace x86 {
 
 /**
 * @brief Resize the image with linear interpolation method.
-* @tparam TSrc The data type of input image, currently only \a uint8_t and \a float are supported.
+* @tparam TSrc The data type of input image, currently only \a uint8_t, \a uint16_t and \a float are supported.
 * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
-* @tparam TDst The data type of output image, currently only \a uint8_t and \a float are supported.The param is same with TSrc.
+* @tparam TDst The data type of output image, currently only \a uint8_t, \a uint16_t and \a float are supported.The param is same with TSrc.
 * @param inHeight          input image's height
 * @param inWidth           input image's width need to be processed
 * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
@@ -45,6 +45,9 @@ namespace x86 {
 * <tr><td>uint8_t(uchar)<td>1
 * <tr><td>uint8_t(uchar)<td>3
 * <tr><td>uint8_t(uchar)<td>4
+* <tr><td>uint16_t<td>1
+* <tr><td>uint16_t<td>3
+* <tr><td>uint16_t<td>4
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
@@ -87,7 +90,7 @@ template<typename T, int32_t channels>
 
 /**
 * @brief Resize the image with nearest neighbor interpolation method
-* @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+* @tparam T The data type of input and output image, currently only \a uint8_t, \a uint16_t and \a float are supported.
 * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
 * @param inHeight          input image's height
 * @param inWidth           input image's width need to be processed
@@ -104,6 +107,9 @@ template<typename T, int32_t channels>
 * <tr><td>uint8_t(uchar)<td>1
 * <tr><td>uint8_t(uchar)<td>3
 * <tr><td>uint8_t(uchar)<td>4
+* <tr><td>uint16_t<td>1
+* <tr><td>uint16_t<td>3
+* <tr><td>uint16_t<td>4
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
@@ -145,6 +151,135 @@ template<typename T, int32_t channels>
     int32_t outWidthStride,
     T* outData);
 
+enum ResizeFilterType {
+    RESIZE_FILTER_TRIANGLE = 0, //!< tent filter, support 1 before scaling (area-like averaging when shrinking)
+    RESIZE_FILTER_MITCHELL = 1, //!< Mitchell-Netravali cubic with B = C = 1/3, support 2 before scaling
+    RESIZE_FILTER_LANCZOS4 = 2, //!< Lanczos windowed sinc with 4 lobes, support 4 before scaling
+};
+
+struct ResizeFilterTables;
+
+/**
+* @brief Separable antialiased resize with a precomputed filter plan.
+* @remark When shrinking, the filter is stretched by the scale factor so that every output pixel is computed from
+*         all the source pixels under its footprint; when enlarging it is used as is. The per-axis weight tables
+*         are computed once by the constructor and reused by every Apply() call, which is what makes a plan
+*         worth keeping for video streams.
+*         The two axes are filtered one after the other, in the order that reads fewer pixels, so the cost is
+*         proportional to the number of source pixels under the filters rather than to a fixed tap count.
+*         uint8_t data is filtered with 14-bit fixed-point weights and rounded to 8 bits between the two passes,
+*         float data with float weights. Rows are processed in parallel.
+*         Pixels outside of the image are not used, the weights of the border pixels are renormalized instead.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> all
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/resize.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/resize.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t inWidth = 3840;
+*     const int32_t inHeight = 2160;
+*     const int32_t outWidth = 256;
+*     const int32_t outHeight = 144;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(inWidth * inHeight * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(outWidth * outHeight * C * sizeof(uint8_t));
+*
+*     ppl::cv::x86::ResizeFilterPlan plan(inHeight, inWidth, outHeight, outWidth, ppl::cv::x86::RESIZE_FILTER_LANCZOS4);
+*     plan.Apply<uint8_t, 3>(inWidth * C, dev_iImage, outWidth * C, dev_oImage);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+class ResizeFilterPlan {
+public:
+    /**
+    * @param inHeight          input image's height
+    * @param inWidth           input image's width
+    * @param outHeight         output image's height
+    * @param outWidth          output image's width
+    * @param filter            resampling filter, see ResizeFilterType
+    */
+    ResizeFilterPlan(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, ResizeFilterType filter);
+    ~ResizeFilterPlan();
+
+    /**
+    * @tparam T The data type of the images, \a uint8_t and \a float are supported.
+    * @tparam channels The number of channels, 1, 3 and 4 are supported.
+    * @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+    * @param inData            input image data of the planned size
+    * @param outWidthStride    the width stride of output image, usually it equals to `outWidth * channels`
+    * @param outData           output image data of the planned size, must not overlap the input
+    * @return RC_INVALID_VALUE when the plan was built with invalid sizes or the arguments are invalid
+    */
+    template<typename T, int32_t channels>
+    ::ppl::common::RetCode Apply(
+        int32_t inWidthStride,
+        const T* inData,
+        int32_t outWidthStride,
+        T* outData) const;
+
+private:
+    ResizeFilterPlan(const ResizeFilterPlan&);
+    ResizeFilterPlan& operator=(const ResizeFilterPlan&);
+
+    int32_t inHeight_;
+    int32_t inWidth_;
+    int32_t outHeight_;
+    int32_t outWidth_;
+    ResizeFilterTables* tables_;
+};
+
+/**
+* @brief Antialiased resize with a one-shot ResizeFilterPlan.
+* @tparam T The data type of the images, \a uint8_t and \a float are supported.
+* @tparam channels The number of channels, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height
+* @param outWidth          output image's width
+* @param outWidthStride    the width stride of output image, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param filter            resampling filter, see ResizeFilterType
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Builds the weight tables on every call, keep a ResizeFilterPlan when resizing many images of the same size.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> all
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/resize.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+***************************************************************************************************/
+template<typename T, int32_t channels>
+::ppl::common::RetCode ResizeFiltered(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    ResizeFilterType filter = RESIZE_FILTER_LANCZOS4);
+
 
 } //! namespace x86
 } //! namespace cv
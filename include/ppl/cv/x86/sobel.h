@@ -38,6 +38,7 @@ namespace x86 {
  * @param dx                order of the derivative x
  * @param dy                order of the derivative y
  * @param ksize             the length of kernel. when ksize == -1, it will use 3x3 scharr kernel, (dx, dy) = (0, 1) or (1, 0). when ksize == 1, 3, 5, 7, dx + dy should > 0. other ksize is not supported.
+ *                          For uint8_t input the sums are exact in integers and saturated to int16_t after scale and delta.
  * @param scale             scale factor for the computed derivative values
  * @param delta             delta value that is added to the results prior to storing them
  * @param border_type       ways to deal with border. Only BORDER_TYPE_REFLECT_101 or BORDER_TYPE_DEFAULT are supported now.
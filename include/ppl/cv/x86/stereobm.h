@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_STEREOBM_H_
+#define __ST_HPC_PPL_CV_X86_STEREOBM_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+enum StereoPreFilterType {
+    STEREO_PREFILTER_NORMALIZED_RESPONSE = 0,
+    STEREO_PREFILTER_XSOBEL              = 1,
+};
+
+/** Parameters of StereoBM, the defaults are the same as OpenCV's */
+struct StereoBMParams {
+    int32_t minDisparity;             //!< minimum possible disparity value
+    int32_t numDisparities;           //!< disparity search range, must be a positive multiple of 16
+    int32_t blockSize;                //!< size of the matching window, odd and in [5, 255]
+    StereoPreFilterType preFilterType; //!< prefilter applied to both images before matching
+    int32_t preFilterSize;            //!< window of the normalized response prefilter, odd and in [5, 255]
+    int32_t preFilterCap;             //!< prefiltered values are clipped to [-preFilterCap, preFilterCap], in [1, 63]
+    int32_t textureThreshold;         //!< windows whose texture is lower than this are invalidated
+    int32_t uniquenessRatio;          //!< margin in percent by which the best cost should win, in [0, 100)
+    bool useSGM;                      //!< aggregate the block costs along 4 paths with semi-global matching
+    int32_t P1;                       //!< SGM penalty for disparity changes by 1, 0 means 8 * blockSize * blockSize
+    int32_t P2;                       //!< SGM penalty for larger disparity changes, 0 means 32 * blockSize * blockSize
+
+    StereoBMParams()
+        : minDisparity(0)
+        , numDisparities(64)
+        , blockSize(21)
+        , preFilterType(STEREO_PREFILTER_XSOBEL)
+        , preFilterSize(9)
+        , preFilterCap(31)
+        , textureThreshold(10)
+        , uniquenessRatio(15)
+        , useSGM(false)
+        , P1(0)
+        , P2(0) {}
+};
+
+struct StereoBMBuffers;
+
+/**
+* @brief Computes the disparity map of a rectified stereo pair by block matching.
+* All working buffers are allocated when the matcher is created, Compute() allocates nothing.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The matching cost of a window is the sum of absolute differences of the prefiltered images
+*         (at most blockSize * blockSize * 2 * preFilterCap, which must fit into 16 bits).
+*         Window costs are aggregated incrementally along columns and rows, the rows are split into strips
+*         which are matched in parallel.
+*         The following table show which data type is supported.
+* <table>
+* <tr><th>Data type
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/stereobm.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/stereobm.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_left = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_right = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     int16_t* dev_disparity = (int16_t*)malloc(W * H * sizeof(int16_t));
+*
+*     ppl::cv::x86::StereoBMParams params;
+*     params.numDisparities = 64;
+*     params.blockSize = 15;
+*     ppl::cv::x86::StereoBM matcher(H, W, params);
+*     matcher.Compute(W, dev_left, W, dev_right, W, dev_disparity);
+*
+*     free(dev_left);
+*     free(dev_right);
+*     free(dev_disparity);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+class StereoBM {
+public:
+    /**
+    * @param height            height of the stereo images
+    * @param width             width of the stereo images
+    * @param params            matching parameters, validated by Compute()
+    */
+    StereoBM(int32_t height, int32_t width, const StereoBMParams& params);
+    ~StereoBM();
+
+    /**
+    * @param leftWidthStride   left image's width stride, usually it equals to `width`
+    * @param left              left 8-bit single-channel image
+    * @param rightWidthStride  right image's width stride, usually it equals to `width`
+    * @param right             right 8-bit single-channel image
+    * @param outWidthStride    the width stride of the disparity map in elements, usually it equals to `width`
+    * @param disparity         output disparity map with 4 fractional bits (disparity * 16), pixels without
+    *                          a reliable match are set to (minDisparity - 1) * 16
+    */
+    ::ppl::common::RetCode Compute(
+        int32_t leftWidthStride,
+        const uint8_t* left,
+        int32_t rightWidthStride,
+        const uint8_t* right,
+        int32_t outWidthStride,
+        int16_t* disparity);
+
+private:
+    StereoBM(const StereoBM&);
+    StereoBM& operator=(const StereoBM&);
+
+    int32_t height_;
+    int32_t width_;
+    StereoBMParams params_;
+    StereoBMBuffers* buffers_;
+};
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_STEREOBM_H_
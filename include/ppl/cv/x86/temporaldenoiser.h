@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_TEMPORALDENOISER_H_
+#define __ST_HPC_PPL_CV_X86_TEMPORALDENOISER_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/** Parameters of TemporalDenoiser */
+struct TemporalDenoiserParams {
+    int32_t historyLength; //!< number of previous denoised frames blended with the current one, in [1, 4]
+    int32_t blockSize;     //!< side of the luma motion blocks, 8 or 16
+    int32_t searchRange;   //!< motion vectors are searched in [-searchRange, searchRange] in both directions, in [0, 16]
+    float noiseLevel;      //!< standard deviation of the noise in 8-bit units, larger values denoise more and blur motion more
+
+    TemporalDenoiserParams()
+        : historyLength(2)
+        , blockSize(16)
+        , searchRange(8)
+        , noiseLevel(6.f) {}
+};
+
+struct TemporalDenoiserBuffers;
+
+/**
+* @brief Denoises a NV12 video stream by blending every frame with motion-compensated previous outputs.
+* The frame history and the motion vectors are allocated when the denoiser is created, Apply() allocates nothing.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Every luma block is matched in each of the previous outputs by a full search of the sum of absolute
+*         differences, which is skipped when the block has not moved by more than the noise. The chroma plane
+*         follows the luma vectors at half resolution. Pixels are blended with a weight of
+*         max(3 * noiseLevel - |reference - current|, 0) per reference, so that occlusions and badly matched
+*         pixels fall back to the current frame. The output is recursive: it becomes the newest reference.
+*         Rows of blocks are processed in parallel.
+*         The following table show which data type is supported.
+* <table>
+* <tr><th>Data type
+* <tr><td>uint8_t
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/temporaldenoiser.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/temporaldenoiser.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 1280;
+*     const int32_t H = 720;
+*     uint8_t* dev_iY = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_iUV = (uint8_t*)malloc(W * H / 2 * sizeof(uint8_t));
+*     uint8_t* dev_oY = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oUV = (uint8_t*)malloc(W * H / 2 * sizeof(uint8_t));
+*
+*     ppl::cv::x86::TemporalDenoiserParams params;
+*     params.noiseLevel = 8.f;
+*     ppl::cv::x86::TemporalDenoiser denoiser(H, W, params);
+*     for (int32_t frame = 0; frame < 100; ++frame) {
+*         denoiser.Apply(W, dev_iY, W, dev_iUV, W, dev_oY, W, dev_oUV);
+*     }
+*
+*     free(dev_iY);
+*     free(dev_iUV);
+*     free(dev_oY);
+*     free(dev_oUV);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+class TemporalDenoiser {
+public:
+    /**
+    * @param height            height of the frames, even and at least blockSize
+    * @param width             width of the frames, even and at least blockSize
+    * @param params            denoising parameters, validated by Apply()
+    * @remark Apply() returns RC_INVALID_VALUE when the parameters are wrong or the frame history could not be
+    *         allocated.
+    */
+    TemporalDenoiser(int32_t height, int32_t width, const TemporalDenoiserParams& params);
+    ~TemporalDenoiser();
+
+    /**
+    * @param inYStride         input Y plane stride, usually it equals to `width`
+    * @param inY               input Y plane
+    * @param inUVStride        input interleaved UV plane stride, usually it equals to `width`
+    * @param inUV              input interleaved UV plane of height / 2 rows
+    * @param outYStride        output Y plane stride, usually it equals to `width`
+    * @param outY              output Y plane, must not overlap the input
+    * @param outUVStride       output UV plane stride, usually it equals to `width`
+    * @param outUV             output UV plane, must not overlap the input
+    */
+    ::ppl::common::RetCode Apply(
+        int32_t inYStride,
+        const uint8_t* inY,
+        int32_t inUVStride,
+        const uint8_t* inUV,
+        int32_t outYStride,
+        uint8_t* outY,
+        int32_t outUVStride,
+        uint8_t* outUV);
+
+    /** Forgets the frame history, for instance after a scene cut */
+    void Reset();
+
+private:
+    TemporalDenoiser(const TemporalDenoiser&);
+    TemporalDenoiser& operator=(const TemporalDenoiser&);
+
+    int32_t height_;
+    int32_t width_;
+    TemporalDenoiserParams params_;
+    TemporalDenoiserBuffers* buffers_;
+};
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_TEMPORALDENOISER_H_
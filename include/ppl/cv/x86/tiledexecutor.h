@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_TILEDEXECUTOR_H_
+#define __ST_HPC_PPL_CV_X86_TILEDEXECUTOR_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/opgraph.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+enum MappedImageLayout {
+    MAPPED_LAYOUT_INTERLEAVED = 0, //!< rows of interleaved pixels
+    MAPPED_LAYOUT_PLANAR      = 1, //!< one plane of rows per channel
+    MAPPED_LAYOUT_TILED       = 2, //!< row-major square tiles of interleaved pixels, the last tiles are padded
+};
+
+/** Layout of a raw image file */
+struct MappedImageDesc {
+    int32_t height;
+    int32_t width;
+    int32_t channels;
+    OpDataType type;
+    MappedImageLayout layout;
+    int32_t tileSize; //!< side of the tiles of MAPPED_LAYOUT_TILED
+    int64_t offset;   //!< bytes before the first pixel, for instance a file header
+
+    MappedImageDesc()
+        : height(0)
+        , width(0)
+        , channels(1)
+        , type(OP_DATA_UINT8)
+        , layout(MAPPED_LAYOUT_INTERLEAVED)
+        , tileSize(256)
+        , offset(0) {}
+};
+
+struct MappedImageBuffers;
+
+/**
+* @brief A raw image file mapped into memory, which can be larger than the physical memory.
+* @remark Rectangles are copied from and to interleaved buffers whatever the layout of the file, pages are
+*         only loaded when they are touched. Open() maps the file read-only, Create() creates or truncates it
+*         to the size of the image and maps it read-write.
+*         Memory mapping is implemented on POSIX systems, RC_UNSUPPORTED is returned elsewhere.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> Linux and other POSIX systems
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/tiledexecutor.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+***************************************************************************************************/
+class MappedImage {
+public:
+    MappedImage();
+    ~MappedImage();
+
+    ::ppl::common::RetCode Open(const char* path, const MappedImageDesc& desc);
+    ::ppl::common::RetCode Create(const char* path, const MappedImageDesc& desc);
+    /** Unmaps the file, the changes of a created file are written back */
+    void Close();
+
+    const MappedImageDesc& Desc() const { return desc_; }
+    bool Writable() const { return writable_; }
+
+    /** copies rect into an interleaved buffer, widthStride in elements */
+    ::ppl::common::RetCode ReadRect(const OpRect& rect, int32_t widthStride, void* data) const;
+    /** copies an interleaved buffer into rect, widthStride in elements */
+    ::ppl::common::RetCode WriteRect(const OpRect& rect, int32_t widthStride, const void* data);
+    /** asks the system to load the pages of rect in the background */
+    void Prefetch(const OpRect& rect) const;
+
+private:
+    MappedImage(const MappedImage&);
+    MappedImage& operator=(const MappedImage&);
+
+    ::ppl::common::RetCode Map(const char* path, const MappedImageDesc& desc, bool create);
+
+    MappedImageDesc desc_;
+    bool writable_;
+    MappedImageBuffers* buffers_;
+};
+
+/** Parameters of ExecuteTiled */
+struct TiledExecutorParams {
+    int32_t tileSize;      //!< side of the output tiles, at least 16
+    int32_t prefetchTiles; //!< the source pages of that many tiles ahead are prefetched, 0 disables it
+
+    TiledExecutorParams()
+        : tileSize(512)
+        , prefetchTiles(2) {}
+};
+
+/**
+* @brief Executes an op graph on a memory-mapped image, tile by tile.
+* @param graph             operations to execute, its input must match the source image
+* @param src               source image
+* @param dst               destination image, created with the output size, channels and data type of the graph
+* @param params            tiling parameters
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The output is cut into tiles of tileSize x tileSize pixels, each tile reads the source rectangle it
+*         depends on, which includes the halos of the filters and the footprint of the warps, runs the graph
+*         on it in memory and writes its output rectangle. Tiles are distributed dynamically to the threads,
+*         every thread allocates scratch memory for one tile at a time, so the memory use does not depend on
+*         the size of the image. It grows with the source rectangle of a tile though: a graph which shrinks
+*         the image by a factor s reads about s * s times the tile area from the source, so tileSize should be
+*         lowered accordingly for large downscales. RC_OUT_OF_MEMORY is returned when the memory of a tile
+*         cannot be allocated. Before a tile is computed,
+*         the source pages of the tiles which follow it are prefetched with madvise(MADV_WILLNEED).
+*         Filters give the same results as on the whole image, resizes and warps can differ by 1 each for uint8_t.
+*         Graphs which start with NV122BGR are not supported, RC_UNSUPPORTED is returned.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> Linux and other POSIX systems
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/tiledexecutor.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/tiledexecutor.h>
+* int32_t main(int32_t argc, char** argv) {
+*     ppl::cv::x86::MappedImageDesc srcDesc;
+*     srcDesc.height   = 50000;
+*     srcDesc.width    = 50000;
+*     srcDesc.channels = 3;
+*     srcDesc.layout   = ppl::cv::x86::MAPPED_LAYOUT_TILED;
+*     ppl::cv::x86::MappedImage src;
+*     src.Open("slide.raw", srcDesc);
+*
+*     ppl::cv::x86::OpGraph graph(50000, 50000, 3, ppl::cv::x86::OP_DATA_UINT8);
+*     graph.AddGaussianBlur(5, 1.2f);
+*     graph.AddResizeLinear(12500, 12500);
+*     graph.AddBGR2GRAY();
+*
+*     ppl::cv::x86::MappedImageDesc dstDesc;
+*     dstDesc.height   = graph.OutputHeight();
+*     dstDesc.width    = graph.OutputWidth();
+*     dstDesc.channels = graph.OutputChannels();
+*     ppl::cv::x86::MappedImage dst;
+*     dst.Create("slide_gray.raw", dstDesc);
+*
+*     ppl::cv::x86::ExecuteTiled(graph, src, dst, ppl::cv::x86::TiledExecutorParams());
+*     dst.Close();
+*     src.Close();
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode ExecuteTiled(
+    const OpGraph& graph,
+    const MappedImage& src,
+    MappedImage& dst,
+    const TiledExecutorParams& params);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_TILEDEXECUTOR_H_
@@ -26,7 +26,7 @@ namespace x86 {
 
 /**
 * @brief Transposes an image.
-* @tparam T The data type of input and output image, currently only \a uint8_t(uchar) and \a float are supported.
+* @tparam T The data type of input and output image, currently only \a uint8_t(uchar), \a uint16_t and \a float are supported.
 * @tparam nc The number of channels of input image and output image, 1, 3 and 4 are supported.
 * @param height            input image's height
 * @param width             input image's width
@@ -44,6 +44,9 @@ namespace x86 {
 * <tr><td>uint8_t(uchar)<td>1
 * <tr><td>uint8_t(uchar)<td>3
 * <tr><td>uint8_t(uchar)<td>4
+* <tr><td>uint16_t<td>1
+* <tr><td>uint16_t<td>3
+* <tr><td>uint16_t<td>4
 * </table>
 * <table>
 * <caption align="left">Requirements</caption>
@@ -0,0 +1,385 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_UNDISTORT_H_
+#define __ST_HPC_PPL_CV_X86_UNDISTORT_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/** Number of fractional bits of the coordinates stored in fixed-point maps */
+#define UNDISTORT_INTER_BITS 5
+
+/**
+* @brief Computes the undistortion and rectification maps of a pinhole camera for RemapLinear and RemapNearestPoint.
+* @param height            maps' height, which is the height of the undistorted image
+* @param width             maps' width, which is the width of the undistorted image
+* @param cameraMatrix      3x3 row-major camera matrix [fx 0 cx; 0 fy cy; 0 0 1]
+* @param distCoeffsNum     number of distortion coefficients, 0, 4, 5, 8, 12 or 14
+* @param distCoeffs        distortion coefficients (k1, k2, p1, p2[, k3[, k4, k5, k6[, s1, s2, s3, s4[, tx, ty]]]])
+* @param R                 3x3 row-major rectification transformation, identity is used if it is nullptr
+* @param newCameraMatrix   3x3 row-major camera matrix of the undistorted image, if it is nullptr, `cameraMatrix`
+*                          with the principal point moved to the image center is used, as OpenCV does
+* @param mapX              output map of x coordinates, `height * width` floats
+* @param mapY              output map of y coordinates, `height * width` floats
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The coordinates are computed 4 pixels at a time with SSE in single precision, and rows are distributed
+*         among threads.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/undistort.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/undistort.h>
+* #include <ppl/cv/x86/remap.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     const double K[9] = {500, 0, 320, 0, 500, 240, 0, 0, 1};
+*     const double D[5] = {-0.3, 0.1, 0.001, -0.001, 0};
+*     float* mapX = (float*)malloc(W * H * sizeof(float));
+*     float* mapY = (float*)malloc(W * H * sizeof(float));
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*
+*     ppl::cv::x86::InitUndistortRectifyMap(H, W, K, 5, D, nullptr, K, mapX, mapY);
+*     ppl::cv::x86::RemapLinear<uint8_t, 3>(H, W, W * C, dev_iImage, H, W, W * C, dev_oImage, mapX, mapY);
+*
+*     free(mapX);
+*     free(mapY);
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode InitUndistortRectifyMap(
+    int32_t height,
+    int32_t width,
+    const double* cameraMatrix,
+    int32_t distCoeffsNum,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    float* mapX,
+    float* mapY);
+
+/**
+* @brief Computes the undistortion and rectification maps of a pinhole camera in fixed-point format.
+* @param height            maps' height, which is the height of the undistorted image
+* @param width             maps' width, which is the width of the undistorted image
+* @param cameraMatrix      3x3 row-major camera matrix [fx 0 cx; 0 fy cy; 0 0 1]
+* @param distCoeffsNum     number of distortion coefficients, 0, 4, 5, 8, 12 or 14
+* @param distCoeffs        distortion coefficients (k1, k2, p1, p2[, k3[, k4, k5, k6[, s1, s2, s3, s4[, tx, ty]]]])
+* @param R                 3x3 row-major rectification transformation, identity is used if it is nullptr
+* @param newCameraMatrix   3x3 row-major camera matrix of the undistorted image, if it is nullptr, `cameraMatrix`
+*                          with the principal point moved to the image center is used, as OpenCV does
+* @param mapXY             output integer parts of the coordinates, `height * width * 2` interleaved (x, y)
+* @param mapFXY            output fractional parts of the coordinates, `height * width` values of
+*                          `(fy << UNDISTORT_INTER_BITS) + fx`
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The maps have the same layout as the CV_16SC2 and CV_16UC1 maps of OpenCV, so they take a quarter of
+*         the memory of float maps and can be passed to cv::remap directly. Integer parts saturate to int16_t.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/undistort.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/undistort.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const double K[9] = {500, 0, 320, 0, 500, 240, 0, 0, 1};
+*     const double D[5] = {-0.3, 0.1, 0.001, -0.001, 0};
+*     int16_t* mapXY = (int16_t*)malloc(W * H * 2 * sizeof(int16_t));
+*     uint16_t* mapFXY = (uint16_t*)malloc(W * H * sizeof(uint16_t));
+*
+*     ppl::cv::x86::InitUndistortRectifyMap(H, W, K, 5, D, nullptr, K, mapXY, mapFXY);
+*
+*     free(mapXY);
+*     free(mapFXY);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode InitUndistortRectifyMap(
+    int32_t height,
+    int32_t width,
+    const double* cameraMatrix,
+    int32_t distCoeffsNum,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    int16_t* mapXY,
+    uint16_t* mapFXY);
+
+/**
+* @brief Computes the undistortion and rectification maps of a fisheye camera for RemapLinear and RemapNearestPoint.
+* @param height            maps' height, which is the height of the undistorted image
+* @param width             maps' width, which is the width of the undistorted image
+* @param cameraMatrix      3x3 row-major camera matrix [fx 0 cx; 0 fy cy; 0 0 1]
+* @param distCoeffs        4 distortion coefficients (k1, k2, k3, k4) of the equidistant model
+* @param R                 3x3 row-major rectification transformation, identity is used if it is nullptr
+* @param newCameraMatrix   3x3 row-major camera matrix of the undistorted image, identity is used if it is nullptr,
+*                          as OpenCV does
+* @param mapX              output map of x coordinates, `height * width` floats
+* @param mapY              output map of y coordinates, `height * width` floats
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The coordinates are computed 4 pixels at a time with SSE in single precision, including the arc tangent
+*         of the equidistant model, and rows are distributed among threads. Pixels behind the camera are mapped
+*         to infinity.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/undistort.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/undistort.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const double K[9] = {300, 0, 320, 0, 300, 240, 0, 0, 1};
+*     const double D[4] = {0.05, -0.01, 0.002, -0.0005};
+*     float* mapX = (float*)malloc(W * H * sizeof(float));
+*     float* mapY = (float*)malloc(W * H * sizeof(float));
+*
+*     ppl::cv::x86::FisheyeInitUndistortRectifyMap(H, W, K, D, nullptr, K, mapX, mapY);
+*
+*     free(mapX);
+*     free(mapY);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode FisheyeInitUndistortRectifyMap(
+    int32_t height,
+    int32_t width,
+    const double* cameraMatrix,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    float* mapX,
+    float* mapY);
+
+/**
+* @brief Computes the undistortion and rectification maps of a fisheye camera in fixed-point format.
+* @param height            maps' height, which is the height of the undistorted image
+* @param width             maps' width, which is the width of the undistorted image
+* @param cameraMatrix      3x3 row-major camera matrix [fx 0 cx; 0 fy cy; 0 0 1]
+* @param distCoeffs        4 distortion coefficients (k1, k2, k3, k4) of the equidistant model
+* @param R                 3x3 row-major rectification transformation, identity is used if it is nullptr
+* @param newCameraMatrix   3x3 row-major camera matrix of the undistorted image, identity is used if it is nullptr,
+*                          as OpenCV does
+* @param mapXY             output integer parts of the coordinates, `height * width * 2` interleaved (x, y)
+* @param mapFXY            output fractional parts of the coordinates, `height * width` values of
+*                          `(fy << UNDISTORT_INTER_BITS) + fx`
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The maps have the same layout as the CV_16SC2 and CV_16UC1 maps of OpenCV. Integer parts saturate
+*         to int16_t.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/undistort.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/undistort.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const double K[9] = {300, 0, 320, 0, 300, 240, 0, 0, 1};
+*     const double D[4] = {0.05, -0.01, 0.002, -0.0005};
+*     int16_t* mapXY = (int16_t*)malloc(W * H * 2 * sizeof(int16_t));
+*     uint16_t* mapFXY = (uint16_t*)malloc(W * H * sizeof(uint16_t));
+*
+*     ppl::cv::x86::FisheyeInitUndistortRectifyMap(H, W, K, D, nullptr, K, mapXY, mapFXY);
+*
+*     free(mapXY);
+*     free(mapFXY);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode FisheyeInitUndistortRectifyMap(
+    int32_t height,
+    int32_t width,
+    const double* cameraMatrix,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    int16_t* mapXY,
+    uint16_t* mapFXY);
+
+/**
+* @brief Removes the lens distortion of an image taken by a pinhole camera without storing maps.
+* @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input and output image, 1, 3 and 4 are supported.
+* @param height            input and output image's height
+* @param width             input and output image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+* @param outData           output image data
+* @param cameraMatrix      3x3 row-major camera matrix [fx 0 cx; 0 fy cy; 0 0 1]
+* @param distCoeffsNum     number of distortion coefficients, 0, 4, 5, 8, 12 or 14
+* @param distCoeffs        distortion coefficients (k1, k2, p1, p2[, k3[, k4, k5, k6[, s1, s2, s3, s4[, tx, ty]]]])
+* @param newCameraMatrix   3x3 row-major camera matrix of the output image, `cameraMatrix` is used if it is nullptr
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT and ppl::cv::BORDER_TYPE_REPLICATE
+* @param borderValue       value used by ppl::cv::BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The coordinates of every row are computed on the fly into a row buffer, quantized to
+*         1 / (1 << UNDISTORT_INTER_BITS) pixel like the fixed-point maps and bilinearly interpolated, so only
+*         O(width) extra memory is used per thread. The result is the same as cv::remap with the fixed-point maps of
+*         InitUndistortRectifyMap; against cv::undistort, which computes the coordinates in double precision, a few
+*         coordinates may round to the neighbouring 1 / (1 << UNDISTORT_INTER_BITS) step.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/undistort.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/undistort.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     const double K[9] = {500, 0, 320, 0, 500, 240, 0, 0, 1};
+*     const double D[5] = {-0.3, 0.1, 0.001, -0.001, 0};
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*
+*     ppl::cv::x86::Undistort<uint8_t, 3>(H, W, W * C, dev_iImage, W * C, dev_oImage, K, 5, D);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode Undistort(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    const double* cameraMatrix,
+    int32_t distCoeffsNum,
+    const double* distCoeffs,
+    const double* newCameraMatrix = nullptr,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T borderValue = 0);
+
+/**
+* @brief Removes the lens distortion of an image taken by a fisheye camera without storing maps.
+* @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input and output image, 1, 3 and 4 are supported.
+* @param height            input and output image's height
+* @param width             input and output image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+* @param outData           output image data
+* @param cameraMatrix      3x3 row-major camera matrix [fx 0 cx; 0 fy cy; 0 0 1]
+* @param distCoeffs        4 distortion coefficients (k1, k2, k3, k4) of the equidistant model
+* @param newCameraMatrix   3x3 row-major camera matrix of the output image, `cameraMatrix` is used if it is nullptr
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT and ppl::cv::BORDER_TYPE_REPLICATE
+* @param borderValue       value used by ppl::cv::BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Same as Undistort, the coordinates are computed on the fly and bilinearly interpolated with
+*         UNDISTORT_INTER_BITS fractional bits, the same as cv::remap with the fixed-point maps of
+*         FisheyeInitUndistortRectifyMap.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/undistort.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/undistort.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const double K[9] = {300, 0, 320, 0, 300, 240, 0, 0, 1};
+*     const double D[4] = {0.05, -0.01, 0.002, -0.0005};
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*
+*     ppl::cv::x86::FisheyeUndistort<uint8_t, 1>(H, W, W, dev_iImage, W, dev_oImage, K, D);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode FisheyeUndistort(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    const double* cameraMatrix,
+    const double* distCoeffs,
+    const double* newCameraMatrix = nullptr,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T borderValue = 0);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_UNDISTORT_H_
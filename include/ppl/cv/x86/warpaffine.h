@@ -26,7 +26,7 @@ namespace x86 {
 
 /**
 * @brief Affine transformation with nearest neighbor interpolation method
-* @tparam T The data type of input image and output image, currently only \a uint8_t and \a float are supported.
+* @tparam T The data type of input image and output image, currently only \a uint8_t, \a uint16_t and \a float are supported.
 * @tparam channels The number of channels of input image and output image, 1, 4 are supported.
 * @param height            input image's height
 * @param width             input image's width need to be processed
@@ -44,6 +44,9 @@ namespace x86 {
 * <tr><td>uint8_t(uint8_t)<td>1
 * <tr><td>uint8_t(uint8_t)<td>3
 * <tr><td>uint8_t(uint8_t)<td>4
+* <tr><td>uint16_t<td>1
+* <tr><td>uint16_t<td>3
+* <tr><td>uint16_t<td>4
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
@@ -91,7 +94,7 @@ template<typename T, int32_t numChannels>
 
 /**
 * @brief Affine transformation with linear interpolation method
-* @tparam T The data type of input image and output image, currently only \a uint8_t and \a float are supported.
+* @tparam T The data type of input image and output image, currently only \a uint8_t, \a uint16_t and \a float are supported.
 * @tparam channels The number of channels of input image and output image, 1, 4 are supported.
 * @param height            input image's height
 * @param width             input image's width need to be processed
@@ -109,6 +112,9 @@ template<typename T, int32_t numChannels>
 * <tr><td>uint8_t(uint8_t)<td>1
 * <tr><td>uint8_t(uint8_t)<td>3
 * <tr><td>uint8_t(uint8_t)<td>4
+* <tr><td>uint16_t<td>1
+* <tr><td>uint16_t<td>3
+* <tr><td>uint16_t<td>4
 * <tr><td>float<td>1
 * <tr><td>float<td>3
 * <tr><td>float<td>4
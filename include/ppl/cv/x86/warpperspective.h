@@ -106,6 +106,10 @@ template <typename T, int32_t numChannels>
 * @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT/ppl::cv::BORDER_TYPE_REPLICATE/ppl::cv::BORDER_TYPE_TRANSPARENT
 * @param border_value      border value for BORDER_TYPE_CONSTANT
 * @warning All input parameters must be valid, or undefined behaviour may occur.
+* @note The source coordinates are rounded to 1/32 pixel and blended with fixed-point weights like
+*       OpenCV does. A coordinate may still round to the neighbouring 1/32 step: on random uint8_t images
+*       with a mild keystone about 0.2-0.4% of the linear samples differ from cv::warpPerspective, by at most
+*       8 levels, and about 1e-4 of the nearest point samples come from the neighbouring pixel.
 * @remark The fllowing table show which data type and channels are supported.
 * <table>
 * <tr><th>Data type(T)<th>channels
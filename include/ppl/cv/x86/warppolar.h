@@ -0,0 +1,189 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_WARPPOLAR_H_
+#define __ST_HPC_PPL_CV_X86_WARPPOLAR_H_
+
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Remaps an image to polar or semilog-polar coordinates space with linear interpolation.
+* @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height. In the polar image rows are angles, so it is the number of angles
+* @param outWidth          output image's width. In the polar image columns are radii, so it is the number of radii
+* @param outWidthStride    output image's width stride, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param centerX           x coordinate of the transformation center in the cartesian image
+* @param centerY           y coordinate of the transformation center in the cartesian image
+* @param maxRadius         radius of the bounding circle to transform, it determines the inverse magnitude scale
+* @param mode              ppl::cv::WARP_POLAR_LINEAR or ppl::cv::WARP_POLAR_LOG
+* @param inverseMap        false to transform the cartesian input to the polar output, true to transform
+*                          the polar input back to the cartesian output
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT, ppl::cv::BORDER_TYPE_REPLICATE and
+*                          ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param borderValue       value used by ppl::cv::BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The coordinates follow cv::warpPolar. They are computed row by row in SIMD, from the sine and cosine of
+*         the row's angle in the forward transform and with vectorized atan2 and log in the inverse one, and
+*         sampled right away with the remap interpolation, so no map is stored. In the inverse transform the angle
+*         axis wraps around. Bands of rows run in parallel.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/warppolar.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/warppolar.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     const int32_t radii = 240;
+*     const int32_t angles = 720;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(radii * angles * C * sizeof(uint8_t));
+*
+*     ppl::cv::x86::WarpPolarLinear<uint8_t, 3>(H, W, W * C, dev_iImage, angles, radii, radii * C, dev_oImage,
+*                                                W / 2.f, H / 2.f, 240.0, ppl::cv::WARP_POLAR_LOG);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode WarpPolarLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    float centerX,
+    float centerY,
+    double maxRadius,
+    WarpPolarMode mode = WARP_POLAR_LINEAR,
+    bool inverseMap = false,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T borderValue = 0);
+
+/**
+* @brief Remaps an image to polar or semilog-polar coordinates space with nearest neighbor interpolation.
+* @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height. In the polar image rows are angles, so it is the number of angles
+* @param outWidth          output image's width. In the polar image columns are radii, so it is the number of radii
+* @param outWidthStride    output image's width stride, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param centerX           x coordinate of the transformation center in the cartesian image
+* @param centerY           y coordinate of the transformation center in the cartesian image
+* @param maxRadius         radius of the bounding circle to transform, it determines the inverse magnitude scale
+* @param mode              ppl::cv::WARP_POLAR_LINEAR or ppl::cv::WARP_POLAR_LOG
+* @param inverseMap        false to transform the cartesian input to the polar output, true to transform
+*                          the polar input back to the cartesian output
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT, ppl::cv::BORDER_TYPE_REPLICATE and
+*                          ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param borderValue       value used by ppl::cv::BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark Same as WarpPolarLinear, the coordinates are computed on the fly and no map is stored.
+*         The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>X86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/warppolar.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/warppolar.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t radii = 240;
+*     const int32_t angles = 720;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(radii * angles * sizeof(uint8_t));
+*
+*     ppl::cv::x86::WarpPolarNearestPoint<uint8_t, 1>(H, W, W, dev_iImage, angles, radii, radii, dev_oImage,
+*                                                      W / 2.f, H / 2.f, 240.0);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode WarpPolarNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    float centerX,
+    float centerY,
+    double maxRadius,
+    WarpPolarMode mode = WARP_POLAR_LINEAR,
+    bool inverseMap = false,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T borderValue = 0);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_WARPPOLAR_H_
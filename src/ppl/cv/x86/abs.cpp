@@ -44,6 +44,23 @@ void abs(float *dst, const float *src, int32_t n)
     }
 }
 
+// -32768 saturates to 32767
+template <>
+void abs(int16_t *dst, const int16_t *src, int32_t n)
+{
+    const __m128i vmax = _mm_set1_epi16(32767);
+    int32_t i          = 0;
+    for (; i <= n - 16; i += 16) {
+        __m128i v0 = _mm_abs_epi16(_mm_loadu_si128((const __m128i *)(src + i)));
+        __m128i v1 = _mm_abs_epi16(_mm_loadu_si128((const __m128i *)(src + i + 8)));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_min_epu16(v0, vmax));
+        _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_min_epu16(v1, vmax));
+    }
+    for (; i < n; ++i) {
+        dst[i] = src[i] == -32768 ? 32767 : (src[i] < 0 ? -src[i] : src[i]);
+    }
+}
+
 template <typename T, int32_t nc>
 ::ppl::common::RetCode Abs(
     int32_t height,
@@ -73,6 +90,10 @@ template ::ppl::common::RetCode Abs<int8_t, 1>(int32_t height, int32_t width, in
 template ::ppl::common::RetCode Abs<int8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const int8_t *inData, int32_t outWidthStride, int8_t *outData);
 template ::ppl::common::RetCode Abs<int8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const int8_t *inData, int32_t outWidthStride, int8_t *outData);
 
+template ::ppl::common::RetCode Abs<int16_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t *inData, int32_t outWidthStride, int16_t *outData);
+template ::ppl::common::RetCode Abs<int16_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t *inData, int32_t outWidthStride, int16_t *outData);
+template ::ppl::common::RetCode Abs<int16_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t *inData, int32_t outWidthStride, int16_t *outData);
+
 }
 }
 } // namespace ppl::cv::x86
@@ -24,11 +24,11 @@
 #include <random>
 
 template<typename T, int nc>
-void AbsTest(int height, int width) {
+void AbsTest(int height, int width, T minValue = -128, T maxValue = 127) {
     std::unique_ptr<T[]> src(new T[width * height * nc]);
     std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
     std::unique_ptr<T[]> dst(new T[width * height * nc]);
-    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, -128, 127);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, minValue, maxValue);
     ppl::cv::x86::Abs<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get());
     cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
     cv::Mat oMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
@@ -55,3 +55,13 @@ TEST(ABS_INT8, x86)
     AbsTest<int8_t, 4>(640, 720);
     AbsTest<int8_t, 4>(720, 1080);
 }
+
+TEST(ABS_INT16, x86)
+{
+    AbsTest<int16_t, 1>(640, 720, -32768, 32767);
+    AbsTest<int16_t, 1>(720, 1080, -32768, 32767);
+    AbsTest<int16_t, 3>(640, 720, -32768, 32767);
+    AbsTest<int16_t, 3>(720, 1080, -32768, 32767);
+    AbsTest<int16_t, 4>(640, 720, -32768, 32767);
+    AbsTest<int16_t, 4>(720, 1080, -32768, 32767);
+}
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/accumulateweighted.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+static inline __m128 load4_ps(const float *src)
+{
+    return _mm_loadu_ps(src);
+}
+
+static inline __m128 load4_ps(const uint8_t *src)
+{
+    int32_t packed;
+    memcpy(&packed, src, sizeof(packed));
+    return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+}
+
+template <typename T>
+static void accumulateRow(const T *src, int32_t len, float alpha, float *acc)
+{
+    const __m128 va = _mm_set1_ps(alpha), vb = _mm_set1_ps(1.f - alpha);
+    int32_t i = 0;
+    for (; i <= len - 8; i += 8) {
+        __m128 a0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(acc + i), vb), _mm_mul_ps(load4_ps(src + i), va));
+        __m128 a1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(acc + i + 4), vb), _mm_mul_ps(load4_ps(src + i + 4), va));
+        _mm_storeu_ps(acc + i, a0);
+        _mm_storeu_ps(acc + i + 4, a1);
+    }
+    for (; i < len; ++i) {
+        acc[i] = acc[i] * (1.f - alpha) + src[i] * alpha;
+    }
+}
+
+template <typename T, int32_t nc>
+::ppl::common::RetCode AccumulateWeighted(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    float alpha,
+    int32_t accWidthStride,
+    float *accData)
+{
+    if (nullptr == inData || nullptr == accData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * nc || accWidthStride < width * nc) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int32_t h = 0; h < height; ++h) {
+        accumulateRow(inData + h * inWidthStride, width * nc, alpha, accData + h * accWidthStride);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode AccumulateWeighted<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, float alpha, int32_t accWidthStride, float *accData);
+template ::ppl::common::RetCode AccumulateWeighted<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, float alpha, int32_t accWidthStride, float *accData);
+template ::ppl::common::RetCode AccumulateWeighted<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, float alpha, int32_t accWidthStride, float *accData);
+template ::ppl::common::RetCode AccumulateWeighted<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, float alpha, int32_t accWidthStride, float *accData);
+template ::ppl::common::RetCode AccumulateWeighted<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, float alpha, int32_t accWidthStride, float *accData);
+template ::ppl::common::RetCode AccumulateWeighted<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, float alpha, int32_t accWidthStride, float *accData);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/accumulateweighted.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+
+namespace {
+
+template<typename T, int32_t nc>
+void BM_AccumulateWeighted_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<float[]> acc(new float[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<float>(acc.get(), width * height * nc, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::AccumulateWeighted<T, nc>(height, width, width * nc, src.get(), 0.05f, width * nc, acc.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_AccumulateWeighted_ppl_x86, uint8_t, c1)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AccumulateWeighted_ppl_x86, uint8_t, c3)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AccumulateWeighted_ppl_x86, float, c1)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AccumulateWeighted_ppl_x86, float, c3)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename T, int32_t nc>
+void BM_AccumulateWeighted_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<float[]> acc(new float[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<float>(acc.get(), width * height * nc, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat accMat(height, width, CV_MAKETYPE(CV_32F, nc), acc.get());
+    for (auto _ : state) {
+        cv::accumulateWeighted(srcMat, accMat, 0.05);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_AccumulateWeighted_opencv_x86, uint8_t, c1)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AccumulateWeighted_opencv_x86, uint8_t, c3)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AccumulateWeighted_opencv_x86, float, c1)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AccumulateWeighted_opencv_x86, float, c3)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+#endif //! PPLCV_BENCHMARK_OPENCV
+}
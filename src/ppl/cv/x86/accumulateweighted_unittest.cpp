@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/accumulateweighted.h"
+#include "ppl/cv/x86/test.h"
+#include <opencv2/imgproc.hpp>
+#include <memory>
+#include <string.h>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include "ppl/common/retcode.h"
+
+template<typename T, int32_t nc>
+void AccumulateWeightedTest(int32_t height, int32_t width, float alpha) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<float[]> acc(new float[width * height * nc]);
+    std::unique_ptr<float[]> acc_ref(new float[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<float>(acc.get(), width * height * nc, 0, 255);
+    memcpy(acc_ref.get(), acc.get(), width * height * nc * sizeof(float));
+
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat accMat(height, width, CV_MAKETYPE(CV_32F, nc), acc_ref.get());
+    // two updates, the second one starts from a non-trivial running average
+    for (int32_t i = 0; i < 2; ++i) {
+        cv::accumulateWeighted(srcMat, accMat, alpha);
+        auto rst = ppl::cv::x86::AccumulateWeighted<T, nc>(height, width, width * nc, src.get(), alpha, width * nc, acc.get());
+        EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    }
+    checkResult<float, nc>(acc.get(), acc_ref.get(), height, width, width * nc, width * nc, 1e-3f);
+}
+
+TEST(ACCUMULATE_WEIGHTED_UINT8, x86)
+{
+    AccumulateWeightedTest<uint8_t, 1>(640, 720, 0.05f);
+    AccumulateWeightedTest<uint8_t, 3>(640, 720, 0.05f);
+    AccumulateWeightedTest<uint8_t, 4>(640, 720, 0.05f);
+
+    AccumulateWeightedTest<uint8_t, 1>(721, 1083, 0.5f);
+    AccumulateWeightedTest<uint8_t, 3>(721, 1083, 0.5f);
+    AccumulateWeightedTest<uint8_t, 4>(721, 1083, 0.5f);
+}
+
+TEST(ACCUMULATE_WEIGHTED_FP32, x86)
+{
+    AccumulateWeightedTest<float, 1>(640, 720, 0.05f);
+    AccumulateWeightedTest<float, 3>(640, 720, 0.05f);
+    AccumulateWeightedTest<float, 4>(640, 720, 0.05f);
+
+    AccumulateWeightedTest<float, 1>(721, 1083, 0.5f);
+    AccumulateWeightedTest<float, 3>(721, 1083, 0.5f);
+    AccumulateWeightedTest<float, 4>(721, 1083, 0.5f);
+}
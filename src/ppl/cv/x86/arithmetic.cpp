@@ -27,6 +27,7 @@
 #include <cmath>
 
 #include <limits.h>
+#include <algorithm>
 #include <immintrin.h>
 #ifdef _WIN32
 #include <algorithm>
@@ -438,6 +439,58 @@ template <int32_t channels>
     return ppl::common::RC_SUCCESS;
 }
 
+template <int32_t channels>
+::ppl::common::RetCode Subtract(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    const int16_t *scalar,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == scalar) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    if (height <= 0 ||
+        width <= 0 ||
+        inWidthStride <= 0 ||
+        outWidthStride <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    // 24 elements hold a whole number of pixels for 1, 3 and 4 channels
+    int16_t scalar_tmp[24];
+    for (int32_t i = 0; i < 24; ++i) {
+        scalar_tmp[i] = scalar[i % channels];
+    }
+    const __m128i vscalar0 = _mm_loadu_si128((const __m128i *)(scalar_tmp + 0));
+    const __m128i vscalar1 = _mm_loadu_si128((const __m128i *)(scalar_tmp + 8));
+    const __m128i vscalar2 = _mm_loadu_si128((const __m128i *)(scalar_tmp + 16));
+    const int32_t len      = width * channels;
+    for (int32_t h = 0; h < height; ++h) {
+        const int16_t *src = inData + h * inWidthStride;
+        int16_t *dst       = outData + h * outWidthStride;
+        int32_t i          = 0;
+        for (; i <= len - 24; i += 24) {
+            _mm_storeu_si128((__m128i *)(dst + i + 0), _mm_subs_epi16(_mm_loadu_si128((const __m128i *)(src + i + 0)), vscalar0));
+            _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_subs_epi16(_mm_loadu_si128((const __m128i *)(src + i + 8)), vscalar1));
+            _mm_storeu_si128((__m128i *)(dst + i + 16), _mm_subs_epi16(_mm_loadu_si128((const __m128i *)(src + i + 16)), vscalar2));
+        }
+        for (; i < len; ++i) {
+            dst[i] = (int16_t)std::min(std::max(src[i] - scalar[i % channels], -32768), 32767);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
 template <typename T, int32_t channels>
 ::ppl::common::RetCode Subtract(
     int32_t height,
@@ -470,6 +523,186 @@ template <typename T, int32_t channels>
     return ppl::common::RC_SUCCESS;
 }
 
+template <typename T, int32_t channels>
+::ppl::common::RetCode AbsDiff(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const T *inData0,
+    int32_t inWidthStride1,
+    const T *inData1,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride0 <= 0 || inWidthStride1 <= 0 || outWidthStride <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int32_t len = width * channels;
+    for (int32_t h = 0; h < height; ++h) {
+        const T *src0 = inData0 + h * inWidthStride0;
+        const T *src1 = inData1 + h * inWidthStride1;
+        T *dst        = outData + h * outWidthStride;
+        int32_t i     = 0;
+        if (std::is_same<T, uint8_t>::value) {
+            // |a - b| = (a -sat b) | (b -sat a)
+            for (; i <= len - 16; i += 16) {
+                __m128i va = _mm_loadu_si128((const __m128i *)(src0 + i));
+                __m128i vb = _mm_loadu_si128((const __m128i *)(src1 + i));
+                _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va)));
+            }
+        } else {
+            const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+            for (; i <= len - 4; i += 4) {
+                __m128 va = _mm_loadu_ps((const float *)(src0 + i));
+                __m128 vb = _mm_loadu_ps((const float *)(src1 + i));
+                _mm_storeu_ps((float *)(dst + i), _mm_and_ps(_mm_sub_ps(va, vb), signMask));
+            }
+        }
+        for (; i < len; ++i) {
+            dst[i] = src0[i] > src1[i] ? src0[i] - src1[i] : src1[i] - src0[i];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+// int16_t rows keep signed gradients and differences at half the bandwidth of float, every op
+// saturates like the 8-bit ones
+static inline int16_t sat_cast_s16(int32_t v)
+{
+    return (int16_t)std::min(std::max(v, -32768), 32767);
+}
+
+static bool arith_s16_valid(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    const int16_t *outData)
+{
+    return inData0 != nullptr && inData1 != nullptr && outData != nullptr && height > 0 && width > 0 &&
+           inWidthStride0 > 0 && inWidthStride1 > 0 && outWidthStride > 0;
+}
+
+template <int32_t channels>
+static ::ppl::common::RetCode add_s16(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (!arith_s16_valid(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int32_t len = width * channels;
+    for (int32_t h = 0; h < height; ++h) {
+        const int16_t *src0 = inData0 + h * inWidthStride0;
+        const int16_t *src1 = inData1 + h * inWidthStride1;
+        int16_t *dst        = outData + h * outWidthStride;
+        int32_t i           = 0;
+        for (; i <= len - 8; i += 8) {
+            __m128i va = _mm_loadu_si128((const __m128i *)(src0 + i));
+            __m128i vb = _mm_loadu_si128((const __m128i *)(src1 + i));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_adds_epi16(va, vb));
+        }
+        for (; i < len; ++i) {
+            dst[i] = sat_cast_s16(src0[i] + src1[i]);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <int32_t channels>
+static ::ppl::common::RetCode mul_s16(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData,
+    float alpha)
+{
+    if (!arith_s16_valid(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const bool unit     = std::abs(alpha - 1.0) < EPS;
+    const __m128 valpha = _mm_set1_ps(alpha);
+    const __m128 vmin   = _mm_set1_ps(-32768.0f);
+    const __m128 vmax   = _mm_set1_ps(32767.0f);
+    const int32_t len   = width * channels;
+    for (int32_t h = 0; h < height; ++h) {
+        const int16_t *src0 = inData0 + h * inWidthStride0;
+        const int16_t *src1 = inData1 + h * inWidthStride1;
+        int16_t *dst        = outData + h * outWidthStride;
+        int32_t i           = 0;
+        for (; i <= len - 8; i += 8) {
+            __m128i va  = _mm_loadu_si128((const __m128i *)(src0 + i));
+            __m128i vb  = _mm_loadu_si128((const __m128i *)(src1 + i));
+            // exact 32-bit products from the low and high halves
+            __m128i vml = _mm_mullo_epi16(va, vb);
+            __m128i vmh = _mm_mulhi_epi16(va, vb);
+            __m128i vlo = _mm_unpacklo_epi16(vml, vmh);
+            __m128i vhi = _mm_unpackhi_epi16(vml, vmh);
+            // clamped in float, the conversion turns values out of the int32_t range into INT_MIN
+            if (!unit) {
+                vlo = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(vlo), valpha), vmin), vmax));
+                vhi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(vhi), valpha), vmin), vmax));
+            }
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(vlo, vhi));
+        }
+        for (; i < len; ++i) {
+            int32_t product = src0[i] * src1[i];
+            dst[i]          = unit ? sat_cast_s16(product) : (int16_t)std::lrint(std::min(std::max((float)product * alpha, -32768.0f), 32767.0f));
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <int32_t channels>
+static ::ppl::common::RetCode absdiff_s16(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (!arith_s16_valid(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int32_t len = width * channels;
+    for (int32_t h = 0; h < height; ++h) {
+        const int16_t *src0 = inData0 + h * inWidthStride0;
+        const int16_t *src1 = inData1 + h * inWidthStride1;
+        int16_t *dst        = outData + h * outWidthStride;
+        int32_t i           = 0;
+        // max -sat min, differences past 32767 saturate
+        for (; i <= len - 8; i += 8) {
+            __m128i va = _mm_loadu_si128((const __m128i *)(src0 + i));
+            __m128i vb = _mm_loadu_si128((const __m128i *)(src1 + i));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_subs_epi16(_mm_max_epi16(va, vb), _mm_min_epi16(va, vb)));
+        }
+        for (; i < len; ++i) {
+            dst[i] = sat_cast_s16(std::abs(src0[i] - src1[i]));
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
 template ::ppl::common::RetCode Add<float, 1>(
     int32_t height,
     int32_t width,
@@ -737,6 +970,216 @@ template ::ppl::common::RetCode Subtract<uint8_t, 4>(
     const uint8_t *scalar,
     int32_t outWidthStride,
     uint8_t *outData);
+template ::ppl::common::RetCode AbsDiff<float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const float *inData0,
+    int32_t inWidthStride1,
+    const float *inData1,
+    int32_t outWidthStride,
+    float *outData);
+template ::ppl::common::RetCode AbsDiff<float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const float *inData0,
+    int32_t inWidthStride1,
+    const float *inData1,
+    int32_t outWidthStride,
+    float *outData);
+template ::ppl::common::RetCode AbsDiff<float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const float *inData0,
+    int32_t inWidthStride1,
+    const float *inData1,
+    int32_t outWidthStride,
+    float *outData);
+template ::ppl::common::RetCode AbsDiff<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const uint8_t *inData0,
+    int32_t inWidthStride1,
+    const uint8_t *inData1,
+    int32_t outWidthStride,
+    uint8_t *outData);
+template ::ppl::common::RetCode AbsDiff<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const uint8_t *inData0,
+    int32_t inWidthStride1,
+    const uint8_t *inData1,
+    int32_t outWidthStride,
+    uint8_t *outData);
+template ::ppl::common::RetCode AbsDiff<uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const uint8_t *inData0,
+    int32_t inWidthStride1,
+    const uint8_t *inData1,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template <>
+::ppl::common::RetCode Add<int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    return add_s16<1>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode Add<int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    return add_s16<3>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode Add<int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    return add_s16<4>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode Mul<int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData,
+    float alpha)
+{
+    return mul_s16<1>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData, alpha);
+}
+
+template <>
+::ppl::common::RetCode Mul<int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData,
+    float alpha)
+{
+    return mul_s16<3>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData, alpha);
+}
+
+template <>
+::ppl::common::RetCode Mul<int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData,
+    float alpha)
+{
+    return mul_s16<4>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData, alpha);
+}
+
+template <>
+::ppl::common::RetCode AbsDiff<int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    return absdiff_s16<1>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode AbsDiff<int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    return absdiff_s16<3>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode AbsDiff<int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const int16_t *inData0,
+    int32_t inWidthStride1,
+    const int16_t *inData1,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    return absdiff_s16<4>(height, width, inWidthStride0, inData0, inWidthStride1, inData1, outWidthStride, outData);
+}
+
+template ::ppl::common::RetCode Subtract<int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    const int16_t *scalar,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template ::ppl::common::RetCode Subtract<int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    const int16_t *scalar,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template ::ppl::common::RetCode Subtract<int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    const int16_t *scalar,
+    int32_t outWidthStride,
+    int16_t *outData);
 
 }
 }
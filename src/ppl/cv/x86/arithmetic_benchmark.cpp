@@ -23,7 +23,7 @@
 
 namespace {
 
-enum MATH_OP {ADD, SUB, MUL, DIV, MLA, MLS};
+enum MATH_OP {ADD, SUB, MUL, DIV, MLA, MLS, ABSDIFF};
 
 template<typename T, int32_t nc, MATH_OP op>
 void BM_MATH_ppl_x86(benchmark::State &state) {
@@ -52,6 +52,10 @@ void BM_MATH_ppl_x86(benchmark::State &state) {
             ppl::cv::debug::randomFill<T>(scl.get(), nc, 1, 255);
             ppl::cv::x86::Subtract<T, nc>(height, width, width * nc, src0.get(), scl.get(), width * nc, dst.get());
         }
+    } else if (op == ABSDIFF) {
+        for (auto _ : state) {
+            ppl::cv::x86::AbsDiff<T, nc>(height, width, width * nc, src0.get(), width * nc, src1.get(), width * nc, dst.get());
+        }
     }
     state.SetItemsProcessed(state.iterations() * 1);
 }
@@ -79,6 +83,12 @@ BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, uint8_t, 4, SUB)->Args({320, 240})->Args({64
 BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, uint8_t, 1, MUL)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, uint8_t, 3, MUL)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, uint8_t, 4, MUL)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, float, 1, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, float, 3, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, float, 4, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, uint8_t, 1, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, uint8_t, 3, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_ppl_x86, uint8_t, 4, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 
 #ifdef PPLCV_BENCHMARK_OPENCV
 template<typename T, int32_t nc, MATH_OP op>
@@ -117,6 +127,10 @@ static void BM_MATH_opencv_x86(benchmark::State &state)
             }
             cv::subtract(src0Mat, scl, resultMat);
         }
+    } else if (op == ABSDIFF) {
+        for (auto _ : state) {
+            cv::absdiff(src0Mat, src1Mat, resultMat);
+        }
     }
     state.SetItemsProcessed(state.iterations() * 1);
 }
@@ -142,5 +156,11 @@ BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, uint8_t, 4, SUB)->Args({320, 240})->Args(
 BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, uint8_t, 1, MUL)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, uint8_t, 3, MUL)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, uint8_t, 4, MUL)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, float, 1, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, float, 3, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, float, 4, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, uint8_t, 1, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, uint8_t, 3, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MATH_opencv_x86, uint8_t, 4, ABSDIFF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 #endif //! PPLCV_BENCHMARK_OPENCV
 }
@@ -23,13 +23,13 @@
 #include <opencv2/imgproc.hpp>
 
 template<typename T, int32_t nc>
-void ADD_Test(int32_t height, int32_t width) {
+void ADD_Test(int32_t height, int32_t width, T minValue = 1, T maxValue = 255) {
     std::unique_ptr<T[]> src0(new T[width * height * nc]);
     std::unique_ptr<T[]> src1(new T[width * height * nc]);
     std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
     std::unique_ptr<T[]> dst(new T[width * height * nc]);
-    ppl::cv::debug::randomFill<T>(src0.get(), width * height * nc, 1, 255);
-    ppl::cv::debug::randomFill<T>(src1.get(), width * height * nc, 1, 255);
+    ppl::cv::debug::randomFill<T>(src0.get(), width * height * nc, minValue, maxValue);
+    ppl::cv::debug::randomFill<T>(src1.get(), width * height * nc, minValue, maxValue);
     cv::Mat adder0(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src0.get());
     cv::Mat adder1(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src1.get());
     cv::Mat result(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
@@ -39,12 +39,12 @@ void ADD_Test(int32_t height, int32_t width) {
 }
 
 template<typename T, int32_t nc>
-void SUB_Test(int32_t height, int32_t width) {
+void SUB_Test(int32_t height, int32_t width, T minValue = 1, T maxValue = 255) {
     std::unique_ptr<T[]> src(new T[width * height * nc]);
     std::unique_ptr<T[]> inScalar(new T[nc]);
     std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
     std::unique_ptr<T[]> dst(new T[width * height * nc]);
-    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 1, 255);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, minValue, maxValue);
     ppl::cv::debug::randomFill<T>(inScalar.get(), nc, 1, 255);
     cv::Mat suber(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
     cv::Mat result(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
@@ -59,13 +59,29 @@ void SUB_Test(int32_t height, int32_t width) {
 }
 
 template<typename T, int32_t nc>
-void MUL_Test(int32_t height, int32_t width) {
+void ABSDIFF_Test(int32_t height, int32_t width, T minValue = 0, T maxValue = 255) {
     std::unique_ptr<T[]> src0(new T[width * height * nc]);
     std::unique_ptr<T[]> src1(new T[width * height * nc]);
     std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
     std::unique_ptr<T[]> dst(new T[width * height * nc]);
-    ppl::cv::debug::randomFill<T>(src0.get(), width * height * nc, 1, 255);
-    ppl::cv::debug::randomFill<T>(src1.get(), width * height * nc, 1, 255);
+    ppl::cv::debug::randomFill<T>(src0.get(), width * height * nc, minValue, maxValue);
+    ppl::cv::debug::randomFill<T>(src1.get(), width * height * nc, minValue, maxValue);
+    cv::Mat src0Mat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src0.get());
+    cv::Mat src1Mat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src1.get());
+    cv::Mat result(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    cv::absdiff(src0Mat, src1Mat, result);
+    ppl::cv::x86::AbsDiff<T, nc>(height, width, width * nc, src0.get(), width * nc, src1.get(), width * nc, dst.get());
+    checkResult<T, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, 1e-5f);
+}
+
+template<typename T, int32_t nc>
+void MUL_Test(int32_t height, int32_t width, T minValue = 1, T maxValue = 255) {
+    std::unique_ptr<T[]> src0(new T[width * height * nc]);
+    std::unique_ptr<T[]> src1(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src0.get(), width * height * nc, minValue, maxValue);
+    ppl::cv::debug::randomFill<T>(src1.get(), width * height * nc, minValue, maxValue);
     cv::Mat mulplier0(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src0.get());
     cv::Mat mulplier1(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src1.get());
     cv::Mat result(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
@@ -225,3 +241,66 @@ TEST(MlsTestFP32, x86)
         Mls_Test<float>(i);
     }
 }
+
+TEST(ABSDIFF_FP32, x86)
+{
+    ABSDIFF_Test<float, 1>(640, 720);
+    ABSDIFF_Test<float, 3>(640, 720);
+    ABSDIFF_Test<float, 4>(640, 720);
+
+    ABSDIFF_Test<float, 1>(721, 1083);
+    ABSDIFF_Test<float, 3>(721, 1083);
+    ABSDIFF_Test<float, 4>(721, 1083);
+}
+
+TEST(ABSDIFF_UINT8, x86)
+{
+    ABSDIFF_Test<uint8_t, 1>(640, 720);
+    ABSDIFF_Test<uint8_t, 3>(640, 720);
+    ABSDIFF_Test<uint8_t, 4>(640, 720);
+
+    ABSDIFF_Test<uint8_t, 1>(721, 1083);
+    ABSDIFF_Test<uint8_t, 3>(721, 1083);
+    ABSDIFF_Test<uint8_t, 4>(721, 1083);
+}
+
+// signed 16-bit data over its whole range, results saturate like OpenCV
+TEST(ADD_INT16, x86)
+{
+    ADD_Test<int16_t, 1>(640, 720, -32768, 32767);
+    ADD_Test<int16_t, 3>(640, 720, -32768, 32767);
+    ADD_Test<int16_t, 4>(640, 720, -32768, 32767);
+    ADD_Test<int16_t, 1>(720, 1080, -32768, 32767);
+    ADD_Test<int16_t, 3>(720, 1080, -32768, 32767);
+    ADD_Test<int16_t, 4>(720, 1080, -32768, 32767);
+}
+
+TEST(SUB_INT16, x86)
+{
+    SUB_Test<int16_t, 1>(640, 720, -32768, 32767);
+    SUB_Test<int16_t, 3>(640, 720, -32768, 32767);
+    SUB_Test<int16_t, 4>(640, 720, -32768, 32767);
+    SUB_Test<int16_t, 1>(720, 1080, -32768, 32767);
+    SUB_Test<int16_t, 3>(720, 1080, -32768, 32767);
+    SUB_Test<int16_t, 4>(720, 1080, -32768, 32767);
+}
+
+TEST(ABSDIFF_INT16, x86)
+{
+    ABSDIFF_Test<int16_t, 1>(640, 720, -32768, 32767);
+    ABSDIFF_Test<int16_t, 3>(640, 720, -32768, 32767);
+    ABSDIFF_Test<int16_t, 4>(640, 720, -32768, 32767);
+    ABSDIFF_Test<int16_t, 1>(720, 1080, -32768, 32767);
+    ABSDIFF_Test<int16_t, 3>(720, 1080, -32768, 32767);
+    ABSDIFF_Test<int16_t, 4>(720, 1080, -32768, 32767);
+}
+
+TEST(MUL_INT16, x86)
+{
+    MUL_Test<int16_t, 1>(640, 720, -32768, 32767);
+    MUL_Test<int16_t, 3>(640, 720, -32768, 32767);
+    MUL_Test<int16_t, 4>(640, 720, -32768, 32767);
+    MUL_Test<int16_t, 1>(720, 1080, -32768, 32767);
+    MUL_Test<int16_t, 3>(720, 1080, -32768, 32767);
+    MUL_Test<int16_t, 4>(720, 1080, -32768, 32767);
+}
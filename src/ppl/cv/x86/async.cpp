@@ -0,0 +1,291 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/async.h"
+#include "ppl/common/retcode.h"
+
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <condition_variable>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+struct AsyncJob;
+
+struct AsyncEventState {
+    std::mutex mutex;
+    std::condition_variable doneCond;
+    bool done;
+    ::ppl::common::RetCode rc;
+    // jobs waiting for this one, released when it is done
+    std::vector<std::shared_ptr<AsyncJob>> dependents;
+
+    AsyncEventState()
+        : done(false)
+        , rc(ppl::common::RC_SUCCESS) {}
+};
+
+struct AsyncJob {
+    AsyncTask task;
+    std::shared_ptr<AsyncEventState> state;
+    AsyncExecutorImpl* owner;
+    // unfinished dependencies, plus one held by the submission until all of them are registered
+    std::atomic<int32_t> pending;
+    // error of the first failed dependency
+    std::atomic<int32_t> failure;
+};
+
+struct AsyncExecutorImpl {
+    std::mutex mutex;
+    std::condition_variable workCond;  // a job is ready, or the workers stop
+    std::condition_variable spaceCond; // a job is done
+    std::deque<std::shared_ptr<AsyncJob>> ready;
+    std::vector<std::thread> workers;
+    int32_t inFlight;
+    int32_t maxInFlight;
+    bool stop;
+};
+
+static void async_enqueue(const std::shared_ptr<AsyncJob>& job)
+{
+    AsyncExecutorImpl* impl = job->owner;
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->ready.push_back(job);
+    }
+    impl->workCond.notify_one();
+}
+
+static void async_complete(const std::shared_ptr<AsyncJob>& job, ::ppl::common::RetCode rc)
+{
+    std::vector<std::shared_ptr<AsyncJob>> dependents;
+    {
+        std::lock_guard<std::mutex> lock(job->state->mutex);
+        job->state->done = true;
+        job->state->rc   = rc;
+        dependents.swap(job->state->dependents);
+    }
+    job->state->doneCond.notify_all();
+
+    for (size_t i = 0; i < dependents.size(); ++i) {
+        if (rc != ppl::common::RC_SUCCESS) {
+            int32_t expected = ppl::common::RC_SUCCESS;
+            dependents[i]->failure.compare_exchange_strong(expected, rc);
+        }
+        if (--dependents[i]->pending == 0) {
+            async_enqueue(dependents[i]);
+        }
+    }
+
+    AsyncExecutorImpl* impl = job->owner;
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        --impl->inFlight;
+    }
+    impl->spaceCond.notify_all();
+}
+
+static void async_worker(AsyncExecutorImpl* impl)
+{
+    for (;;) {
+        std::shared_ptr<AsyncJob> job;
+        {
+            std::unique_lock<std::mutex> lock(impl->mutex);
+            while (impl->ready.empty() && !impl->stop) {
+                impl->workCond.wait(lock);
+            }
+            if (impl->ready.empty()) {
+                return;
+            }
+            job = impl->ready.front();
+            impl->ready.pop_front();
+        }
+        ::ppl::common::RetCode rc = (::ppl::common::RetCode)job->failure.load();
+        if (rc == ppl::common::RC_SUCCESS) {
+            rc = job->task();
+        }
+        // releases whatever the task holds before its waiters wake up
+        job->task = AsyncTask();
+        async_complete(job, rc);
+    }
+}
+
+// queues a job behind the unfinished events of deps, empty ones are ignored. Returns an empty state when the
+// executor is full and block is false
+static std::shared_ptr<AsyncEventState> async_submit(
+    AsyncExecutorImpl* impl,
+    const AsyncTask& task,
+    const std::vector<std::shared_ptr<AsyncEventState>>& deps,
+    bool block)
+{
+    {
+        std::unique_lock<std::mutex> lock(impl->mutex);
+        if (impl->inFlight >= impl->maxInFlight && !block) {
+            return std::shared_ptr<AsyncEventState>();
+        }
+        while (impl->inFlight >= impl->maxInFlight) {
+            impl->spaceCond.wait(lock);
+        }
+        ++impl->inFlight;
+    }
+
+    std::shared_ptr<AsyncJob> job = std::make_shared<AsyncJob>();
+    job->task                     = task;
+    job->state                    = std::make_shared<AsyncEventState>();
+    job->owner                    = impl;
+    job->pending                  = 1;
+    job->failure                  = ppl::common::RC_SUCCESS;
+    for (size_t i = 0; i < deps.size(); ++i) {
+        AsyncEventState* dep = deps[i].get();
+        if (dep == NULL) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(dep->mutex);
+        if (!dep->done) {
+            ++job->pending;
+            dep->dependents.push_back(job);
+        } else if (dep->rc != ppl::common::RC_SUCCESS) {
+            int32_t expected = ppl::common::RC_SUCCESS;
+            job->failure.compare_exchange_strong(expected, dep->rc);
+        }
+    }
+    std::shared_ptr<AsyncEventState> state = job->state;
+    if (--job->pending == 0) {
+        async_enqueue(job);
+    }
+    return state;
+}
+
+AsyncEvent::AsyncEvent() {}
+
+AsyncEvent::AsyncEvent(const std::shared_ptr<AsyncEventState>& state)
+    : state_(state) {}
+
+bool AsyncEvent::Ready() const
+{
+    if (!state_) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->done;
+}
+
+::ppl::common::RetCode AsyncEvent::Wait() const
+{
+    if (!state_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    while (!state_->done) {
+        state_->doneCond.wait(lock);
+    }
+    return state_->rc;
+}
+
+AsyncExecutor::AsyncExecutor(const AsyncExecutorParams& params)
+{
+    impl_              = new AsyncExecutorImpl();
+    impl_->inFlight    = 0;
+    impl_->maxInFlight = std::max(params.maxInFlight, 1);
+    impl_->stop        = false;
+    const int32_t workers = std::max(params.workers, 1);
+    for (int32_t i = 0; i < workers; ++i) {
+        impl_->workers.push_back(std::thread(async_worker, impl_));
+    }
+}
+
+AsyncExecutor::~AsyncExecutor()
+{
+    WaitAll();
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        impl_->stop = true;
+    }
+    impl_->workCond.notify_all();
+    for (size_t i = 0; i < impl_->workers.size(); ++i) {
+        impl_->workers[i].join();
+    }
+    delete impl_;
+}
+
+AsyncEvent AsyncExecutor::Submit(const AsyncTask& task, const AsyncEvent* deps, int32_t numDeps)
+{
+    std::vector<std::shared_ptr<AsyncEventState>> states;
+    for (int32_t i = 0; deps != NULL && i < numDeps; ++i) {
+        states.push_back(deps[i].state_);
+    }
+    return AsyncEvent(async_submit(impl_, task, states, true));
+}
+
+AsyncEvent AsyncExecutor::TrySubmit(const AsyncTask& task, const AsyncEvent* deps, int32_t numDeps)
+{
+    std::vector<std::shared_ptr<AsyncEventState>> states;
+    for (int32_t i = 0; deps != NULL && i < numDeps; ++i) {
+        states.push_back(deps[i].state_);
+    }
+    return AsyncEvent(async_submit(impl_, task, states, false));
+}
+
+struct AsyncGraphTask {
+    const OpGraph* graph;
+    int32_t inWidthStride;
+    const void* inData;
+    int32_t outWidthStride;
+    void* outData;
+
+    ::ppl::common::RetCode operator()() const
+    {
+        return graph->Execute(inWidthStride, inData, outWidthStride, outData);
+    }
+};
+
+AsyncEvent AsyncExecutor::Submit(
+    const OpGraph& graph,
+    int32_t inWidthStride,
+    const void* inData,
+    int32_t outWidthStride,
+    void* outData,
+    const AsyncEvent* deps,
+    int32_t numDeps)
+{
+    AsyncGraphTask task = {&graph, inWidthStride, inData, outWidthStride, outData};
+    return Submit(AsyncTask(task), deps, numDeps);
+}
+
+void AsyncExecutor::WaitAll()
+{
+    std::unique_lock<std::mutex> lock(impl_->mutex);
+    while (impl_->inFlight > 0) {
+        impl_->spaceCond.wait(lock);
+    }
+}
+
+int32_t AsyncExecutor::InFlight() const
+{
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->inFlight;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/async.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// overhead of the async layer on a small operation, submitted and waited for at once
+void BM_AsyncSubmitWait_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3 / 2]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3 / 2, 0, 255);
+    const uint8_t *in = src.get();
+    uint8_t *out = dst.get();
+    ppl::cv::x86::AsyncExecutor executor;
+    for (auto _ : state) {
+        executor.Submit([=]() {
+            return ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, in, width * 3, out);
+        }).Wait();
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_AsyncSubmitWaitDirect_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3 / 2]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3 / 2, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+// the conversion of the next frame overlaps with a blur of the current one standing for the inference, which
+// runs on the calling thread
+void BM_AsyncPipeline_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3 / 2]);
+    std::unique_ptr<uint8_t[]> bgr(new uint8_t[2 * width * height * 3]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3 / 2, 0, 255);
+    const uint8_t *in = src.get();
+    ppl::cv::x86::AsyncExecutor executor;
+    int32_t frame = 0;
+    uint8_t *next = bgr.get();
+    ppl::cv::x86::AsyncEvent ready = executor.Submit([=]() {
+        return ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, in, width * 3, next);
+    });
+    for (auto _ : state) {
+        ready.Wait();
+        uint8_t *current = bgr.get() + (frame % 2) * width * height * 3;
+        next = bgr.get() + ((frame + 1) % 2) * width * height * 3;
+        ready = executor.Submit([=]() {
+            return ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, in, width * 3, next);
+        });
+        ppl::cv::x86::GaussianBlur<uint8_t, 3>(height, width, width * 3, current, 7, 2.f, width * 3, dst.get());
+        ++frame;
+    }
+    ready.Wait();
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_AsyncPipelineSync_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3 / 2]);
+    std::unique_ptr<uint8_t[]> bgr(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3 / 2, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, src.get(), width * 3, bgr.get());
+        ppl::cv::x86::GaussianBlur<uint8_t, 3>(height, width, width * 3, bgr.get(), 7, 2.f, width * 3, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+BENCHMARK(BM_AsyncSubmitWait_ppl_x86)->Args({64, 64})->Args({640, 480});
+BENCHMARK(BM_AsyncSubmitWaitDirect_ppl_x86)->Args({64, 64})->Args({640, 480});
+BENCHMARK(BM_AsyncPipeline_ppl_x86)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK(BM_AsyncPipelineSync_ppl_x86)->Args({640, 480})->Args({1920, 1080});
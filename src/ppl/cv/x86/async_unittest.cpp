@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/async.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/test.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+// NV122BGR -> ResizeLinear per frame, chained by events, must match the synchronous calls
+void AsyncChainTest(int32_t frames, int32_t height, int32_t width, int32_t workers)
+{
+    const int32_t outHeight = height / 2, outWidth = width / 2;
+    std::vector<uint8_t> src((size_t)frames * height * width * 3 / 2);
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+    std::vector<uint8_t> bgr((size_t)frames * height * width * 3), dst((size_t)frames * outHeight * outWidth * 3);
+    std::vector<uint8_t> expected(dst.size()), tmp((size_t)height * width * 3);
+
+    ppl::cv::x86::AsyncExecutorParams params;
+    params.workers     = workers;
+    params.maxInFlight = 4;
+    ppl::cv::x86::AsyncExecutor executor(params);
+    std::vector<ppl::cv::x86::AsyncEvent> done(frames);
+    for (int32_t f = 0; f < frames; ++f) {
+        const uint8_t* in = src.data() + (size_t)f * height * width * 3 / 2;
+        uint8_t* mid      = bgr.data() + (size_t)f * height * width * 3;
+        uint8_t* out      = dst.data() + (size_t)f * outHeight * outWidth * 3;
+        ppl::cv::x86::AsyncEvent converted = executor.Submit([=]() {
+            return ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, in, width * 3, mid);
+        });
+        ASSERT_TRUE(converted.Valid());
+        done[f] = executor.Submit([=]() {
+            return ppl::cv::x86::ResizeLinear<uint8_t, 3>(height, width, width * 3, mid, outHeight, outWidth, outWidth * 3, out);
+        }, &converted, 1);
+        EXPECT_LE(executor.InFlight(), 4);
+    }
+    for (int32_t f = 0; f < frames; ++f) {
+        EXPECT_EQ(ppl::common::RC_SUCCESS, done[f].Wait());
+        EXPECT_TRUE(done[f].Ready());
+        ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, src.data() + (size_t)f * height * width * 3 / 2, width * 3, tmp.data());
+        ppl::cv::x86::ResizeLinear<uint8_t, 3>(height, width, width * 3, tmp.data(), outHeight, outWidth, outWidth * 3, expected.data() + (size_t)f * outHeight * outWidth * 3);
+    }
+    checkResult<uint8_t, 3>(expected.data(), dst.data(), frames * outHeight, outWidth, outWidth * 3, outWidth * 3, 0.01f);
+}
+
+TEST(Async_Chain, x86)
+{
+    AsyncChainTest(8, 480, 640, 1);
+    AsyncChainTest(6, 240, 320, 3);
+}
+
+// a latch opened once, the tasks of the tests block on it instead of sleeping
+class AsyncTestGate {
+public:
+    AsyncTestGate()
+        : open_(false) {}
+    void Open()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            open_ = true;
+        }
+        cond_.notify_all();
+    }
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!open_) {
+            cond_.wait(lock);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool open_;
+};
+
+// a diamond a -> (b, c) -> d on several workers: d runs last, b and c after a
+TEST(Async_Dependencies, x86)
+{
+    ppl::cv::x86::AsyncExecutorParams params;
+    params.workers = 3;
+    ppl::cv::x86::AsyncExecutor executor(params);
+    AsyncTestGate gate;
+    std::mutex mutex;
+    std::vector<int32_t> order;
+    auto record = [&](int32_t id) {
+        return [&, id]() {
+            if (id == 0) {
+                gate.Wait();
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+            return ppl::common::RC_SUCCESS;
+        };
+    };
+    ppl::cv::x86::AsyncEvent a     = executor.Submit(record(0));
+    ppl::cv::x86::AsyncEvent b     = executor.Submit(record(1), &a, 1);
+    ppl::cv::x86::AsyncEvent c     = executor.Submit(record(2), &a, 1);
+    ppl::cv::x86::AsyncEvent bc[3] = {b, c, ppl::cv::x86::AsyncEvent()};
+    ppl::cv::x86::AsyncEvent d     = executor.Submit(record(3), bc, 3);
+    // a is held by the gate, so nothing which depends on it can be done, whatever the free workers
+    EXPECT_FALSE(a.Ready());
+    EXPECT_FALSE(b.Ready() || c.Ready() || d.Ready());
+    gate.Open();
+    EXPECT_EQ(ppl::common::RC_SUCCESS, d.Wait());
+    ASSERT_EQ(4u, order.size());
+    EXPECT_EQ(0, order[0]);
+    EXPECT_EQ(3, order[3]);
+}
+
+// a failure skips the tasks which depend on it and is reported by their events
+TEST(Async_Failure, x86)
+{
+    ppl::cv::x86::AsyncExecutor executor;
+    std::atomic<int32_t> runs(0);
+    ppl::cv::x86::AsyncEvent failed = executor.Submit([&]() {
+        ++runs;
+        return ppl::common::RC_INVALID_VALUE;
+    });
+    ppl::cv::x86::AsyncEvent skipped = executor.Submit([&]() {
+        ++runs;
+        return ppl::common::RC_SUCCESS;
+    }, &failed, 1);
+    ppl::cv::x86::AsyncEvent chained = executor.Submit([&]() {
+        ++runs;
+        return ppl::common::RC_SUCCESS;
+    }, &skipped, 1);
+    ppl::cv::x86::AsyncEvent independent = executor.Submit([&]() {
+        ++runs;
+        return ppl::common::RC_SUCCESS;
+    });
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, chained.Wait());
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, skipped.Wait());
+    EXPECT_EQ(ppl::common::RC_SUCCESS, independent.Wait());
+    EXPECT_EQ(2, runs.load());
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::AsyncEvent().Wait());
+}
+
+// tasks held by a gate fill the queue: TrySubmit() refuses, Submit() waits until one is done
+TEST(Async_Backpressure, x86)
+{
+    ppl::cv::x86::AsyncExecutorParams params;
+    params.maxInFlight = 2;
+    ppl::cv::x86::AsyncExecutor executor(params);
+    AsyncTestGate started, gate;
+    auto blocked = [&]() {
+        started.Open();
+        gate.Wait();
+        return ppl::common::RC_SUCCESS;
+    };
+    ppl::cv::x86::AsyncEvent first  = executor.Submit(blocked);
+    ppl::cv::x86::AsyncEvent second = executor.Submit(blocked);
+    EXPECT_EQ(2, executor.InFlight());
+    EXPECT_FALSE(executor.TrySubmit(blocked).Valid());
+    EXPECT_FALSE(first.Ready());
+
+    std::atomic<bool> submitted(false);
+    ppl::cv::x86::AsyncEvent third;
+    std::thread submitter([&]() {
+        third     = executor.Submit(blocked);
+        submitted = true;
+    });
+    // the worker holds the first task, the queue stays full until the gate opens
+    started.Wait();
+    EXPECT_FALSE(submitted.load());
+    gate.Open();
+    submitter.join();
+    EXPECT_TRUE(first.Ready());
+    executor.WaitAll();
+    EXPECT_EQ(0, executor.InFlight());
+    EXPECT_TRUE(second.Ready() && third.Ready());
+}
+
+TEST(Async_OpGraph, x86)
+{
+    const int32_t height = 360, width = 480;
+    std::vector<uint8_t> src((size_t)height * width * 3), dst(src.size()), expected(src.size());
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+    ppl::cv::x86::OpGraph graph(height, width, 3, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddGaussianBlur(5, 1.f));
+
+    ppl::cv::x86::AsyncExecutor executor;
+    ppl::cv::x86::AsyncEvent done = executor.Submit(graph, width * 3, src.data(), width * 3, dst.data());
+    ppl::cv::x86::GaussianBlur<uint8_t, 3>(height, width, width * 3, src.data(), 5, 1.f, width * 3, expected.data());
+    EXPECT_EQ(ppl::common::RC_SUCCESS, done.Wait());
+    checkResult<uint8_t, 3>(expected.data(), dst.data(), height, width, width * 3, width * 3, 0.01f);
+}
@@ -0,0 +1,439 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/backgroundsubtractor.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define MOG2_MAX_MIXTURES   8
+#define MOG2_MAX_CHANNELS   3
+#define MOG2_WEIGHT_SCALE   65535.f
+#define MOG2_MOMENT_SCALE   256.f
+
+// the parameters of mode m are stored in planes: weight m, variance nmixtures + m and mean component c
+// at 2 * nmixtures + m * channels + c. Plane rows are padded to a multiple of 4 pixels
+struct BackgroundModelBuffers {
+    int32_t stride;
+    size_t planeSize;
+    void *planes;
+};
+
+struct Mog2Constants {
+    int32_t nmixtures;
+    float alphaT;
+    float alpha1;
+    float prune;
+    float Tb;
+    float Tg;
+    float TB;
+    float varInit;
+    float varMin;
+    float varMax;
+    float tau;
+    bool detectShadows;
+    uint8_t shadowValue;
+};
+
+static inline __m128 load_param(const float *p, float)
+{
+    return _mm_loadu_ps(p);
+}
+
+static inline __m128 load_param(const uint16_t *p, float scale)
+{
+    __m128i v = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)p));
+    return _mm_mul_ps(_mm_cvtepi32_ps(v), _mm_set1_ps(1.f / scale));
+}
+
+static inline void store_param(float *p, __m128 v, float)
+{
+    _mm_storeu_ps(p, v);
+}
+
+static inline void store_param(uint16_t *p, __m128 v, float scale)
+{
+    __m128i i = _mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(scale)));
+    _mm_storel_epi64((__m128i *)p, _mm_packus_epi32(i, i));
+}
+
+static inline __m128 blend(__m128 a, __m128 b, __m128 mask)
+{
+    return _mm_blendv_ps(a, b, mask);
+}
+
+// loads 4 pixels as one float vector per channel, reads exactly 4 * nc bytes
+template <int32_t nc>
+static inline void load_pixels(const uint8_t *src, __m128 *x)
+{
+    if (nc == 1) {
+        int32_t packed;
+        memcpy(&packed, src, sizeof(packed));
+        x[0] = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+    } else {
+        int64_t lo;
+        int32_t hi;
+        memcpy(&lo, src, sizeof(lo));
+        memcpy(&hi, src + 8, sizeof(hi));
+        __m128i v = _mm_insert_epi32(_mm_cvtsi64_si128(lo), hi, 2);
+        v         = _mm_shuffle_epi8(v, _mm_setr_epi8(0, 3, 6, 9, 1, 4, 7, 10, 2, 5, 8, 11, -1, -1, -1, -1));
+        x[0]      = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(v));
+        x[1]      = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+        x[2]      = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+    }
+}
+
+// lanes where mode j comes before mode i in the order of decreasing weight, ties are broken by the index
+static inline __m128 ranks_before(__m128 wj, __m128 wi, int32_t j, int32_t i)
+{
+    return j < i ? _mm_cmpge_ps(wj, wi) : _mm_cmpgt_ps(wj, wi);
+}
+
+// one MOG2 step for 4 pixels. The modes are kept in fixed slots instead of being sorted by weight, the
+// sums of heavier weights that the sorted implementation accumulates are computed by pairwise comparisons
+template <typename P, int32_t nc>
+static void mog2_block(const Mog2Constants &k, const __m128 *x, P **planes, size_t offset, __m128 *maskOut)
+{
+    const int32_t K = k.nmixtures;
+    P **wp = planes, **vp = planes + K, **mp = planes + 2 * K;
+    const __m128 zero = _mm_setzero_ps();
+
+    __m128 w[MOG2_MAX_MIXTURES], var[MOG2_MAX_MIXTURES], mean[MOG2_MAX_MIXTURES][MOG2_MAX_CHANNELS];
+    __m128 d2[MOG2_MAX_MIXTURES], fit[MOG2_MAX_MIXTURES], decayed[MOG2_MAX_MIXTURES];
+    for (int32_t m = 0; m < K; ++m) {
+        w[m]       = load_param(wp[m] + offset, MOG2_WEIGHT_SCALE);
+        var[m]     = load_param(vp[m] + offset, MOG2_MOMENT_SCALE);
+        d2[m]      = zero;
+        for (int32_t c = 0; c < nc; ++c) {
+            mean[m][c] = load_param(mp[m * nc + c] + offset, MOG2_MOMENT_SCALE);
+            __m128 d   = _mm_sub_ps(mean[m][c], x[c]);
+            d2[m]      = _mm_add_ps(d2[m], _mm_mul_ps(d, d));
+        }
+        __m128 active = _mm_cmpgt_ps(w[m], zero);
+        fit[m]        = _mm_and_ps(active, _mm_cmplt_ps(d2[m], _mm_mul_ps(_mm_set1_ps(k.Tg), var[m])));
+        decayed[m]    = _mm_and_ps(active, _mm_add_ps(_mm_mul_ps(w[m], _mm_set1_ps(k.alpha1)), _mm_set1_ps(k.prune)));
+    }
+
+    // the first matching mode in weight order is updated, the modes up to it decide the background
+    __m128 anyFit = zero, background = zero;
+    __m128 best[MOG2_MAX_MIXTURES];
+    for (int32_t i = 0; i < K; ++i) {
+        __m128 fitBefore = zero, cum = zero;
+        for (int32_t j = 0; j < K; ++j) {
+            if (j == i) continue;
+            __m128 before = _mm_and_ps(ranks_before(w[j], w[i], j, i), _mm_cmpgt_ps(w[j], zero));
+            fitBefore     = _mm_or_ps(fitBefore, _mm_and_ps(before, fit[j]));
+            __m128 kept   = _mm_and_ps(decayed[j], _mm_cmpge_ps(decayed[j], _mm_set1_ps(-k.prune)));
+            cum           = _mm_add_ps(cum, _mm_and_ps(before, kept));
+        }
+        __m128 eligible = _mm_andnot_ps(fitBefore, _mm_cmpgt_ps(w[i], zero));
+        __m128 isBg     = _mm_and_ps(_mm_cmplt_ps(cum, _mm_set1_ps(k.TB)), _mm_cmplt_ps(d2[i], _mm_mul_ps(_mm_set1_ps(k.Tb), var[i])));
+        background      = _mm_or_ps(background, _mm_and_ps(eligible, isBg));
+        best[i]         = _mm_andnot_ps(fitBefore, fit[i]);
+        anyFit          = _mm_or_ps(anyFit, fit[i]);
+    }
+
+    __m128 total = zero;
+    for (int32_t m = 0; m < K; ++m) {
+        __m128 nw = _mm_add_ps(decayed[m], _mm_and_ps(best[m], _mm_set1_ps(k.alphaT)));
+        __m128 r  = _mm_and_ps(best[m], _mm_div_ps(_mm_set1_ps(k.alphaT), _mm_max_ps(nw, _mm_set1_ps(1e-20f))));
+        for (int32_t c = 0; c < nc; ++c) {
+            mean[m][c] = _mm_add_ps(mean[m][c], _mm_mul_ps(r, _mm_sub_ps(x[c], mean[m][c])));
+        }
+        __m128 nv = _mm_add_ps(var[m], _mm_mul_ps(r, _mm_sub_ps(d2[m], var[m])));
+        nv        = _mm_min_ps(_mm_max_ps(nv, _mm_set1_ps(k.varMin)), _mm_set1_ps(k.varMax));
+        var[m]    = blend(var[m], nv, best[m]);
+        w[m]      = _mm_and_ps(nw, _mm_cmpge_ps(nw, _mm_set1_ps(-k.prune)));
+        total     = _mm_add_ps(total, w[m]);
+    }
+    __m128 scale = _mm_and_ps(_mm_cmpgt_ps(total, zero), _mm_div_ps(_mm_set1_ps(1.f), _mm_max_ps(total, _mm_set1_ps(1e-20f))));
+
+    // pixels that match no mode replace the lightest one, which is an empty slot while there is one left
+    __m128 minW = _mm_set1_ps(2.f), target = _mm_set1_ps((float)(K - 1));
+    for (int32_t m = 0; m < K; ++m) {
+        w[m]      = _mm_mul_ps(w[m], scale);
+        __m128 le = _mm_cmple_ps(w[m], minW);
+        minW      = blend(minW, w[m], le);
+        target    = blend(target, _mm_set1_ps((float)m), le);
+    }
+    const __m128 noFit = _mm_andnot_ps(anyFit, _mm_castsi128_ps(_mm_set1_epi32(-1)));
+    __m128 others      = zero;
+    for (int32_t m = 0; m < K; ++m) {
+        others = _mm_or_ps(others, _mm_andnot_ps(_mm_cmpeq_ps(target, _mm_set1_ps((float)m)), _mm_cmpgt_ps(w[m], zero)));
+    }
+    const __m128 newWeight = blend(_mm_set1_ps(1.f), _mm_set1_ps(k.alphaT), others);
+    for (int32_t m = 0; m < K; ++m) {
+        __m128 isTarget = _mm_and_ps(noFit, _mm_cmpeq_ps(target, _mm_set1_ps((float)m)));
+        __m128 isOther  = _mm_andnot_ps(isTarget, noFit);
+        w[m]            = blend(w[m], _mm_mul_ps(w[m], _mm_set1_ps(k.alpha1)), isOther);
+        w[m]            = blend(w[m], newWeight, isTarget);
+        var[m]          = blend(var[m], _mm_set1_ps(k.varInit), isTarget);
+        for (int32_t c = 0; c < nc; ++c) {
+            mean[m][c] = blend(mean[m][c], x[c], isTarget);
+        }
+        store_param(wp[m] + offset, w[m], MOG2_WEIGHT_SCALE);
+        store_param(vp[m] + offset, var[m], MOG2_MOMENT_SCALE);
+        for (int32_t c = 0; c < nc; ++c) {
+            store_param(mp[m * nc + c] + offset, mean[m][c], MOG2_MOMENT_SCALE);
+        }
+    }
+
+    // a shadow is a darker version of one of the background modes with the same chromaticity
+    __m128 shadow = zero;
+    if (k.detectShadows) {
+        for (int32_t i = 0; i < K; ++i) {
+            __m128 cum = zero;
+            for (int32_t j = 0; j < K; ++j) {
+                if (j == i) continue;
+                cum = _mm_add_ps(cum, _mm_and_ps(ranks_before(w[j], w[i], j, i), w[j]));
+            }
+            __m128 num = zero, den = zero;
+            for (int32_t c = 0; c < nc; ++c) {
+                num = _mm_add_ps(num, _mm_mul_ps(x[c], mean[i][c]));
+                den = _mm_add_ps(den, _mm_mul_ps(mean[i][c], mean[i][c]));
+            }
+            __m128 a     = _mm_div_ps(num, _mm_max_ps(den, _mm_set1_ps(1e-20f)));
+            __m128 dist2 = zero;
+            for (int32_t c = 0; c < nc; ++c) {
+                __m128 d = _mm_sub_ps(_mm_mul_ps(a, mean[i][c]), x[c]);
+                dist2    = _mm_add_ps(dist2, _mm_mul_ps(d, d));
+            }
+            __m128 ok = _mm_and_ps(_mm_cmpgt_ps(w[i], zero), _mm_cmple_ps(cum, _mm_set1_ps(k.TB)));
+            ok        = _mm_and_ps(ok, _mm_cmpgt_ps(den, zero));
+            ok        = _mm_and_ps(ok, _mm_and_ps(_mm_cmple_ps(num, den), _mm_cmpge_ps(num, _mm_mul_ps(_mm_set1_ps(k.tau), den))));
+            ok        = _mm_and_ps(ok, _mm_cmplt_ps(dist2, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(k.Tb), var[i]), _mm_mul_ps(a, a))));
+            shadow    = _mm_or_ps(shadow, ok);
+        }
+    }
+    __m128 mask = blend(_mm_set1_ps(255.f), _mm_set1_ps((float)k.shadowValue), shadow);
+    *maskOut    = _mm_andnot_ps(background, mask);
+}
+
+template <typename P, int32_t nc>
+static void mog2_row(const Mog2Constants &k, const uint8_t *src, int32_t width, P **planes, size_t offset, uint8_t *dst)
+{
+    __m128 x[MOG2_MAX_CHANNELS], mask;
+    int32_t j = 0;
+    for (; j <= width - 4; j += 4) {
+        load_pixels<nc>(src + j * nc, x);
+        mog2_block<P, nc>(k, x, planes, offset + j, &mask);
+        __m128i v = _mm_cvtps_epi32(mask);
+        v         = _mm_packus_epi16(_mm_packs_epi32(v, v), v);
+        int32_t packed = _mm_cvtsi128_si32(v);
+        memcpy(dst + j, &packed, sizeof(packed));
+    }
+    if (j < width) {
+        // the model planes are padded, the last pixels go through a zero-padded copy of the frame
+        uint8_t tail[4 * MOG2_MAX_CHANNELS] = {0}, out[4];
+        memcpy(tail, src + j * nc, (width - j) * nc);
+        load_pixels<nc>(tail, x);
+        mog2_block<P, nc>(k, x, planes, offset + j, &mask);
+        __m128i v = _mm_cvtps_epi32(mask);
+        v         = _mm_packus_epi16(_mm_packs_epi32(v, v), v);
+        int32_t packed = _mm_cvtsi128_si32(v);
+        memcpy(out, &packed, sizeof(packed));
+        memcpy(dst + j, out, width - j);
+    }
+}
+
+template <typename P, int32_t nc>
+static void mog2_apply(const Mog2Constants &k, int32_t height, int32_t width, const BackgroundModelBuffers *buffers,
+                       int32_t inWidthStride, const uint8_t *inData, int32_t maskWidthStride, uint8_t *maskData)
+{
+    P *planes[MOG2_MAX_MIXTURES * (2 + MOG2_MAX_CHANNELS)];
+    for (int32_t p = 0; p < k.nmixtures * (2 + nc); ++p) {
+        planes[p] = (P *)buffers->planes + p * buffers->planeSize;
+    }
+#pragma omp parallel for schedule(static)
+    for (int32_t y = 0; y < height; ++y) {
+        mog2_row<P, nc>(k, inData + y * inWidthStride, width, planes, (size_t)y * buffers->stride, maskData + y * maskWidthStride);
+    }
+}
+
+static bool validateParams(int32_t height, int32_t width, int32_t channels, const BackgroundSubtractorMOG2Params &p)
+{
+    if (height <= 0 || width <= 0 || (channels != 1 && channels != 3)) {
+        return false;
+    }
+    if (p.history <= 0 || p.nmixtures < 1 || p.nmixtures > MOG2_MAX_MIXTURES) {
+        return false;
+    }
+    if (p.varThreshold <= 0.f || p.varThresholdGen <= 0.f || p.backgroundRatio <= 0.f || p.backgroundRatio > 1.f) {
+        return false;
+    }
+    if (p.varMin <= 0.f || p.varMax < p.varMin || p.varInit < p.varMin || p.varInit > p.varMax) {
+        return false;
+    }
+    if (p.complexityReduction < 0.f || p.shadowThreshold <= 0.f || p.shadowThreshold >= 1.f) {
+        return false;
+    }
+    if (p.precision != BACKGROUND_MODEL_FLOAT32 && p.precision != BACKGROUND_MODEL_FIXED16) {
+        return false;
+    }
+    // variances are stored with 8 fractional bits in 16 bits
+    if (p.precision == BACKGROUND_MODEL_FIXED16 && p.varMax * MOG2_MOMENT_SCALE > 65535.f) {
+        return false;
+    }
+    return true;
+}
+
+BackgroundSubtractorMOG2::BackgroundSubtractorMOG2(int32_t height, int32_t width, int32_t channels, const BackgroundSubtractorMOG2Params &params)
+    : height_(height)
+    , width_(width)
+    , channels_(channels)
+    , nframes_(0)
+    , params_(params)
+    , buffers_(NULL)
+{
+    if (!validateParams(height_, width_, channels_, params_)) {
+        return;
+    }
+    const size_t elemSize = params_.precision == BACKGROUND_MODEL_FIXED16 ? sizeof(uint16_t) : sizeof(float);
+    const int32_t numPlanes = params_.nmixtures * (2 + channels_);
+    buffers_            = new BackgroundModelBuffers;
+    buffers_->stride    = (width_ + 3) & ~3;
+    buffers_->planeSize = (size_t)buffers_->stride * height_;
+    buffers_->planes    = ppl::common::AlignedAlloc(numPlanes * buffers_->planeSize * elemSize, 64);
+    // a zero weight marks an unused mode
+    memset(buffers_->planes, 0, numPlanes * buffers_->planeSize * elemSize);
+}
+
+BackgroundSubtractorMOG2::~BackgroundSubtractorMOG2()
+{
+    if (buffers_ == NULL) {
+        return;
+    }
+    ppl::common::AlignedFree(buffers_->planes);
+    delete buffers_;
+}
+
+::ppl::common::RetCode BackgroundSubtractorMOG2::Apply(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    uint8_t *maskData,
+    float learningRate)
+{
+    if (buffers_ == NULL || inData == NULL || maskData == NULL) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inWidthStride < width_ * channels_ || maskWidthStride < width_ || learningRate > 1.f) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    // like OpenCV the first frame is always learned with a rate of 1/2
+    ++nframes_;
+    const float alphaT = learningRate >= 0.f && nframes_ > 1 ? learningRate : 1.f / std::min(2 * nframes_, params_.history);
+
+    Mog2Constants k;
+    k.nmixtures     = params_.nmixtures;
+    k.alphaT        = alphaT;
+    k.alpha1        = 1.f - alphaT;
+    k.prune         = -alphaT * params_.complexityReduction;
+    k.Tb            = params_.varThreshold;
+    k.Tg            = params_.varThresholdGen;
+    k.TB            = params_.backgroundRatio;
+    k.varInit       = params_.varInit;
+    k.varMin        = params_.varMin;
+    k.varMax        = params_.varMax;
+    k.tau           = params_.shadowThreshold;
+    k.detectShadows = params_.detectShadows;
+    k.shadowValue   = params_.shadowValue;
+
+    const bool fixed = params_.precision == BACKGROUND_MODEL_FIXED16;
+    if (channels_ == 1) {
+        if (fixed) {
+            mog2_apply<uint16_t, 1>(k, height_, width_, buffers_, inWidthStride, inData, maskWidthStride, maskData);
+        } else {
+            mog2_apply<float, 1>(k, height_, width_, buffers_, inWidthStride, inData, maskWidthStride, maskData);
+        }
+    } else {
+        if (fixed) {
+            mog2_apply<uint16_t, 3>(k, height_, width_, buffers_, inWidthStride, inData, maskWidthStride, maskData);
+        } else {
+            mog2_apply<float, 3>(k, height_, width_, buffers_, inWidthStride, inData, maskWidthStride, maskData);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename P>
+static void background_image(const BackgroundSubtractorMOG2Params &params, int32_t height, int32_t width, int32_t nc,
+                             const BackgroundModelBuffers *buffers, int32_t outWidthStride, uint8_t *outData)
+{
+    const int32_t K     = params.nmixtures;
+    const float wScale  = std::is_same<P, float>::value ? 1.f : 1.f / MOG2_WEIGHT_SCALE;
+    const float mScale  = std::is_same<P, float>::value ? 1.f : 1.f / MOG2_MOMENT_SCALE;
+    const P *planes     = (const P *)buffers->planes;
+#pragma omp parallel for schedule(static)
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            const size_t idx = (size_t)y * buffers->stride + x;
+            int32_t order[MOG2_MAX_MIXTURES];
+            float w[MOG2_MAX_MIXTURES];
+            for (int32_t m = 0; m < K; ++m) {
+                order[m] = m;
+                w[m]     = planes[m * buffers->planeSize + idx] * wScale;
+            }
+            // stable, so that ties keep the slot order of the SIMD update
+            std::stable_sort(order, order + K, [&w](int32_t a, int32_t b) { return w[a] > w[b]; });
+            float sum[MOG2_MAX_CHANNELS] = {0.f, 0.f, 0.f}, total = 0.f;
+            for (int32_t r = 0; r < K && w[order[r]] > 0.f; ++r) {
+                const int32_t m = order[r];
+                for (int32_t c = 0; c < nc; ++c) {
+                    sum[c] += w[m] * planes[(2 * K + m * nc + c) * buffers->planeSize + idx] * mScale;
+                }
+                total += w[m];
+                if (total > params.backgroundRatio) {
+                    break;
+                }
+            }
+            const float inv = total > 0.f ? 1.f / total : 0.f;
+            uint8_t *dst    = outData + y * outWidthStride + x * nc;
+            for (int32_t c = 0; c < nc; ++c) {
+                dst[c] = (uint8_t)std::min(std::max((int32_t)std::lrint(sum[c] * inv), 0), 255);
+            }
+        }
+    }
+}
+
+::ppl::common::RetCode BackgroundSubtractorMOG2::GetBackgroundImage(int32_t outWidthStride, uint8_t *outData) const
+{
+    if (buffers_ == NULL || outData == NULL || outWidthStride < width_ * channels_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (params_.precision == BACKGROUND_MODEL_FIXED16) {
+        background_image<uint16_t>(params_, height_, width_, channels_, buffers_, outWidthStride, outData);
+    } else {
+        background_image<float>(params_, height_, width_, channels_, buffers_, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/backgroundsubtractor.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+template <int32_t channels, ppl::cv::x86::BackgroundModelPrecision precision>
+void BM_BackgroundSubtractorMOG2_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * channels]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * channels, 0, 255);
+    ppl::cv::x86::BackgroundSubtractorMOG2Params params;
+    params.precision = precision;
+    ppl::cv::x86::BackgroundSubtractorMOG2 subtractor(height, width, channels, params);
+    for (auto _ : state) {
+        subtractor.Apply(width * channels, src.get(), width, mask.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+using namespace ppl::cv::debug;
+using ppl::cv::x86::BACKGROUND_MODEL_FLOAT32;
+using ppl::cv::x86::BACKGROUND_MODEL_FIXED16;
+
+BENCHMARK_TEMPLATE(BM_BackgroundSubtractorMOG2_ppl_x86, c1, BACKGROUND_MODEL_FLOAT32)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_BackgroundSubtractorMOG2_ppl_x86, c3, BACKGROUND_MODEL_FLOAT32)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_BackgroundSubtractorMOG2_ppl_x86, c1, BACKGROUND_MODEL_FIXED16)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_BackgroundSubtractorMOG2_ppl_x86, c3, BACKGROUND_MODEL_FIXED16)->Args({640, 480})->Args({1920, 1080});
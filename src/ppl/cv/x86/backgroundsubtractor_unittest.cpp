@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/backgroundsubtractor.h"
+#include "ppl/cv/x86/test.h"
+#include <vector>
+#include <cmath>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/core.hpp>
+
+// the video module is not part of the OpenCV build, the subtractor is checked on a synthetic sequence with
+// known foreground: a static noisy scene, then a bright box and a darkened box that is a shadow of the scene
+static void MakeFrame(const cv::Mat& scene, int32_t index, int32_t changeFrom, cv::Mat& frame)
+{
+    cv::Mat noise(scene.size(), CV_32FC(scene.channels()));
+    cv::randn(noise, cv::Scalar::all(0), cv::Scalar::all(3));
+    cv::Mat f;
+    scene.convertTo(f, CV_32F);
+    f += noise;
+    if (index >= changeFrom) {
+        const int32_t height = scene.rows, width = scene.cols;
+        f(cv::Rect(width / 8, height / 8, width / 4, height / 4)).setTo(cv::Scalar::all(250));
+        cv::Mat shadow = f(cv::Rect(width / 2, height / 2, width / 3, height / 3));
+        shadow *= 0.7;
+    }
+    f.convertTo(frame, CV_8U);
+}
+
+static float Fraction(const cv::Mat& mask, const cv::Rect& roi, uint8_t value)
+{
+    return (float)cv::countNonZero(mask(roi) == value) / roi.area();
+}
+
+void BackgroundSubtractorMOG2Test(int32_t height, int32_t width, int32_t channels, ppl::cv::x86::BackgroundModelPrecision precision)
+{
+    cv::Mat scene(height, width, CV_8UC(channels));
+    cv::randu(scene, cv::Scalar::all(40), cv::Scalar::all(200));
+
+    ppl::cv::x86::BackgroundSubtractorMOG2Params params;
+    params.precision = precision;
+    ppl::cv::x86::BackgroundSubtractorMOG2 subtractor(height, width, channels, params);
+    const int32_t numFrames = 60, changeFrom = 50;
+    cv::Mat frame, mask(height, width, CV_8UC1);
+    for (int32_t i = 0; i < numFrames; ++i) {
+        MakeFrame(scene, i, changeFrom, frame);
+        ASSERT_EQ(ppl::common::RC_SUCCESS, subtractor.Apply(width * channels, frame.ptr<uint8_t>(), width, mask.ptr<uint8_t>()));
+        if (i == changeFrom - 1) {
+            EXPECT_LT(cv::countNonZero(mask), height * width / 100);
+        }
+    }
+    cv::Rect object(width / 8, height / 8, width / 4, height / 4);
+    cv::Rect shadow(width / 2, height / 2, width / 3, height / 3);
+    cv::Rect still(0, height - height / 8, width, height / 8);
+    EXPECT_GT(Fraction(mask, object, 255), 0.98f);
+    EXPECT_GT(Fraction(mask, shadow, params.shadowValue), 0.9f);
+    EXPECT_GT(Fraction(mask, still, 0), 0.99f);
+
+    // the background image averages the heaviest modes, far from the changes it is the scene itself
+    cv::Mat background(height, width, CV_8UC(channels));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, subtractor.GetBackgroundImage(width * channels, background.ptr<uint8_t>()));
+    const int32_t step = width * channels;
+    checkResult<uint8_t, 1>(scene.ptr<uint8_t>(still.y), background.ptr<uint8_t>(still.y), still.height, step, step, step, 6.f);
+}
+
+TEST(BackgroundSubtractorMOG2_UINT8, x86)
+{
+    BackgroundSubtractorMOG2Test(240, 320, 1, ppl::cv::x86::BACKGROUND_MODEL_FLOAT32);
+    BackgroundSubtractorMOG2Test(240, 320, 3, ppl::cv::x86::BACKGROUND_MODEL_FLOAT32);
+    BackgroundSubtractorMOG2Test(121, 163, 1, ppl::cv::x86::BACKGROUND_MODEL_FIXED16);
+    BackgroundSubtractorMOG2Test(121, 163, 3, ppl::cv::x86::BACKGROUND_MODEL_FIXED16);
+}
+
+TEST(BackgroundSubtractorMOG2_InvalidParams, x86)
+{
+    std::vector<uint8_t> frame(64 * 64), mask(64 * 64);
+    ppl::cv::x86::BackgroundSubtractorMOG2Params params;
+    params.nmixtures = 9;
+    ppl::cv::x86::BackgroundSubtractorMOG2 tooManyModes(64, 64, 1, params);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, tooManyModes.Apply(64, frame.data(), 64, mask.data()));
+
+    params           = ppl::cv::x86::BackgroundSubtractorMOG2Params();
+    params.precision = ppl::cv::x86::BACKGROUND_MODEL_FIXED16;
+    params.varMax    = 300.f;
+    ppl::cv::x86::BackgroundSubtractorMOG2 varianceOverflow(64, 64, 1, params);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, varianceOverflow.Apply(64, frame.data(), 64, mask.data()));
+
+    ppl::cv::x86::BackgroundSubtractorMOG2 fourChannels(64, 16, 4, ppl::cv::x86::BackgroundSubtractorMOG2Params());
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, fourChannels.Apply(64, frame.data(), 16, mask.data()));
+}
@@ -0,0 +1,603 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/batch.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/convertto.h"
+#include "ppl/cv/x86/resize_linear.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows of one work item, even so that NV12 bands start on a chroma row
+#define BATCH_BAND_ROWS     32
+#define BATCH_SCRATCH_ALIGN 128
+
+static inline uint64_t batch_align(uint64_t size)
+{
+    return (size + BATCH_SCRATCH_ALIGN - 1) / BATCH_SCRATCH_ALIGN * BATCH_SCRATCH_ALIGN;
+}
+
+struct BatchBand {
+    int32_t image;
+    int32_t hBegin;
+    int32_t hEnd;
+};
+
+static bool batch_valid_image(const BatchImage &image, int32_t channels)
+{
+    return image.data != NULL && image.height > 0 && image.width > 0 && image.widthStride >= image.width * channels;
+}
+
+static bool batch_valid_tensor(int32_t batchSize, const BatchTensor &tensor)
+{
+    return batchSize > 0 && tensor.data != NULL && tensor.height > 0 && tensor.width > 0 &&
+           (tensor.layout == BATCH_TENSOR_NHWC || tensor.layout == BATCH_TENSOR_NCHW);
+}
+
+template <typename T>
+static inline T batch_saturate_cast(float value);
+
+template <>
+inline float batch_saturate_cast<float>(float value)
+{
+    return value;
+}
+
+template <>
+inline uint8_t batch_saturate_cast<uint8_t>(float value)
+{
+    return sat_cast_u8((int32_t)lrintf(value));
+}
+
+// u8 to float with scale of one row, either straight or split into one plane per channel
+template <int32_t nc>
+static void batch_store_row_u8_f32(int32_t width, const uint8_t *src, float scale, float *dst, uint64_t planeSize, bool planar)
+{
+    const __m128 vscale = _mm_set1_ps(scale);
+    if (!planar || nc == 1) {
+        int32_t i = 0;
+        for (; i <= width * nc - 4; i += 4) {
+            int32_t packed;
+            memcpy(&packed, src + i, sizeof(packed));
+            __m128 v = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+            _mm_storeu_ps(dst + i, _mm_mul_ps(v, vscale));
+        }
+        for (; i < width * nc; ++i) {
+            dst[i] = src[i] * scale;
+        }
+        return;
+    }
+    // gathers channel c of 4 pixels into the low bytes
+    __m128i masks[nc];
+    for (int32_t c = 0; c < nc; ++c) {
+        int8_t m[16];
+        memset(m, -1, sizeof(m));
+        for (int32_t k = 0; k < 4; ++k) {
+            m[k] = (int8_t)(c + k * nc);
+        }
+        masks[c] = _mm_loadu_si128((const __m128i *)m);
+    }
+    int32_t x = 0;
+    for (; x <= width - 16 / nc - 1; x += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + x * nc));
+        for (int32_t c = 0; c < nc; ++c) {
+            __m128 f = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_shuffle_epi8(v, masks[c])));
+            _mm_storeu_ps(dst + c * planeSize + x, _mm_mul_ps(f, vscale));
+        }
+    }
+    for (; x < width; ++x) {
+        for (int32_t c = 0; c < nc; ++c) {
+            dst[c * planeSize + x] = src[x * nc + c] * scale;
+        }
+    }
+}
+
+// stores rows of an interleaved image into rows [y, y + rows) of image n of the tensor
+template <typename TSrc, int32_t nc, typename TDst>
+static void batch_store_tensor(int32_t rows, int32_t inWidthStride, const TSrc *inData, const BatchTensor &tensor, int32_t n, int32_t y)
+{
+    const int32_t width  = tensor.width;
+    const uint64_t plane = (uint64_t)tensor.height * width;
+    const bool planar    = tensor.layout == BATCH_TENSOR_NCHW;
+    const float scale    = tensor.scale;
+    TDst *base           = (TDst *)tensor.data + (uint64_t)n * nc * plane;
+    for (int32_t r = 0; r < rows; ++r) {
+        const TSrc *src = inData + (uint64_t)r * inWidthStride;
+        TDst *dst       = planar ? base + (uint64_t)(y + r) * width : base + (uint64_t)(y + r) * width * nc;
+        if (std::is_same<TSrc, uint8_t>::value && std::is_same<TDst, float>::value) {
+            batch_store_row_u8_f32<nc>(width, (const uint8_t *)src, scale, (float *)dst, plane, planar);
+        } else if (planar) {
+            for (int32_t x = 0; x < width; ++x) {
+                for (int32_t c = 0; c < nc; ++c) {
+                    dst[c * plane + x] = batch_saturate_cast<TDst>(src[x * nc + c] * scale);
+                }
+            }
+        } else {
+            for (int32_t i = 0; i < width * nc; ++i) {
+                dst[i] = batch_saturate_cast<TDst>(src[i] * scale);
+            }
+        }
+    }
+}
+
+// true if bands can be written straight into the tensor
+template <typename TSrc, typename TDst>
+static inline bool batch_tensor_direct(const BatchTensor &tensor)
+{
+    return std::is_same<TSrc, TDst>::value && tensor.layout == BATCH_TENSOR_NHWC && tensor.scale == 1.f;
+}
+
+template <typename TDst, int32_t nc>
+static inline TDst *batch_tensor_row(const BatchTensor &tensor, int32_t n, int32_t y)
+{
+    return (TDst *)tensor.data + ((uint64_t)n * tensor.height + y) * tensor.width * nc;
+}
+
+// Runs op.run(image, hBegin, hEnd, scratch) for every band of BATCH_BAND_ROWS rows of every image, all bands
+// of the batch are scheduled together. scratchSize bytes of scratch are given to every thread
+template <typename Op>
+static ::ppl::common::RetCode batch_run(const Op &op, const std::vector<int32_t> &heights, uint64_t scratchSize)
+{
+    std::vector<BatchBand> bands;
+    for (int32_t i = 0; i < (int32_t)heights.size(); ++i) {
+        for (int32_t h = 0; h < heights[i]; h += BATCH_BAND_ROWS) {
+            BatchBand band = {i, h, std::min(h + BATCH_BAND_ROWS, heights[i])};
+            bands.push_back(band);
+        }
+    }
+    scratchSize      = batch_align(scratchSize);
+    uint8_t *scratch = NULL;
+    if (scratchSize > 0) {
+        scratch = (uint8_t *)ppl::common::AlignedAlloc(scratchSize * get_max_threads(), BATCH_SCRATCH_ALIGN);
+        if (scratch == NULL) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    }
+    const int32_t numBands = bands.size();
+    std::vector<int32_t> results(numBands, ppl::common::RC_SUCCESS);
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t b = 0; b < numBands; ++b) {
+        results[b] = op.run(bands[b].image, bands[b].hBegin, bands[b].hEnd, scratch + scratchSize * get_thread_num());
+    }
+    if (scratch != NULL) {
+        ppl::common::AlignedFree(scratch);
+    }
+    for (int32_t b = 0; b < numBands; ++b) {
+        if (results[b] != ppl::common::RC_SUCCESS) {
+            return (::ppl::common::RetCode)results[b];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+/*********************************** NV122BGR ***********************************/
+
+static bool batch_valid_nv12(const BatchImage &image)
+{
+    return batch_valid_image(image, 1) && image.height % 2 == 0 && image.width % 2 == 0 &&
+           (image.uvData == NULL || image.uvStride >= image.width);
+}
+
+// converts rows [hBegin, hEnd) of an NV12 image
+static ::ppl::common::RetCode batch_nv12_band(const BatchImage &image, int32_t hBegin, int32_t hEnd, int32_t outWidthStride, uint8_t *outData)
+{
+    const uint8_t *y    = (const uint8_t *)image.data;
+    const uint8_t *uv   = image.uvData != NULL ? (const uint8_t *)image.uvData : y + (uint64_t)image.height * image.widthStride;
+    const int32_t uvStr = image.uvData != NULL ? image.uvStride : image.widthStride;
+    return NV122BGR<uint8_t>(hEnd - hBegin, image.width, image.widthStride, y + (uint64_t)hBegin * image.widthStride, uvStr, uv + (uint64_t)hBegin / 2 * uvStr, outWidthStride, outData);
+}
+
+struct BatchNV12Op {
+    const BatchImage *src;
+    const BatchImage *dst;
+
+    int32_t run(int32_t n, int32_t hBegin, int32_t hEnd, uint8_t *) const
+    {
+        return batch_nv12_band(src[n], hBegin, hEnd, dst[n].widthStride, (uint8_t *)dst[n].data + (uint64_t)hBegin * dst[n].widthStride);
+    }
+};
+
+template <typename TDst>
+struct BatchNV12TensorOp {
+    const BatchImage *src;
+    const BatchTensor *dst;
+
+    int32_t run(int32_t n, int32_t hBegin, int32_t hEnd, uint8_t *scratch) const
+    {
+        if (batch_tensor_direct<uint8_t, TDst>(*dst)) {
+            return batch_nv12_band(src[n], hBegin, hEnd, dst->width * 3, (uint8_t *)batch_tensor_row<TDst, 3>(*dst, n, hBegin));
+        }
+        ::ppl::common::RetCode rc = batch_nv12_band(src[n], hBegin, hEnd, dst->width * 3, scratch);
+        if (rc == ppl::common::RC_SUCCESS) {
+            batch_store_tensor<uint8_t, 3, TDst>(hEnd - hBegin, dst->width * 3, scratch, *dst, n, hBegin);
+        }
+        return rc;
+    }
+};
+
+template <>
+::ppl::common::RetCode NV122BGRBatch<uint8_t>(
+    int32_t batchSize,
+    const BatchImage *src,
+    const BatchImage *dst)
+{
+    if (batchSize <= 0 || src == NULL || dst == NULL) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    std::vector<int32_t> heights(batchSize);
+    for (int32_t i = 0; i < batchSize; ++i) {
+        if (!batch_valid_nv12(src[i]) || !batch_valid_image(dst[i], 3) ||
+            dst[i].height != src[i].height || dst[i].width != src[i].width) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        heights[i] = src[i].height;
+    }
+    BatchNV12Op op = {src, dst};
+    return batch_run(op, heights, 0);
+}
+
+template <typename T, typename TDst>
+::ppl::common::RetCode NV122BGRBatch(
+    int32_t batchSize,
+    const BatchImage *src,
+    const BatchTensor &dst)
+{
+    if (src == NULL || !batch_valid_tensor(batchSize, dst)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    std::vector<int32_t> heights(batchSize);
+    for (int32_t i = 0; i < batchSize; ++i) {
+        if (!batch_valid_nv12(src[i]) || src[i].height != dst.height || src[i].width != dst.width) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        heights[i] = src[i].height;
+    }
+    BatchNV12TensorOp<TDst> op = {src, &dst};
+    uint64_t scratchSize       = batch_tensor_direct<T, TDst>(dst) ? 0 : (uint64_t)BATCH_BAND_ROWS * dst.width * 3;
+    return batch_run(op, heights, scratchSize);
+}
+
+template ::ppl::common::RetCode NV122BGRBatch<uint8_t, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode NV122BGRBatch<uint8_t, float>(int32_t, const BatchImage *, const BatchTensor &);
+
+/*********************************** ResizeLinear ***********************************/
+
+template <typename T>
+struct BatchResizeLinearKernel;
+
+template <>
+struct BatchResizeLinearKernel<uint8_t> {
+    static uint64_t tablesSize(int32_t channels, int32_t outHeight, int32_t outWidth)
+    {
+        return resize_linear_tables_size_u8(channels, outHeight, outWidth);
+    }
+    static uint64_t rowsSize(int32_t channels, int32_t outWidth)
+    {
+        return resize_linear_rows_size_u8(channels, outWidth);
+    }
+    static void tables(int32_t inHeight, int32_t inWidth, int32_t channels, int32_t outHeight, int32_t outWidth, void *tables)
+    {
+        resize_linear_tables_u8(inHeight, inWidth, channels, outHeight, outWidth, tables);
+    }
+    static void band(const BatchImage &src, int32_t channels, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, const void *tables, int32_t hBegin, int32_t hEnd, void *rows)
+    {
+        resize_linear_band_u8(src.height, src.width, src.widthStride, (const uint8_t *)src.data, channels, outHeight, outWidth, outWidthStride, outData, tables, hBegin, hEnd, rows);
+    }
+};
+
+template <>
+struct BatchResizeLinearKernel<float> {
+    static uint64_t tablesSize(int32_t channels, int32_t outHeight, int32_t outWidth)
+    {
+        return resize_linear_tables_size_fp32(channels, outHeight, outWidth);
+    }
+    static uint64_t rowsSize(int32_t channels, int32_t outWidth)
+    {
+        return resize_linear_rows_size_fp32(channels, outWidth);
+    }
+    static void tables(int32_t inHeight, int32_t inWidth, int32_t channels, int32_t outHeight, int32_t outWidth, void *tables)
+    {
+        resize_linear_tables_fp32(inHeight, inWidth, channels, outHeight, outWidth, tables);
+    }
+    static void band(const BatchImage &src, int32_t channels, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, const void *tables, int32_t hBegin, int32_t hEnd, void *rows)
+    {
+        resize_linear_band_fp32(src.height, src.width, src.widthStride, (const float *)src.data, channels, outHeight, outWidth, outWidthStride, outData, tables, hBegin, hEnd, rows);
+    }
+};
+
+// interpolation tables of every distinct (input size, output size) pair of a batch
+template <typename T, int32_t nc>
+class BatchResizeTables {
+public:
+    BatchResizeTables()
+        : buffer_(NULL)
+        , maxRowsSize_(0) {}
+    ~BatchResizeTables()
+    {
+        if (buffer_ != NULL) {
+            ppl::common::AlignedFree(buffer_);
+        }
+    }
+
+    void Add(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth)
+    {
+        int32_t s = 0;
+        for (; s < (int32_t)shapes_.size(); ++s) {
+            const Shape &shape = shapes_[s];
+            if (shape.inHeight == inHeight && shape.inWidth == inWidth && shape.outHeight == outHeight && shape.outWidth == outWidth) {
+                break;
+            }
+        }
+        if (s == (int32_t)shapes_.size()) {
+            Shape shape  = {inHeight, inWidth, outHeight, outWidth, 0};
+            shape.offset = shapes_.empty() ? 0 : shapes_.back().offset + batch_align(BatchResizeLinearKernel<T>::tablesSize(nc, shapes_.back().outHeight, shapes_.back().outWidth));
+            shapes_.push_back(shape);
+            maxRowsSize_ = std::max(maxRowsSize_, BatchResizeLinearKernel<T>::rowsSize(nc, outWidth));
+        }
+        index_.push_back(s);
+    }
+
+    bool Build()
+    {
+        const Shape &last = shapes_.back();
+        buffer_           = (uint8_t *)ppl::common::AlignedAlloc(last.offset + batch_align(BatchResizeLinearKernel<T>::tablesSize(nc, last.outHeight, last.outWidth)), BATCH_SCRATCH_ALIGN);
+        if (buffer_ == NULL) {
+            return false;
+        }
+        for (size_t s = 0; s < shapes_.size(); ++s) {
+            const Shape &shape = shapes_[s];
+            BatchResizeLinearKernel<T>::tables(shape.inHeight, shape.inWidth, nc, shape.outHeight, shape.outWidth, buffer_ + shape.offset);
+        }
+        return true;
+    }
+
+    const void *Tables(int32_t image) const
+    {
+        return buffer_ + shapes_[index_[image]].offset;
+    }
+    uint64_t MaxRowsSize() const
+    {
+        return maxRowsSize_;
+    }
+
+private:
+    struct Shape {
+        int32_t inHeight;
+        int32_t inWidth;
+        int32_t outHeight;
+        int32_t outWidth;
+        uint64_t offset;
+    };
+    std::vector<Shape> shapes_;
+    std::vector<int32_t> index_;
+    uint8_t *buffer_;
+    uint64_t maxRowsSize_;
+
+    BatchResizeTables(const BatchResizeTables &);
+    BatchResizeTables &operator=(const BatchResizeTables &);
+};
+
+template <typename T, int32_t nc>
+struct BatchResizeOp {
+    const BatchImage *src;
+    const BatchImage *dst;
+    const BatchResizeTables<T, nc> *tables;
+
+    int32_t run(int32_t n, int32_t hBegin, int32_t hEnd, uint8_t *scratch) const
+    {
+        BatchResizeLinearKernel<T>::band(src[n], nc, dst[n].height, dst[n].width, dst[n].widthStride, (T *)dst[n].data + (uint64_t)hBegin * dst[n].widthStride, tables->Tables(n), hBegin, hEnd, scratch);
+        return ppl::common::RC_SUCCESS;
+    }
+};
+
+template <typename T, int32_t nc, typename TDst>
+struct BatchResizeTensorOp {
+    const BatchImage *src;
+    const BatchTensor *dst;
+    const BatchResizeTables<T, nc> *tables;
+
+    int32_t run(int32_t n, int32_t hBegin, int32_t hEnd, uint8_t *scratch) const
+    {
+        const int32_t stride = dst->width * nc;
+        if (batch_tensor_direct<T, TDst>(*dst)) {
+            BatchResizeLinearKernel<T>::band(src[n], nc, dst->height, dst->width, stride, (T *)batch_tensor_row<TDst, nc>(*dst, n, hBegin), tables->Tables(n), hBegin, hEnd, scratch);
+            return ppl::common::RC_SUCCESS;
+        }
+        T *staging = (T *)(scratch + batch_align(tables->MaxRowsSize()));
+        BatchResizeLinearKernel<T>::band(src[n], nc, dst->height, dst->width, stride, staging, tables->Tables(n), hBegin, hEnd, scratch);
+        batch_store_tensor<T, nc, TDst>(hEnd - hBegin, stride, staging, *dst, n, hBegin);
+        return ppl::common::RC_SUCCESS;
+    }
+};
+
+template <typename T, int32_t nc>
+::ppl::common::RetCode ResizeLinearBatch(
+    int32_t batchSize,
+    const BatchImage *src,
+    const BatchImage *dst)
+{
+    if (batchSize <= 0 || src == NULL || dst == NULL) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    BatchResizeTables<T, nc> tables;
+    std::vector<int32_t> heights(batchSize);
+    for (int32_t i = 0; i < batchSize; ++i) {
+        if (!batch_valid_image(src[i], nc) || !batch_valid_image(dst[i], nc)) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        tables.Add(src[i].height, src[i].width, dst[i].height, dst[i].width);
+        heights[i] = dst[i].height;
+    }
+    if (!tables.Build()) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    BatchResizeOp<T, nc> op = {src, dst, &tables};
+    return batch_run(op, heights, tables.MaxRowsSize());
+}
+
+template <typename T, int32_t nc, typename TDst>
+::ppl::common::RetCode ResizeLinearBatch(
+    int32_t batchSize,
+    const BatchImage *src,
+    const BatchTensor &dst)
+{
+    if (src == NULL || !batch_valid_tensor(batchSize, dst)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    BatchResizeTables<T, nc> tables;
+    std::vector<int32_t> heights(batchSize, dst.height);
+    for (int32_t i = 0; i < batchSize; ++i) {
+        if (!batch_valid_image(src[i], nc)) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        tables.Add(src[i].height, src[i].width, dst.height, dst.width);
+    }
+    if (!tables.Build()) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    BatchResizeTensorOp<T, nc, TDst> op = {src, &dst, &tables};
+    uint64_t scratchSize                = batch_align(tables.MaxRowsSize());
+    if (!batch_tensor_direct<T, TDst>(dst)) {
+        scratchSize += (uint64_t)BATCH_BAND_ROWS * dst.width * nc * sizeof(T);
+    }
+    return batch_run(op, heights, scratchSize);
+}
+
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 1>(int32_t, const BatchImage *, const BatchImage *);
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 3>(int32_t, const BatchImage *, const BatchImage *);
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 4>(int32_t, const BatchImage *, const BatchImage *);
+template ::ppl::common::RetCode ResizeLinearBatch<float, 1>(int32_t, const BatchImage *, const BatchImage *);
+template ::ppl::common::RetCode ResizeLinearBatch<float, 3>(int32_t, const BatchImage *, const BatchImage *);
+template ::ppl::common::RetCode ResizeLinearBatch<float, 4>(int32_t, const BatchImage *, const BatchImage *);
+
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 1, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 3, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 4, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 1, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 3, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ResizeLinearBatch<uint8_t, 4, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ResizeLinearBatch<float, 1, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ResizeLinearBatch<float, 3, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ResizeLinearBatch<float, 4, float>(int32_t, const BatchImage *, const BatchTensor &);
+
+/*********************************** ConvertTo ***********************************/
+
+template <typename TSrc, int32_t nc, typename TDst>
+struct BatchConvertOp {
+    const BatchImage *src;
+    const BatchImage *dst;
+    float scale;
+
+    int32_t run(int32_t n, int32_t hBegin, int32_t hEnd, uint8_t *) const
+    {
+        const BatchImage &in  = src[n];
+        const BatchImage &out = dst[n];
+        return ConvertTo<TSrc, nc, TDst>(hEnd - hBegin, in.width, in.widthStride, (const TSrc *)in.data + (uint64_t)hBegin * in.widthStride, scale, out.widthStride, (TDst *)out.data + (uint64_t)hBegin * out.widthStride);
+    }
+};
+
+template <typename TSrc, int32_t nc, typename TDst>
+struct BatchConvertTensorOp {
+    const BatchImage *src;
+    const BatchTensor *dst;
+
+    int32_t run(int32_t n, int32_t hBegin, int32_t hEnd, uint8_t *) const
+    {
+        const BatchImage &in = src[n];
+        batch_store_tensor<TSrc, nc, TDst>(hEnd - hBegin, in.widthStride, (const TSrc *)in.data + (uint64_t)hBegin * in.widthStride, *dst, n, hBegin);
+        return ppl::common::RC_SUCCESS;
+    }
+};
+
+template <typename TSrc, int32_t nc, typename TDst>
+::ppl::common::RetCode ConvertToBatch(
+    int32_t batchSize,
+    const BatchImage *src,
+    float scale,
+    const BatchImage *dst)
+{
+    if (batchSize <= 0 || src == NULL || dst == NULL) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    std::vector<int32_t> heights(batchSize);
+    for (int32_t i = 0; i < batchSize; ++i) {
+        if (!batch_valid_image(src[i], nc) || !batch_valid_image(dst[i], nc) ||
+            dst[i].height != src[i].height || dst[i].width != src[i].width) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        heights[i] = src[i].height;
+    }
+    BatchConvertOp<TSrc, nc, TDst> op = {src, dst, scale};
+    return batch_run(op, heights, 0);
+}
+
+template <typename TSrc, int32_t nc, typename TDst>
+::ppl::common::RetCode ConvertToBatch(
+    int32_t batchSize,
+    const BatchImage *src,
+    const BatchTensor &dst)
+{
+    if (src == NULL || !batch_valid_tensor(batchSize, dst)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    std::vector<int32_t> heights(batchSize);
+    for (int32_t i = 0; i < batchSize; ++i) {
+        if (!batch_valid_image(src[i], nc) || src[i].height != dst.height || src[i].width != dst.width) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        heights[i] = src[i].height;
+    }
+    BatchConvertTensorOp<TSrc, nc, TDst> op = {src, &dst};
+    return batch_run(op, heights, 0);
+}
+
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 1, float>(int32_t, const BatchImage *, float, const BatchImage *);
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 3, float>(int32_t, const BatchImage *, float, const BatchImage *);
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 4, float>(int32_t, const BatchImage *, float, const BatchImage *);
+template ::ppl::common::RetCode ConvertToBatch<float, 1, uint8_t>(int32_t, const BatchImage *, float, const BatchImage *);
+template ::ppl::common::RetCode ConvertToBatch<float, 3, uint8_t>(int32_t, const BatchImage *, float, const BatchImage *);
+template ::ppl::common::RetCode ConvertToBatch<float, 4, uint8_t>(int32_t, const BatchImage *, float, const BatchImage *);
+
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 1, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 3, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 4, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 1, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 3, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<uint8_t, 4, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<float, 1, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<float, 3, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<float, 4, uint8_t>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<float, 1, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<float, 3, float>(int32_t, const BatchImage *, const BatchTensor &);
+template ::ppl::common::RetCode ConvertToBatch<float, 4, float>(int32_t, const BatchImage *, const BatchTensor &);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/batch.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/convertto.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// a batch of state.range(2) NV12 frames to a 1/4 size NCHW float tensor, batched and with one call per
+// frame and operation for comparison
+void BM_BatchNV12Tensor_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t n = state.range(2);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[n * width * height * 3 / 2]);
+    std::unique_ptr<uint8_t[]> bgr(new uint8_t[n * width * height * 3]);
+    std::unique_ptr<float[]> dst(new float[n * width / 2 * height / 2 * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), n * width * height * 3 / 2, 0, 255);
+    std::vector<ppl::cv::x86::BatchImage> frames(n), images(n);
+    for (int32_t i = 0; i < n; ++i) {
+        frames[i] = ppl::cv::x86::BatchImage(height, width, width, src.get() + i * width * height * 3 / 2);
+        images[i] = ppl::cv::x86::BatchImage(height, width, width * 3, bgr.get() + i * width * height * 3);
+    }
+    ppl::cv::x86::BatchTensor tensor(height / 2, width / 2, ppl::cv::x86::BATCH_TENSOR_NCHW, dst.get(), 1.f / 255);
+    for (auto _ : state) {
+        ppl::cv::x86::NV122BGRBatch<uint8_t>(n, frames.data(), images.data());
+        ppl::cv::x86::ResizeLinearBatch<uint8_t, 3, float>(n, images.data(), tensor);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_BatchNV12TensorPerFrame_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t n = state.range(2);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[n * width * height * 3 / 2]);
+    std::unique_ptr<uint8_t[]> bgr(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> resized(new uint8_t[width / 2 * height / 2 * 3]);
+    std::unique_ptr<float[]> planar(new float[width / 2 * height / 2 * 3]);
+    std::unique_ptr<float[]> dst(new float[n * width / 2 * height / 2 * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), n * width * height * 3 / 2, 0, 255);
+    const int32_t plane = width / 2 * height / 2;
+    for (auto _ : state) {
+        for (int32_t i = 0; i < n; ++i) {
+            ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, src.get() + i * width * height * 3 / 2, width * 3, bgr.get());
+            ppl::cv::x86::ResizeLinear<uint8_t, 3>(height, width, width * 3, bgr.get(), height / 2, width / 2, width / 2 * 3, resized.get());
+            ppl::cv::x86::ConvertTo<uint8_t, 3, float>(height / 2, width / 2, width / 2 * 3, resized.get(), 1.f / 255, width / 2 * 3, planar.get());
+            float *out = dst.get() + i * plane * 3;
+            for (int32_t p = 0; p < plane; ++p) {
+                out[p]             = planar[p * 3 + 0];
+                out[plane + p]     = planar[p * 3 + 1];
+                out[2 * plane + p] = planar[p * 3 + 2];
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T, int32_t nc>
+void BM_ResizeLinearBatch_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t n = state.range(2);
+    std::unique_ptr<T[]> src(new T[n * width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[n * width / 3 * height / 3 * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), n * width * height * nc, 0, 255);
+    std::vector<ppl::cv::x86::BatchImage> in(n), out(n);
+    for (int32_t i = 0; i < n; ++i) {
+        in[i] = ppl::cv::x86::BatchImage(height, width, width * nc, src.get() + i * width * height * nc);
+        out[i] = ppl::cv::x86::BatchImage(height / 3, width / 3, width / 3 * nc, dst.get() + i * width / 3 * height / 3 * nc);
+    }
+    for (auto _ : state) {
+        ppl::cv::x86::ResizeLinearBatch<T, nc>(n, in.data(), out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T, int32_t nc>
+void BM_ResizeLinearPerFrame_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t n = state.range(2);
+    std::unique_ptr<T[]> src(new T[n * width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[n * width / 3 * height / 3 * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), n * width * height * nc, 0, 255);
+    for (auto _ : state) {
+        for (int32_t i = 0; i < n; ++i) {
+            ppl::cv::x86::ResizeLinear<T, nc>(height, width, width * nc, src.get() + i * width * height * nc, height / 3, width / 3, width / 3 * nc, dst.get() + i * width / 3 * height / 3 * nc);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+}
+
+BENCHMARK(BM_BatchNV12Tensor_ppl_x86)->Args({640, 480, 16})->Args({1920, 1080, 16});
+BENCHMARK(BM_BatchNV12TensorPerFrame_ppl_x86)->Args({640, 480, 16})->Args({1920, 1080, 16});
+BENCHMARK_TEMPLATE(BM_ResizeLinearBatch_ppl_x86, uint8_t, 3)->Args({640, 480, 64})->Args({1920, 1080, 16});
+BENCHMARK_TEMPLATE(BM_ResizeLinearPerFrame_ppl_x86, uint8_t, 3)->Args({640, 480, 64})->Args({1920, 1080, 16});
+BENCHMARK_TEMPLATE(BM_ResizeLinearBatch_ppl_x86, float, 1)->Args({640, 480, 64})->Args({1920, 1080, 16});
+BENCHMARK_TEMPLATE(BM_ResizeLinearPerFrame_ppl_x86, float, 1)->Args({640, 480, 64})->Args({1920, 1080, 16});
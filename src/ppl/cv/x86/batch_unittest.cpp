@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/batch.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/convertto.h"
+#include "ppl/cv/x86/test.h"
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+struct BatchShape {
+    int32_t height;
+    int32_t width;
+};
+
+template <typename T>
+static T BatchCast(float value)
+{
+    return (T)value;
+}
+
+template <>
+uint8_t BatchCast<uint8_t>(float value)
+{
+    return (uint8_t)std::min(std::max((int32_t)std::lrint(value), 0), 255);
+}
+
+// copies one interleaved image into image n of a tensor
+template <typename TSrc, int32_t nc, typename TDst>
+static void ToTensor(int32_t height, int32_t width, int32_t stride, const TSrc* src, ppl::cv::x86::BatchTensorLayout layout, float scale, int32_t n, TDst* tensor)
+{
+    const size_t plane = (size_t)height * width;
+    TDst* base         = tensor + n * nc * plane;
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            for (int32_t c = 0; c < nc; ++c) {
+                TDst v = BatchCast<TDst>(src[y * stride + x * nc + c] * scale);
+                if (layout == ppl::cv::x86::BATCH_TENSOR_NCHW) {
+                    base[c * plane + (size_t)y * width + x] = v;
+                } else {
+                    base[((size_t)y * width + x) * nc + c] = v;
+                }
+            }
+        }
+    }
+}
+
+// every other image has its chroma plane in a separate buffer
+void NV122BGRBatchTest(const std::vector<BatchShape>& shapes)
+{
+    const int32_t n = shapes.size();
+    std::vector<std::vector<uint8_t>> y(n), uv(n), dst(n), expected(n);
+    std::vector<ppl::cv::x86::BatchImage> src(n), out(n);
+    for (int32_t i = 0; i < n; ++i) {
+        const int32_t H = shapes[i].height, W = shapes[i].width, stride = W + 2 * i;
+        y[i].resize((size_t)H * stride * 3 / 2);
+        ppl::cv::debug::randomFill<uint8_t>(y[i].data(), y[i].size(), 0, 255);
+        src[i] = ppl::cv::x86::BatchImage(H, W, stride, y[i].data());
+        if (i % 2 == 1) {
+            uv[i].resize((size_t)H / 2 * W);
+            ppl::cv::debug::randomFill<uint8_t>(uv[i].data(), uv[i].size(), 0, 255);
+            src[i].uvStride = W;
+            src[i].uvData   = uv[i].data();
+        }
+        dst[i].resize((size_t)H * W * 3);
+        expected[i].resize(dst[i].size());
+        out[i] = ppl::cv::x86::BatchImage(H, W, W * 3, dst[i].data());
+        const uint8_t* uvData = i % 2 == 1 ? uv[i].data() : y[i].data() + (size_t)H * stride;
+        ppl::cv::x86::NV122BGR<uint8_t>(H, W, stride, y[i].data(), i % 2 == 1 ? W : stride, uvData, W * 3, expected[i].data());
+    }
+    ASSERT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::NV122BGRBatch<uint8_t>(n, src.data(), out.data()));
+    for (int32_t i = 0; i < n; ++i) {
+        checkResult<uint8_t, 3>(expected[i].data(), dst[i].data(), shapes[i].height, shapes[i].width, shapes[i].width * 3, shapes[i].width * 3, 0.01f);
+    }
+}
+
+template <typename TDst>
+void NV122BGRBatchTensorTest(int32_t n, int32_t height, int32_t width, ppl::cv::x86::BatchTensorLayout layout, float scale)
+{
+    std::vector<uint8_t> nv12((size_t)n * height * width * 3 / 2), bgr((size_t)height * width * 3);
+    ppl::cv::debug::randomFill<uint8_t>(nv12.data(), nv12.size(), 0, 255);
+    std::vector<ppl::cv::x86::BatchImage> src(n);
+    std::vector<TDst> tensor((size_t)n * height * width * 3), expected(tensor.size());
+    for (int32_t i = 0; i < n; ++i) {
+        uint8_t* frame = nv12.data() + (size_t)i * height * width * 3 / 2;
+        src[i]         = ppl::cv::x86::BatchImage(height, width, width, frame);
+        ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, frame, width * 3, bgr.data());
+        ToTensor<uint8_t, 3, TDst>(height, width, width * 3, bgr.data(), layout, scale, i, expected.data());
+    }
+    ppl::cv::x86::BatchTensor dst(height, width, layout, tensor.data(), scale);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, (ppl::cv::x86::NV122BGRBatch<uint8_t, TDst>(n, src.data(), dst)));
+    checkResult<TDst, 1>(expected.data(), tensor.data(), n * height * 3, width, width, width, 1e-5f);
+}
+
+// the batch mixes repeated shapes, which share their tables, and halvings, which take the shrink2 kernels
+template <typename T, int32_t nc>
+void ResizeLinearBatchTest(const std::vector<BatchShape>& inShapes, const std::vector<BatchShape>& outShapes, float diff)
+{
+    const int32_t n = inShapes.size();
+    std::vector<std::vector<T>> in(n), dst(n), expected(n);
+    std::vector<ppl::cv::x86::BatchImage> src(n), out(n);
+    for (int32_t i = 0; i < n; ++i) {
+        const int32_t inStride = inShapes[i].width * nc + i;
+        const int32_t H = outShapes[i].height, W = outShapes[i].width;
+        in[i].resize((size_t)inShapes[i].height * inStride);
+        ppl::cv::debug::randomFill<T>(in[i].data(), in[i].size(), 0, 255);
+        src[i] = ppl::cv::x86::BatchImage(inShapes[i].height, inShapes[i].width, inStride, in[i].data());
+        dst[i].resize((size_t)H * W * nc);
+        expected[i].resize(dst[i].size());
+        out[i] = ppl::cv::x86::BatchImage(H, W, W * nc, dst[i].data());
+        ppl::cv::x86::ResizeLinear<T, nc>(inShapes[i].height, inShapes[i].width, inStride, in[i].data(), H, W, W * nc, expected[i].data());
+    }
+    ASSERT_EQ(ppl::common::RC_SUCCESS, (ppl::cv::x86::ResizeLinearBatch<T, nc>(n, src.data(), out.data())));
+    for (int32_t i = 0; i < n; ++i) {
+        checkResult<T, nc>(expected[i].data(), dst[i].data(), outShapes[i].height, outShapes[i].width, outShapes[i].width * nc, outShapes[i].width * nc, diff);
+    }
+}
+
+template <typename T, int32_t nc, typename TDst>
+void ResizeLinearBatchTensorTest(const std::vector<BatchShape>& inShapes, int32_t height, int32_t width, ppl::cv::x86::BatchTensorLayout layout, float scale, float diff)
+{
+    const int32_t n = inShapes.size();
+    std::vector<std::vector<T>> in(n);
+    std::vector<T> resized((size_t)height * width * nc);
+    std::vector<ppl::cv::x86::BatchImage> src(n);
+    std::vector<TDst> tensor((size_t)n * height * width * nc), expected(tensor.size());
+    for (int32_t i = 0; i < n; ++i) {
+        in[i].resize((size_t)inShapes[i].height * inShapes[i].width * nc);
+        ppl::cv::debug::randomFill<T>(in[i].data(), in[i].size(), 0, 255);
+        src[i] = ppl::cv::x86::BatchImage(inShapes[i].height, inShapes[i].width, inShapes[i].width * nc, in[i].data());
+        ppl::cv::x86::ResizeLinear<T, nc>(inShapes[i].height, inShapes[i].width, inShapes[i].width * nc, in[i].data(), height, width, width * nc, resized.data());
+        ToTensor<T, nc, TDst>(height, width, width * nc, resized.data(), layout, scale, i, expected.data());
+    }
+    ppl::cv::x86::BatchTensor dst(height, width, layout, tensor.data(), scale);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, (ppl::cv::x86::ResizeLinearBatch<T, nc, TDst>(n, src.data(), dst)));
+    checkResult<TDst, 1>(expected.data(), tensor.data(), n * height * nc, width, width, width, diff);
+}
+
+template <typename TSrc, int32_t nc, typename TDst>
+void ConvertToBatchTest(int32_t n, int32_t height, int32_t width, float scale)
+{
+    std::vector<std::vector<TSrc>> in(n);
+    std::vector<std::vector<TDst>> dst(n), expected(n);
+    std::vector<ppl::cv::x86::BatchImage> src(n), out(n);
+    for (int32_t i = 0; i < n; ++i) {
+        const int32_t H = height + i, W = width + 3 * i;
+        in[i].resize((size_t)H * W * nc);
+        ppl::cv::debug::randomFill<TSrc>(in[i].data(), in[i].size(), 0, 255);
+        dst[i].resize(in[i].size());
+        expected[i].resize(in[i].size());
+        src[i] = ppl::cv::x86::BatchImage(H, W, W * nc, in[i].data());
+        out[i] = ppl::cv::x86::BatchImage(H, W, W * nc, dst[i].data());
+        ppl::cv::x86::ConvertTo<TSrc, nc, TDst>(H, W, W * nc, in[i].data(), scale, W * nc, expected[i].data());
+    }
+    ASSERT_EQ(ppl::common::RC_SUCCESS, (ppl::cv::x86::ConvertToBatch<TSrc, nc, TDst>(n, src.data(), scale, out.data())));
+    for (int32_t i = 0; i < n; ++i) {
+        checkResult<TDst, nc>(expected[i].data(), dst[i].data(), height + i, width + 3 * i, (width + 3 * i) * nc, (width + 3 * i) * nc, 1e-5f);
+    }
+}
+
+template <typename TSrc, int32_t nc, typename TDst>
+void ConvertToBatchTensorTest(int32_t n, int32_t height, int32_t width, ppl::cv::x86::BatchTensorLayout layout, float scale)
+{
+    std::vector<TSrc> in((size_t)n * height * width * nc);
+    ppl::cv::debug::randomFill<TSrc>(in.data(), in.size(), 0, 255);
+    std::vector<ppl::cv::x86::BatchImage> src(n);
+    std::vector<TDst> tensor(in.size()), expected(in.size());
+    for (int32_t i = 0; i < n; ++i) {
+        TSrc* image = in.data() + (size_t)i * height * width * nc;
+        src[i]      = ppl::cv::x86::BatchImage(height, width, width * nc, image);
+        ToTensor<TSrc, nc, TDst>(height, width, width * nc, image, layout, scale, i, expected.data());
+    }
+    ppl::cv::x86::BatchTensor dst(height, width, layout, tensor.data(), scale);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, (ppl::cv::x86::ConvertToBatch<TSrc, nc, TDst>(n, src.data(), dst)));
+    checkResult<TDst, 1>(expected.data(), tensor.data(), n * height * nc, width, width, width, 1e-5f);
+}
+
+TEST(NV122BGRBatch, x86)
+{
+    NV122BGRBatchTest({{480, 640}, {480, 640}, {720, 1280}, {36, 50}, {2, 2}});
+    NV122BGRBatchTensorTest<float>(5, 64, 98, ppl::cv::x86::BATCH_TENSOR_NCHW, 1.f / 255);
+    NV122BGRBatchTensorTest<float>(3, 40, 60, ppl::cv::x86::BATCH_TENSOR_NHWC, 1.f);
+    NV122BGRBatchTensorTest<uint8_t>(4, 72, 36, ppl::cv::x86::BATCH_TENSOR_NHWC, 1.f);
+    NV122BGRBatchTensorTest<uint8_t>(2, 34, 38, ppl::cv::x86::BATCH_TENSOR_NCHW, 0.5f);
+}
+
+TEST(ResizeLinearBatch, x86)
+{
+    const std::vector<BatchShape> inShapes  = {{480, 640}, {480, 640}, {101, 67}, {480, 640}, {96, 128}, {33, 257}};
+    const std::vector<BatchShape> outShapes = {{240, 320}, {240, 320}, {203, 150}, {100, 90}, {48, 64}, {17, 100}};
+    ResizeLinearBatchTest<uint8_t, 1>(inShapes, outShapes, 0.01f);
+    ResizeLinearBatchTest<uint8_t, 3>(inShapes, outShapes, 0.01f);
+    ResizeLinearBatchTest<uint8_t, 4>(inShapes, outShapes, 0.01f);
+    ResizeLinearBatchTest<float, 1>(inShapes, outShapes, 1e-4f);
+    ResizeLinearBatchTest<float, 3>(inShapes, outShapes, 1e-4f);
+    ResizeLinearBatchTest<float, 4>(inShapes, outShapes, 1e-4f);
+}
+
+TEST(ResizeLinearBatchTensor, x86)
+{
+    const std::vector<BatchShape> inShapes = {{480, 640}, {360, 640}, {480, 640}, {100, 100}};
+    ResizeLinearBatchTensorTest<uint8_t, 3, float>(inShapes, 224, 224, ppl::cv::x86::BATCH_TENSOR_NCHW, 1.f / 255, 1e-5f);
+    ResizeLinearBatchTensorTest<uint8_t, 1, float>(inShapes, 120, 90, ppl::cv::x86::BATCH_TENSOR_NHWC, 1.f, 1e-5f);
+    ResizeLinearBatchTensorTest<uint8_t, 4, uint8_t>(inShapes, 240, 320, ppl::cv::x86::BATCH_TENSOR_NHWC, 1.f, 0.01f);
+    ResizeLinearBatchTensorTest<float, 3, float>(inShapes, 64, 80, ppl::cv::x86::BATCH_TENSOR_NCHW, 0.5f, 1e-4f);
+}
+
+TEST(ConvertToBatch, x86)
+{
+    ConvertToBatchTest<uint8_t, 1, float>(4, 33, 50, 1.f / 255);
+    ConvertToBatchTest<uint8_t, 3, float>(4, 64, 64, 0.5f);
+    ConvertToBatchTest<float, 4, uint8_t>(3, 40, 41, 1.f);
+    ConvertToBatchTensorTest<uint8_t, 3, float>(4, 64, 77, ppl::cv::x86::BATCH_TENSOR_NCHW, 1.f / 255);
+    ConvertToBatchTensorTest<uint8_t, 4, float>(2, 31, 45, ppl::cv::x86::BATCH_TENSOR_NCHW, 1.f);
+    ConvertToBatchTensorTest<float, 3, float>(3, 50, 30, ppl::cv::x86::BATCH_TENSOR_NCHW, 2.f);
+    ConvertToBatchTensorTest<float, 1, uint8_t>(3, 50, 30, ppl::cv::x86::BATCH_TENSOR_NHWC, 0.9f);
+}
+
+TEST(Batch_InvalidParams, x86)
+{
+    std::vector<uint8_t> data(64 * 64 * 3);
+    ppl::cv::x86::BatchImage images[2] = {ppl::cv::x86::BatchImage(64, 64, 64, data.data()),
+                                          ppl::cv::x86::BatchImage(63, 64, 64, data.data())};
+    ppl::cv::x86::BatchImage outs[2]   = {ppl::cv::x86::BatchImage(64, 64, 64 * 3, data.data()),
+                                          ppl::cv::x86::BatchImage(62, 64, 64 * 3, data.data())};
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::NV122BGRBatch<uint8_t>(2, images, outs));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::NV122BGRBatch<uint8_t>(0, images, outs));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, (ppl::cv::x86::ResizeLinearBatch<uint8_t, 3>(1, images, outs)));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, (ppl::cv::x86::ConvertToBatch<uint8_t, 1, float>(2, images, 1.f, outs)));
+
+    ppl::cv::x86::BatchTensor tensor(32, 32, ppl::cv::x86::BATCH_TENSOR_NCHW, NULL);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, (ppl::cv::x86::ResizeLinearBatch<uint8_t, 1, float>(1, images, tensor)));
+    tensor.data = data.data();
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, (ppl::cv::x86::ConvertToBatch<uint8_t, 1, uint8_t>(1, images, tensor)));
+    EXPECT_EQ(ppl::common::RC_SUCCESS, (ppl::cv::x86::ResizeLinearBatch<uint8_t, 1, uint8_t>(1, images, tensor)));
+}
@@ -0,0 +1,363 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <limits.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// output rows handled by one task, each task keeps its own ring of input rows
+#define BAYER_BAND_ROWS 32
+#define BAYER_RING_ROWS 5
+#define BAYER_PAD       2
+
+// same weights and precision as OpenCV's Bayer to gray conversion
+#define BAYER_R2Y 4899
+#define BAYER_G2Y 9617
+#define BAYER_B2Y 1868
+
+// ring rows are widened so that the 5x5 filters can not overflow: int16_t lanes for 8-bit and int32_t
+// lanes for 16-bit images
+template <typename T>
+struct BayerVec;
+
+template <>
+struct BayerVec<uint8_t> {
+    typedef int16_t W;
+    enum { LANES = 8, MAXV = 255 };
+    static inline __m128i widen(const uint8_t *p) { return _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)p)); }
+    static inline __m128i set1(int32_t v) { return _mm_set1_epi16((int16_t)v); }
+    static inline __m128i add(__m128i a, __m128i b) { return _mm_add_epi16(a, b); }
+    static inline __m128i sub(__m128i a, __m128i b) { return _mm_sub_epi16(a, b); }
+    static inline __m128i mul(__m128i a, int32_t k) { return _mm_mullo_epi16(a, set1(k)); }
+    static inline __m128i clamp(__m128i a) { return _mm_min_epi16(_mm_max_epi16(a, _mm_setzero_si128()), set1(MAXV)); }
+    template <int32_t n>
+    static inline __m128i shl(__m128i a) { return _mm_slli_epi16(a, n); }
+    template <int32_t n>
+    static inline __m128i sra(__m128i a) { return _mm_srai_epi16(a, n); }
+    // lanes holding the columns of the given parity, for a chunk starting at an even column
+    static inline __m128i parityMask(int32_t parity) { return parity ? _mm_set1_epi32((int32_t)0xFFFF0000) : _mm_set1_epi32(0x0000FFFF); }
+};
+
+template <>
+struct BayerVec<uint16_t> {
+    typedef int32_t W;
+    enum { LANES = 4, MAXV = 65535 };
+    static inline __m128i widen(const uint16_t *p) { return _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)p)); }
+    static inline __m128i set1(int32_t v) { return _mm_set1_epi32(v); }
+    static inline __m128i add(__m128i a, __m128i b) { return _mm_add_epi32(a, b); }
+    static inline __m128i sub(__m128i a, __m128i b) { return _mm_sub_epi32(a, b); }
+    static inline __m128i mul(__m128i a, int32_t k) { return _mm_mullo_epi32(a, set1(k)); }
+    static inline __m128i clamp(__m128i a) { return _mm_min_epi32(_mm_max_epi32(a, _mm_setzero_si128()), set1(MAXV)); }
+    template <int32_t n>
+    static inline __m128i shl(__m128i a) { return _mm_slli_epi32(a, n); }
+    template <int32_t n>
+    static inline __m128i sra(__m128i a) { return _mm_srai_epi32(a, n); }
+    static inline __m128i parityMask(int32_t parity) { return parity ? _mm_set_epi32(-1, 0, -1, 0) : _mm_set_epi32(0, -1, 0, -1); }
+};
+
+static inline int32_t reflect101(int32_t p, int32_t len)
+{
+    return p < 0 ? -p : (p >= len ? 2 * (len - 1) - p : p);
+}
+
+// widens one input row into the ring, with a BORDER_TYPE_REFLECT_101 margin of BAYER_PAD columns
+template <typename T>
+static void fillRingRow(const T *src, int32_t width, typename BayerVec<T>::W *dst)
+{
+    typedef BayerVec<T> V;
+    int32_t x = 0;
+    for (; x <= width - V::LANES; x += V::LANES) {
+        _mm_storeu_si128((__m128i *)(dst + x), V::widen(src + x));
+    }
+    for (; x < width; ++x) {
+        dst[x] = src[x];
+    }
+    for (int32_t k = 1; k <= BAYER_PAD; ++k) {
+        dst[-k]            = src[reflect101(-k, width)];
+        dst[width - 1 + k] = src[reflect101(width - 1 + k, width)];
+    }
+}
+
+// interpolates one output row from the ring rows r[0..4] centered on it. xc is the color of the row other
+// than green, found on the columns of parity xParity, yc is the color on the rows above and below.
+// Results are 4 times the interpolated values, which keeps the bilinear averages exact for the gray output
+template <typename T, bool edgeAware>
+static void demosaicRow(
+    const typename BayerVec<T>::W *const *r,
+    int32_t width,
+    int32_t xParity,
+    typename BayerVec<T>::W *xc,
+    typename BayerVec<T>::W *gc,
+    typename BayerVec<T>::W *yc)
+{
+    typedef BayerVec<T> V;
+    const typename V::W *a2 = r[0], *a1 = r[1], *b = r[2], *c1 = r[3], *c2 = r[4];
+    const __m128i isX = V::parityMask(xParity);
+#define BAYER_LOAD(p) _mm_loadu_si128((const __m128i *)(p))
+    for (int32_t x = 0; x < width; x += V::LANES) {
+        __m128i c  = BAYER_LOAD(b + x);
+        __m128i h1 = V::add(BAYER_LOAD(b + x - 1), BAYER_LOAD(b + x + 1));
+        __m128i v1 = V::add(BAYER_LOAD(a1 + x), BAYER_LOAD(c1 + x));
+        __m128i d  = V::add(V::add(BAYER_LOAD(a1 + x - 1), BAYER_LOAD(a1 + x + 1)), V::add(BAYER_LOAD(c1 + x - 1), BAYER_LOAD(c1 + x + 1)));
+        __m128i vx, vg, vy;
+        if (!edgeAware) {
+            __m128i c4 = V::template shl<2>(c);
+            vx         = _mm_blendv_epi8(V::template shl<1>(h1), c4, isX);
+            vg         = _mm_blendv_epi8(c4, V::add(h1, v1), isX);
+            vy         = _mm_blendv_epi8(V::template shl<1>(v1), d, isX);
+        } else {
+            // Malvar-He-Cutler gradient corrected filters, scaled by 16
+            __m128i h2 = V::add(BAYER_LOAD(b + x - 2), BAYER_LOAD(b + x + 2));
+            __m128i v2 = V::add(BAYER_LOAD(a2 + x), BAYER_LOAD(c2 + x));
+            __m128i s2 = V::add(h2, v2);
+            __m128i d2 = V::template shl<1>(d);
+            __m128i gx = V::sub(V::add(V::template shl<3>(c), V::template shl<2>(V::add(h1, v1))), V::template shl<1>(s2));
+            __m128i yx = V::sub(V::add(V::mul(c, 12), V::template shl<2>(d)), V::mul(s2, 3));
+            __m128i xg = V::add(V::sub(V::add(V::mul(c, 10), V::template shl<3>(h1)), V::add(V::template shl<1>(h2), d2)), v2);
+            __m128i yg = V::add(V::sub(V::add(V::mul(c, 10), V::template shl<3>(v1)), V::add(V::template shl<1>(v2), d2)), h2);
+            __m128i c16   = V::template shl<4>(c);
+            const __m128i half = V::set1(8);
+            vx = V::template shl<2>(V::clamp(V::template sra<4>(V::add(_mm_blendv_epi8(xg, c16, isX), half))));
+            vg = V::template shl<2>(V::clamp(V::template sra<4>(V::add(_mm_blendv_epi8(c16, gx, isX), half))));
+            vy = V::template shl<2>(V::clamp(V::template sra<4>(V::add(_mm_blendv_epi8(yg, yx, isX), half))));
+        }
+        _mm_storeu_si128((__m128i *)(xc + x), vx);
+        _mm_storeu_si128((__m128i *)(gc + x), vg);
+        _mm_storeu_si128((__m128i *)(yc + x), vy);
+    }
+#undef BAYER_LOAD
+}
+
+static const int8_t kInterleaveU8[3][3][16] = {
+    {{0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5}, {-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1}, {-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1}},
+    {{-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1}, {5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10}, {-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1}},
+    {{-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1}, {-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1}, {10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15}},
+};
+
+static const int8_t kInterleaveU16[3][3][16] = {
+    {{0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, 4, 5, -1, -1}, {-1, -1, 0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, 4, 5}, {-1, -1, -1, -1, 0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1}},
+    {{-1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1, 10, 11}, {-1, -1, -1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1}, {4, 5, -1, -1, -1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1}},
+    {{-1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1}, {10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1}, {-1, -1, 10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15}},
+};
+
+// interleaves three registers of planar values into 48 bytes of packed BGR
+static inline void interleave3(__m128i b, __m128i g, __m128i r, const int8_t (*masks)[3][16], void *dst)
+{
+    for (int32_t o = 0; o < 3; ++o) {
+        __m128i v = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(b, _mm_loadu_si128((const __m128i *)masks[o][0])),
+                                              _mm_shuffle_epi8(g, _mm_loadu_si128((const __m128i *)masks[o][1]))),
+                                 _mm_shuffle_epi8(r, _mm_loadu_si128((const __m128i *)masks[o][2])));
+        _mm_storeu_si128((__m128i *)dst + o, v);
+    }
+}
+
+static void storeBGR(const int16_t *b, const int16_t *g, const int16_t *r, int32_t width, uint8_t *dst)
+{
+    const __m128i two = _mm_set1_epi16(2);
+    int32_t x         = 0;
+#define BAYER_DESCALE(p) _mm_srai_epi16(_mm_add_epi16(_mm_loadu_si128((const __m128i *)(p)), two), 2)
+    for (; x <= width - 16; x += 16) {
+        __m128i vb = _mm_packus_epi16(BAYER_DESCALE(b + x), BAYER_DESCALE(b + x + 8));
+        __m128i vg = _mm_packus_epi16(BAYER_DESCALE(g + x), BAYER_DESCALE(g + x + 8));
+        __m128i vr = _mm_packus_epi16(BAYER_DESCALE(r + x), BAYER_DESCALE(r + x + 8));
+        interleave3(vb, vg, vr, kInterleaveU8, dst + 3 * x);
+    }
+#undef BAYER_DESCALE
+    for (; x < width; ++x) {
+        dst[3 * x]     = (uint8_t)((b[x] + 2) >> 2);
+        dst[3 * x + 1] = (uint8_t)((g[x] + 2) >> 2);
+        dst[3 * x + 2] = (uint8_t)((r[x] + 2) >> 2);
+    }
+}
+
+static void storeBGR(const int32_t *b, const int32_t *g, const int32_t *r, int32_t width, uint16_t *dst)
+{
+    const __m128i two = _mm_set1_epi32(2);
+    int32_t x         = 0;
+#define BAYER_DESCALE(p) _mm_srai_epi32(_mm_add_epi32(_mm_loadu_si128((const __m128i *)(p)), two), 2)
+    for (; x <= width - 8; x += 8) {
+        __m128i vb = _mm_packus_epi32(BAYER_DESCALE(b + x), BAYER_DESCALE(b + x + 4));
+        __m128i vg = _mm_packus_epi32(BAYER_DESCALE(g + x), BAYER_DESCALE(g + x + 4));
+        __m128i vr = _mm_packus_epi32(BAYER_DESCALE(r + x), BAYER_DESCALE(r + x + 4));
+        interleave3(vb, vg, vr, kInterleaveU16, dst + 3 * x);
+    }
+#undef BAYER_DESCALE
+    for (; x < width; ++x) {
+        dst[3 * x]     = (uint16_t)((b[x] + 2) >> 2);
+        dst[3 * x + 1] = (uint16_t)((g[x] + 2) >> 2);
+        dst[3 * x + 2] = (uint16_t)((r[x] + 2) >> 2);
+    }
+}
+
+// gray from the unrounded interpolated values, which reproduces OpenCV's Bayer to gray conversion
+static void storeGray(const int16_t *b, const int16_t *g, const int16_t *r, int32_t width, uint8_t *dst)
+{
+    const __m128i cb = _mm_set1_epi32(BAYER_B2Y), cg = _mm_set1_epi32(BAYER_G2Y), cr = _mm_set1_epi32(BAYER_R2Y);
+    const __m128i round = _mm_set1_epi32(1 << 15);
+    int32_t x           = 0;
+    for (; x <= width - 8; x += 8) {
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + x));
+        __m128i vg = _mm_loadu_si128((const __m128i *)(g + x));
+        __m128i vr = _mm_loadu_si128((const __m128i *)(r + x));
+        __m128i lo = _mm_add_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_cvtepi16_epi32(vb), cb), _mm_mullo_epi32(_mm_cvtepi16_epi32(vg), cg)),
+                                   _mm_add_epi32(_mm_mullo_epi32(_mm_cvtepi16_epi32(vr), cr), round));
+        __m128i hi = _mm_add_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_cvtepi16_epi32(_mm_srli_si128(vb, 8)), cb),
+                                                 _mm_mullo_epi32(_mm_cvtepi16_epi32(_mm_srli_si128(vg, 8)), cg)),
+                                   _mm_add_epi32(_mm_mullo_epi32(_mm_cvtepi16_epi32(_mm_srli_si128(vr, 8)), cr), round));
+        __m128i v  = _mm_packs_epi32(_mm_srai_epi32(lo, 16), _mm_srai_epi32(hi, 16));
+        _mm_storel_epi64((__m128i *)(dst + x), _mm_packus_epi16(v, v));
+    }
+    for (; x < width; ++x) {
+        dst[x] = (uint8_t)((b[x] * BAYER_B2Y + g[x] * BAYER_G2Y + r[x] * BAYER_R2Y + (1 << 15)) >> 16);
+    }
+}
+
+// the weighted sum of 16-bit values times 4 needs all 32 bits, so it is accumulated as unsigned
+static void storeGray(const int32_t *b, const int32_t *g, const int32_t *r, int32_t width, uint16_t *dst)
+{
+    const __m128i cb = _mm_set1_epi32(BAYER_B2Y), cg = _mm_set1_epi32(BAYER_G2Y), cr = _mm_set1_epi32(BAYER_R2Y);
+    const __m128i round = _mm_set1_epi32(1 << 15);
+    int32_t x           = 0;
+    for (; x <= width - 4; x += 4) {
+        __m128i v = _mm_add_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(b + x)), cb),
+                                                _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(g + x)), cg)),
+                                  _mm_add_epi32(_mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(r + x)), cr), round));
+        v         = _mm_srli_epi32(v, 16);
+        _mm_storel_epi64((__m128i *)(dst + x), _mm_packus_epi32(v, v));
+    }
+    for (; x < width; ++x) {
+        uint32_t sum = (uint32_t)b[x] * BAYER_B2Y + (uint32_t)g[x] * BAYER_G2Y + (uint32_t)r[x] * BAYER_R2Y + (1u << 15);
+        dst[x]       = (uint16_t)(sum >> 16);
+    }
+}
+
+// blueY and blueX give the position of the blue pixel in the 2x2 pattern at the top left corner of the image.
+// Bilinear mode follows OpenCV, which interpolates the inner pixels and copies the first and last rows and
+// columns from their neighbours, the edge-aware mode filters every pixel with a BORDER_TYPE_REFLECT_101 border
+template <typename T, bool toGray>
+static ::ppl::common::RetCode demosaic(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t blueY,
+    int32_t blueX,
+    BayerDemosaicType type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height < 3 || width < 3 || inWidthStride < width || outWidthStride < width * (toGray ? 1 : 3)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (type != BAYER_DEMOSAIC_BILINEAR && type != BAYER_DEMOSAIC_EDGE_AWARE) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    typedef BayerVec<T> V;
+    typedef typename V::W W;
+    const bool edgeAware   = type == BAYER_DEMOSAIC_EDGE_AWARE;
+    const int32_t chunks   = (width + V::LANES - 1) / V::LANES * V::LANES;
+    const int32_t rowLen   = chunks + 2 * BAYER_PAD + V::LANES;
+    const int32_t numBands = (height + BAYER_BAND_ROWS - 1) / BAYER_BAND_ROWS;
+
+#pragma omp parallel for schedule(static)
+    for (int32_t band = 0; band < numBands; ++band) {
+        std::vector<W> ring(BAYER_RING_ROWS * rowLen, 0);
+        std::vector<W> planes(3 * chunks);
+        int32_t held[BAYER_RING_ROWS];
+        std::fill(held, held + BAYER_RING_ROWS, INT_MIN);
+        W *xc = &planes[0], *gc = xc + chunks, *yc = gc + chunks;
+
+        const int32_t yEnd = std::min(height, (band + 1) * BAYER_BAND_ROWS);
+        for (int32_t y = band * BAYER_BAND_ROWS; y < yEnd; ++y) {
+            const int32_t ys = edgeAware ? y : std::min(std::max(y, 1), height - 2);
+            const W *rows[BAYER_RING_ROWS];
+            for (int32_t k = 0; k < BAYER_RING_ROWS; ++k) {
+                const int32_t row  = ys + k - BAYER_RING_ROWS / 2;
+                const int32_t slot = (row % BAYER_RING_ROWS + BAYER_RING_ROWS) % BAYER_RING_ROWS;
+                W *dst             = &ring[slot * rowLen + BAYER_PAD];
+                if (held[slot] != row && (edgeAware || (k > 0 && k < BAYER_RING_ROWS - 1))) {
+                    fillRingRow<T>(inData + reflect101(row, height) * inWidthStride, width, dst);
+                    held[slot] = row;
+                }
+                rows[k] = dst;
+            }
+            const bool blueRow    = (ys & 1) == blueY;
+            const int32_t xParity = blueRow ? blueX : 1 - blueX;
+            if (edgeAware) {
+                demosaicRow<T, true>(rows, width, xParity, xc, gc, yc);
+            } else {
+                demosaicRow<T, false>(rows, width, xParity, xc, gc, yc);
+                for (int32_t k = 0; k < 3; ++k) {
+                    W *p         = &planes[k * chunks];
+                    p[0]         = p[1];
+                    p[width - 1] = p[width - 2];
+                }
+            }
+            const W *bc = blueRow ? xc : yc;
+            const W *rc = blueRow ? yc : xc;
+            if (toGray) {
+                storeGray(bc, gc, rc, width, outData + y * outWidthStride);
+            } else {
+                storeBGR(bc, gc, rc, width, outData + y * outWidthStride);
+            }
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+#define BAYER_CONVERSION(name, toGray, blueY, blueX)                                                                           \
+    template <>                                                                                                                \
+    ::ppl::common::RetCode name<uint8_t>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData,         \
+                                         int32_t outWidthStride, uint8_t *outData, BayerDemosaicType type)                    \
+    {                                                                                                                          \
+        return demosaic<uint8_t, toGray>(height, width, inWidthStride, inData, outWidthStride, outData, blueY, blueX, type);  \
+    }                                                                                                                          \
+    template <>                                                                                                                \
+    ::ppl::common::RetCode name<uint16_t>(int32_t height, int32_t width, int32_t inWidthStride, const uint16_t *inData,       \
+                                          int32_t outWidthStride, uint16_t *outData, BayerDemosaicType type)                  \
+    {                                                                                                                          \
+        return demosaic<uint16_t, toGray>(height, width, inWidthStride, inData, outWidthStride, outData, blueY, blueX, type); \
+    }
+
+// OpenCV names a pattern by the second and third pixels of its second row
+BAYER_CONVERSION(BayerBG2BGR, false, 1, 1)
+BAYER_CONVERSION(BayerGB2BGR, false, 1, 0)
+BAYER_CONVERSION(BayerRG2BGR, false, 0, 0)
+BAYER_CONVERSION(BayerGR2BGR, false, 0, 1)
+BAYER_CONVERSION(BayerBG2GRAY, true, 1, 1)
+BAYER_CONVERSION(BayerGB2GRAY, true, 1, 0)
+BAYER_CONVERSION(BayerRG2GRAY, true, 0, 0)
+BAYER_CONVERSION(BayerGR2GRAY, true, 0, 1)
+
+#undef BAYER_CONVERSION
+
+}
+}
+} // namespace ppl::cv::x86
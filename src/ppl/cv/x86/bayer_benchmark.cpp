@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+
+namespace {
+
+template <typename T, ppl::cv::x86::BayerDemosaicType type>
+void BM_BayerBG2BGR_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::BayerBG2BGR<T>(height, width, width, src.get(), width * 3, dst.get(), type);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T>
+void BM_BayerBG2GRAY_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height]);
+    std::unique_ptr<T[]> dst(new T[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::BayerBG2GRAY<T>(height, width, width, src.get(), width, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+using namespace ppl::cv::debug;
+using namespace ppl::cv::x86;
+
+BENCHMARK_TEMPLATE(BM_BayerBG2BGR_ppl_x86, uint8_t, BAYER_DEMOSAIC_BILINEAR)->Args({1920, 1080})->Args({4000, 3000});
+BENCHMARK_TEMPLATE(BM_BayerBG2BGR_ppl_x86, uint8_t, BAYER_DEMOSAIC_EDGE_AWARE)->Args({1920, 1080})->Args({4000, 3000});
+BENCHMARK_TEMPLATE(BM_BayerBG2BGR_ppl_x86, uint16_t, BAYER_DEMOSAIC_BILINEAR)->Args({1920, 1080})->Args({4000, 3000});
+BENCHMARK_TEMPLATE(BM_BayerBG2BGR_ppl_x86, uint16_t, BAYER_DEMOSAIC_EDGE_AWARE)->Args({1920, 1080})->Args({4000, 3000});
+BENCHMARK_TEMPLATE(BM_BayerBG2GRAY_ppl_x86, uint8_t)->Args({1920, 1080})->Args({4000, 3000});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template <typename T, int32_t code>
+static void BM_Bayer_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 1), src.get());
+    cv::Mat dstMat;
+    for (auto _ : state) {
+        cv::cvtColor(srcMat, dstMat, code);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Bayer_opencv_x86, uint8_t, cv::COLOR_BayerBG2BGR)->Args({1920, 1080})->Args({4000, 3000});
+BENCHMARK_TEMPLATE(BM_Bayer_opencv_x86, uint8_t, cv::COLOR_BayerBG2BGR_EA)->Args({1920, 1080})->Args({4000, 3000});
+BENCHMARK_TEMPLATE(BM_Bayer_opencv_x86, uint16_t, cv::COLOR_BayerBG2BGR)->Args({1920, 1080})->Args({4000, 3000});
+BENCHMARK_TEMPLATE(BM_Bayer_opencv_x86, uint8_t, cv::COLOR_BayerBG2GRAY)->Args({1920, 1080})->Args({4000, 3000});
+#endif //! PPLCV_BENCHMARK_OPENCV
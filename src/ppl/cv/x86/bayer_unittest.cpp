@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <cmath>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+
+enum BayerPattern {BAYER_BG, BAYER_GB, BAYER_RG, BAYER_GR};
+
+template <typename T>
+static ::ppl::common::RetCode BayerConvert(BayerPattern pattern, bool toGray, int32_t height, int32_t width, const T* src, T* dst,
+                                           ppl::cv::x86::BayerDemosaicType type)
+{
+    int32_t outStride = toGray ? width : width * 3;
+    switch (pattern) {
+    case BAYER_BG:
+        return toGray ? ppl::cv::x86::BayerBG2GRAY<T>(height, width, width, src, outStride, dst, type)
+                      : ppl::cv::x86::BayerBG2BGR<T>(height, width, width, src, outStride, dst, type);
+    case BAYER_GB:
+        return toGray ? ppl::cv::x86::BayerGB2GRAY<T>(height, width, width, src, outStride, dst, type)
+                      : ppl::cv::x86::BayerGB2BGR<T>(height, width, width, src, outStride, dst, type);
+    case BAYER_RG:
+        return toGray ? ppl::cv::x86::BayerRG2GRAY<T>(height, width, width, src, outStride, dst, type)
+                      : ppl::cv::x86::BayerRG2BGR<T>(height, width, width, src, outStride, dst, type);
+    default:
+        return toGray ? ppl::cv::x86::BayerGR2GRAY<T>(height, width, width, src, outStride, dst, type)
+                      : ppl::cv::x86::BayerGR2BGR<T>(height, width, width, src, outStride, dst, type);
+    }
+}
+
+static int32_t OpenCVCode(BayerPattern pattern, bool toGray)
+{
+    static const int32_t bgr[]  = {cv::COLOR_BayerBG2BGR, cv::COLOR_BayerGB2BGR, cv::COLOR_BayerRG2BGR, cv::COLOR_BayerGR2BGR};
+    static const int32_t gray[] = {cv::COLOR_BayerBG2GRAY, cv::COLOR_BayerGB2GRAY, cv::COLOR_BayerRG2GRAY, cv::COLOR_BayerGR2GRAY};
+    return toGray ? gray[pattern] : bgr[pattern];
+}
+
+// the bilinear mode is compared with OpenCV bit by bit
+template <typename T>
+void BayerBilinearTest(int32_t height, int32_t width, BayerPattern pattern, bool toGray)
+{
+    const int32_t nc = toGray ? 1 : 3;
+    std::unique_ptr<T[]> src(new T[width * height]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height, 0, sizeof(T) == 1 ? 255 : 65535);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 1), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    cv::cvtColor(srcMat, dstMat, OpenCVCode(pattern, toGray));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, BayerConvert<T>(pattern, toGray, height, width, src.get(), dst.get(), ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR));
+    checkResult<T, 1>(dst.get(), dst_ref.get(), height, width * nc, width * nc, width * nc, 0.01f);
+}
+
+// the edge-aware mode has no OpenCV counterpart, a mosaic of a smooth image with correlated channels
+// has to be restored more accurately than by the bilinear mode
+void BayerEdgeAwareTest(int32_t height, int32_t width, BayerPattern pattern)
+{
+    cv::Mat noise(height / 3 + 2, width / 3 + 2, CV_32FC1), lum;
+    cv::randu(noise, cv::Scalar(0), cv::Scalar(256));
+    cv::resize(noise, lum, cv::Size(width, height), 0, 0, cv::INTER_CUBIC);
+    cv::Mat truth(height, width, CV_8UC3), raw(height, width, CV_8UC1);
+    // channels of the 2x2 pattern at the top left corner, OpenCV names a pattern by its second row
+    static const int32_t cfa[4][2][2] = {{{2, 1}, {1, 0}}, {{1, 2}, {0, 1}}, {{0, 1}, {1, 2}}, {{1, 0}, {2, 1}}};
+    for (int32_t i = 0; i < height; ++i) {
+        for (int32_t j = 0; j < width; ++j) {
+            float v         = lum.at<float>(i, j);
+            cv::Vec3b color = cv::Vec3b(cv::saturate_cast<uint8_t>(v * 0.7f), cv::saturate_cast<uint8_t>(v * 0.9f),
+                                        cv::saturate_cast<uint8_t>(v * (0.6f + 0.3f * j / width)));
+            truth.at<cv::Vec3b>(i, j) = color;
+            raw.at<uint8_t>(i, j)     = color[cfa[pattern][i & 1][j & 1]];
+        }
+    }
+
+    double error[2];
+    for (int32_t k = 0; k < 2; ++k) {
+        cv::Mat dst(height, width, CV_8UC3);
+        ppl::cv::x86::BayerDemosaicType type = k == 0 ? ppl::cv::x86::BAYER_DEMOSAIC_BILINEAR : ppl::cv::x86::BAYER_DEMOSAIC_EDGE_AWARE;
+        ASSERT_EQ(ppl::common::RC_SUCCESS, BayerConvert<uint8_t>(pattern, false, height, width, raw.ptr<uint8_t>(), dst.ptr<uint8_t>(), type));
+        cv::Mat diff;
+        cv::absdiff(dst, truth, diff);
+        error[k] = cv::mean(diff(cv::Rect(2, 2, width - 4, height - 4)))[0];
+    }
+    EXPECT_LT(error[1], error[0] * 0.75);
+}
+
+TEST(BayerBilinear_UINT8, x86)
+{
+    for (int32_t p = BAYER_BG; p <= BAYER_GR; ++p) {
+        BayerBilinearTest<uint8_t>(480, 640, (BayerPattern)p, false);
+        BayerBilinearTest<uint8_t>(241, 323, (BayerPattern)p, false);
+        BayerBilinearTest<uint8_t>(480, 640, (BayerPattern)p, true);
+        BayerBilinearTest<uint8_t>(5, 17, (BayerPattern)p, true);
+    }
+}
+
+TEST(BayerBilinear_UINT16, x86)
+{
+    for (int32_t p = BAYER_BG; p <= BAYER_GR; ++p) {
+        BayerBilinearTest<uint16_t>(480, 640, (BayerPattern)p, false);
+        BayerBilinearTest<uint16_t>(241, 323, (BayerPattern)p, false);
+        BayerBilinearTest<uint16_t>(480, 640, (BayerPattern)p, true);
+        BayerBilinearTest<uint16_t>(5, 17, (BayerPattern)p, true);
+    }
+}
+
+TEST(BayerEdgeAware_UINT8, x86)
+{
+    for (int32_t p = BAYER_BG; p <= BAYER_GR; ++p) {
+        BayerEdgeAwareTest(480, 640, (BayerPattern)p);
+        BayerEdgeAwareTest(241, 323, (BayerPattern)p);
+    }
+}
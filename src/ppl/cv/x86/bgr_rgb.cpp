@@ -0,0 +1,225 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+
+#include <immintrin.h>
+#include <algorithm>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// swaps the first and the third channel of a row. Every store only covers elements which the same step
+// has loaded, so the row may be converted in place
+template <typename T, int32_t cn>
+struct SwapRB {
+    void operator()(const T *src, T *dst, int32_t width) const
+    {
+        for (int32_t i = 0; i < width * cn; i += cn) {
+            T c0       = src[i];
+            dst[i]     = src[i + 2];
+            dst[i + 1] = src[i + 1];
+            dst[i + 2] = c0;
+            if (cn == 4) {
+                dst[i + 3] = src[i + 3];
+            }
+        }
+    }
+};
+
+template <>
+struct SwapRB<uint8_t, 3> {
+    void operator()(const uint8_t *src, uint8_t *dst, int32_t width) const
+    {
+        // 5 pixels per 16 bytes, the last byte is stored back unchanged and loaded again by the next step
+        const __m128i mask = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+        int32_t i          = 0;
+        for (; i + 16 <= width * 3; i += 15) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(v, mask));
+        }
+        for (; i < width * 3; i += 3) {
+            uint8_t c0 = src[i];
+            dst[i]     = src[i + 2];
+            dst[i + 1] = src[i + 1];
+            dst[i + 2] = c0;
+        }
+    }
+};
+
+template <>
+struct SwapRB<uint8_t, 4> {
+    void operator()(const uint8_t *src, uint8_t *dst, int32_t width) const
+    {
+        const __m128i mask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+        int32_t i          = 0;
+        for (; i + 16 <= width * 4; i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(v, mask));
+        }
+        for (; i < width * 4; i += 4) {
+            uint8_t c0 = src[i];
+            dst[i]     = src[i + 2];
+            dst[i + 1] = src[i + 1];
+            dst[i + 2] = c0;
+            dst[i + 3] = src[i + 3];
+        }
+    }
+};
+
+template <>
+struct SwapRB<float, 4> {
+    void operator()(const float *src, float *dst, int32_t width) const
+    {
+        for (int32_t i = 0; i < width * 4; i += 4) {
+            __m128 v = _mm_loadu_ps(src + i);
+            _mm_storeu_ps(dst + i, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 1, 2)));
+        }
+    }
+};
+
+template <typename T, int32_t cn>
+static ::ppl::common::RetCode SwapRBImage(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inData == outData && inWidthStride != outWidthStride) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    SwapRB<T, cn> s;
+    for (int32_t i = 0; i < height; ++i) {
+        s.operator()(inData + i * inWidthStride, outData + i * outWidthStride, width);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGR2RGB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return SwapRBImage<float, 3>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGR2RGB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return SwapRBImage<uint8_t, 3>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGB2BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return SwapRBImage<float, 3>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGB2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return SwapRBImage<uint8_t, 3>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGRA2RGBA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return SwapRBImage<float, 4>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGRA2RGBA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return SwapRBImage<uint8_t, 4>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGBA2BGRA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return SwapRBImage<float, 4>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGBA2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return SwapRBImage<uint8_t, 4>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+enum SwapRBMode {BGR2RGB_MODE, RGB2BGR_MODE};
+template<typename T, int32_t nc, SwapRBMode mode>
+void SwapRBTest(int32_t height, int32_t width) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    if (nc == 3) {
+        if (mode == BGR2RGB_MODE) {
+            ppl::cv::x86::BGR2RGB<T>(height, width, width * nc, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_BGR2RGB);
+        }
+        if (mode == RGB2BGR_MODE) {
+            ppl::cv::x86::RGB2BGR<T>(height, width, width * nc, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_RGB2BGR);
+        }
+    } else if (nc == 4) {
+        if (mode == BGR2RGB_MODE) {
+            ppl::cv::x86::BGRA2RGBA<T>(height, width, width * nc, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_BGRA2RGBA);
+        }
+        if (mode == RGB2BGR_MODE) {
+            ppl::cv::x86::RGBA2BGRA<T>(height, width, width * nc, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_RGBA2BGRA);
+        }
+    }
+    checkResult<T, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, 0.01f);
+
+    // converting back in place restores the source
+    if (nc == 3) {
+        ppl::cv::x86::RGB2BGR<T>(height, width, width * nc, dst.get(), width * nc, dst.get());
+    } else {
+        ppl::cv::x86::RGBA2BGRA<T>(height, width, width * nc, dst.get(), width * nc, dst.get());
+    }
+    checkResult<T, nc>(dst.get(), src.get(), height, width, width * nc, width * nc, 0.01f);
+}
+
+TEST(BGR2RGB_FP32, x86)
+{
+    SwapRBTest<float, 3, BGR2RGB_MODE>(480, 640);
+    SwapRBTest<float, 3, BGR2RGB_MODE>(241, 321);
+}
+
+TEST(RGB2BGR_FP32, x86)
+{
+    SwapRBTest<float, 3, RGB2BGR_MODE>(480, 640);
+    SwapRBTest<float, 3, RGB2BGR_MODE>(241, 321);
+}
+
+TEST(BGRA2RGBA_FP32, x86)
+{
+    SwapRBTest<float, 4, BGR2RGB_MODE>(480, 640);
+    SwapRBTest<float, 4, BGR2RGB_MODE>(241, 321);
+}
+
+TEST(RGBA2BGRA_FP32, x86)
+{
+    SwapRBTest<float, 4, RGB2BGR_MODE>(480, 640);
+    SwapRBTest<float, 4, RGB2BGR_MODE>(241, 321);
+}
+
+TEST(BGR2RGB_UINT8, x86)
+{
+    SwapRBTest<uint8_t, 3, BGR2RGB_MODE>(480, 640);
+    SwapRBTest<uint8_t, 3, BGR2RGB_MODE>(241, 321);
+}
+
+TEST(RGB2BGR_UINT8, x86)
+{
+    SwapRBTest<uint8_t, 3, RGB2BGR_MODE>(480, 640);
+    SwapRBTest<uint8_t, 3, RGB2BGR_MODE>(241, 321);
+}
+
+TEST(BGRA2RGBA_UINT8, x86)
+{
+    SwapRBTest<uint8_t, 4, BGR2RGB_MODE>(480, 640);
+    SwapRBTest<uint8_t, 4, BGR2RGB_MODE>(241, 321);
+}
+
+TEST(RGBA2BGRA_UINT8, x86)
+{
+    SwapRBTest<uint8_t, 4, RGB2BGR_MODE>(480, 640);
+    SwapRBTest<uint8_t, 4, RGB2BGR_MODE>(241, 321);
+}
@@ -18,6 +18,7 @@
 #include "ppl/cv/x86/boxfilter.h"
 #include "ppl/cv/x86/avx/internal_avx.hpp"
 #include "ppl/cv/x86/copymakeborder.h"
+#include "ppl/cv/x86/inplace.hpp"
 #include "ppl/cv/types.h"
 #include "ppl/common/sys.h"
 #include "ppl/cv/x86/util.hpp"
@@ -428,6 +429,45 @@ void x86boxFilter_b(
     pReRowFilter = NULL;
 }
 
+template <typename T, int32_t cn>
+struct BoxFilterRows {
+    int32_t width;
+    int32_t kernelx_len;
+    int32_t kernely_len;
+    bool normalize;
+    BorderType border_type;
+
+    BoxFilterRows(int32_t width, int32_t kernelx_len, int32_t kernely_len, bool normalize, BorderType border_type)
+        : width(width)
+        , kernelx_len(kernelx_len)
+        , kernely_len(kernely_len)
+        , normalize(normalize)
+        , border_type(border_type) {}
+    ::ppl::common::RetCode operator()(int32_t height, int32_t inWidthStride, const T* inData, int32_t outWidthStride, T* outData) const
+    {
+        return BoxFilter<T, cn>(height, width, inWidthStride, inData, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
+    }
+};
+
+// inData == outData: the rows are filtered band by band through a ring of kernely_len / 2 halo rows
+template <typename T, int32_t cn>
+static ::ppl::common::RetCode x86boxFilter_inplace(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t kernelx_len,
+    int32_t kernely_len,
+    bool normalize,
+    int32_t outWidthStride,
+    T* data,
+    BorderType border_type)
+{
+    if (inWidthStride != outWidthStride) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return inplace_filter_rows(height, width * cn, outWidthStride, data, kernely_len / 2, BoxFilterRows<T, cn>(width, kernelx_len, kernely_len, normalize, border_type));
+}
+
 template <>
 ::ppl::common::RetCode BoxFilter<float, 1>(
     int32_t height,
@@ -447,6 +487,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86boxFilter_inplace<float, 1>(height, width, inWidthStride, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
+    }
     x86boxFilter_f<1>(height, width, inWidthStride, inData, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
@@ -469,6 +512,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86boxFilter_inplace<float, 3>(height, width, inWidthStride, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
+    }
     x86boxFilter_f<3>(height, width, inWidthStride, inData, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
@@ -491,6 +537,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86boxFilter_inplace<float, 4>(height, width, inWidthStride, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
+    }
     x86boxFilter_f<4>(height, width, inWidthStride, inData, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
@@ -513,6 +562,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86boxFilter_inplace<uint8_t, 1>(height, width, inWidthStride, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
+    }
     x86boxFilter_b<1>(height, width, inWidthStride, inData, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
@@ -535,6 +587,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86boxFilter_inplace<uint8_t, 3>(height, width, inWidthStride, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
+    }
     x86boxFilter_b<3>(height, width, inWidthStride, inData, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
@@ -557,6 +612,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86boxFilter_inplace<uint8_t, 4>(height, width, inWidthStride, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
+    }
     x86boxFilter_b<4>(height, width, inWidthStride, inData, kernelx_len, kernely_len, normalize, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
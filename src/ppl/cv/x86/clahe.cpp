@@ -0,0 +1,240 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/clahe.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define CLAHE_HIST_SIZE 256
+
+static inline int32_t reflect101(int32_t p, int32_t len)
+{
+    if (len == 1) {
+        return 0;
+    }
+    while (p < 0 || p >= len) {
+        p = p < 0 ? -p : 2 * (len - 1) - p;
+    }
+    return p;
+}
+
+// histogram of one tile, pixels outside of the image are taken from its BORDER_TYPE_REFLECT_101 extension.
+// Consecutive pixels go to four interleaved sub-histograms, so that runs of equal values do not stall on
+// a single counter
+static void tileHistogram(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t y0,
+    int32_t y1,
+    int32_t x0,
+    int32_t x1,
+    int32_t *hist)
+{
+    int32_t sub[4][CLAHE_HIST_SIZE];
+    memset(sub, 0, sizeof(sub));
+    const int32_t xin = std::min(x1, width);
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = inData + reflect101(y, height) * inWidthStride;
+        int32_t x          = x0;
+        for (; x <= xin - 4; x += 4) {
+            ++sub[0][src[x]];
+            ++sub[1][src[x + 1]];
+            ++sub[2][src[x + 2]];
+            ++sub[3][src[x + 3]];
+        }
+        for (; x < xin; ++x) {
+            ++sub[0][src[x]];
+        }
+        for (; x < x1; ++x) {
+            ++sub[1][src[reflect101(x, width)]];
+        }
+    }
+    for (int32_t i = 0; i < CLAHE_HIST_SIZE; ++i) {
+        hist[i] = sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i];
+    }
+}
+
+// clips the histogram, redistributes the clipped counts like OpenCV and builds the cumulative look-up table
+static void tileLut(int32_t *hist, int32_t clipLimit, float lutScale, float *lut)
+{
+    if (clipLimit > 0) {
+        int32_t clipped = 0;
+        for (int32_t i = 0; i < CLAHE_HIST_SIZE; ++i) {
+            if (hist[i] > clipLimit) {
+                clipped += hist[i] - clipLimit;
+                hist[i] = clipLimit;
+            }
+        }
+        int32_t batch    = clipped / CLAHE_HIST_SIZE;
+        int32_t residual = clipped - batch * CLAHE_HIST_SIZE;
+        for (int32_t i = 0; i < CLAHE_HIST_SIZE; ++i) {
+            hist[i] += batch;
+        }
+        if (residual != 0) {
+            int32_t step = std::max(CLAHE_HIST_SIZE / residual, 1);
+            for (int32_t i = 0; i < CLAHE_HIST_SIZE && residual > 0; i += step, --residual) {
+                ++hist[i];
+            }
+        }
+    }
+    int32_t sum = 0;
+    for (int32_t i = 0; i < CLAHE_HIST_SIZE; ++i) {
+        sum += hist[i];
+        lut[i] = (float)std::min(std::max((int32_t)std::lrint(sum * lutScale), 0), 255);
+    }
+}
+
+static inline __m128 gather4(const float *lut, const int32_t *ind, const uint8_t *src)
+{
+    return _mm_setr_ps(lut[ind[0] + src[0]], lut[ind[1] + src[1]], lut[ind[2] + src[2]], lut[ind[3] + src[3]]);
+}
+
+// blends the look-up tables of the four tiles around every pixel of a row, lut1 and lut2 are the tile
+// rows above and below, ind1 and ind2 the offsets of the tiles on the left and on the right
+static void interpolateRow(
+    int32_t width,
+    const uint8_t *src,
+    const float *lut1,
+    const float *lut2,
+    const int32_t *ind1,
+    const int32_t *ind2,
+    const float *xa,
+    const float *xa1,
+    float ya,
+    float ya1,
+    uint8_t *dst)
+{
+    const __m128 vya = _mm_set1_ps(ya), vya1 = _mm_set1_ps(ya1);
+    int32_t x        = 0;
+    for (; x <= width - 4; x += 4) {
+        __m128 wl  = _mm_loadu_ps(xa1 + x), wr = _mm_loadu_ps(xa + x);
+        __m128 top = _mm_add_ps(_mm_mul_ps(gather4(lut1, ind1 + x, src + x), wl), _mm_mul_ps(gather4(lut1, ind2 + x, src + x), wr));
+        __m128 bot = _mm_add_ps(_mm_mul_ps(gather4(lut2, ind1 + x, src + x), wl), _mm_mul_ps(gather4(lut2, ind2 + x, src + x), wr));
+        __m128i v  = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(top, vya1), _mm_mul_ps(bot, vya)));
+        v          = _mm_packus_epi16(_mm_packs_epi32(v, v), v);
+        int32_t packed = _mm_cvtsi128_si32(v);
+        memcpy(dst + x, &packed, sizeof(packed));
+    }
+    for (; x < width; ++x) {
+        const int32_t v = src[x];
+        float res       = (lut1[ind1[x] + v] * xa1[x] + lut1[ind2[x] + v] * xa[x]) * ya1 +
+                    (lut2[ind1[x] + v] * xa1[x] + lut2[ind2[x] + v] * xa[x]) * ya;
+        dst[x] = (uint8_t)std::min(std::max((int32_t)std::lrint(res), 0), 255);
+    }
+}
+
+::ppl::common::RetCode CLAHE(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    double clipLimit,
+    int32_t tilesX,
+    int32_t tilesY)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || outWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (tilesX <= 0 || tilesY <= 0 || clipLimit < 0.0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    // the last tiles extend past the image when its size is not a multiple of the grid. As in OpenCV, both
+    // axes are then extended, an axis which is a multiple by a whole tile row or column
+    int32_t paddedW = width, paddedH = height;
+    if (width % tilesX != 0 || height % tilesY != 0) {
+        paddedW += tilesX - width % tilesX;
+        paddedH += tilesY - height % tilesY;
+    }
+    const int32_t tileW     = paddedW / tilesX;
+    const int32_t tileH     = paddedH / tilesY;
+    const int32_t tileTotal = tileW * tileH;
+    const float lutScale    = (float)(CLAHE_HIST_SIZE - 1) / tileTotal;
+    int32_t clip            = 0;
+    if (clipLimit > 0.0) {
+        clip = std::max((int32_t)(clipLimit * tileTotal / CLAHE_HIST_SIZE), 1);
+    }
+
+    std::vector<float> luts((size_t)tilesX * tilesY * CLAHE_HIST_SIZE);
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t t = 0; t < tilesX * tilesY; ++t) {
+        const int32_t tx = t % tilesX, ty = t / tilesX;
+        int32_t hist[CLAHE_HIST_SIZE];
+        tileHistogram(height, width, inWidthStride, inData, ty * tileH, (ty + 1) * tileH, tx * tileW, (tx + 1) * tileW, hist);
+        tileLut(hist, clip, lutScale, &luts[(size_t)t * CLAHE_HIST_SIZE]);
+    }
+
+    std::vector<int32_t> ind(2 * width);
+    std::vector<float> weights(2 * width);
+    int32_t *ind1 = &ind[0], *ind2 = ind1 + width;
+    float *xa = &weights[0], *xa1 = xa + width;
+    const float invW = 1.f / tileW, invH = 1.f / tileH;
+    for (int32_t x = 0; x < width; ++x) {
+        float txf   = x * invW - 0.5f;
+        int32_t tx1 = (int32_t)std::floor(txf);
+        int32_t tx2 = tx1 + 1;
+        xa[x]       = txf - tx1;
+        xa1[x]      = 1.f - xa[x];
+        ind1[x]     = std::max(tx1, 0) * CLAHE_HIST_SIZE;
+        ind2[x]     = std::min(tx2, tilesX - 1) * CLAHE_HIST_SIZE;
+    }
+
+    const bool useFMA = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+#pragma omp parallel for schedule(static)
+    for (int32_t y = 0; y < height; ++y) {
+        float tyf   = y * invH - 0.5f;
+        int32_t ty1 = (int32_t)std::floor(tyf);
+        int32_t ty2 = ty1 + 1;
+        float ya    = tyf - ty1;
+        ty1         = std::max(ty1, 0);
+        ty2         = std::min(ty2, tilesY - 1);
+        const float *lut1  = &luts[(size_t)ty1 * tilesX * CLAHE_HIST_SIZE];
+        const float *lut2  = &luts[(size_t)ty2 * tilesX * CLAHE_HIST_SIZE];
+        const uint8_t *src = inData + y * inWidthStride;
+        uint8_t *dst       = outData + y * outWidthStride;
+        if (useFMA) {
+            fma::clahe_interpolate_row_fma(width, src, lut1, lut2, ind1, ind2, xa, xa1, ya, 1.f - ya, dst);
+        } else {
+            interpolateRow(width, src, lut1, lut2, ind1, ind2, xa, xa1, ya, 1.f - ya, dst);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -169,6 +169,7 @@ struct RGB2Gray<uint8_t> {
     int32_t width,
     int32_t height,
     int32_t stride,
+    int32_t outStride,
     bool flag)
 {
     const int32_t shift     = 15;
@@ -188,9 +189,9 @@ struct RGB2Gray<uint8_t> {
     int32_t vsize = 16;
     for (int32_t h = 0; h < height; h++) {
         const uint8_t *src_ptr = src + h * stride;
-        uint8_t *dst_ptr       = dst + h * width;
+        uint8_t *dst_ptr       = dst + h * outStride;
         int32_t w              = 0;
-        for (; w < width; w += vsize, src_ptr += vsize * 3) {
+        for (; w <= width - vsize; w += vsize, src_ptr += vsize * 3) {
             __m128i data1 = _mm_loadu_si128((__m128i *)(src_ptr + 0));
             __m128i data2 = _mm_loadu_si128((__m128i *)(src_ptr + 16));
             __m128i data3 = _mm_loadu_si128((__m128i *)(src_ptr + 32));
@@ -278,7 +279,7 @@ template <>
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
-    return bgr2gray_operator(inData, outData, width, height, inWidthStride, true);
+    return bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, true);
 }
 
 template <>
@@ -392,7 +393,7 @@ template <>
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
-    return bgr2gray_operator(inData, outData, width, height, inWidthStride, false);
+    return bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, false);
     const uint8_t *src  = inData;
     uint8_t *dst        = outData;
     RGB2Gray<uint8_t> s = RGB2Gray<uint8_t>(3, 2, NULL);
@@ -98,6 +98,156 @@ template <>
     return ppl::common::RC_SUCCESS;
 }
 
+template <>
+::ppl::common::RetCode ChangeDataTypeAndScale<float, float>(
+    int32_t height,
+    int32_t width,
+    int32_t nc,
+    int32_t inWidthStride,
+    const float* inData,
+    float scale,
+    int32_t outWidthStride,
+    float* outData)
+{
+    __m128 scale_vec = _mm_set1_ps(scale);
+    for (int32_t h = 0; h < height; ++h) {
+        const float* base_in = inData + h * inWidthStride;
+        float* base_out      = outData + h * outWidthStride;
+        for (int32_t w = 0; w < (nc * width) / 4 * 4; w += 4) {
+            _mm_storeu_ps(base_out + w, _mm_mul_ps(_mm_loadu_ps(base_in + w), scale_vec));
+        }
+        for (int32_t w = (nc * width) / 4 * 4; w < (nc * width); ++w) {
+            base_out[w] = scale * base_in[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode ChangeDataTypeAndScale<uint8_t, uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t nc,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    __m128 scale_vec = _mm_set1_ps(scale);
+    for (int32_t h = 0; h < height; ++h) {
+        const uint8_t* base_in = inData + h * inWidthStride;
+        uint8_t* base_out      = outData + h * outWidthStride;
+        for (int32_t w = 0; w < (nc * width) / 16 * 16; w += 16) {
+            __m128i data_u8x16_vec    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base_in + w));
+            __m128i data0_int32x4_vec = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(data_u8x16_vec)), scale_vec));
+            __m128i data1_int32x4_vec = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(data_u8x16_vec, 4))), scale_vec));
+            __m128i data2_int32x4_vec = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(data_u8x16_vec, 8))), scale_vec));
+            __m128i data3_int32x4_vec = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(data_u8x16_vec, 12))), scale_vec));
+            __m128i result_vec        = _mm_packus_epi16(_mm_packs_epi32(data0_int32x4_vec, data1_int32x4_vec), _mm_packs_epi32(data2_int32x4_vec, data3_int32x4_vec));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(base_out + w), result_vec);
+        }
+        for (int32_t w = (nc * width) / 16 * 16; w < (nc * width); ++w) {
+            base_out[w] = static_cast<uint8_t>(std::min(std::max(static_cast<int32_t>(std::lrint(scale * base_in[w])), 0), 255));
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode ChangeDataTypeAndScale<int16_t, uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t nc,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    const bool unit  = scale == 1.0f;
+    __m128 scale_vec = _mm_set1_ps(scale);
+    for (int32_t h = 0; h < height; ++h) {
+        const int16_t* base_in = inData + h * inWidthStride;
+        uint8_t* base_out      = outData + h * outWidthStride;
+        for (int32_t w = 0; w < (nc * width) / 16 * 16; w += 16) {
+            __m128i data0_int16x8_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base_in + w));
+            __m128i data1_int16x8_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base_in + w + 8));
+            if (!unit) {
+                __m128i data0_int32x4_vec = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(data0_int16x8_vec)), scale_vec));
+                __m128i data1_int32x4_vec = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(data0_int16x8_vec, 8))), scale_vec));
+                __m128i data2_int32x4_vec = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(data1_int16x8_vec)), scale_vec));
+                __m128i data3_int32x4_vec = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(data1_int16x8_vec, 8))), scale_vec));
+                data0_int16x8_vec         = _mm_packs_epi32(data0_int32x4_vec, data1_int32x4_vec);
+                data1_int16x8_vec         = _mm_packs_epi32(data2_int32x4_vec, data3_int32x4_vec);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(base_out + w), _mm_packus_epi16(data0_int16x8_vec, data1_int16x8_vec));
+        }
+        for (int32_t w = (nc * width) / 16 * 16; w < (nc * width); ++w) {
+            base_out[w] = static_cast<uint8_t>(std::min(std::max(static_cast<int32_t>(std::lrint(scale * base_in[w])), 0), 255));
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode ChangeDataTypeAndScale<int16_t, float>(
+    int32_t height,
+    int32_t width,
+    int32_t nc,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    float* outData)
+{
+    __m128 scale_vec = _mm_set1_ps(scale);
+    for (int32_t h = 0; h < height; ++h) {
+        const int16_t* base_in = inData + h * inWidthStride;
+        float* base_out        = outData + h * outWidthStride;
+        for (int32_t w = 0; w < (nc * width) / 8 * 8; w += 8) {
+            __m128i data_int16x8_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base_in + w));
+            _mm_storeu_ps(base_out + w, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(data_int16x8_vec)), scale_vec));
+            _mm_storeu_ps(base_out + w + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(data_int16x8_vec, 8))), scale_vec));
+        }
+        for (int32_t w = (nc * width) / 8 * 8; w < (nc * width); ++w) {
+            base_out[w] = scale * static_cast<float>(base_in[w]);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode ChangeDataTypeAndScale<float, int16_t>(
+    int32_t height,
+    int32_t width,
+    int32_t nc,
+    int32_t inWidthStride,
+    const float* inData,
+    float scale,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    // clamped before the conversion, which turns values out of the int32_t range into INT_MIN
+    __m128 scale_vec = _mm_set1_ps(scale);
+    __m128 min_vec   = _mm_set1_ps(-32768.0f);
+    __m128 max_vec   = _mm_set1_ps(32767.0f);
+    for (int32_t h = 0; h < height; ++h) {
+        const float* base_in = inData + h * inWidthStride;
+        int16_t* base_out    = outData + h * outWidthStride;
+        for (int32_t w = 0; w < (nc * width) / 8 * 8; w += 8) {
+            __m128i data0_int32x4_vec = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(base_in + w), scale_vec), min_vec), max_vec));
+            __m128i data1_int32x4_vec = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(base_in + w + 4), scale_vec), min_vec), max_vec));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(base_out + w), _mm_packs_epi32(data0_int32x4_vec, data1_int32x4_vec));
+        }
+        for (int32_t w = (nc * width) / 8 * 8; w < (nc * width); ++w) {
+            float value = std::min(std::max(scale * base_in[w], -32768.0f), 32767.0f);
+            base_out[w] = static_cast<int16_t>(std::lrint(value));
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
 template <>
 ::ppl::common::RetCode ConvertTo<float, 1, uint8_t>(
     int32_t height,
@@ -230,6 +380,423 @@ template <>
     return ChangeDataTypeAndScale<uint8_t, float>(height, width, 4, inWidthStride, inData, scale, outWidthStride, outData);
 }
 
+template <>
+::ppl::common::RetCode ConvertTo<float, 1, float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData,
+    float scale,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<float, float>(height, width, 1, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<float, 3, float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData,
+    float scale,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<float, float>(height, width, 3, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<float, 4, float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData,
+    float scale,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<float, float>(height, width, 4, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<uint8_t, 1, uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<uint8_t, uint8_t>(height, width, 1, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<uint8_t, 3, uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<uint8_t, uint8_t>(height, width, 3, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<uint8_t, 4, uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<uint8_t, uint8_t>(height, width, 4, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<int16_t, 1, uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<int16_t, uint8_t>(height, width, 1, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<int16_t, 3, uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<int16_t, uint8_t>(height, width, 3, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<int16_t, 4, uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<int16_t, uint8_t>(height, width, 4, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<int16_t, 1, float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<int16_t, float>(height, width, 1, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<int16_t, 3, float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<int16_t, float>(height, width, 3, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<int16_t, 4, float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    float scale,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<int16_t, float>(height, width, 4, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<float, 1, int16_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData,
+    float scale,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<float, int16_t>(height, width, 1, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<float, 3, int16_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData,
+    float scale,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<float, int16_t>(height, width, 3, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode ConvertTo<float, 4, int16_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData,
+    float scale,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ChangeDataTypeAndScale<float, int16_t>(height, width, 4, inWidthStride, inData, scale, outWidthStride, outData);
+}
+
+// saturate(|src * scale + delta|), without the float round trip when scale is 1 and delta 0
+static void convert_scale_abs_row(const int16_t* src, int32_t len, float scale, float delta, uint8_t* dst)
+{
+    int32_t i = 0;
+    if (scale == 1.0f && delta == 0.0f) {
+        const __m128i vmax = _mm_set1_epi16(255);
+        for (; i <= len - 16; i += 16) {
+            __m128i v0 = _mm_min_epu16(_mm_abs_epi16(_mm_loadu_si128((const __m128i*)(src + i))), vmax);
+            __m128i v1 = _mm_min_epu16(_mm_abs_epi16(_mm_loadu_si128((const __m128i*)(src + i + 8))), vmax);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(v0, v1));
+        }
+    } else {
+        const __m128 vscale = _mm_set1_ps(scale);
+        const __m128 vdelta = _mm_set1_ps(delta);
+        const __m128 vabs   = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        const __m128 vmax   = _mm_set1_ps(255.0f);
+        for (; i <= len - 16; i += 16) {
+            __m128i v0 = _mm_loadu_si128((const __m128i*)(src + i));
+            __m128i v1 = _mm_loadu_si128((const __m128i*)(src + i + 8));
+            __m128 f0  = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(v0));
+            __m128 f1  = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(v0, 8)));
+            __m128 f2  = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(v1));
+            __m128 f3  = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(v1, 8)));
+            __m128i r0 = _mm_cvtps_epi32(_mm_min_ps(_mm_and_ps(_mm_add_ps(_mm_mul_ps(f0, vscale), vdelta), vabs), vmax));
+            __m128i r1 = _mm_cvtps_epi32(_mm_min_ps(_mm_and_ps(_mm_add_ps(_mm_mul_ps(f1, vscale), vdelta), vabs), vmax));
+            __m128i r2 = _mm_cvtps_epi32(_mm_min_ps(_mm_and_ps(_mm_add_ps(_mm_mul_ps(f2, vscale), vdelta), vabs), vmax));
+            __m128i r3 = _mm_cvtps_epi32(_mm_min_ps(_mm_and_ps(_mm_add_ps(_mm_mul_ps(f3, vscale), vdelta), vabs), vmax));
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(_mm_packs_epi32(r0, r1), _mm_packs_epi32(r2, r3)));
+        }
+    }
+    for (; i < len; ++i) {
+        dst[i] = static_cast<uint8_t>(std::lrint(std::min(std::abs(src[i] * scale + delta), 255.0f)));
+    }
+}
+
+static void convert_scale_abs_row(const float* src, int32_t len, float scale, float delta, uint8_t* dst)
+{
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vdelta = _mm_set1_ps(delta);
+    const __m128 vabs   = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 vmax   = _mm_set1_ps(255.0f);
+    int32_t i           = 0;
+    for (; i <= len - 16; i += 16) {
+        __m128i r0 = _mm_cvtps_epi32(_mm_min_ps(_mm_and_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), vscale), vdelta), vabs), vmax));
+        __m128i r1 = _mm_cvtps_epi32(_mm_min_ps(_mm_and_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), vscale), vdelta), vabs), vmax));
+        __m128i r2 = _mm_cvtps_epi32(_mm_min_ps(_mm_and_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 8), vscale), vdelta), vabs), vmax));
+        __m128i r3 = _mm_cvtps_epi32(_mm_min_ps(_mm_and_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 12), vscale), vdelta), vabs), vmax));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(_mm_packs_epi32(r0, r1), _mm_packs_epi32(r2, r3)));
+    }
+    for (; i < len; ++i) {
+        dst[i] = static_cast<uint8_t>(std::lrint(std::min(std::abs(src[i] * scale + delta), 255.0f)));
+    }
+}
+
+template <typename TSrc, int32_t channels>
+::ppl::common::RetCode ConvertScaleAbs(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const TSrc* inData,
+    float scale,
+    float delta,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride <= 0 || outWidthStride <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    for (int32_t h = 0; h < height; ++h) {
+        convert_scale_abs_row(inData + h * inWidthStride, width * channels, scale, delta, outData + h * outWidthStride);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode ConvertScaleAbs<int16_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t* inData, float scale, float delta, int32_t outWidthStride, uint8_t* outData);
+template ::ppl::common::RetCode ConvertScaleAbs<int16_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t* inData, float scale, float delta, int32_t outWidthStride, uint8_t* outData);
+template ::ppl::common::RetCode ConvertScaleAbs<int16_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t* inData, float scale, float delta, int32_t outWidthStride, uint8_t* outData);
+template ::ppl::common::RetCode ConvertScaleAbs<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, float scale, float delta, int32_t outWidthStride, uint8_t* outData);
+template ::ppl::common::RetCode ConvertScaleAbs<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, float scale, float delta, int32_t outWidthStride, uint8_t* outData);
+template ::ppl::common::RetCode ConvertScaleAbs<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, float scale, float delta, int32_t outWidthStride, uint8_t* outData);
+
 }
 }
 } // namespace ppl::cv::x86
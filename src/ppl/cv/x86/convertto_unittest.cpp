@@ -64,3 +64,55 @@ TEST(CONVERT_UINT8_TO_FP32, x86)
     Uint8_To_FP32_Test<3>(640, 720);
     Uint8_To_FP32_Test<4>(640, 720);
 }
+
+template <typename TSrc, int32_t nc, typename TDst>
+void Int16_Convert_Test(int32_t height, int32_t width, float scale, TSrc minValue, TSrc maxValue)
+{
+    std::unique_ptr<TSrc[]> src(new TSrc[width * height * nc]);
+    std::unique_ptr<TDst[]> dst_ref(new TDst[width * height * nc]);
+    std::unique_ptr<TDst[]> dst(new TDst[width * height * nc]);
+    ppl::cv::debug::randomFill<TSrc>(src.get(), width * height * nc, minValue, maxValue);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<TSrc>::depth, nc), src.get(), sizeof(TSrc) * width * nc);
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(cv::DataType<TDst>::depth, nc), dst_ref.get(), sizeof(TDst) * width * nc);
+    ppl::cv::x86::ConvertTo<TSrc, nc, TDst>(height, width, width * nc, src.get(), scale, width * nc, dst.get());
+    src_opencv.convertTo(dst_opencv, cv::DataType<TDst>::depth, scale);
+    checkResult<TDst, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, 1.01f);
+}
+
+template <typename TSrc, int32_t nc>
+void ConvertScaleAbs_Test(int32_t height, int32_t width, float scale, float delta, TSrc minValue, TSrc maxValue)
+{
+    std::unique_ptr<TSrc[]> src(new TSrc[width * height * nc]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[width * height * nc]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * nc]);
+    ppl::cv::debug::randomFill<TSrc>(src.get(), width * height * nc, minValue, maxValue);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<TSrc>::depth, nc), src.get(), sizeof(TSrc) * width * nc);
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(CV_8U, nc), dst_ref.get(), sizeof(uint8_t) * width * nc);
+    ppl::cv::x86::ConvertScaleAbs<TSrc, nc>(height, width, width * nc, src.get(), scale, delta, width * nc, dst.get());
+    cv::convertScaleAbs(src_opencv, dst_opencv, scale, delta);
+    checkResult<uint8_t, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, 1.01f);
+}
+
+TEST(CONVERT_INT16, x86)
+{
+    Int16_Convert_Test<int16_t, 1, uint8_t>(640, 720, 1.0f, -32768, 32767);
+    Int16_Convert_Test<int16_t, 3, uint8_t>(640, 720, 0.25f, -1024, 1024);
+    Int16_Convert_Test<int16_t, 4, uint8_t>(640, 720, 1.0f, -300, 300);
+    Int16_Convert_Test<int16_t, 1, float>(640, 720, 1.0f / 256, -32768, 32767);
+    Int16_Convert_Test<int16_t, 3, float>(640, 720, 1.0f, -32768, 32767);
+    Int16_Convert_Test<int16_t, 4, float>(640, 720, 2.0f, -32768, 32767);
+    Int16_Convert_Test<float, 1, int16_t>(640, 720, 1.0f, -40000.f, 40000.f);
+    Int16_Convert_Test<float, 3, int16_t>(640, 720, 256.0f, -200.f, 200.f);
+    Int16_Convert_Test<float, 4, int16_t>(640, 720, 1.0f, -100.f, 100.f);
+}
+
+// the usual way to display the int16_t gradients of Sobel
+TEST(CONVERT_SCALE_ABS, x86)
+{
+    ConvertScaleAbs_Test<int16_t, 1>(640, 720, 1.0f, 0.0f, -1024, 1024);
+    ConvertScaleAbs_Test<int16_t, 3>(640, 720, 0.5f, 3.0f, -32768, 32767);
+    ConvertScaleAbs_Test<int16_t, 4>(640, 720, 1.0f, 0.0f, -32768, 32767);
+    ConvertScaleAbs_Test<float, 1>(640, 720, 1.0f, 0.0f, -300.f, 300.f);
+    ConvertScaleAbs_Test<float, 3>(640, 720, 255.0f, 0.0f, -1.f, 1.f);
+    ConvertScaleAbs_Test<float, 4>(640, 720, 0.5f, -2.0f, -600.f, 600.f);
+}
@@ -207,6 +207,40 @@ template ::ppl::common::RetCode CopyMakeBorder<uint8_t, 4>(
     BorderType border_type,
     uint8_t border_value);
 
+template ::ppl::common::RetCode CopyMakeBorder<uint16_t, 1>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const uint16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    uint16_t *dst,
+    BorderType border_type,
+    uint16_t border_value);
+template ::ppl::common::RetCode CopyMakeBorder<uint16_t, 3>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const uint16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    uint16_t *dst,
+    BorderType border_type,
+    uint16_t border_value);
+template ::ppl::common::RetCode CopyMakeBorder<uint16_t, 4>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const uint16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    uint16_t *dst,
+    BorderType border_type,
+    uint16_t border_value);
+
 template ::ppl::common::RetCode CopyMakeBorder<float, 1>(
     int32_t srcHeight,
     int32_t srcWidth,
@@ -17,6 +17,7 @@
 
 #include "ppl/cv/x86/erode.h"
 #include "ppl/cv/x86/morph.hpp"
+#include "ppl/cv/x86/inplace.hpp"
 
 #include "ppl/cv/types.h"
 #include "ppl/common/sys.h"
@@ -249,6 +250,49 @@ template <typename T>
     return ppl::common::RC_SUCCESS;
 }
 
+template <typename T, int32_t cn>
+struct ErodeRows {
+    int32_t width;
+    int32_t kernelx_len;
+    int32_t kernely_len;
+    const uint8_t* element;
+    BorderType border_type;
+    T border_value;
+
+    ErodeRows(int32_t width, int32_t kernelx_len, int32_t kernely_len, const uint8_t* element, BorderType border_type, T border_value)
+        : width(width)
+        , kernelx_len(kernelx_len)
+        , kernely_len(kernely_len)
+        , element(element)
+        , border_type(border_type)
+        , border_value(border_value) {}
+    ::ppl::common::RetCode operator()(int32_t height, int32_t inWidthStride, const T* inData, int32_t outWidthStride, T* outData) const
+    {
+        return Erode<T, cn>(height, width, inWidthStride, inData, kernelx_len, kernely_len, element, outWidthStride, outData, border_type, border_value);
+    }
+};
+
+// inData == outData: the rows are filtered band by band through a ring of halo rows as deep as the kernel radius
+template <typename T, int32_t cn>
+static ::ppl::common::RetCode x86erode_inplace(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t kernelx_len,
+    int32_t kernely_len,
+    const uint8_t* element,
+    int32_t outWidthStride,
+    T* data,
+    BorderType border_type,
+    T border_value)
+{
+    if (inWidthStride != outWidthStride) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int32_t radius = std::max(kernelx_len, kernely_len) / 2;
+    return inplace_filter_rows(height, width * cn, outWidthStride, data, radius, ErodeRows<T, cn>(width, kernelx_len, kernely_len, element, border_type, border_value));
+}
+
 template <>
 ::ppl::common::RetCode Erode<uint8_t, 1>(
     int32_t height,
@@ -266,6 +310,9 @@ template <>
     if (!inData || !outData || !element || height == 0 || width == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86erode_inplace<uint8_t, 1>(height, width, inWidthStride, kernelx_len, kernely_len, element, outWidthStride, outData, border_type, border_value);
+    }
     if (!isErodeBorderSupported(border_type)) {
         return ppl::common::RC_UNSUPPORTED;
     }
@@ -312,6 +359,9 @@ template <>
     if (!inData || !outData || !element || height == 0 || width == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86erode_inplace<uint8_t, 3>(height, width, inWidthStride, kernelx_len, kernely_len, element, outWidthStride, outData, border_type, border_value);
+    }
     if (!isErodeBorderSupported(border_type)) {
         return ppl::common::RC_UNSUPPORTED;
     }
@@ -359,6 +409,9 @@ template <>
     if (!inData || !outData || !element || height == 0 || width == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86erode_inplace<uint8_t, 4>(height, width, inWidthStride, kernelx_len, kernely_len, element, outWidthStride, outData, border_type, border_value);
+    }
     if (!isErodeBorderSupported(border_type)) {
         return ppl::common::RC_UNSUPPORTED;
     }
@@ -406,6 +459,9 @@ template <>
     if (!inData || !outData || !element || height == 0 || width == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86erode_inplace<float, 1>(height, width, inWidthStride, kernelx_len, kernely_len, element, outWidthStride, outData, border_type, border_value);
+    }
     if (!isErodeBorderSupported(border_type)) {
         return ppl::common::RC_UNSUPPORTED;
     }
@@ -453,6 +509,9 @@ template <>
     if (!inData || !outData || !element || height == 0 || width == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86erode_inplace<float, 3>(height, width, inWidthStride, kernelx_len, kernely_len, element, outWidthStride, outData, border_type, border_value);
+    }
     if (!isErodeBorderSupported(border_type)) {
         return ppl::common::RC_UNSUPPORTED;
     }
@@ -500,6 +559,9 @@ template <>
     if (!inData || !outData || !element || height == 0 || width == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86erode_inplace<float, 4>(height, width, inWidthStride, kernelx_len, kernely_len, element, outWidthStride, outData, border_type, border_value);
+    }
     if (!isErodeBorderSupported(border_type)) {
         return ppl::common::RC_UNSUPPORTED;
     }
@@ -0,0 +1,494 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/findcontours.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// chain code directions, counterclockwise starting from the right neighbour
+static const int32_t kChainDeltaX[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+static const int32_t kChainDeltaY[8] = {0, -1, -1, -1, 0, 1, 1, 1};
+
+// contours found in a band of rows which does not share any foreground pixel with other bands
+struct ContourBand {
+    int32_t rowBegin; // first padded row of the band
+    int32_t rowEnd;   // one past the last padded row of the band
+    std::vector<std::vector<Point2i> > contours;
+    std::vector<int32_t> parents; // index into contours of this band, -1 for the image frame
+};
+
+// converts the source into a zero padded label image of 0's and 1's, and flags the rows without foreground pixel
+static void initLabels(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t paddedWidth,
+    int32_t *labels,
+    uint8_t *emptyRows)
+{
+    memset(labels, 0, paddedWidth * sizeof(int32_t));
+    memset(labels + (height + 1) * paddedWidth, 0, paddedWidth * sizeof(int32_t));
+    const __m128i v_one = _mm_set1_epi8(1);
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        int32_t *dst       = labels + (i + 1) * paddedWidth;
+        dst[0]             = 0;
+        dst[width + 1]     = 0;
+        dst += 1;
+        __m128i v_any = _mm_setzero_si128();
+        int32_t j     = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i v_src = _mm_min_epu8(_mm_loadu_si128((const __m128i *)(src + j)), v_one);
+            v_any         = _mm_or_si128(v_any, v_src);
+            _mm_storeu_si128((__m128i *)(dst + j + 0), _mm_cvtepu8_epi32(v_src));
+            _mm_storeu_si128((__m128i *)(dst + j + 4), _mm_cvtepu8_epi32(_mm_srli_si128(v_src, 4)));
+            _mm_storeu_si128((__m128i *)(dst + j + 8), _mm_cvtepu8_epi32(_mm_srli_si128(v_src, 8)));
+            _mm_storeu_si128((__m128i *)(dst + j + 12), _mm_cvtepu8_epi32(_mm_srli_si128(v_src, 12)));
+        }
+        int32_t any = _mm_movemask_epi8(_mm_cmpeq_epi8(v_any, _mm_setzero_si128())) != 0xFFFF;
+        for (; j < width; ++j) {
+            dst[j] = src[j] != 0;
+            any |= dst[j];
+        }
+        emptyRows[i] = !any;
+    }
+}
+
+// returns the first position in [x, end) whose label differs from prev, or end.
+// background and untouched foreground runs are skipped 16 labels at a time.
+static inline int32_t skipRun(
+    const int32_t *row,
+    int32_t x,
+    int32_t end,
+    int32_t prev)
+{
+    const __m128i v_prev = _mm_set1_epi32(prev);
+    for (; x <= end - 16; x += 16) {
+        __m128i v_eq0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(row + x + 0)), v_prev);
+        __m128i v_eq1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(row + x + 4)), v_prev);
+        __m128i v_eq2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(row + x + 8)), v_prev);
+        __m128i v_eq3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(row + x + 12)), v_prev);
+        __m128i v_eq  = _mm_packs_epi16(_mm_packs_epi32(v_eq0, v_eq1), _mm_packs_epi32(v_eq2, v_eq3));
+        if (_mm_movemask_epi8(v_eq) != 0xFFFF) {
+            break;
+        }
+    }
+    for (; x < end && row[x] == prev; ++x)
+        ;
+    return x;
+}
+
+// follows one border starting at (x, y) of the padded label image, and marks its pixels with nbd.
+// pixels whose right neighbour is a 0-pixel examined during the following are marked with -nbd.
+static void followBorder(
+    int32_t *labels,
+    int32_t paddedWidth,
+    int32_t x,
+    int32_t y,
+    bool isHole,
+    int32_t nbd,
+    ContourApproximationModes method,
+    int32_t offsetX,
+    int32_t offsetY,
+    std::vector<Point2i> &contour)
+{
+    int32_t deltas[16];
+    for (int32_t s = 0; s < 8; ++s) {
+        deltas[s]     = kChainDeltaY[s] * paddedWidth + kChainDeltaX[s];
+        deltas[s + 8] = deltas[s];
+    }
+
+    int32_t *i0 = labels + y * paddedWidth + x;
+    Point2i pt  = {x - 1 + offsetX, y - 1 + offsetY};
+    int32_t s   = isHole ? 0 : 4;
+    int32_t s_end = s;
+    int32_t *i1;
+    do {
+        s  = (s - 1) & 7;
+        i1 = i0 + deltas[s];
+    } while (*i1 == 0 && s != s_end);
+
+    if (s == s_end) {
+        *i0 = -nbd;
+        contour.push_back(pt);
+        return;
+    }
+
+    int32_t *i3    = i0;
+    int32_t *i4    = i0;
+    int32_t prev_s = s ^ 4;
+    for (;;) {
+        s_end = s;
+        while (s < 15) {
+            i4 = i3 + deltas[++s];
+            if (*i4 != 0) {
+                break;
+            }
+        }
+        s &= 7;
+
+        if ((uint32_t)(s - 1) < (uint32_t)s_end) {
+            *i3 = -nbd;
+        } else if (*i3 == 1) {
+            *i3 = nbd;
+        }
+
+        if (s != prev_s || method == CHAIN_APPROX_NONE) {
+            contour.push_back(pt);
+            prev_s = s;
+        }
+        pt.x += kChainDeltaX[s];
+        pt.y += kChainDeltaY[s];
+
+        if (i4 == i0 && i3 == i1) {
+            break;
+        }
+        i3 = i4;
+        s  = (s + 4) & 7;
+    }
+}
+
+// raster scan of the rows [rowBegin, rowEnd) of the padded label image (Suzuki85).
+static void traceBand(
+    int32_t *labels,
+    int32_t paddedWidth,
+    ContourRetrievalModes mode,
+    ContourApproximationModes method,
+    int32_t offsetX,
+    int32_t offsetY,
+    ContourBand &band)
+{
+    // border attributes indexed by the border number, border 1 is the image frame
+    std::vector<uint8_t> borderIsHole(2, 1);
+    std::vector<int32_t> borderParent(2, 0);
+    std::vector<int32_t> borderContour(2, -1);
+
+    int32_t nbd       = 1;
+    const int32_t end = paddedWidth - 1;
+    for (int32_t y = band.rowBegin; y < band.rowEnd; ++y) {
+        int32_t *row     = labels + y * paddedWidth;
+        int32_t prev     = 0;
+        int32_t lastMark = 0; // signed label of the last border pixel met, 0 for the frame
+        for (int32_t x = 1; x < end; ++x) {
+            x = skipRun(row, x, end, prev);
+            if (x >= end) {
+                break;
+            }
+            int32_t p     = row[x];
+            bool isStart  = false;
+            bool isHole   = false;
+            if (prev == 0 && p == 1) {
+                isStart = true;
+            } else if (p == 0 && prev >= 1) {
+                isStart = true;
+                isHole  = true;
+                if (prev != 1) {
+                    lastMark = prev;
+                }
+            }
+
+            if (isStart && !(mode == RETR_EXTERNAL && (isHole || lastMark > 0))) {
+                int32_t parent = 1;
+                if (mode == RETR_TREE) {
+                    int32_t lnbd = lastMark == 0 ? 1 : std::abs(lastMark);
+                    parent       = (borderIsHole[lnbd] != 0) == isHole ? borderParent[lnbd] : lnbd;
+                }
+                ++nbd;
+                borderIsHole.push_back(isHole);
+                borderParent.push_back(parent);
+                borderContour.push_back((int32_t)band.contours.size());
+                band.parents.push_back(borderContour[parent]);
+                band.contours.push_back(std::vector<Point2i>());
+
+                int32_t originX = x - (isHole ? 1 : 0);
+                followBorder(labels, paddedWidth, originX, y, isHole, nbd, method, offsetX, offsetY, band.contours.back());
+                lastMark = row[originX];
+                prev     = row[x];
+                continue;
+            }
+
+            prev = p;
+            if (p != 0 && p != 1) {
+                lastMark = p;
+            }
+        }
+    }
+}
+
+::ppl::common::RetCode FindContours(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    std::vector<std::vector<Point2i> > &contours,
+    std::vector<ContourHierarchy> *hierarchy,
+    ContourRetrievalModes mode,
+    ContourApproximationModes method,
+    int32_t offsetX,
+    int32_t offsetY)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mode != RETR_EXTERNAL && mode != RETR_TREE) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (method != CHAIN_APPROX_NONE && method != CHAIN_APPROX_SIMPLE) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int32_t paddedWidth = width + 2;
+    std::vector<int32_t> labels((size_t)(height + 2) * paddedWidth);
+    std::vector<uint8_t> emptyRows(height);
+    initLabels(height, width, inWidthStride, inData, paddedWidth, labels.data(), emptyRows.data());
+
+    // an empty row separates the image into parts that can be traced independently,
+    // group the rows into bands of at least minBandRows rows cut at empty rows.
+    const int32_t minBandRows = std::max(height / 16, 32);
+    std::vector<ContourBand> bands;
+    int32_t bandBegin = 0;
+    for (int32_t i = 0; i < height; ++i) {
+        if ((emptyRows[i] && i + 1 - bandBegin >= minBandRows) || i == height - 1) {
+            ContourBand band;
+            band.rowBegin = bandBegin + 1;
+            band.rowEnd   = i + 2;
+            bands.push_back(band);
+            bandBegin = i + 1;
+        }
+    }
+
+    const int32_t bandCount = (int32_t)bands.size();
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t b = 0; b < bandCount; ++b) {
+        traceBand(labels.data(), paddedWidth, mode, method, offsetX, offsetY, bands[b]);
+    }
+
+    contours.clear();
+    std::vector<int32_t> parents;
+    for (int32_t b = 0; b < bandCount; ++b) {
+        int32_t base = (int32_t)contours.size();
+        for (size_t k = 0; k < bands[b].contours.size(); ++k) {
+            contours.push_back(std::vector<Point2i>());
+            contours.back().swap(bands[b].contours[k]);
+            int32_t parent = bands[b].parents[k];
+            parents.push_back(parent < 0 ? -1 : parent + base);
+        }
+    }
+
+    if (nullptr != hierarchy) {
+        const int32_t count = (int32_t)contours.size();
+        ContourHierarchy none = {-1, -1, -1, -1};
+        hierarchy->assign(count, none);
+        std::vector<int32_t> lastChild(count + 1, -1); // the last slot is for the image frame
+        for (int32_t k = 0; k < count; ++k) {
+            int32_t parent      = parents[k];
+            int32_t slot        = parent < 0 ? count : parent;
+            int32_t sibling     = lastChild[slot];
+            (*hierarchy)[k].parent   = parent;
+            (*hierarchy)[k].previous = sibling;
+            if (sibling >= 0) {
+                (*hierarchy)[sibling].next = k;
+            } else if (parent >= 0) {
+                (*hierarchy)[parent].firstChild = k;
+            }
+            lastChild[slot] = k;
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+// Douglas-Peucker approximation, the slices are half-open ranges of point indices on a cyclic curve.
+::ppl::common::RetCode ApproxPolyDP(
+    int32_t count,
+    const Point2i *curve,
+    double epsilon,
+    bool closed,
+    std::vector<Point2i> &approxCurve)
+{
+    if (nullptr == curve || count < 0 || epsilon < 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    approxCurve.clear();
+    if (count == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    struct Slice {
+        int32_t start;
+        int32_t end;
+    };
+    std::vector<Slice> stack;
+    std::vector<Point2i> dst(count);
+    Slice slice       = {0, 0};
+    Slice right_slice = {0, 0};
+    Point2i start_pt  = {-1000000, -1000000};
+    Point2i end_pt    = {0, 0};
+    Point2i pt        = {0, 0};
+    int32_t pos       = 0;
+    int32_t new_count = 0;
+    int32_t init_iters = 3;
+    bool is_closed    = closed;
+    bool le_eps       = false;
+    double eps        = epsilon * epsilon;
+
+    if (!is_closed) {
+        right_slice.start = count;
+        end_pt            = curve[0];
+        start_pt          = curve[count - 1];
+        if (start_pt.x != end_pt.x || start_pt.y != end_pt.y) {
+            slice.start = 0;
+            slice.end   = count - 1;
+            stack.push_back(slice);
+        } else {
+            is_closed  = true;
+            init_iters = 1;
+        }
+    }
+
+    if (is_closed) {
+        // find approximately the two farthest points of the curve
+        right_slice.start = 0;
+        for (int32_t i = 0; i < init_iters; ++i) {
+            double max_dist = 0;
+            pos             = (pos + right_slice.start) % count;
+            start_pt        = curve[pos];
+            if (++pos >= count) pos = 0;
+            for (int32_t j = 1; j < count; ++j) {
+                pt = curve[pos];
+                if (++pos >= count) pos = 0;
+                double dx   = pt.x - start_pt.x;
+                double dy   = pt.y - start_pt.y;
+                double dist = dx * dx + dy * dy;
+                if (dist > max_dist) {
+                    max_dist          = dist;
+                    right_slice.start = j;
+                }
+            }
+            le_eps = max_dist <= eps;
+        }
+
+        if (!le_eps) {
+            right_slice.end = slice.start = pos % count;
+            slice.end = right_slice.start = (right_slice.start + slice.start) % count;
+            stack.push_back(right_slice);
+            stack.push_back(slice);
+        } else {
+            dst[new_count++] = start_pt;
+        }
+    }
+
+    while (!stack.empty()) {
+        slice = stack.back();
+        stack.pop_back();
+        end_pt   = curve[slice.end];
+        pos      = slice.start;
+        start_pt = curve[pos];
+        if (++pos >= count) pos = 0;
+
+        if (pos != slice.end) {
+            double max_dist = 0;
+            double dx       = end_pt.x - start_pt.x;
+            double dy       = end_pt.y - start_pt.y;
+            while (pos != slice.end) {
+                pt = curve[pos];
+                if (++pos >= count) pos = 0;
+                double dist = std::fabs((pt.y - start_pt.y) * dx - (pt.x - start_pt.x) * dy);
+                if (dist > max_dist) {
+                    max_dist          = dist;
+                    right_slice.start = (pos + count - 1) % count;
+                }
+            }
+            le_eps = max_dist * max_dist <= eps * (dx * dx + dy * dy);
+        } else {
+            le_eps   = true;
+            start_pt = curve[slice.start];
+        }
+
+        if (le_eps) {
+            dst[new_count++] = start_pt;
+        } else {
+            right_slice.end = slice.end;
+            slice.end       = right_slice.start;
+            stack.push_back(right_slice);
+            stack.push_back(slice);
+        }
+    }
+
+    if (!is_closed) {
+        dst[new_count++] = curve[count - 1];
+    }
+
+    // remove the extra points lying on almost straight lines
+    is_closed     = closed;
+    count         = new_count;
+    int32_t open  = is_closed ? 0 : 1;
+    pos           = is_closed ? count - 1 : 0;
+    start_pt      = dst[pos];
+    if (++pos >= count) pos = 0;
+    int32_t wpos  = pos;
+    pt            = dst[pos];
+    if (++pos >= count) pos = 0;
+
+    for (int32_t i = open; i < count - open && new_count > 2; ++i) {
+        end_pt = dst[pos];
+        if (++pos >= count) pos = 0;
+        double dx    = end_pt.x - start_pt.x;
+        double dy    = end_pt.y - start_pt.y;
+        double dist  = std::fabs((pt.x - start_pt.x) * dy - (pt.y - start_pt.y) * dx);
+        double inner = (double)(pt.x - start_pt.x) * (end_pt.x - pt.x) +
+                       (double)(pt.y - start_pt.y) * (end_pt.y - pt.y);
+
+        if (dist * dist <= 0.5 * eps * (dx * dx + dy * dy) && dx != 0 && dy != 0 && inner >= 0) {
+            new_count--;
+            dst[wpos] = start_pt = end_pt;
+            if (++wpos >= count) wpos = 0;
+            pt = dst[pos];
+            if (++pos >= count) pos = 0;
+            i++;
+            continue;
+        }
+        dst[wpos] = start_pt = pt;
+        if (++wpos >= count) wpos = 0;
+        pt = end_pt;
+    }
+
+    if (!is_closed) {
+        dst[wpos] = pt;
+    }
+
+    approxCurve.assign(dst.begin(), dst.begin() + new_count);
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/findcontours.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+
+namespace {
+
+void FillMask(uint8_t* mask, int32_t height, int32_t width)
+{
+    cv::Mat maskMat(height, width, CV_8UC1, mask);
+    maskMat.setTo(0);
+    for (int32_t i = 0; i < 64; ++i) {
+        cv::Point center((i * 7919) % width, (i * 104729) % height);
+        cv::circle(maskMat, center, 4 + (i * 31) % 48, cv::Scalar(255), (i % 3 == 0) ? 3 : -1);
+    }
+}
+
+template <ppl::cv::ContourRetrievalModes mode, ppl::cv::ContourApproximationModes method>
+void BM_FindContours_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    FillMask(src.get(), height, width);
+    std::vector<std::vector<ppl::cv::Point2i> > contours;
+    std::vector<ppl::cv::x86::ContourHierarchy> hierarchy;
+    for (auto _ : state) {
+        ppl::cv::x86::FindContours(height, width, width, src.get(), contours, &hierarchy, mode, method);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_FindContours_ppl_x86, ppl::cv::RETR_EXTERNAL, ppl::cv::CHAIN_APPROX_SIMPLE)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_FindContours_ppl_x86, ppl::cv::RETR_TREE, ppl::cv::CHAIN_APPROX_NONE)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template <int mode, int method>
+static void BM_FindContours_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    FillMask(src.get(), height, width);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 1), src.get());
+    std::vector<std::vector<cv::Point> > contours;
+    std::vector<cv::Vec4i> hierarchy;
+    for (auto _ : state) {
+        cv::findContours(srcMat, contours, hierarchy, mode, method);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_FindContours_opencv_x86, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_FindContours_opencv_x86, cv::RETR_TREE, cv::CHAIN_APPROX_NONE)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! PPLCV_BENCHMARK_OPENCV
+}
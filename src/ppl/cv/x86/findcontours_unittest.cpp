@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/findcontours.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+
+// contour points with the starting point of the parent contour, used to compare contours regardless of their order
+typedef std::pair<std::vector<int32_t>, std::vector<int32_t> > ContourKey;
+
+static void FillMask(cv::Mat& mask)
+{
+    std::default_random_engine eng(clock());
+    std::uniform_int_distribution<int32_t> dis(0, 1 << 16);
+    mask.setTo(0);
+    for (int32_t i = 0; i < 40; ++i) {
+        cv::Point center(dis(eng) % mask.cols, dis(eng) % mask.rows);
+        int32_t radius    = 2 + dis(eng) % 60;
+        int32_t thickness = (dis(eng) % 3 == 0) ? 1 + dis(eng) % 4 : -1;
+        int32_t color     = (dis(eng) % 4 == 0) ? 0 : 1 + dis(eng) % 255;
+        cv::circle(mask, center, radius, cv::Scalar(color), thickness);
+    }
+}
+
+void FindContoursTest(int32_t height, int32_t width, ppl::cv::ContourRetrievalModes mode, ppl::cv::ContourApproximationModes method)
+{
+    cv::Mat src(height, width, CV_8UC1);
+    FillMask(src);
+
+    std::vector<std::vector<cv::Point> > contours_ref;
+    std::vector<cv::Vec4i> hierarchy_ref;
+    cv::findContours(src, contours_ref, hierarchy_ref, mode, method);
+
+    std::vector<std::vector<ppl::cv::Point2i> > contours;
+    std::vector<ppl::cv::x86::ContourHierarchy> hierarchy;
+    ppl::cv::x86::FindContours(height, width, width, src.ptr<uint8_t>(), contours, &hierarchy, mode, method);
+
+    ASSERT_EQ(contours.size(), contours_ref.size());
+    ASSERT_EQ(hierarchy.size(), contours.size());
+
+    std::vector<ContourKey> keys, keys_ref;
+    for (size_t i = 0; i < contours.size(); ++i) {
+        ContourKey key;
+        for (size_t k = 0; k < contours[i].size(); ++k) {
+            key.first.push_back(contours[i][k].x);
+            key.first.push_back(contours[i][k].y);
+        }
+        int32_t parent = hierarchy[i].parent;
+        if (parent >= 0) {
+            key.second.push_back(contours[parent][0].x);
+            key.second.push_back(contours[parent][0].y);
+        }
+        keys.push_back(key);
+
+        ContourKey key_ref;
+        for (size_t k = 0; k < contours_ref[i].size(); ++k) {
+            key_ref.first.push_back(contours_ref[i][k].x);
+            key_ref.first.push_back(contours_ref[i][k].y);
+        }
+        int32_t parent_ref = hierarchy_ref.empty() ? -1 : hierarchy_ref[i][3];
+        if (parent_ref >= 0) {
+            key_ref.second.push_back(contours_ref[parent_ref][0].x);
+            key_ref.second.push_back(contours_ref[parent_ref][0].y);
+        }
+        keys_ref.push_back(key_ref);
+    }
+    std::sort(keys.begin(), keys.end());
+    std::sort(keys_ref.begin(), keys_ref.end());
+    EXPECT_TRUE(keys == keys_ref);
+}
+
+void ApproxPolyDPTest(int32_t height, int32_t width, double epsilon, bool closed)
+{
+    cv::Mat src(height, width, CV_8UC1);
+    FillMask(src);
+
+    std::vector<std::vector<ppl::cv::Point2i> > contours;
+    ppl::cv::x86::FindContours(height, width, width, src.ptr<uint8_t>(), contours, nullptr, ppl::cv::RETR_TREE, ppl::cv::CHAIN_APPROX_NONE);
+
+    for (size_t i = 0; i < contours.size(); ++i) {
+        std::vector<cv::Point> curve_ref, approx_ref;
+        for (size_t k = 0; k < contours[i].size(); ++k) {
+            curve_ref.push_back(cv::Point(contours[i][k].x, contours[i][k].y));
+        }
+        cv::approxPolyDP(curve_ref, approx_ref, epsilon, closed);
+
+        std::vector<ppl::cv::Point2i> approx;
+        ppl::cv::x86::ApproxPolyDP(contours[i].size(), contours[i].data(), epsilon, closed, approx);
+
+        ASSERT_EQ(approx.size(), approx_ref.size());
+        for (size_t k = 0; k < approx.size(); ++k) {
+            EXPECT_EQ(approx[k].x, approx_ref[k].x);
+            EXPECT_EQ(approx[k].y, approx_ref[k].y);
+        }
+    }
+}
+
+TEST(FindContours_UINT8, x86)
+{
+    FindContoursTest(480, 640, ppl::cv::RETR_EXTERNAL, ppl::cv::CHAIN_APPROX_NONE);
+    FindContoursTest(480, 640, ppl::cv::RETR_EXTERNAL, ppl::cv::CHAIN_APPROX_SIMPLE);
+    FindContoursTest(480, 640, ppl::cv::RETR_TREE, ppl::cv::CHAIN_APPROX_NONE);
+    FindContoursTest(480, 640, ppl::cv::RETR_TREE, ppl::cv::CHAIN_APPROX_SIMPLE);
+    FindContoursTest(1080, 1920, ppl::cv::RETR_TREE, ppl::cv::CHAIN_APPROX_SIMPLE);
+    FindContoursTest(37, 53, ppl::cv::RETR_TREE, ppl::cv::CHAIN_APPROX_NONE);
+}
+
+TEST(ApproxPolyDP, x86)
+{
+    ApproxPolyDPTest(480, 640, 2.5, true);
+    ApproxPolyDPTest(480, 640, 1.5, false);
+    ApproxPolyDPTest(720, 1080, 6.0, true);
+}
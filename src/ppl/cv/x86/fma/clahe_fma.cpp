@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include <string.h>
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+void clahe_interpolate_row_fma(
+    int32_t width,
+    const uint8_t *src,
+    const float *lut1,
+    const float *lut2,
+    const int32_t *ind1,
+    const int32_t *ind2,
+    const float *xa,
+    const float *xa1,
+    float ya,
+    float ya1,
+    uint8_t *dst)
+{
+    const __m256 vya = _mm256_set1_ps(ya), vya1 = _mm256_set1_ps(ya1);
+    int32_t x        = 0;
+    for (; x <= width - 8; x += 8) {
+        __m256i v   = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + x)));
+        __m256i i1  = _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)(ind1 + x)), v);
+        __m256i i2  = _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)(ind2 + x)), v);
+        __m256 wl   = _mm256_loadu_ps(xa1 + x), wr = _mm256_loadu_ps(xa + x);
+        __m256 top  = _mm256_fmadd_ps(_mm256_i32gather_ps(lut1, i1, 4), wl, _mm256_mul_ps(_mm256_i32gather_ps(lut1, i2, 4), wr));
+        __m256 bot  = _mm256_fmadd_ps(_mm256_i32gather_ps(lut2, i1, 4), wl, _mm256_mul_ps(_mm256_i32gather_ps(lut2, i2, 4), wr));
+        __m256i res = _mm256_cvtps_epi32(_mm256_fmadd_ps(top, vya1, _mm256_mul_ps(bot, vya)));
+        __m128i r16 = _mm_packs_epi32(_mm256_castsi256_si128(res), _mm256_extracti128_si256(res, 1));
+        _mm_storel_epi64((__m128i *)(dst + x), _mm_packus_epi16(r16, r16));
+    }
+    for (; x < width; ++x) {
+        const int32_t v = src[x];
+        float res       = (lut1[ind1[x] + v] * xa1[x] + lut1[ind2[x] + v] * xa[x]) * ya1 +
+                    (lut2[ind1[x] + v] * xa1[x] + lut2[ind2[x] + v] * xa[x]) * ya;
+        dst[x] = (uint8_t)std::min(std::max((int32_t)std::lrint(res), 0), 255);
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
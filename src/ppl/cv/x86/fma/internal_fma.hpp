@@ -198,31 +198,19 @@ template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
     const double *M,
     T delta);
 
-template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
-::ppl::common::RetCode warpperspective_linear(
-    int32_t inHeight,
-    int32_t inWidth,
-    int32_t inWidthStride,
-    int32_t outHeight,
-    int32_t outWidth,
-    int32_t outWidthStride,
-    T *dst,
-    const T *src,
-    const double M[][3],
-    T delta);
-
-template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
-::ppl::common::RetCode warpperspective_nearest(
-    int32_t inHeight,
-    int32_t inWidth,
-    int32_t inWidthStride,
-    int32_t outHeight,
-    int32_t outWidth,
-    int32_t outWidthStride,
-    T *dst,
-    const T *src,
+void warpperspective_project_block_fma(
     const double M[][3],
-    T delta);
+    int32_t i,
+    int32_t j0,
+    int32_t len,
+    int32_t bits,
+    int32_t limX,
+    int32_t limY,
+    int32_t *sx,
+    int32_t *sy,
+    int32_t *fx,
+    int32_t *fy,
+    uint8_t *inside);
 
 template <typename T, int32_t nc>
 ::ppl::common::RetCode splitAOS2SOA(
@@ -306,5 +294,54 @@ void mergeSOA2AOS(
     int32_t outWidthStride,
     T *out);
 
+void stereo_update_column_cost_fma(
+    const uint8_t *addL,
+    const uint8_t *addR,
+    const uint8_t *subL,
+    const uint8_t *subR,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t numD,
+    uint16_t *colCost);
+
+void stereo_aggregate_row_cost_fma(
+    const uint16_t *colCost,
+    int32_t radius,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t numD,
+    uint16_t *rowCost);
+
+void clahe_interpolate_row_fma(
+    int32_t width,
+    const uint8_t *src,
+    const float *lut1,
+    const float *lut2,
+    const int32_t *ind1,
+    const int32_t *ind2,
+    const float *xa,
+    const float *xa1,
+    float ya,
+    float ya1,
+    uint8_t *dst);
+
+void resize_filter_horizontal_f32_fma(
+    const float *src,
+    int32_t channels,
+    int32_t outWidth,
+    const int32_t *start,
+    const int32_t *count,
+    const float *weights,
+    int32_t ksize,
+    float *dst);
+
+void resize_filter_vertical_f32_fma(
+    const float *src,
+    size_t srcStride,
+    int32_t n,
+    const float *w,
+    int32_t width,
+    float *dst);
+
 }}}} // namespace ppl::cv::x86::fma
 #endif //! PPL_CV_X86_INTERNAL_FMA_H_
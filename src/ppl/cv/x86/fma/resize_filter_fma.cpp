@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include <string.h>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+static inline __m128 hsum4_ps(__m256 a0, __m256 a1, __m256 a2, __m256 a3)
+{
+    __m256 s = _mm256_hadd_ps(_mm256_hadd_ps(a0, a1), _mm256_hadd_ps(a2, a3));
+    return _mm_add_ps(_mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1));
+}
+
+void resize_filter_horizontal_f32_fma(
+    const float *src,
+    int32_t channels,
+    int32_t outWidth,
+    const int32_t *start,
+    const int32_t *count,
+    const float *weights,
+    int32_t ksize,
+    float *dst)
+{
+    if (channels == 1) {
+        int32_t i = 0;
+        for (; i <= outWidth - 4; i += 4) {
+            const float *s0 = src + start[i], *s1 = src + start[i + 1], *s2 = src + start[i + 2], *s3 = src + start[i + 3];
+            const float *w0 = weights + (size_t)i * ksize;
+            __m256 a0 = _mm256_setzero_ps(), a1 = a0, a2 = a0, a3 = a0;
+            for (int32_t k = 0; k < ksize; k += 8) {
+                a0 = _mm256_fmadd_ps(_mm256_loadu_ps(s0 + k), _mm256_loadu_ps(w0 + k), a0);
+                a1 = _mm256_fmadd_ps(_mm256_loadu_ps(s1 + k), _mm256_loadu_ps(w0 + ksize + k), a1);
+                a2 = _mm256_fmadd_ps(_mm256_loadu_ps(s2 + k), _mm256_loadu_ps(w0 + 2 * ksize + k), a2);
+                a3 = _mm256_fmadd_ps(_mm256_loadu_ps(s3 + k), _mm256_loadu_ps(w0 + 3 * ksize + k), a3);
+            }
+            _mm_storeu_ps(dst + i, hsum4_ps(a0, a1, a2, a3));
+        }
+        for (; i < outWidth; ++i) {
+            const float *s  = src + start[i];
+            const float *w0 = weights + (size_t)i * ksize;
+            float sum       = 0.f;
+            for (int32_t k = 0; k < count[i]; ++k) {
+                sum += s[k] * w0[k];
+            }
+            dst[i] = sum;
+        }
+    } else if (channels == 4) {
+        // two taps per vector, the halves are added at the end
+        for (int32_t i = 0; i < outWidth; ++i) {
+            const float *s  = src + start[i] * 4;
+            const float *w0 = weights + (size_t)i * ksize;
+            __m256 acc      = _mm256_setzero_ps();
+            for (int32_t k = 0; k < count[i]; k += 2) {
+                __m256 wk = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(w0[k])), _mm_set1_ps(w0[k + 1]), 1);
+                acc       = _mm256_fmadd_ps(_mm256_loadu_ps(s + k * 4), wk, acc);
+            }
+            _mm_storeu_ps(dst + i * 4, _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1)));
+        }
+    } else {
+        for (int32_t i = 0; i < outWidth; ++i) {
+            const float *s  = src + start[i] * channels;
+            const float *w0 = weights + (size_t)i * ksize;
+            __m128 acc      = _mm_setzero_ps();
+            for (int32_t k = 0; k < count[i]; ++k) {
+                acc = _mm_fmadd_ps(_mm_loadu_ps(s + k * channels), _mm_set1_ps(w0[k]), acc);
+            }
+            _mm_storeu_ps(dst + i * channels, acc);
+        }
+    }
+}
+
+void resize_filter_vertical_f32_fma(
+    const float *src,
+    size_t srcStride,
+    int32_t n,
+    const float *w,
+    int32_t width,
+    float *dst)
+{
+    int32_t x = 0;
+    for (; x <= width - 32; x += 32) {
+        __m256 a0 = _mm256_setzero_ps(), a1 = a0, a2 = a0, a3 = a0;
+        for (int32_t k = 0; k < n; ++k) {
+            const float *r  = src + k * srcStride + x;
+            const __m256 wk = _mm256_set1_ps(w[k]);
+            a0 = _mm256_fmadd_ps(_mm256_loadu_ps(r), wk, a0);
+            a1 = _mm256_fmadd_ps(_mm256_loadu_ps(r + 8), wk, a1);
+            a2 = _mm256_fmadd_ps(_mm256_loadu_ps(r + 16), wk, a2);
+            a3 = _mm256_fmadd_ps(_mm256_loadu_ps(r + 24), wk, a3);
+        }
+        _mm256_storeu_ps(dst + x, a0);
+        _mm256_storeu_ps(dst + x + 8, a1);
+        _mm256_storeu_ps(dst + x + 16, a2);
+        _mm256_storeu_ps(dst + x + 24, a3);
+    }
+    for (; x <= width - 8; x += 8) {
+        __m256 a0 = _mm256_setzero_ps();
+        for (int32_t k = 0; k < n; ++k) {
+            a0 = _mm256_fmadd_ps(_mm256_loadu_ps(src + k * srcStride + x), _mm256_set1_ps(w[k]), a0);
+        }
+        _mm256_storeu_ps(dst + x, a0);
+    }
+    for (; x < width; ++x) {
+        float sum = 0.f;
+        for (int32_t k = 0; k < n; ++k) {
+            sum += src[k * srcStride + x] * w[k];
+        }
+        dst[x] = sum;
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include <string.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+void stereo_update_column_cost_fma(
+    const uint8_t *addL,
+    const uint8_t *addR,
+    const uint8_t *subL,
+    const uint8_t *subR,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t numD,
+    uint16_t *colCost)
+{
+    for (int32_t x = xBegin; x < xEnd; ++x) {
+        uint16_t *cost = colCost + x * numD;
+        __m256i al     = _mm256_set1_epi16(addL[x]);
+        if (subL) {
+            __m256i sl = _mm256_set1_epi16(subL[x]);
+            for (int32_t j = 0; j < numD; j += 16) {
+                __m256i ar = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(addR + x + j)));
+                __m256i sr = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(subR + x + j)));
+                __m256i c  = _mm256_loadu_si256((const __m256i *)(cost + j));
+                c          = _mm256_add_epi16(c, _mm256_abs_epi16(_mm256_sub_epi16(al, ar)));
+                c          = _mm256_sub_epi16(c, _mm256_abs_epi16(_mm256_sub_epi16(sl, sr)));
+                _mm256_storeu_si256((__m256i *)(cost + j), c);
+            }
+        } else {
+            for (int32_t j = 0; j < numD; j += 16) {
+                __m256i ar = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(addR + x + j)));
+                __m256i c  = _mm256_loadu_si256((const __m256i *)(cost + j));
+                c          = _mm256_add_epi16(c, _mm256_abs_epi16(_mm256_sub_epi16(al, ar)));
+                _mm256_storeu_si256((__m256i *)(cost + j), c);
+            }
+        }
+    }
+}
+
+void stereo_aggregate_row_cost_fma(
+    const uint16_t *colCost,
+    int32_t radius,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t numD,
+    uint16_t *rowCost)
+{
+    uint16_t *first = rowCost + xBegin * numD;
+    memcpy(first, colCost + (xBegin - radius) * numD, numD * sizeof(uint16_t));
+    for (int32_t k = xBegin - radius + 1; k <= xBegin + radius; ++k) {
+        const uint16_t *col = colCost + k * numD;
+        for (int32_t j = 0; j < numD; j += 16) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)(first + j));
+            _mm256_storeu_si256((__m256i *)(first + j), _mm256_add_epi16(s, _mm256_loadu_si256((const __m256i *)(col + j))));
+        }
+    }
+    for (int32_t x = xBegin + 1; x < xEnd; ++x) {
+        const uint16_t *prev = rowCost + (x - 1) * numD;
+        const uint16_t *add  = colCost + (x + radius) * numD;
+        const uint16_t *sub  = colCost + (x - radius - 1) * numD;
+        uint16_t *cur        = rowCost + x * numD;
+        for (int32_t j = 0; j < numD; j += 16) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)(prev + j));
+            s         = _mm256_add_epi16(s, _mm256_loadu_si256((const __m256i *)(add + j)));
+            s         = _mm256_sub_epi16(s, _mm256_loadu_si256((const __m256i *)(sub + j)));
+            _mm256_storeu_si256((__m256i *)(cur + j), s);
+        }
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -28,6 +28,10 @@
 #define QUANTIZED_MULTIPLIER (1 << QUANTIZED_BITS)
 #define QUANTIZED_BIAS       (1 << (QUANTIZED_BITS - 1))
 
+#define QUANTIZED_BITS_U16       15
+#define QUANTIZED_MULTIPLIER_U16 (1 << QUANTIZED_BITS_U16)
+#define QUANTIZED_BIAS_U16       (1 << (QUANTIZED_BITS_U16 - 1))
+
 namespace ppl {
 namespace cv {
 namespace x86 {
@@ -431,6 +435,120 @@ template <int32_t nc, ppl::cv::BorderType borderMode>
     return ppl::common::RC_SUCCESS;
 }
 
+// 16-bit samples take Q15 weights. The last weight is what the three truncated others leave of 1, so the weights
+// add up to exactly 2^15 and a sum of four products stays below 2^31
+template <int32_t nc, ppl::cv::BorderType borderMode>
+::ppl::common::RetCode warpaffine_linear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *dst,
+    const uint16_t *src,
+    const double *M,
+    uint16_t delta)
+{
+    uint32_t cur_mode = _MM_GET_ROUNDING_MODE();
+    _MM_SET_ROUNDING_MODE(_MM_ROUND_DOWN);
+    __m256 base_seq_vec             = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    __m256 quantized_multiplier_vec = _mm256_set1_ps(QUANTIZED_MULTIPLIER_U16);
+    __m256i quantized_one_vec       = _mm256_set1_epi32(QUANTIZED_MULTIPLIER_U16);
+    __m128i quantized_bias_vec      = _mm_set1_epi32(QUANTIZED_BIAS_U16);
+    __m256 one_vec                  = _mm256_set1_ps(1.0f);
+    __m256 m3_vec                   = _mm256_set1_ps(M[3]);
+    __m256 m0_vec                   = _mm256_set1_ps(M[0]);
+    for (int32_t i = 0; i < outHeight; i++) {
+        float base_x     = M[1] * i + M[2];
+        float base_y     = M[4] * i + M[5];
+        __m256 baseX_vec = _mm256_set1_ps(base_x);
+        __m256 baseY_vec = _mm256_set1_ps(base_y);
+        for (int32_t block_j = 0; block_j < round_up(outWidth, 8); block_j += 8) {
+            int32_t sx0_array[8];
+            int32_t sy0_array[8];
+            int32_t tab_array[4][8];
+            __m256 seq_vec   = _mm256_add_ps(base_seq_vec, _mm256_set1_ps(block_j));
+            __m256 x_vec     = _mm256_fmadd_ps(m0_vec, seq_vec, baseX_vec);
+            __m256 y_vec     = _mm256_fmadd_ps(m3_vec, seq_vec, baseY_vec);
+            __m256i sx0_vec  = _mm256_cvtps_epi32(x_vec);
+            __m256i sy0_vec  = _mm256_cvtps_epi32(y_vec);
+            __m256 u_vec     = _mm256_sub_ps(x_vec, _mm256_cvtepi32_ps(sx0_vec));
+            __m256 v_vec     = _mm256_sub_ps(y_vec, _mm256_cvtepi32_ps(sy0_vec));
+            __m256 taby0_vec = _mm256_sub_ps(one_vec, v_vec);
+            __m256 tabx0_vec = _mm256_sub_ps(one_vec, u_vec);
+            __m256i tab0_vec = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_mul_ps(taby0_vec, tabx0_vec), quantized_multiplier_vec));
+            __m256i tab1_vec = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_mul_ps(taby0_vec, u_vec), quantized_multiplier_vec));
+            __m256i tab2_vec = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_mul_ps(v_vec, tabx0_vec), quantized_multiplier_vec));
+            __m256i tab3_vec = _mm256_sub_epi32(quantized_one_vec, _mm256_add_epi32(_mm256_add_epi32(tab0_vec, tab1_vec), tab2_vec));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(tab_array[0]), tab0_vec);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(tab_array[1]), tab1_vec);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(tab_array[2]), tab2_vec);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(tab_array[3]), tab3_vec);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(sx0_array), sx0_vec);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(sy0_array), sy0_vec);
+            for (int32_t j = block_j; j < std::min(block_j + 8, outWidth); ++j) {
+                int32_t idx     = j - block_j;
+                int32_t sx0     = sx0_array[idx];
+                int32_t sy0     = sy0_array[idx];
+                int32_t tab0    = tab_array[0][idx];
+                int32_t tab1    = tab_array[1][idx];
+                int32_t tab2    = tab_array[2][idx];
+                int32_t tab3    = tab_array[3][idx];
+                uint16_t *d     = dst + i * outWidthStride + j * nc;
+                bool all_inside = (sx0 >= 0 && sx0 < (inWidth - 1) && sy0 >= 0 && sy0 < (inHeight - 1));
+                if (borderMode == ppl::cv::BORDER_TYPE_TRANSPARENT && !all_inside) {
+                    continue;
+                }
+                if (borderMode == ppl::cv::BORDER_TYPE_CONSTANT && !all_inside) {
+                    bool flag0 = (sx0 >= 0 && sx0 < inWidth && sy0 >= 0 && sy0 < inHeight);
+                    bool flag1 = (sx0 + 1 >= 0 && sx0 + 1 < inWidth && sy0 >= 0 && sy0 < inHeight);
+                    bool flag2 = (sx0 >= 0 && sx0 < inWidth && sy0 + 1 >= 0 && sy0 + 1 < inHeight);
+                    bool flag3 = (sx0 + 1 >= 0 && sx0 + 1 < inWidth && sy0 + 1 >= 0 && sy0 + 1 < inHeight);
+                    const uint16_t *t0 = src + sy0 * inWidthStride + sx0 * nc;
+                    const uint16_t *t2 = t0 + inWidthStride;
+                    for (int32_t k = 0; k < nc; k++) {
+                        int32_t v0 = flag0 ? t0[k] : delta;
+                        int32_t v1 = flag1 ? t0[nc + k] : delta;
+                        int32_t v2 = flag2 ? t2[k] : delta;
+                        int32_t v3 = flag3 ? t2[nc + k] : delta;
+                        d[k]       = (uint16_t)((tab0 * v0 + tab1 * v1 + tab2 * v2 + tab3 * v3 + QUANTIZED_BIAS_U16) >> QUANTIZED_BITS_U16);
+                    }
+                    continue;
+                }
+                int32_t sx1 = sx0 + 1;
+                int32_t sy1 = sy0 + 1;
+                if (!all_inside) {
+                    sx0 = clip(sx0, 0, inWidth - 1);
+                    sx1 = clip(sx1, 0, inWidth - 1);
+                    sy0 = clip(sy0, 0, inHeight - 1);
+                    sy1 = clip(sy1, 0, inHeight - 1);
+                }
+                const uint16_t *t0 = src + sy0 * inWidthStride + sx0 * nc;
+                const uint16_t *t1 = src + sy0 * inWidthStride + sx1 * nc;
+                const uint16_t *t2 = src + sy1 * inWidthStride + sx0 * nc;
+                const uint16_t *t3 = src + sy1 * inWidthStride + sx1 * nc;
+                if (nc == 4) {
+                    __m128i v0_vec = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(t0)));
+                    __m128i v1_vec = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(t1)));
+                    __m128i v2_vec = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(t2)));
+                    __m128i v3_vec = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(t3)));
+                    __m128i sum    = _mm_add_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_set1_epi32(tab0), v0_vec), _mm_mullo_epi32(_mm_set1_epi32(tab1), v1_vec)),
+                                                _mm_add_epi32(_mm_mullo_epi32(_mm_set1_epi32(tab2), v2_vec), _mm_mullo_epi32(_mm_set1_epi32(tab3), v3_vec)));
+                    __m128i result = _mm_srli_epi32(_mm_add_epi32(sum, quantized_bias_vec), QUANTIZED_BITS_U16);
+                    _mm_storel_epi64(reinterpret_cast<__m128i *>(d), _mm_packus_epi32(result, result));
+                } else {
+                    for (int32_t k = 0; k < nc; ++k) {
+                        d[k] = (uint16_t)((tab0 * t0[k] + tab1 * t1[k] + tab2 * t2[k] + tab3 * t3[k] + QUANTIZED_BIAS_U16) >> QUANTIZED_BITS_U16);
+                    }
+                }
+            }
+        }
+    }
+    _MM_SET_ROUNDING_MODE(cur_mode);
+    return ppl::common::RC_SUCCESS;
+}
+
 template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
 ::ppl::common::RetCode warpaffine_linear(
     int32_t inHeight,
@@ -455,6 +573,10 @@ template ::ppl::common::RetCode warpaffine_linear<uint8_t, 1, BORDER_TYPE_CONSTA
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 2, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 3, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 4, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 1, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 2, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 3, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 4, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
 template ::ppl::common::RetCode warpaffine_linear<float, 1, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_linear<float, 2, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_linear<float, 3, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
@@ -463,6 +585,10 @@ template ::ppl::common::RetCode warpaffine_linear<uint8_t, 1, BORDER_TYPE_TRANSP
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 2, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 3, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 4, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 1, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 2, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 3, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 4, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
 template ::ppl::common::RetCode warpaffine_linear<float, 1, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_linear<float, 2, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_linear<float, 3, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
@@ -471,6 +597,10 @@ template ::ppl::common::RetCode warpaffine_linear<uint8_t, 1, BORDER_TYPE_REPLIC
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 2, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 3, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_linear<uint8_t, 4, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 1, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 2, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 3, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_linear<uint16_t, 4, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
 
 template ::ppl::common::RetCode warpaffine_nearest<float, 1, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_nearest<float, 2, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
@@ -480,6 +610,10 @@ template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 1, BORDER_TYPE_CONST
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 2, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 3, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 4, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 1, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 2, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 3, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 4, BORDER_TYPE_CONSTANT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
 template ::ppl::common::RetCode warpaffine_nearest<float, 1, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_nearest<float, 2, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_nearest<float, 3, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
@@ -488,6 +622,10 @@ template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 1, BORDER_TYPE_TRANS
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 2, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 3, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 4, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 1, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 2, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 3, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 4, BORDER_TYPE_TRANSPARENT>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
 template ::ppl::common::RetCode warpaffine_nearest<float, 1, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_nearest<float, 2, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
 template ::ppl::common::RetCode warpaffine_nearest<float, 3, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *dst, const float *src, const double *M, float delta);
@@ -496,6 +634,10 @@ template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 1, BORDER_TYPE_REPLI
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 2, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 3, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
 template ::ppl::common::RetCode warpaffine_nearest<uint8_t, 4, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *dst, const uint8_t *src, const double *M, uint8_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 1, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 2, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 3, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
+template ::ppl::common::RetCode warpaffine_nearest<uint16_t, 4, BORDER_TYPE_REPLICATE>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint16_t *dst, const uint16_t *src, const double *M, uint16_t delta);
 }
 }
 }
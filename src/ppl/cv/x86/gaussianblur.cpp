@@ -23,6 +23,7 @@
 #include <string.h>
 #include <cmath>
 #include "ppl/cv/x86/copymakeborder.h"
+#include "ppl/cv/x86/inplace.hpp"
 #include <limits.h>
 #include <immintrin.h>
 #include <algorithm>
@@ -32,6 +33,10 @@ namespace ppl {
 namespace cv {
 namespace x86 {
 
+// 16-bit samples are filtered with Q15 taps
+#define GAUSSIAN_U16_BITS 15
+#define GAUSSIAN_U16_HALF (1 << (GAUSSIAN_U16_BITS - 1))
+
 int32_t borderInterpolate(int32_t p, int32_t len)
 {
     p = p < 0 ? -p : 2 * len - p - 2;
@@ -890,6 +895,131 @@ void x86GaussianBlur_b(
     pReRowFilter    = NULL;
 }
 
+// acc += x * f on eight 16-bit lanes, f a Q15 tap: the 32-bit products are rebuilt from the low and high halves
+static inline void gaussian_madd_u16(__m128i x, __m128i f, __m128i &acc_lo, __m128i &acc_hi)
+{
+    __m128i lo = _mm_mullo_epi16(x, f);
+    __m128i hi = _mm_mulhi_epu16(x, f);
+    acc_lo     = _mm_add_epi32(acc_lo, _mm_unpacklo_epi16(lo, hi));
+    acc_hi     = _mm_add_epi32(acc_hi, _mm_unpackhi_epi16(lo, hi));
+}
+
+static inline __m128i gaussian_round_u16(__m128i acc_lo, __m128i acc_hi)
+{
+    __m128i half = _mm_set1_epi32(GAUSSIAN_U16_HALF);
+    acc_lo       = _mm_srli_epi32(_mm_add_epi32(acc_lo, half), GAUSSIAN_U16_BITS);
+    acc_hi       = _mm_srli_epi32(_mm_add_epi32(acc_hi, half), GAUSSIAN_U16_BITS);
+    return _mm_packus_epi32(acc_lo, acc_hi);
+}
+
+// out[i] = sum_k src[k][i] * kernel[k], the taps are Q15 and add up to exactly 2^15 so the 32-bit sums
+// of 16-bit samples cannot overflow
+static void gaussian_taps_u16(const uint16_t **src, const std::vector<uint16_t> &kernel, int32_t length, uint16_t *out)
+{
+    const int32_t ksize = kernel.size();
+    int32_t i           = 0;
+    for (; i <= length - 8; i += 8) {
+        __m128i acc_lo = _mm_setzero_si128(), acc_hi = _mm_setzero_si128();
+        for (int32_t k = 0; k < ksize; k++) {
+            gaussian_madd_u16(_mm_loadu_si128((const __m128i *)(src[k] + i)), _mm_set1_epi16((int16_t)kernel[k]), acc_lo, acc_hi);
+        }
+        _mm_storeu_si128((__m128i *)(out + i), gaussian_round_u16(acc_lo, acc_hi));
+    }
+    for (; i < length; i++) {
+        uint32_t s = GAUSSIAN_U16_HALF;
+        for (int32_t k = 0; k < ksize; k++) {
+            s += (uint32_t)src[k][i] * kernel[k];
+        }
+        out[i] = (uint16_t)(s >> GAUSSIAN_U16_BITS);
+    }
+}
+
+template <int32_t cn>
+void x86GaussianBlur_w(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t kernel_len,
+    float sigma,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    BorderType border_type)
+{
+    std::vector<float> kernel_f;
+    createGaussianKernels(kernel_f, kernel_len, sigma, sense32F);
+
+    // rounded taps, the center one takes up the rounding error
+    std::vector<uint16_t> kernel(kernel_f.size());
+    int32_t sum = 0;
+    for (size_t i = 0; i < kernel_f.size(); i++) {
+        kernel[i] = (uint16_t)senseRound(kernel_f[i] * (1 << GAUSSIAN_U16_BITS));
+        sum += kernel[i];
+    }
+    kernel[kernel.size() / 2] += (1 << GAUSSIAN_U16_BITS) - sum;
+
+    int32_t radius        = kernel_len / 2;
+    int32_t bsrcHeight    = height + 2 * radius;
+    int32_t bsrcWidth     = width + 2 * radius;
+    int32_t bsrcWidthStep = bsrcWidth * cn;
+    int32_t rowLength     = width * cn;
+    uint16_t *bsrc        = (uint16_t *)ppl::common::AlignedAlloc(bsrcHeight * bsrcWidthStep * sizeof(uint16_t), 64);
+    uint16_t *rowFiltered = (uint16_t *)ppl::common::AlignedAlloc(bsrcHeight * rowLength * sizeof(uint16_t), 64);
+    CopyMakeBorder<uint16_t, cn>(height, width, inWidthStride, inData, bsrcHeight, bsrcWidth, bsrcWidthStep, bsrc, border_type);
+
+    std::vector<const uint16_t *> taps(kernel.size());
+    for (int32_t i = 0; i < bsrcHeight; i++) {
+        for (int32_t k = 0; k < kernel_len; k++) {
+            taps[k] = bsrc + i * bsrcWidthStep + k * cn;
+        }
+        gaussian_taps_u16(&taps[0], kernel, rowLength, rowFiltered + i * rowLength);
+    }
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t k = 0; k < kernel_len; k++) {
+            taps[k] = rowFiltered + (i + k) * rowLength;
+        }
+        gaussian_taps_u16(&taps[0], kernel, rowLength, outData + i * outWidthStride);
+    }
+    ppl::common::AlignedFree(bsrc);
+    ppl::common::AlignedFree(rowFiltered);
+}
+
+template <typename T, int32_t cn>
+struct GaussianBlurRows {
+    int32_t width;
+    int32_t kernel_len;
+    float sigma;
+    BorderType border_type;
+
+    GaussianBlurRows(int32_t width, int32_t kernel_len, float sigma, BorderType border_type)
+        : width(width)
+        , kernel_len(kernel_len)
+        , sigma(sigma)
+        , border_type(border_type) {}
+    ::ppl::common::RetCode operator()(int32_t height, int32_t inWidthStride, const T *inData, int32_t outWidthStride, T *outData) const
+    {
+        return GaussianBlur<T, cn>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
+};
+
+// inData == outData: the rows are blurred band by band through a ring of kernel_len / 2 halo rows
+template <typename T, int32_t cn>
+static ::ppl::common::RetCode x86GaussianBlur_inplace(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t kernel_len,
+    float sigma,
+    int32_t outWidthStride,
+    T *data,
+    BorderType border_type)
+{
+    if (inWidthStride != outWidthStride) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return inplace_filter_rows(height, width * cn, outWidthStride, data, kernel_len / 2, GaussianBlurRows<T, cn>(width, kernel_len, sigma, border_type));
+}
+
 template <>
 ::ppl::common::RetCode GaussianBlur<float, 3>(
     int32_t height,
@@ -908,6 +1038,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<float, 3>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
     bool bSupportAVX = ppl::common::CpuSupports(ppl::common::ISA_X86_AVX);
     if (bSupportAVX) {
         x86GaussianBlur_f_avx<3>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
@@ -935,6 +1068,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<float, 1>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
     bool bSupportAVX = ppl::common::CpuSupports(ppl::common::ISA_X86_AVX);
     if (bSupportAVX) {
         x86GaussianBlur_f_avx<1>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
@@ -961,6 +1097,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<float, 4>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
     bool bSupportAVX = ppl::common::CpuSupports(ppl::common::ISA_X86_AVX);
     if (bSupportAVX) {
         x86GaussianBlur_f_avx<4>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
@@ -988,6 +1127,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<uint8_t, 3>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
     x86GaussianBlur_b<uint8_t, 3>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
@@ -1009,6 +1151,9 @@ template <>
     if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<uint8_t, 1>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
     x86GaussianBlur_b<uint8_t, 1>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
@@ -1030,9 +1175,84 @@ template <>
     if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<uint8_t, 4>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
     x86GaussianBlur_b<uint8_t, 4>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
     return ppl::common::RC_SUCCESS;
 }
+template <>
+::ppl::common::RetCode GaussianBlur<uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t kernel_len,
+    float sigma,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<uint16_t, 3>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
+    x86GaussianBlur_w<3>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
+    return ppl::common::RC_SUCCESS;
+}
+template <>
+::ppl::common::RetCode GaussianBlur<uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t kernel_len,
+    float sigma,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<uint16_t, 1>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
+    x86GaussianBlur_w<1>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
+    return ppl::common::RC_SUCCESS;
+}
+template <>
+::ppl::common::RetCode GaussianBlur<uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t kernel_len,
+    float sigma,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width == 0 || height == 0 || inWidthStride < width || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inData == outData) {
+        return x86GaussianBlur_inplace<uint16_t, 4>(height, width, inWidthStride, kernel_len, sigma, outWidthStride, outData, border_type);
+    }
+    x86GaussianBlur_w<4>(height, width, inWidthStride, inData, kernel_len, sigma, outWidthStride, outData, border_type);
+    return ppl::common::RC_SUCCESS;
+}
 }
 }
 } // namespace ppl::cv::x86
@@ -20,7 +20,9 @@
 #include "ppl/cv/x86/test.h"
 #include <gtest/gtest.h>
 
-template<typename T, ppl::cv::BorderType border_type, int c>
+// max_value is the upper bound of the random input, 65535 covers the full uint16_t range where OpenCV's
+// fixed point kernels round differently from ours by a few levels
+template<typename T, ppl::cv::BorderType border_type, int c, int max_value = 255>
 class gaussblur_ : public  ::testing::TestWithParam<std::tuple<Size, int>> {
 public:
     using GaussblurParameter = std::tuple<Size, int>;
@@ -38,7 +40,7 @@ public:
         std::unique_ptr<T[]> src(new T[size.width * size.height * c]);
         std::unique_ptr<T[]> dst_ref(new T[size.width * size.height * c]);
         std::unique_ptr<T[]> dst(new T[size.width * size.height * c]);
-        ppl::cv::debug::randomFill<T>(src.get(), size.width * size.height * c, 0, 255);
+        ppl::cv::debug::randomFill<T>(src.get(), size.width * size.height * c, 0, max_value);
         cv::Mat src_opencv(size.height, size.width, CV_MAKETYPE(cv::DataType<T>::depth, c), src.get(), sizeof(T) * size.width * c);
         cv::Mat dst_opencv(size.height, size.width, CV_MAKETYPE(cv::DataType<T>::depth, c), dst_ref.get(), sizeof(T) * size.width * c);
         int cv_bordertype = 4;
@@ -54,12 +56,12 @@ public:
 
         checkResult<T, c>(dst_ref.get(), dst.get(),
                         size.height, size.width,
-                        size.width * c, size.width * c, 1.01f);
+                        size.width * c, size.width * c, max_value > 255 ? 3.01f : 1.01f);
     }
 };
 
-#define R(name, t, b, c) \
-    using name = gaussblur_<t, b, c>; \
+#define R_MAX(name, t, b, c, m) \
+    using name = gaussblur_<t, b, c, m>; \
     TEST_P(name, abc) \
     { \
         this->apply(GetParam());\
@@ -68,6 +70,7 @@ public:
                             ::testing::Combine(\
                             ::testing::Values(Size{320, 240}, Size{640, 480}, Size{321, 241}, Size{319, 239}),\
                             ::testing::Values(3, 5, 7)));
+#define R(name, t, b, c) R_MAX(name, t, b, c, 255)
 
 R(gaussianblur_f32c1_reflect_101, float, ppl::cv::BORDER_TYPE_REFLECT_101, 1)
 R(gaussianblur_f32c3_reflect_101, float, ppl::cv::BORDER_TYPE_REFLECT_101, 3)
@@ -75,6 +78,9 @@ R(gaussianblur_f32c4_reflect_101, float, ppl::cv::BORDER_TYPE_REFLECT_101, 4)
 R(gaussianblur_u8c1_reflect_101, uint8_t, ppl::cv::BORDER_TYPE_REFLECT_101, 1)
 R(gaussianblur_u8c3_reflect_101, uint8_t, ppl::cv::BORDER_TYPE_REFLECT_101, 3)
 R(gaussianblur_u8c4_reflect_101, uint8_t, ppl::cv::BORDER_TYPE_REFLECT_101, 4)
+R(gaussianblur_u16c1_reflect_101, uint16_t, ppl::cv::BORDER_TYPE_REFLECT_101, 1)
+R(gaussianblur_u16c3_reflect_101, uint16_t, ppl::cv::BORDER_TYPE_REFLECT_101, 3)
+R(gaussianblur_u16c4_reflect_101, uint16_t, ppl::cv::BORDER_TYPE_REFLECT_101, 4)
 
 R(gaussianblur_f32c1_reflect, float, ppl::cv::BORDER_TYPE_REFLECT, 1)
 R(gaussianblur_f32c3_reflect, float, ppl::cv::BORDER_TYPE_REFLECT, 3)
@@ -82,6 +88,9 @@ R(gaussianblur_f32c4_reflect, float, ppl::cv::BORDER_TYPE_REFLECT, 4)
 R(gaussianblur_u8c1_reflect, uint8_t, ppl::cv::BORDER_TYPE_REFLECT, 1)
 R(gaussianblur_u8c3_reflect, uint8_t, ppl::cv::BORDER_TYPE_REFLECT, 3)
 R(gaussianblur_u8c4_reflect, uint8_t, ppl::cv::BORDER_TYPE_REFLECT, 4)
+R(gaussianblur_u16c1_reflect, uint16_t, ppl::cv::BORDER_TYPE_REFLECT, 1)
+R(gaussianblur_u16c3_reflect, uint16_t, ppl::cv::BORDER_TYPE_REFLECT, 3)
+R(gaussianblur_u16c4_reflect, uint16_t, ppl::cv::BORDER_TYPE_REFLECT, 4)
 
 R(gaussianblur_f32c1_replicate, float, ppl::cv::BORDER_TYPE_REPLICATE, 1)
 R(gaussianblur_f32c3_replicate, float, ppl::cv::BORDER_TYPE_REPLICATE, 3)
@@ -89,3 +98,12 @@ R(gaussianblur_f32c4_replicate, float, ppl::cv::BORDER_TYPE_REPLICATE, 4)
 R(gaussianblur_u8c1_replicate, uint8_t, ppl::cv::BORDER_TYPE_REPLICATE, 1)
 R(gaussianblur_u8c3_replicate, uint8_t, ppl::cv::BORDER_TYPE_REPLICATE, 3)
 R(gaussianblur_u8c4_replicate, uint8_t, ppl::cv::BORDER_TYPE_REPLICATE, 4)
+R(gaussianblur_u16c1_replicate, uint16_t, ppl::cv::BORDER_TYPE_REPLICATE, 1)
+R(gaussianblur_u16c3_replicate, uint16_t, ppl::cv::BORDER_TYPE_REPLICATE, 3)
+R(gaussianblur_u16c4_replicate, uint16_t, ppl::cv::BORDER_TYPE_REPLICATE, 4)
+
+R_MAX(gaussianblur_u16c1_reflect_101_full, uint16_t, ppl::cv::BORDER_TYPE_REFLECT_101, 1, 65535)
+R_MAX(gaussianblur_u16c3_reflect_101_full, uint16_t, ppl::cv::BORDER_TYPE_REFLECT_101, 3, 65535)
+R_MAX(gaussianblur_u16c4_reflect_101_full, uint16_t, ppl::cv::BORDER_TYPE_REFLECT_101, 4, 65535)
+R_MAX(gaussianblur_u16c1_reflect_full, uint16_t, ppl::cv::BORDER_TYPE_REFLECT, 1, 65535)
+R_MAX(gaussianblur_u16c1_replicate_full, uint16_t, ppl::cv::BORDER_TYPE_REPLICATE, 1, 65535)
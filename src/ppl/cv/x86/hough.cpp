@@ -0,0 +1,766 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/hough.h"
+#include "ppl/cv/x86/sobel.h"
+#include "ppl/cv/x86/copymakeborder.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <float.h>
+#include <limits.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+#define CV_PI 3.1415926535897932384626433832795
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+static inline int32_t round_to_int(float v)
+{
+    return _mm_cvtss_si32(_mm_set_ss(v));
+}
+
+static inline int32_t round_to_int(double v)
+{
+    return _mm_cvtsd_si32(_mm_set_sd(v));
+}
+
+// positions of the set bits of every 8-bit mask, used to compact the coordinates of non-zero pixels
+struct CompactTable {
+    uint8_t count[256];
+    uint8_t index[256][8];
+    CompactTable()
+    {
+        for (int32_t m = 0; m < 256; ++m) {
+            int32_t n = 0;
+            memset(index[m], 0, 8);
+            for (int32_t b = 0; b < 8; ++b) {
+                if (m & (1 << b)) {
+                    index[m][n++] = b;
+                }
+            }
+            count[m] = n;
+        }
+    }
+};
+
+static inline int32_t compact8(const CompactTable &table, int32_t mask, int32_t base, int32_t *out)
+{
+    __m128i v_idx  = _mm_loadl_epi64((const __m128i *)table.index[mask]);
+    __m128i v_base = _mm_set1_epi32(base);
+    _mm_storeu_si128((__m128i *)(out + 0), _mm_add_epi32(_mm_cvtepu8_epi32(v_idx), v_base));
+    _mm_storeu_si128((__m128i *)(out + 4), _mm_add_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(v_idx, 4)), v_base));
+    return table.count[mask];
+}
+
+// collects the coordinates of the non-zero pixels in raster order
+static void collectNonZero(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    std::vector<int32_t> &xs,
+    std::vector<int32_t> &ys)
+{
+    static const CompactTable table;
+    std::vector<int32_t> rowXs(width + 16);
+    const __m128i v_zero = _mm_setzero_si128();
+    xs.clear();
+    ys.clear();
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        int32_t *dst       = rowXs.data();
+        int32_t count      = 0;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i v_src = _mm_loadu_si128((const __m128i *)(src + j));
+            int32_t mask  = _mm_movemask_epi8(_mm_cmpeq_epi8(v_src, v_zero)) ^ 0xFFFF;
+            if (mask == 0) {
+                continue;
+            }
+            count += compact8(table, mask & 0xFF, j, dst + count);
+            count += compact8(table, mask >> 8, j + 8, dst + count);
+        }
+        for (; j < width; ++j) {
+            if (src[j]) {
+                dst[count++] = j;
+            }
+        }
+        xs.insert(xs.end(), dst, dst + count);
+        ys.insert(ys.end(), count, i);
+    }
+}
+
+static int32_t computeNumAngle(double minTheta, double maxTheta, double thetaStep)
+{
+    int32_t numAngle = (int32_t)std::floor((maxTheta - minTheta) / thetaStep) + 1;
+    // the last angle is removed if it is the first angle plus pi, or the line would be detected twice
+    if (numAngle > 1 && std::fabs(CV_PI - (numAngle - 1) * thetaStep) < thetaStep / 2) {
+        --numAngle;
+    }
+    return numAngle;
+}
+
+// computes the rho bins of 4 points for one angle, offset to the middle of the accumulator row
+static inline __m128i houghRho4(const int32_t *xs, const int32_t *ys, __m128 v_cos, __m128 v_sin)
+{
+    __m128 v_x = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)xs));
+    __m128 v_y = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)ys));
+    return _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(v_x, v_cos), _mm_mul_ps(v_y, v_sin)));
+}
+
+struct HoughPeakGreater {
+    const int32_t *accum;
+    bool operator()(int32_t a, int32_t b) const
+    {
+        return accum[a] > accum[b] || (accum[a] == accum[b] && a < b);
+    }
+};
+
+::ppl::common::RetCode HoughLines(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    std::vector<HoughLine> &lines,
+    float rho,
+    float theta,
+    int32_t threshold,
+    double minTheta,
+    double maxTheta)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (rho <= 0 || theta <= 0 || minTheta < 0 || maxTheta < minTheta || maxTheta > CV_PI) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const float irho       = 1 / rho;
+    const int32_t numAngle = computeNumAngle(minTheta, maxTheta, theta);
+    const int32_t numRho   = round_to_int(((width + height) * 2 + 1) / rho);
+    const int32_t accStep  = numRho + 2;
+
+    std::vector<float> tabSin(numAngle), tabCos(numAngle);
+    float angle = (float)minTheta;
+    for (int32_t n = 0; n < numAngle; angle += theta, ++n) {
+        tabSin[n] = (float)(std::sin((double)angle) * irho);
+        tabCos[n] = (float)(std::cos((double)angle) * irho);
+    }
+
+    std::vector<int32_t> xs, ys;
+    collectNonZero(height, width, inWidthStride, inData, xs, ys);
+    const int32_t count = (int32_t)xs.size();
+
+    // every angle owns one accumulator row, so threads voting for different angles never collide
+    std::vector<int32_t> accum((size_t)(numAngle + 2) * accStep, 0);
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int32_t n = 0; n < numAngle; ++n) {
+        int32_t *acc         = accum.data() + (n + 1) * accStep + 1 + (numRho - 1) / 2;
+        const __m128 v_cos   = _mm_set1_ps(tabCos[n]);
+        const __m128 v_sin   = _mm_set1_ps(tabSin[n]);
+        int32_t r[4];
+        int32_t k = 0;
+        for (; k <= count - 4; k += 4) {
+            _mm_storeu_si128((__m128i *)r, houghRho4(xs.data() + k, ys.data() + k, v_cos, v_sin));
+            acc[r[0]]++;
+            acc[r[1]]++;
+            acc[r[2]]++;
+            acc[r[3]]++;
+        }
+        for (; k < count; ++k) {
+            acc[round_to_int(xs[k] * tabCos[n] + ys[k] * tabSin[n])]++;
+        }
+    }
+
+    // local maxima in the 4-neighbourhood
+    std::vector<int32_t> peaks;
+    const __m128i v_thresh = _mm_set1_epi32(threshold);
+    for (int32_t n = 0; n < numAngle; ++n) {
+        const int32_t *acc = accum.data() + (n + 1) * accStep + 1;
+        int32_t base       = (n + 1) * accStep + 1;
+        int32_t r          = 0;
+        for (; r <= numRho - 4; r += 4) {
+            __m128i v_c  = _mm_loadu_si128((const __m128i *)(acc + r));
+            __m128i v_l  = _mm_loadu_si128((const __m128i *)(acc + r - 1));
+            __m128i v_r  = _mm_loadu_si128((const __m128i *)(acc + r + 1));
+            __m128i v_u  = _mm_loadu_si128((const __m128i *)(acc + r - accStep));
+            __m128i v_d  = _mm_loadu_si128((const __m128i *)(acc + r + accStep));
+            __m128i v_gt = _mm_and_si128(_mm_cmpgt_epi32(v_c, v_thresh), _mm_cmpgt_epi32(v_c, v_l));
+            v_gt         = _mm_and_si128(v_gt, _mm_cmpgt_epi32(v_c, v_u));
+            v_gt         = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi32(v_r, v_c), _mm_cmpgt_epi32(v_d, v_c)), v_gt);
+            int32_t mask = _mm_movemask_ps(_mm_castsi128_ps(v_gt));
+            for (; mask != 0; mask &= mask - 1) {
+                int32_t lane = (mask & 1) ? 0 : (mask & 2) ? 1 : (mask & 4) ? 2 : 3;
+                peaks.push_back(base + r + lane);
+            }
+        }
+        for (; r < numRho; ++r) {
+            int32_t v = acc[r];
+            if (v > threshold && v > acc[r - 1] && v >= acc[r + 1] && v > acc[r - accStep] && v >= acc[r + accStep]) {
+                peaks.push_back(base + r);
+            }
+        }
+    }
+
+    HoughPeakGreater greater = {accum.data()};
+    std::sort(peaks.begin(), peaks.end(), greater);
+
+    lines.resize(peaks.size());
+    for (size_t i = 0; i < peaks.size(); ++i) {
+        int32_t n      = peaks[i] / accStep - 1;
+        int32_t r      = peaks[i] - (n + 1) * accStep - 1;
+        lines[i].rho   = (r - (numRho - 1) * 0.5f) * rho;
+        lines[i].theta = (float)minTheta + n * theta;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+// multiply-with-carry generator with the same sequence as cv::RNG
+struct HoughRandom {
+    uint64_t state;
+    uint32_t next()
+    {
+        state = (uint64_t)(uint32_t)state * 4164903690U + (uint32_t)(state >> 32);
+        return (uint32_t)state;
+    }
+    int32_t uniform(int32_t a, int32_t b)
+    {
+        return a == b ? a : (int32_t)(next() % (uint32_t)(b - a) + a);
+    }
+};
+
+// adds delta to the accumulator bins of point (x, y) for all angles, and returns the first angle with the most votes
+static inline int32_t voteAllAngles(
+    int32_t x,
+    int32_t y,
+    int32_t delta,
+    int32_t numAngle,
+    int32_t numRho,
+    const float *tabCos,
+    const float *tabSin,
+    int32_t *accum,
+    int32_t &maxVal)
+{
+    const __m128 v_x    = _mm_set1_ps((float)x);
+    const __m128 v_y    = _mm_set1_ps((float)y);
+    const int32_t rhoOffset = (numRho - 1) / 2;
+    int32_t maxN = 0;
+    int32_t r[4];
+    int32_t n = 0;
+    for (; n <= numAngle - 4; n += 4) {
+        __m128 v_rho = _mm_add_ps(_mm_mul_ps(v_x, _mm_loadu_ps(tabCos + n)), _mm_mul_ps(v_y, _mm_loadu_ps(tabSin + n)));
+        _mm_storeu_si128((__m128i *)r, _mm_cvtps_epi32(v_rho));
+        for (int32_t k = 0; k < 4; ++k) {
+            int32_t val = (accum[(n + k) * numRho + r[k] + rhoOffset] += delta);
+            if (maxVal < val) {
+                maxVal = val;
+                maxN   = n + k;
+            }
+        }
+    }
+    for (; n < numAngle; ++n) {
+        int32_t val = (accum[n * numRho + round_to_int(x * tabCos[n] + y * tabSin[n]) + rhoOffset] += delta);
+        if (maxVal < val) {
+            maxVal = val;
+            maxN   = n;
+        }
+    }
+    return maxN;
+}
+
+::ppl::common::RetCode HoughLinesP(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    std::vector<HoughSegment> &lines,
+    float rho,
+    float theta,
+    int32_t threshold,
+    double minLineLength,
+    double maxLineGap)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (rho <= 0 || theta <= 0 || threshold <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const float irho         = 1 / rho;
+    const int32_t numAngle   = computeNumAngle(0.0, CV_PI, theta);
+    const int32_t numRho     = round_to_int(((width + height) * 2 + 1) / rho);
+    const int32_t lineLength = round_to_int(minLineLength);
+    const int32_t lineGap    = round_to_int(maxLineGap);
+    const int32_t shift      = 16;
+
+    std::vector<float> tabCos(numAngle), tabSin(numAngle);
+    for (int32_t n = 0; n < numAngle; ++n) {
+        tabCos[n] = (float)(std::cos((double)n * theta) * irho);
+        tabSin[n] = (float)(std::sin((double)n * theta) * irho);
+    }
+
+    std::vector<int32_t> xs, ys;
+    collectNonZero(height, width, inWidthStride, inData, xs, ys);
+
+    // mask of the points not yet assigned to any line
+    std::vector<uint8_t> mask(height * width, 0);
+    for (size_t k = 0; k < xs.size(); ++k) {
+        mask[ys[k] * width + xs[k]] = 1;
+    }
+    std::vector<int32_t> accum((size_t)numAngle * numRho, 0);
+    uint8_t *mdata0 = mask.data();
+
+    HoughRandom rng = {(uint64_t)-1};
+    lines.clear();
+    for (int32_t count = (int32_t)xs.size(); count > 0; count--) {
+        // pick a random remaining point, and remove it by overriding it with the last one
+        int32_t idx = rng.uniform(0, count);
+        int32_t j   = xs[idx];
+        int32_t i   = ys[idx];
+        xs[idx]     = xs[count - 1];
+        ys[idx]     = ys[count - 1];
+
+        if (!mdata0[i * width + j]) {
+            continue;
+        }
+
+        int32_t maxVal = threshold - 1;
+        int32_t maxN   = voteAllAngles(j, i, 1, numAngle, numRho, tabCos.data(), tabSin.data(), accum.data(), maxVal);
+        if (maxVal < threshold) {
+            continue;
+        }
+
+        // walk from the point in both directions along the line, using fixed-point arithmetic
+        float a = -tabSin[maxN];
+        float b = tabCos[maxN];
+        int32_t x0 = j, y0 = i, dx0, dy0;
+        bool xflag;
+        if (std::fabs(a) > std::fabs(b)) {
+            xflag = true;
+            dx0   = a > 0 ? 1 : -1;
+            dy0   = round_to_int(b * (1 << shift) / std::fabs(a));
+            y0    = (y0 << shift) + (1 << (shift - 1));
+        } else {
+            xflag = false;
+            dy0   = b > 0 ? 1 : -1;
+            dx0   = round_to_int(a * (1 << shift) / std::fabs(b));
+            x0    = (x0 << shift) + (1 << (shift - 1));
+        }
+
+        Point2i lineEnd[2] = {{0, 0}, {0, 0}};
+        for (int32_t k = 0; k < 2; ++k) {
+            int32_t gap = 0, x = x0, y = y0, dx = k ? -dx0 : dx0, dy = k ? -dy0 : dy0;
+            for (;; x += dx, y += dy) {
+                int32_t j1 = xflag ? x : x >> shift;
+                int32_t i1 = xflag ? y >> shift : y;
+                if (j1 < 0 || j1 >= width || i1 < 0 || i1 >= height) {
+                    break;
+                }
+                if (mdata0[i1 * width + j1]) {
+                    gap          = 0;
+                    lineEnd[k].x = j1;
+                    lineEnd[k].y = i1;
+                } else if (++gap > lineGap) {
+                    break;
+                }
+            }
+        }
+
+        bool goodLine = std::abs(lineEnd[1].x - lineEnd[0].x) >= lineLength ||
+                        std::abs(lineEnd[1].y - lineEnd[0].y) >= lineLength;
+
+        // clear the points of the segment, and take back their votes if the segment is accepted
+        for (int32_t k = 0; k < 2; ++k) {
+            int32_t x = x0, y = y0, dx = k ? -dx0 : dx0, dy = k ? -dy0 : dy0;
+            for (;; x += dx, y += dy) {
+                int32_t j1 = xflag ? x : x >> shift;
+                int32_t i1 = xflag ? y >> shift : y;
+                uint8_t *mdata = mdata0 + i1 * width + j1;
+                if (*mdata) {
+                    if (goodLine) {
+                        int32_t unused = INT_MAX;
+                        voteAllAngles(j1, i1, -1, numAngle, numRho, tabCos.data(), tabSin.data(), accum.data(), unused);
+                    }
+                    *mdata = 0;
+                }
+                if (i1 == lineEnd[k].y && j1 == lineEnd[k].x) {
+                    break;
+                }
+            }
+        }
+
+        if (goodLine) {
+            HoughSegment segment = {lineEnd[0].x, lineEnd[0].y, lineEnd[1].x, lineEnd[1].y};
+            lines.push_back(segment);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+// edge map of a Canny detector with L1 gradient norm, using the gradients computed by Sobel.
+// edges are marked with 2 in map.
+static void detectEdges(
+    int32_t height,
+    int32_t width,
+    const int16_t *dxData,
+    const int16_t *dyData,
+    int32_t lowThresh,
+    int32_t highThresh,
+    uint8_t *map)
+{
+    const int32_t mapStep = width + 2;
+    std::vector<int32_t> magBuffer((size_t)(height + 2) * mapStep, 0);
+    int32_t *mag = magBuffer.data() + mapStep + 1;
+    for (int32_t i = 0; i < height; ++i) {
+        const int16_t *dx = dxData + i * width;
+        const int16_t *dy = dyData + i * width;
+        int32_t *m        = mag + i * mapStep;
+        int32_t j         = 0;
+        for (; j <= width - 8; j += 8) {
+            __m128i v_dx  = _mm_abs_epi16(_mm_loadu_si128((const __m128i *)(dx + j)));
+            __m128i v_dy  = _mm_abs_epi16(_mm_loadu_si128((const __m128i *)(dy + j)));
+            __m128i v_sum0 = _mm_add_epi32(_mm_cvtepu16_epi32(v_dx), _mm_cvtepu16_epi32(v_dy));
+            __m128i v_sum1 = _mm_add_epi32(_mm_cvtepu16_epi32(_mm_srli_si128(v_dx, 8)),
+                                           _mm_cvtepu16_epi32(_mm_srli_si128(v_dy, 8)));
+            _mm_storeu_si128((__m128i *)(m + j), v_sum0);
+            _mm_storeu_si128((__m128i *)(m + j + 4), v_sum1);
+        }
+        for (; j < width; ++j) {
+            m[j] = std::abs((int32_t)dx[j]) + std::abs((int32_t)dy[j]);
+        }
+    }
+
+    // 0: may be an edge, 1: not an edge, 2: edge
+    memset(map, 1, (size_t)(height + 2) * mapStep);
+    uint8_t *mapData = map + mapStep + 1;
+    std::vector<uint8_t *> stack;
+    const int32_t shift = 15;
+    const int32_t tg22  = (int32_t)(0.4142135623730950488016887242097 * (1 << shift) + 0.5);
+    for (int32_t i = 0; i < height; ++i) {
+        const int16_t *dx = dxData + i * width;
+        const int16_t *dy = dyData + i * width;
+        const int32_t *m  = mag + i * mapStep;
+        uint8_t *mp       = mapData + i * mapStep;
+        bool prevFlag     = false;
+        for (int32_t j = 0; j < width; ++j) {
+            int32_t v = m[j];
+            if (v > lowThresh) {
+                int32_t xs    = dx[j];
+                int32_t ys    = dy[j];
+                int32_t x     = std::abs(xs);
+                int32_t y     = std::abs(ys) << shift;
+                int32_t tg22x = x * tg22;
+                bool isMax;
+                if (y < tg22x) {
+                    isMax = v > m[j - 1] && v >= m[j + 1];
+                } else {
+                    int32_t tg67x = tg22x + (x << (shift + 1));
+                    if (y > tg67x) {
+                        isMax = v > m[j - mapStep] && v >= m[j + mapStep];
+                    } else {
+                        int32_t s = (xs ^ ys) < 0 ? -1 : 1;
+                        isMax     = v > m[j - mapStep - s] && v > m[j + mapStep + s];
+                    }
+                }
+                if (isMax) {
+                    if (!prevFlag && v > highThresh && mp[j - mapStep] != 2) {
+                        mp[j] = 2;
+                        stack.push_back(mp + j);
+                        prevFlag = true;
+                    } else {
+                        mp[j] = 0;
+                    }
+                    continue;
+                }
+            }
+            prevFlag = false;
+        }
+    }
+
+    // hysteresis
+    const int32_t offsets[8] = {-mapStep - 1, -mapStep, -mapStep + 1, -1, 1, mapStep - 1, mapStep, mapStep + 1};
+    while (!stack.empty()) {
+        uint8_t *p = stack.back();
+        stack.pop_back();
+        for (int32_t k = 0; k < 8; ++k) {
+            if (p[offsets[k]] == 0) {
+                p[offsets[k]] = 2;
+                stack.push_back(p + offsets[k]);
+            }
+        }
+    }
+}
+
+::ppl::common::RetCode HoughCircles(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    std::vector<HoughCircle> &circles,
+    double dp,
+    double minDist,
+    double param1,
+    double param2,
+    int32_t minRadius,
+    int32_t maxRadius)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (dp < 1 || minDist <= 0 || param1 <= 0 || param2 <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    minRadius = std::max(minRadius, 0);
+    if (maxRadius <= 0) {
+        maxRadius = std::max(height, width);
+    } else if (maxRadius <= minRadius) {
+        maxRadius = minRadius + 2;
+    }
+    const int32_t accThresh = round_to_int(param2);
+    const int32_t highThresh = round_to_int(param1);
+    const int32_t lowThresh  = std::max(1, round_to_int(param1 / 2));
+
+    // OpenCV takes the gradients with BORDER_REPLICATE, which Sobel does not support: the image is padded by
+    // one replicated pixel and only the inner gradients are kept
+    const int32_t padStep = width + 2;
+    std::vector<uint8_t> padded((size_t)(height + 2) * padStep);
+    std::vector<int16_t> grad(padded.size());
+    CopyMakeBorder<uint8_t, 1>(height, width, inWidthStride, inData, height + 2, padStep, padStep, padded.data(), BORDER_TYPE_REPLICATE);
+    std::vector<int16_t> dx(height * width), dy(height * width);
+    Sobel<uint8_t, int16_t, 1>(height + 2, padStep, padStep, padded.data(), padStep, grad.data(), 1, 0, 3, 1.0, 0.0, BORDER_TYPE_REFLECT_101);
+    for (int32_t i = 0; i < height; ++i) {
+        memcpy(dx.data() + i * width, grad.data() + (i + 1) * padStep + 1, width * sizeof(int16_t));
+    }
+    Sobel<uint8_t, int16_t, 1>(height + 2, padStep, padStep, padded.data(), padStep, grad.data(), 0, 1, 3, 1.0, 0.0, BORDER_TYPE_REFLECT_101);
+    for (int32_t i = 0; i < height; ++i) {
+        memcpy(dy.data() + i * width, grad.data() + (i + 1) * padStep + 1, width * sizeof(int16_t));
+    }
+
+    const int32_t mapStep = width + 2;
+    std::vector<uint8_t> edges((size_t)(height + 2) * mapStep);
+    detectEdges(height, width, dx.data(), dy.data(), lowThresh, highThresh, edges.data());
+
+    // gather edge points with a non-zero gradient
+    std::vector<int32_t> xs, ys;
+    {
+        std::vector<uint8_t> edgeMask(height * width);
+        for (int32_t i = 0; i < height; ++i) {
+            const uint8_t *mp = edges.data() + (i + 1) * mapStep + 1;
+            uint8_t *dst      = edgeMask.data() + i * width;
+            const int16_t *gx = dx.data() + i * width;
+            const int16_t *gy = dy.data() + i * width;
+            for (int32_t j = 0; j < width; ++j) {
+                dst[j] = mp[j] == 2 && (gx[j] != 0 || gy[j] != 0);
+            }
+        }
+        collectNonZero(height, width, width, edgeMask.data(), xs, ys);
+    }
+    const int32_t count = (int32_t)xs.size();
+    circles.clear();
+    if (count == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // every edge point votes along its gradient direction, into the accumulator of its thread
+    const float idp       = (float)(1.0 / dp);
+    const int32_t accCols = (int32_t)std::ceil(width * idp);
+    const int32_t accRows = (int32_t)std::ceil(height * idp);
+    const int32_t accStep = accCols + 2;
+    const size_t accSize  = (size_t)(accRows + 2) * accStep;
+    const int32_t shift   = 10;
+    const int32_t one     = 1 << shift;
+    const int32_t threads = std::max(1, std::min(get_max_threads(), (count + 4095) / 4096));
+    std::vector<int32_t> accums(accSize * threads, 0);
+
+#pragma omp parallel for num_threads(threads) schedule(static)
+    for (int32_t t = 0; t < threads; ++t) {
+        int32_t *acc  = accums.data() + accSize * t + accStep + 1;
+        int32_t begin = (int32_t)((int64_t)count * t / threads);
+        int32_t end   = (int32_t)((int64_t)count * (t + 1) / threads);
+        for (int32_t k = begin; k < end; ++k) {
+            int32_t x  = xs[k];
+            int32_t y  = ys[k];
+            float vx   = dx[y * width + x];
+            float vy   = dy[y * width + x];
+            float mag  = std::sqrt(vx * vx + vy * vy);
+            int32_t sx = round_to_int((vx * idp) * one / mag);
+            int32_t sy = round_to_int((vy * idp) * one / mag);
+            int32_t x0 = round_to_int((x * idp) * one);
+            int32_t y0 = round_to_int((y * idp) * one);
+            for (int32_t k1 = 0; k1 < 2; ++k1) {
+                int32_t x1 = x0 + minRadius * sx;
+                int32_t y1 = y0 + minRadius * sy;
+                for (int32_t r = minRadius; r <= maxRadius; x1 += sx, y1 += sy, ++r) {
+                    int32_t x2 = x1 >> shift;
+                    int32_t y2 = y1 >> shift;
+                    if ((uint32_t)x2 >= (uint32_t)accCols || (uint32_t)y2 >= (uint32_t)accRows) {
+                        break;
+                    }
+                    acc[y2 * accStep + x2]++;
+                }
+                sx = -sx;
+                sy = -sy;
+            }
+        }
+    }
+
+    int32_t *accum = accums.data();
+    for (int32_t t = 1; t < threads; ++t) {
+        const int32_t *acc = accums.data() + accSize * t;
+        size_t i           = 0;
+        for (; i + 4 <= accSize; i += 4) {
+            __m128i v_sum = _mm_add_epi32(_mm_loadu_si128((const __m128i *)(accum + i)),
+                                          _mm_loadu_si128((const __m128i *)(acc + i)));
+            _mm_storeu_si128((__m128i *)(accum + i), v_sum);
+        }
+        for (; i < accSize; ++i) {
+            accum[i] += acc[i];
+        }
+    }
+
+    // possible centers are the local maxima of the accumulator
+    std::vector<int32_t> centers;
+    for (int32_t y = 1; y < accRows - 1; ++y) {
+        for (int32_t x = 1; x < accCols - 1; ++x) {
+            int32_t base = (y + 1) * accStep + x + 1;
+            int32_t v    = accum[base];
+            if (v > accThresh && v > accum[base - 1] && v >= accum[base + 1] &&
+                v > accum[base - accStep] && v >= accum[base + accStep]) {
+                centers.push_back(base);
+            }
+        }
+    }
+    HoughPeakGreater greater = {accum};
+    std::sort(centers.begin(), centers.end(), greater);
+
+    // estimate the radius of every center from the distances of the edge points
+    std::vector<float> fxs(count), fys(count);
+    for (int32_t k = 0; k < count; ++k) {
+        fxs[k] = (float)xs[k];
+        fys[k] = (float)ys[k];
+    }
+    const float minDist2  = (float)(std::max(minDist, dp) * std::max(minDist, dp));
+    const float minRadius2 = (float)minRadius * minRadius;
+    const float maxRadius2 = (float)maxRadius * maxRadius;
+    const float dr         = (float)dp;
+    std::vector<float> dists(count);
+    for (size_t c = 0; c < centers.size(); ++c) {
+        int32_t y = centers[c] / accStep - 1;
+        int32_t x = centers[c] - (y + 1) * accStep - 1;
+        float cx  = (float)((x + 0.5f) * dp);
+        float cy  = (float)((y + 0.5f) * dp);
+
+        size_t j = 0;
+        for (; j < circles.size(); ++j) {
+            float ddx = circles[j].x - cx;
+            float ddy = circles[j].y - cy;
+            if (ddx * ddx + ddy * ddy < minDist2) {
+                break;
+            }
+        }
+        if (j < circles.size()) {
+            continue;
+        }
+
+        const __m128 v_cx   = _mm_set1_ps(cx);
+        const __m128 v_cy   = _mm_set1_ps(cy);
+        const __m128 v_min2 = _mm_set1_ps(minRadius2);
+        const __m128 v_max2 = _mm_set1_ps(maxRadius2);
+        int32_t inRange     = 0;
+        int32_t k           = 0;
+        for (; k <= count - 4; k += 4) {
+            __m128 v_dx  = _mm_sub_ps(v_cx, _mm_loadu_ps(fxs.data() + k));
+            __m128 v_dy  = _mm_sub_ps(v_cy, _mm_loadu_ps(fys.data() + k));
+            __m128 v_r2  = _mm_add_ps(_mm_mul_ps(v_dx, v_dx), _mm_mul_ps(v_dy, v_dy));
+            __m128 v_in  = _mm_and_ps(_mm_cmple_ps(v_min2, v_r2), _mm_cmple_ps(v_r2, v_max2));
+            int32_t mask = _mm_movemask_ps(v_in);
+            if (mask == 0) {
+                continue;
+            }
+            float r2[4];
+            _mm_storeu_ps(r2, _mm_sqrt_ps(v_r2));
+            for (int32_t lane = 0; lane < 4; ++lane) {
+                if (mask & (1 << lane)) {
+                    dists[inRange++] = r2[lane];
+                }
+            }
+        }
+        for (; k < count; ++k) {
+            float ddx = cx - fxs[k];
+            float ddy = cy - fys[k];
+            float r2  = ddx * ddx + ddy * ddy;
+            if (minRadius2 <= r2 && r2 <= maxRadius2) {
+                dists[inRange++] = std::sqrt(r2);
+            }
+        }
+        if (inRange == 0) {
+            continue;
+        }
+
+        // the radius is the middle of the densest run of distances no wider than dr
+        std::sort(dists.begin(), dists.begin() + inRange);
+        float rBest       = 0;
+        int32_t maxCount  = 0;
+        int32_t startIdx  = 0;
+        float startDist   = dists[0];
+        for (int32_t m = 1; m < inRange; ++m) {
+            float d = dists[m];
+            if (d > maxRadius) {
+                break;
+            }
+            if (d - startDist > dr) {
+                float rCur = dists[(m - 1 + startIdx) / 2];
+                if ((m - startIdx) * rBest >= maxCount * rCur || (rBest < FLT_EPSILON && m - startIdx >= maxCount)) {
+                    rBest    = rCur;
+                    maxCount = m - startIdx;
+                }
+                startDist = d;
+                startIdx  = m;
+            }
+        }
+
+        if (maxCount > accThresh) {
+            HoughCircle circle = {cx, cy, rBest};
+            circles.push_back(circle);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/hough.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+
+namespace {
+
+void DrawLines(uint8_t* image, int32_t height, int32_t width)
+{
+    cv::Mat imageMat(height, width, CV_8UC1, image);
+    imageMat.setTo(0);
+    for (int32_t i = 0; i < 16; ++i) {
+        cv::line(imageMat, cv::Point((i * 7919) % width, 0), cv::Point((i * 104729) % width, height - 1), cv::Scalar(255), 1);
+    }
+}
+
+void DrawCircles(uint8_t* image, int32_t height, int32_t width)
+{
+    cv::Mat imageMat(height, width, CV_8UC1, image);
+    imageMat.setTo(40);
+    for (int32_t i = 0; i < 8; ++i) {
+        cv::circle(imageMat, cv::Point((i * 7919) % width, (i * 104729) % height), 10 + i * 5, cv::Scalar(200), -1);
+    }
+}
+
+void BM_HoughLines_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    DrawLines(src.get(), height, width);
+    std::vector<ppl::cv::x86::HoughLine> lines;
+    for (auto _ : state) {
+        ppl::cv::x86::HoughLines(height, width, width, src.get(), lines, 1.f, 3.1415926f / 180, 100);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_HoughLinesP_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    DrawLines(src.get(), height, width);
+    std::vector<ppl::cv::x86::HoughSegment> lines;
+    for (auto _ : state) {
+        ppl::cv::x86::HoughLinesP(height, width, width, src.get(), lines, 1.f, 3.1415926f / 180, 50, 50, 10);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_HoughCircles_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    DrawCircles(src.get(), height, width);
+    std::vector<ppl::cv::x86::HoughCircle> circles;
+    for (auto _ : state) {
+        ppl::cv::x86::HoughCircles(height, width, width, src.get(), circles, 1.0, 20, 100, 30, 5, 60);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK(BM_HoughLines_ppl_x86)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK(BM_HoughLinesP_ppl_x86)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK(BM_HoughCircles_ppl_x86)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+static void BM_HoughLines_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    DrawLines(src.get(), height, width);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 1), src.get());
+    std::vector<cv::Vec2f> lines;
+    for (auto _ : state) {
+        cv::HoughLines(srcMat, lines, 1, CV_PI / 180, 100);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+static void BM_HoughLinesP_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    DrawLines(src.get(), height, width);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 1), src.get());
+    std::vector<cv::Vec4i> lines;
+    for (auto _ : state) {
+        cv::HoughLinesP(srcMat, lines, 1, CV_PI / 180, 50, 50, 10);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+static void BM_HoughCircles_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    DrawCircles(src.get(), height, width);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 1), src.get());
+    std::vector<cv::Vec3f> circles;
+    for (auto _ : state) {
+        cv::HoughCircles(srcMat, circles, cv::HOUGH_GRADIENT, 1.0, 20, 100, 30, 5, 60);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK(BM_HoughLines_opencv_x86)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK(BM_HoughLinesP_opencv_x86)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK(BM_HoughCircles_opencv_x86)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! PPLCV_BENCHMARK_OPENCV
+}
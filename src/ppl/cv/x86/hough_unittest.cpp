@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/hough.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+
+static void DrawRandomLines(cv::Mat& image)
+{
+    std::default_random_engine eng(clock());
+    std::uniform_int_distribution<int32_t> dis(0, 1 << 16);
+    image.setTo(0);
+    for (int32_t i = 0; i < 10; ++i) {
+        cv::Point p0(dis(eng) % image.cols, dis(eng) % image.rows);
+        cv::Point p1(dis(eng) % image.cols, dis(eng) % image.rows);
+        cv::line(image, p0, p1, cv::Scalar(255), 1);
+    }
+    for (int32_t i = 0; i < image.rows * image.cols / 200; ++i) {
+        image.at<uint8_t>(dis(eng) % image.rows, dis(eng) % image.cols) = 255;
+    }
+}
+
+void HoughLinesTest(int32_t height, int32_t width, int32_t threshold)
+{
+    cv::Mat src(height, width, CV_8UC1);
+    DrawRandomLines(src);
+    const float theta = (float)(CV_PI / 180);
+
+    std::vector<cv::Vec2f> lines_ref;
+    cv::HoughLines(src, lines_ref, 1, theta, threshold);
+    std::vector<ppl::cv::x86::HoughLine> lines;
+    ppl::cv::x86::HoughLines(height, width, width, src.ptr<uint8_t>(), lines, 1.f, theta, threshold);
+
+    ASSERT_EQ(lines.size(), lines_ref.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        EXPECT_NEAR(lines[i].rho, lines_ref[i][0], 1e-4);
+        EXPECT_NEAR(lines[i].theta, lines_ref[i][1], 1e-4);
+    }
+}
+
+void HoughLinesPTest(int32_t height, int32_t width, int32_t threshold, double minLineLength, double maxLineGap)
+{
+    cv::Mat src(height, width, CV_8UC1);
+    DrawRandomLines(src);
+    const float theta = (float)(CV_PI / 180);
+
+    std::vector<cv::Vec4i> lines_ref;
+    cv::HoughLinesP(src, lines_ref, 1, theta, threshold, minLineLength, maxLineGap);
+    std::vector<ppl::cv::x86::HoughSegment> lines;
+    ppl::cv::x86::HoughLinesP(height, width, width, src.ptr<uint8_t>(), lines, 1.f, theta, threshold, minLineLength, maxLineGap);
+
+    ASSERT_EQ(lines.size(), lines_ref.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        EXPECT_EQ(lines[i].x1, lines_ref[i][0]);
+        EXPECT_EQ(lines[i].y1, lines_ref[i][1]);
+        EXPECT_EQ(lines[i].x2, lines_ref[i][2]);
+        EXPECT_EQ(lines[i].y2, lines_ref[i][3]);
+    }
+}
+
+// the detected circles are checked against the drawn ones, as the radius estimation differs from OpenCV
+void HoughCirclesTest(int32_t height, int32_t width)
+{
+    cv::Mat src(height, width, CV_8UC1, cv::Scalar(40));
+    const int32_t count = 3;
+    cv::Point centers[count];
+    int32_t radii[count];
+    for (int32_t i = 0; i < count; ++i) {
+        centers[i] = cv::Point((i + 1) * width / (count + 1), (i % 2 + 1) * height / 3);
+        radii[i]   = std::min(width / (count + 1), height / 3) / 3 + i * 4;
+        cv::circle(src, centers[i], radii[i], cv::Scalar(200), -1);
+    }
+    cv::GaussianBlur(src, src, cv::Size(5, 5), 1.5);
+
+    std::vector<ppl::cv::x86::HoughCircle> circles;
+    ppl::cv::x86::HoughCircles(height, width, width, src.ptr<uint8_t>(), circles, 1.0, 20, 100, 30, 5, 0);
+
+    ASSERT_GE(circles.size(), (size_t)count);
+    for (int32_t i = 0; i < count; ++i) {
+        bool found = false;
+        for (size_t j = 0; j < circles.size() && !found; ++j) {
+            found = std::fabs(circles[j].x - centers[i].x) <= 3.f && std::fabs(circles[j].y - centers[i].y) <= 3.f &&
+                    std::fabs(circles[j].radius - radii[i]) <= 3.f;
+        }
+        EXPECT_TRUE(found);
+    }
+}
+
+TEST(HoughLines_UINT8, x86)
+{
+    HoughLinesTest(480, 640, 60);
+    HoughLinesTest(720, 1280, 100);
+}
+
+TEST(HoughLinesP_UINT8, x86)
+{
+    HoughLinesPTest(480, 640, 40, 30, 5);
+    HoughLinesPTest(720, 1280, 50, 50, 10);
+}
+
+TEST(HoughCircles_UINT8, x86)
+{
+    HoughCirclesTest(480, 640);
+    HoughCirclesTest(720, 1280);
+}
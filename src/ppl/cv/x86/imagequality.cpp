@@ -0,0 +1,447 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/imagequality.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <cfloat>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define SSIM_STRIP_HEIGHT 16
+#define MSSSIM_MAX_SCALES 5
+
+static const double msssim_weights[MSSSIM_MAX_SCALES] = {0.0448, 0.2856, 0.3001, 0.2363, 0.1333};
+
+static inline __m128 load_ps(const float *p)
+{
+    return _mm_loadu_ps(p);
+}
+
+static inline __m128 load_ps(const uint8_t *p)
+{
+    int32_t packed;
+    memcpy(&packed, p, sizeof(packed));
+    return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+}
+
+template <typename T>
+static double rowSquaredError(int32_t len, const T *src0, const T *src1);
+
+template <>
+double rowSquaredError<uint8_t>(int32_t len, const uint8_t *src0, const uint8_t *src1)
+{
+    // every 32-bit lane takes two squares per step, it is flushed before it can overflow
+    const int32_t flush = 8 * 8192;
+    const __m128i zero  = _mm_setzero_si128();
+    int64_t total       = 0;
+    int32_t i           = 0;
+    while (i <= len - 8) {
+        __m128i acc       = zero;
+        const int32_t end = std::min(len - 8, i + flush - 8);
+        for (; i <= end; i += 8) {
+            __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(src0 + i)));
+            __m128i b = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(src1 + i)));
+            __m128i d = _mm_sub_epi16(a, b);
+            acc       = _mm_add_epi32(acc, _mm_madd_epi16(d, d));
+        }
+        int32_t lanes[4];
+        _mm_storeu_si128((__m128i *)lanes, acc);
+        total += (int64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    for (; i < len; ++i) {
+        int32_t d = (int32_t)src0[i] - src1[i];
+        total += d * d;
+    }
+    return (double)total;
+}
+
+template <>
+double rowSquaredError<float>(int32_t len, const float *src0, const float *src1)
+{
+    __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+    int32_t i    = 0;
+    for (; i <= len - 4; i += 4) {
+        __m128 d  = _mm_sub_ps(_mm_loadu_ps(src0 + i), _mm_loadu_ps(src1 + i));
+        __m128d l = _mm_cvtps_pd(d), h = _mm_cvtps_pd(_mm_movehl_ps(d, d));
+        acc0      = _mm_add_pd(acc0, _mm_mul_pd(l, l));
+        acc1      = _mm_add_pd(acc1, _mm_mul_pd(h, h));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(acc0, acc1));
+    double total = lanes[0] + lanes[1];
+    for (; i < len; ++i) {
+        double d = (double)src0[i] - src1[i];
+        total += d * d;
+    }
+    return total;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode PSNR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const T *inData0,
+    int32_t inWidthStride1,
+    const T *inData1,
+    double *psnr,
+    double maxValue)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == psnr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride0 < width * channels || inWidthStride1 < width * channels || maxValue <= 0.0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    std::vector<double> rowSums(height);
+#pragma omp parallel for schedule(static)
+    for (int32_t y = 0; y < height; ++y) {
+        rowSums[y] = rowSquaredError<T>(width * channels, inData0 + y * inWidthStride0, inData1 + y * inWidthStride1);
+    }
+    double total = 0.0;
+    for (int32_t y = 0; y < height; ++y) {
+        total += rowSums[y];
+    }
+    const double rmse = std::sqrt(total / ((double)height * width * channels));
+    *psnr             = 20.0 * std::log10(maxValue / (rmse + DBL_EPSILON));
+    return ppl::common::RC_SUCCESS;
+}
+
+static std::vector<float> windowKernel(const SSIMParams &params)
+{
+    std::vector<float> kernel(params.windowSize);
+    double sum = 0.0;
+    for (int32_t i = 0; i < params.windowSize; ++i) {
+        double x  = i - (params.windowSize - 1) * 0.5;
+        kernel[i] = params.windowType == SSIM_WINDOW_BOX ? 1.f : (float)std::exp(-0.5 * x * x / ((double)params.sigma * params.sigma));
+        sum += kernel[i];
+    }
+    for (int32_t i = 0; i < params.windowSize; ++i) {
+        kernel[i] = (float)(kernel[i] / sum);
+    }
+    return kernel;
+}
+
+// weighted sums of x, y, x * x, y * y and x * y over the window rows, `len` values of each
+template <typename T>
+static void verticalStats(int32_t len, const T *src0, int32_t step0, const T *src1, int32_t step1, const float *kernel, int32_t win, float *stats)
+{
+    float *sx = stats, *sy = stats + len, *sxx = stats + 2 * len, *syy = stats + 3 * len, *sxy = stats + 4 * len;
+    int32_t i = 0;
+    for (; i <= len - 4; i += 4) {
+        __m128 ax = _mm_setzero_ps(), ay = ax, axx = ax, ayy = ax, axy = ax;
+        for (int32_t k = 0; k < win; ++k) {
+            __m128 w  = _mm_set1_ps(kernel[k]);
+            __m128 x  = load_ps(src0 + k * step0 + i);
+            __m128 y  = load_ps(src1 + k * step1 + i);
+            __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y);
+            ax        = _mm_add_ps(ax, wx);
+            ay        = _mm_add_ps(ay, wy);
+            axx       = _mm_add_ps(axx, _mm_mul_ps(wx, x));
+            ayy       = _mm_add_ps(ayy, _mm_mul_ps(wy, y));
+            axy       = _mm_add_ps(axy, _mm_mul_ps(wx, y));
+        }
+        _mm_storeu_ps(sx + i, ax);
+        _mm_storeu_ps(sy + i, ay);
+        _mm_storeu_ps(sxx + i, axx);
+        _mm_storeu_ps(syy + i, ayy);
+        _mm_storeu_ps(sxy + i, axy);
+    }
+    for (; i < len; ++i) {
+        float ax = 0.f, ay = 0.f, axx = 0.f, ayy = 0.f, axy = 0.f;
+        for (int32_t k = 0; k < win; ++k) {
+            float x = src0[k * step0 + i], y = src1[k * step1 + i];
+            ax += kernel[k] * x;
+            ay += kernel[k] * y;
+            axx += kernel[k] * x * x;
+            ayy += kernel[k] * y * y;
+            axy += kernel[k] * x * y;
+        }
+        sx[i]  = ax;
+        sy[i]  = ay;
+        sxx[i] = axx;
+        syy[i] = ayy;
+        sxy[i] = axy;
+    }
+}
+
+// horizontal window sums of the vertical statistics and the SSIM and contrast-structure terms of `len`
+// outputs, neighbouring pixels of a channel are nc values apart
+static void horizontalIndex(int32_t len, int32_t statLen, int32_t nc, const float *stats, const float *kernel, int32_t win,
+                            float C1, float C2, float *ssim, float *cs)
+{
+    const float *sx = stats, *sy = stats + statLen, *sxx = stats + 2 * statLen, *syy = stats + 3 * statLen, *sxy = stats + 4 * statLen;
+    const __m128 vC1 = _mm_set1_ps(C1), vC2 = _mm_set1_ps(C2), two = _mm_set1_ps(2.f);
+    int32_t i        = 0;
+    for (; i <= len - 4; i += 4) {
+        __m128 mx = _mm_setzero_ps(), my = mx, exx = mx, eyy = mx, exy = mx;
+        for (int32_t k = 0; k < win; ++k) {
+            __m128 w = _mm_set1_ps(kernel[k]);
+            int32_t o = i + k * nc;
+            mx        = _mm_add_ps(mx, _mm_mul_ps(w, _mm_loadu_ps(sx + o)));
+            my        = _mm_add_ps(my, _mm_mul_ps(w, _mm_loadu_ps(sy + o)));
+            exx       = _mm_add_ps(exx, _mm_mul_ps(w, _mm_loadu_ps(sxx + o)));
+            eyy       = _mm_add_ps(eyy, _mm_mul_ps(w, _mm_loadu_ps(syy + o)));
+            exy       = _mm_add_ps(exy, _mm_mul_ps(w, _mm_loadu_ps(sxy + o)));
+        }
+        __m128 mxy  = _mm_mul_ps(mx, my);
+        __m128 mm   = _mm_add_ps(_mm_mul_ps(mx, mx), _mm_mul_ps(my, my));
+        __m128 vxy  = _mm_sub_ps(exy, mxy);
+        __m128 vv   = _mm_sub_ps(_mm_add_ps(exx, eyy), mm);
+        __m128 lum  = _mm_div_ps(_mm_add_ps(_mm_mul_ps(two, mxy), vC1), _mm_add_ps(mm, vC1));
+        __m128 cont = _mm_div_ps(_mm_add_ps(_mm_mul_ps(two, vxy), vC2), _mm_add_ps(vv, vC2));
+        _mm_storeu_ps(ssim + i, _mm_mul_ps(lum, cont));
+        _mm_storeu_ps(cs + i, cont);
+    }
+    for (; i < len; ++i) {
+        float mx = 0.f, my = 0.f, exx = 0.f, eyy = 0.f, exy = 0.f;
+        for (int32_t k = 0; k < win; ++k) {
+            int32_t o = i + k * nc;
+            mx += kernel[k] * sx[o];
+            my += kernel[k] * sy[o];
+            exx += kernel[k] * sxx[o];
+            eyy += kernel[k] * syy[o];
+            exy += kernel[k] * sxy[o];
+        }
+        float mxy  = mx * my;
+        float mm   = mx * mx + my * my;
+        float cont = (2.f * (exy - mxy) + C2) / (exx + eyy - mm + C2);
+        ssim[i]    = (2.f * mxy + C1) / (mm + C1) * cont;
+        cs[i]      = cont;
+    }
+}
+
+// sums of the SSIM and contrast-structure terms of every channel over all windows inside the images
+template <typename T>
+static void ssimSums(int32_t height, int32_t width, int32_t nc, int32_t inWidthStride0, const T *inData0, int32_t inWidthStride1,
+                     const T *inData1, const SSIMParams &params, int32_t mapWidthStride, float *mapData, double *ssimSum, double *csSum)
+{
+    const std::vector<float> kernel = windowKernel(params);
+    const int32_t win               = params.windowSize;
+    const int32_t outHeight         = height - win + 1;
+    const int32_t statLen           = width * nc;
+    const int32_t outLen            = (width - win + 1) * nc;
+    const float C1                  = params.K1 * params.dynamicRange * params.K1 * params.dynamicRange;
+    const float C2                  = params.K2 * params.dynamicRange * params.K2 * params.dynamicRange;
+    const int32_t numStrips         = (outHeight + SSIM_STRIP_HEIGHT - 1) / SSIM_STRIP_HEIGHT;
+
+    // per row sums are reduced in row order, so that the result does not depend on the number of threads
+    std::vector<double> rowSums((size_t)outHeight * nc * 2);
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t strip = 0; strip < numStrips; ++strip) {
+        std::vector<float> buffer(5 * statLen + 2 * outLen);
+        float *stats = &buffer[0], *ssim = stats + 5 * statLen, *cs = ssim + outLen;
+        const int32_t y1 = std::min(outHeight, (strip + 1) * SSIM_STRIP_HEIGHT);
+        for (int32_t y = strip * SSIM_STRIP_HEIGHT; y < y1; ++y) {
+            verticalStats<T>(statLen, inData0 + y * inWidthStride0, inWidthStride0, inData1 + y * inWidthStride1, inWidthStride1, kernel.data(), win, stats);
+            float *rowSsim = mapData ? mapData + y * mapWidthStride : ssim;
+            horizontalIndex(outLen, statLen, nc, stats, kernel.data(), win, C1, C2, rowSsim, cs);
+            double *sums = &rowSums[(size_t)y * nc * 2];
+            for (int32_t c = 0; c < 2 * nc; ++c) {
+                sums[c] = 0.0;
+            }
+            for (int32_t i = 0; i < outLen; i += nc) {
+                for (int32_t c = 0; c < nc; ++c) {
+                    sums[c] += rowSsim[i + c];
+                    sums[nc + c] += cs[i + c];
+                }
+            }
+        }
+    }
+    for (int32_t c = 0; c < nc; ++c) {
+        ssimSum[c] = 0.0;
+        csSum[c]   = 0.0;
+    }
+    for (int32_t y = 0; y < outHeight; ++y) {
+        for (int32_t c = 0; c < nc; ++c) {
+            ssimSum[c] += rowSums[(size_t)y * nc * 2 + c];
+            csSum[c] += rowSums[(size_t)y * nc * 2 + nc + c];
+        }
+    }
+}
+
+static bool validSSIMParams(const SSIMParams &params)
+{
+    if (params.windowSize <= 0 || params.windowSize % 2 == 0) {
+        return false;
+    }
+    if (params.windowType != SSIM_WINDOW_GAUSSIAN && params.windowType != SSIM_WINDOW_BOX) {
+        return false;
+    }
+    if (params.windowType == SSIM_WINDOW_GAUSSIAN && params.sigma <= 0.f) {
+        return false;
+    }
+    return params.K1 > 0.f && params.K2 > 0.f && params.dynamicRange > 0.f;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode SSIM(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const T *inData0,
+    int32_t inWidthStride1,
+    const T *inData1,
+    double *ssim,
+    const SSIMParams &params,
+    int32_t mapWidthStride,
+    float *mapData)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == ssim || !validSSIMParams(params)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height < params.windowSize || width < params.windowSize || inWidthStride0 < width * channels || inWidthStride1 < width * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mapData != nullptr && mapWidthStride < (width - params.windowSize + 1) * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    double ssimSum[channels], csSum[channels];
+    ssimSums<T>(height, width, channels, inWidthStride0, inData0, inWidthStride1, inData1, params, mapWidthStride, mapData, ssimSum, csSum);
+    const double count = (double)(height - params.windowSize + 1) * (width - params.windowSize + 1);
+    for (int32_t c = 0; c < channels; ++c) {
+        ssim[c] = ssimSum[c] / count;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+// 2x2 average of the even part of the image
+template <typename T>
+static void halve(int32_t height, int32_t width, int32_t nc, int32_t inWidthStride, const T *inData, float *outData)
+{
+    const int32_t outHeight = height / 2, outWidth = width / 2;
+#pragma omp parallel for schedule(static)
+    for (int32_t y = 0; y < outHeight; ++y) {
+        const T *src0 = inData + 2 * y * inWidthStride;
+        const T *src1 = src0 + inWidthStride;
+        float *dst    = outData + y * outWidth * nc;
+        for (int32_t x = 0; x < outWidth; ++x) {
+            for (int32_t c = 0; c < nc; ++c) {
+                int32_t i = 2 * x * nc + c;
+                dst[x * nc + c] = 0.25f * ((float)src0[i] + (float)src0[i + nc] + (float)src1[i] + (float)src1[i + nc]);
+            }
+        }
+    }
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode MSSSIM(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride0,
+    const T *inData0,
+    int32_t inWidthStride1,
+    const T *inData1,
+    double *msssim,
+    const SSIMParams &params,
+    int32_t scales)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == msssim || !validSSIMParams(params)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (scales < 1 || scales > MSSSIM_MAX_SCALES || inWidthStride0 < width * channels || inWidthStride1 < width * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if ((height >> (scales - 1)) < params.windowSize || (width >> (scales - 1)) < params.windowSize) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    double weightSum = 0.0;
+    for (int32_t s = 0; s < scales; ++s) {
+        weightSum += msssim_weights[s];
+    }
+    double result[channels];
+    for (int32_t c = 0; c < channels; ++c) {
+        result[c] = 1.0;
+    }
+
+    std::vector<float> level[2];
+    int32_t h = height, w = width;
+    for (int32_t s = 0; s < scales; ++s) {
+        double ssimSum[channels], csSum[channels];
+        if (s == 0) {
+            ssimSums<T>(h, w, channels, inWidthStride0, inData0, inWidthStride1, inData1, params, 0, nullptr, ssimSum, csSum);
+        } else {
+            ssimSums<float>(h, w, channels, w * channels, level[0].data(), w * channels, level[1].data(), params, 0, nullptr, ssimSum, csSum);
+        }
+        const double count  = (double)(h - params.windowSize + 1) * (w - params.windowSize + 1);
+        const double weight = msssim_weights[s] / weightSum;
+        for (int32_t c = 0; c < channels; ++c) {
+            double term = (s == scales - 1 ? ssimSum[c] : csSum[c]) / count;
+            result[c] *= std::pow(std::max(term, 0.0), weight);
+        }
+        if (s == scales - 1) {
+            break;
+        }
+
+        std::vector<float> next[2];
+        next[0].resize((size_t)(h / 2) * (w / 2) * channels);
+        next[1].resize(next[0].size());
+        if (s == 0) {
+            halve<T>(h, w, channels, inWidthStride0, inData0, next[0].data());
+            halve<T>(h, w, channels, inWidthStride1, inData1, next[1].data());
+        } else {
+            halve<float>(h, w, channels, w * channels, level[0].data(), next[0].data());
+            halve<float>(h, w, channels, w * channels, level[1].data(), next[1].data());
+        }
+        level[0].swap(next[0]);
+        level[1].swap(next[1]);
+        h /= 2;
+        w /= 2;
+    }
+    for (int32_t c = 0; c < channels; ++c) {
+        msssim[c] = result[c];
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode PSNR<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *psnr, double maxValue);
+template ::ppl::common::RetCode PSNR<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *psnr, double maxValue);
+template ::ppl::common::RetCode PSNR<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *psnr, double maxValue);
+template ::ppl::common::RetCode PSNR<float, 1>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *psnr, double maxValue);
+template ::ppl::common::RetCode PSNR<float, 3>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *psnr, double maxValue);
+template ::ppl::common::RetCode PSNR<float, 4>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *psnr, double maxValue);
+
+template ::ppl::common::RetCode SSIM<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *ssim, const SSIMParams &params, int32_t mapWidthStride, float *mapData);
+template ::ppl::common::RetCode SSIM<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *ssim, const SSIMParams &params, int32_t mapWidthStride, float *mapData);
+template ::ppl::common::RetCode SSIM<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *ssim, const SSIMParams &params, int32_t mapWidthStride, float *mapData);
+template ::ppl::common::RetCode SSIM<float, 1>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *ssim, const SSIMParams &params, int32_t mapWidthStride, float *mapData);
+template ::ppl::common::RetCode SSIM<float, 3>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *ssim, const SSIMParams &params, int32_t mapWidthStride, float *mapData);
+template ::ppl::common::RetCode SSIM<float, 4>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *ssim, const SSIMParams &params, int32_t mapWidthStride, float *mapData);
+
+template ::ppl::common::RetCode MSSSIM<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *msssim, const SSIMParams &params, int32_t scales);
+template ::ppl::common::RetCode MSSSIM<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *msssim, const SSIMParams &params, int32_t scales);
+template ::ppl::common::RetCode MSSSIM<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride0, const uint8_t *inData0, int32_t inWidthStride1, const uint8_t *inData1, double *msssim, const SSIMParams &params, int32_t scales);
+template ::ppl::common::RetCode MSSSIM<float, 1>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *msssim, const SSIMParams &params, int32_t scales);
+template ::ppl::common::RetCode MSSSIM<float, 3>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *msssim, const SSIMParams &params, int32_t scales);
+template ::ppl::common::RetCode MSSSIM<float, 4>(int32_t height, int32_t width, int32_t inWidthStride0, const float *inData0, int32_t inWidthStride1, const float *inData1, double *msssim, const SSIMParams &params, int32_t scales);
+
+}
+}
+} // namespace ppl::cv::x86
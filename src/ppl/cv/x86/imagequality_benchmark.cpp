@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/imagequality.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+
+namespace {
+
+enum QUALITY_METRIC {PSNR, SSIM, MSSSIM};
+
+template <typename T, int32_t nc, QUALITY_METRIC metric>
+void BM_ImageQuality_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src0(new T[width * height * nc]);
+    std::unique_ptr<T[]> src1(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src0.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<T>(src1.get(), width * height * nc, 0, 255);
+    double result[nc];
+    for (auto _ : state) {
+        if (metric == PSNR) {
+            ppl::cv::x86::PSNR<T, nc>(height, width, width * nc, src0.get(), width * nc, src1.get(), result);
+        } else if (metric == SSIM) {
+            ppl::cv::x86::SSIM<T, nc>(height, width, width * nc, src0.get(), width * nc, src1.get(), result);
+        } else {
+            ppl::cv::x86::MSSSIM<T, nc>(height, width, width * nc, src0.get(), width * nc, src1.get(), result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_ImageQuality_ppl_x86, uint8_t, c1, PSNR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ImageQuality_ppl_x86, uint8_t, c3, PSNR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ImageQuality_ppl_x86, float, c1, PSNR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ImageQuality_ppl_x86, uint8_t, c1, SSIM)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ImageQuality_ppl_x86, uint8_t, c3, SSIM)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ImageQuality_ppl_x86, float, c1, SSIM)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ImageQuality_ppl_x86, uint8_t, c1, MSSSIM)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ImageQuality_ppl_x86, float, c1, MSSSIM)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template <typename T, int32_t nc>
+static void BM_PSNR_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    cv::Mat src0(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc));
+    cv::Mat src1(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc));
+    cv::randu(src0, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::randu(src1, cv::Scalar::all(0), cv::Scalar::all(255));
+    for (auto _ : state) {
+        cv::PSNR(src0, src1);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+// SSIM composed from five gaussian blurs, the way it is done without a fused implementation
+template <typename T, int32_t nc>
+static void BM_SSIM_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    cv::Mat src0(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc));
+    cv::Mat src1(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc));
+    cv::randu(src0, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::randu(src1, cv::Scalar::all(0), cv::Scalar::all(255));
+    const double C1 = 6.5025, C2 = 58.5225;
+    for (auto _ : state) {
+        cv::Mat x, y, mx, my, xx, yy, xy;
+        src0.convertTo(x, CV_32F);
+        src1.convertTo(y, CV_32F);
+        cv::GaussianBlur(x, mx, cv::Size(11, 11), 1.5);
+        cv::GaussianBlur(y, my, cv::Size(11, 11), 1.5);
+        cv::GaussianBlur(x.mul(x), xx, cv::Size(11, 11), 1.5);
+        cv::GaussianBlur(y.mul(y), yy, cv::Size(11, 11), 1.5);
+        cv::GaussianBlur(x.mul(y), xy, cv::Size(11, 11), 1.5);
+        cv::Mat mxy = mx.mul(my), mm = mx.mul(mx) + my.mul(my);
+        cv::Mat num = (2 * mxy + C1).mul(2 * (xy - mxy) + C2);
+        cv::Mat den = (mm + C1).mul(xx + yy - mm + C2);
+        cv::Mat map;
+        cv::divide(num, den, map);
+        cv::mean(map);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_PSNR_opencv_x86, uint8_t, c1)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PSNR_opencv_x86, uint8_t, c3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PSNR_opencv_x86, float, c1)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_SSIM_opencv_x86, uint8_t, c1)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_SSIM_opencv_x86, uint8_t, c3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_SSIM_opencv_x86, float, c1)->Args({640, 480})->Args({1920, 1080});
+#endif //! PPLCV_BENCHMARK_OPENCV
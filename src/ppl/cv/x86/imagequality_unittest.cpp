@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/imagequality.h"
+#include "ppl/cv/x86/test.h"
+#include <vector>
+#include <cmath>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+
+// the reference SSIM composes the window statistics from five OpenCV blurs in double precision, and keeps
+// the windows which lie entirely inside the images
+static void ReferenceSSIM(const cv::Mat& a, const cv::Mat& b, const ppl::cv::x86::SSIMParams& params, cv::Mat& ssimMap, cv::Mat& csMap)
+{
+    cv::Mat x, y;
+    a.convertTo(x, CV_64F);
+    b.convertTo(y, CV_64F);
+    const int32_t win = params.windowSize, r = win / 2;
+    auto filter       = [&](const cv::Mat& src) {
+        cv::Mat dst;
+        if (params.windowType == ppl::cv::x86::SSIM_WINDOW_BOX) {
+            cv::blur(src, dst, cv::Size(win, win));
+        } else {
+            cv::GaussianBlur(src, dst, cv::Size(win, win), params.sigma);
+        }
+        return dst(cv::Rect(r, r, src.cols - 2 * r, src.rows - 2 * r)).clone();
+    };
+    const double C1 = std::pow(params.K1 * params.dynamicRange, 2), C2 = std::pow(params.K2 * params.dynamicRange, 2);
+    cv::Mat mx = filter(x), my = filter(y);
+    cv::Mat vx = filter(x.mul(x)) - mx.mul(mx), vy = filter(y.mul(y)) - my.mul(my), vxy = filter(x.mul(y)) - mx.mul(my);
+    cv::Mat lum;
+    cv::divide(2 * mx.mul(my) + C1, mx.mul(mx) + my.mul(my) + C1, lum);
+    cv::divide(2 * vxy + C2, vx + vy + C2, csMap);
+    ssimMap = lum.mul(csMap);
+}
+
+static void ReferenceMSSSIM(const cv::Mat& a, const cv::Mat& b, const ppl::cv::x86::SSIMParams& params, int32_t scales, double* result)
+{
+    static const double weights[] = {0.0448, 0.2856, 0.3001, 0.2363, 0.1333};
+    double weightSum              = 0.0;
+    for (int32_t s = 0; s < scales; ++s) {
+        weightSum += weights[s];
+    }
+    cv::Mat x, y;
+    a.convertTo(x, CV_64F);
+    b.convertTo(y, CV_64F);
+    for (int32_t c = 0; c < a.channels(); ++c) {
+        result[c] = 1.0;
+    }
+    for (int32_t s = 0; s < scales; ++s) {
+        cv::Mat ssimMap, csMap;
+        ReferenceSSIM(x, y, params, ssimMap, csMap);
+        cv::Scalar term = cv::mean(s == scales - 1 ? ssimMap : csMap);
+        for (int32_t c = 0; c < a.channels(); ++c) {
+            result[c] *= std::pow(std::max(term[c], 0.0), weights[s] / weightSum);
+        }
+        cv::Rect even(0, 0, x.cols / 2 * 2, x.rows / 2 * 2);
+        cv::resize(x(even), x, cv::Size(), 0.5, 0.5, cv::INTER_AREA);
+        cv::resize(y(even), y, cv::Size(), 0.5, 0.5, cv::INTER_AREA);
+    }
+}
+
+// a smooth image and two noisy versions of it, so that the similarity is neither 0 nor 1
+template <typename T, int32_t nc>
+static void MakePair(int32_t height, int32_t width, cv::Mat& a, cv::Mat& b)
+{
+    cv::Mat base(height, width, CV_32FC(nc)), noise(height, width, CV_32FC(nc));
+    cv::randu(base, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::GaussianBlur(base, base, cv::Size(0, 0), 3);
+    const double scale = std::is_same<T, float>::value ? 1.0 / 255 : 1.0;
+    cv::randn(noise, cv::Scalar::all(0), cv::Scalar::all(10));
+    cv::Mat(base + noise).convertTo(a, CV_MAKETYPE(cv::DataType<T>::depth, nc), scale);
+    cv::randn(noise, cv::Scalar::all(0), cv::Scalar::all(20));
+    cv::Mat(base + noise).convertTo(b, CV_MAKETYPE(cv::DataType<T>::depth, nc), scale);
+}
+
+template <typename T, int32_t nc>
+void PSNRTest(int32_t height, int32_t width)
+{
+    cv::Mat a, b;
+    MakePair<T, nc>(height, width, a, b);
+    const double maxValue = std::is_same<T, float>::value ? 1.0 : 255.0;
+    double psnr;
+    ASSERT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::PSNR<T, nc>(height, width, width * nc, a.ptr<T>(), width * nc, b.ptr<T>(), &psnr, maxValue));
+    EXPECT_LT(std::abs(psnr - cv::PSNR(a, b, maxValue)), 1e-6);
+}
+
+template <typename T, int32_t nc>
+void SSIMTest(int32_t height, int32_t width, ppl::cv::x86::SSIMWindowType windowType)
+{
+    cv::Mat a, b;
+    MakePair<T, nc>(height, width, a, b);
+    ppl::cv::x86::SSIMParams params;
+    params.windowType   = windowType;
+    params.dynamicRange = std::is_same<T, float>::value ? 1.f : 255.f;
+    const int32_t mapHeight = height - params.windowSize + 1, mapWidth = width - params.windowSize + 1;
+    cv::Mat map(mapHeight, mapWidth, CV_32FC(nc));
+    double ssim[nc];
+    ASSERT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::SSIM<T, nc>(height, width, width * nc, a.ptr<T>(), width * nc, b.ptr<T>(), ssim, params, mapWidth * nc, map.ptr<float>()));
+
+    cv::Mat ssimMap, csMap, ssimMapF;
+    ReferenceSSIM(a, b, params, ssimMap, csMap);
+    ssimMap.convertTo(ssimMapF, CV_32F);
+    checkResult<float, nc>(ssimMapF.ptr<float>(), map.ptr<float>(), mapHeight, mapWidth, mapWidth * nc, mapWidth * nc, 1e-4f);
+    cv::Scalar ref = cv::mean(ssimMap);
+    for (int32_t c = 0; c < nc; ++c) {
+        EXPECT_LT(std::abs(ssim[c] - ref[c]), 1e-5);
+    }
+
+    // the index of an image with itself is 1
+    ASSERT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::SSIM<T, nc>(height, width, width * nc, a.ptr<T>(), width * nc, a.ptr<T>(), ssim, params));
+    for (int32_t c = 0; c < nc; ++c) {
+        EXPECT_LT(std::abs(ssim[c] - 1.0), 1e-5);
+    }
+}
+
+template <typename T, int32_t nc>
+void MSSSIMTest(int32_t height, int32_t width, int32_t scales)
+{
+    cv::Mat a, b;
+    MakePair<T, nc>(height, width, a, b);
+    ppl::cv::x86::SSIMParams params;
+    params.dynamicRange = std::is_same<T, float>::value ? 1.f : 255.f;
+    double msssim[nc], ref[nc];
+    ASSERT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::MSSSIM<T, nc>(height, width, width * nc, a.ptr<T>(), width * nc, b.ptr<T>(), msssim, params, scales));
+    ReferenceMSSSIM(a, b, params, scales, ref);
+    for (int32_t c = 0; c < nc; ++c) {
+        EXPECT_LT(std::abs(msssim[c] - ref[c]), 1e-4);
+    }
+}
+
+TEST(PSNR_UINT8, x86)
+{
+    PSNRTest<uint8_t, 1>(240, 321);
+    PSNRTest<uint8_t, 3>(240, 321);
+    PSNRTest<uint8_t, 4>(240, 321);
+}
+
+TEST(PSNR_FP32, x86)
+{
+    PSNRTest<float, 1>(240, 321);
+    PSNRTest<float, 3>(240, 321);
+    PSNRTest<float, 4>(240, 321);
+}
+
+TEST(SSIM_UINT8, x86)
+{
+    SSIMTest<uint8_t, 1>(203, 187, ppl::cv::x86::SSIM_WINDOW_GAUSSIAN);
+    SSIMTest<uint8_t, 3>(203, 187, ppl::cv::x86::SSIM_WINDOW_GAUSSIAN);
+    SSIMTest<uint8_t, 4>(203, 187, ppl::cv::x86::SSIM_WINDOW_BOX);
+}
+
+TEST(SSIM_FP32, x86)
+{
+    SSIMTest<float, 1>(203, 187, ppl::cv::x86::SSIM_WINDOW_GAUSSIAN);
+    SSIMTest<float, 3>(203, 187, ppl::cv::x86::SSIM_WINDOW_BOX);
+    SSIMTest<float, 4>(203, 187, ppl::cv::x86::SSIM_WINDOW_GAUSSIAN);
+}
+
+TEST(MSSSIM_UINT8, x86)
+{
+    MSSSIMTest<uint8_t, 1>(203, 187, 5);
+    MSSSIMTest<uint8_t, 3>(203, 187, 4);
+}
+
+TEST(MSSSIM_FP32, x86)
+{
+    MSSSIMTest<float, 1>(180, 190, 5);
+    MSSSIMTest<float, 4>(97, 131, 3);
+}
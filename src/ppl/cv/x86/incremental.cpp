@@ -0,0 +1,471 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/incremental.h"
+#include "ppl/cv/x86/opgraph.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <emmintrin.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define INCREMENTAL_ALIGN 64
+
+// whether len bytes differ, the differences of 16 bytes are accumulated before they are tested
+static bool spanDiffers(const uint8_t *a, const uint8_t *b, int32_t len)
+{
+    int32_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        __m128i d = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i)), _mm_loadu_si128((const __m128i *)(b + i)));
+        d         = _mm_or_si128(d, _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i + 16)), _mm_loadu_si128((const __m128i *)(b + i + 16))));
+        d         = _mm_or_si128(d, _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i + 32)), _mm_loadu_si128((const __m128i *)(b + i + 32))));
+        d         = _mm_or_si128(d, _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i + 48)), _mm_loadu_si128((const __m128i *)(b + i + 48))));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(d, _mm_setzero_si128())) != 0xFFFF) {
+            return true;
+        }
+    }
+    for (; i + 16 <= len; i += 16) {
+        __m128i d = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i)), _mm_loadu_si128((const __m128i *)(b + i)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(d, _mm_setzero_si128())) != 0xFFFF) {
+            return true;
+        }
+    }
+    return i < len && memcmp(a + i, b + i, len - i) != 0;
+}
+
+// block comparison on rows of pixelBytes-byte pixels, the strides are in bytes
+static void diffBlocksBytes(
+    int32_t height,
+    int32_t width,
+    int32_t pixelBytes,
+    int32_t prevStride,
+    const uint8_t *prev,
+    int32_t curStride,
+    const uint8_t *cur,
+    int32_t blockSize,
+    std::vector<OpRect> *dirtyRects)
+{
+    const int32_t blocksX = (width + blockSize - 1) / blockSize;
+    const int32_t blocksY = (height + blockSize - 1) / blockSize;
+    std::vector<uint8_t> changed((size_t)blocksX * blocksY, 0);
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t by = 0; by < blocksY; ++by) {
+        uint8_t *flags     = &changed[(size_t)by * blocksX];
+        const int32_t rows = std::min(blockSize, height - by * blockSize);
+        int32_t left       = blocksX;
+        for (int32_t y = by * blockSize; y < by * blockSize + rows && left > 0; ++y) {
+            const uint8_t *p = prev + (size_t)y * prevStride;
+            const uint8_t *c = cur + (size_t)y * curStride;
+            // most rows of a static scene are unchanged, they are compared at once before the blocks
+            if (!spanDiffers(p, c, width * pixelBytes)) {
+                continue;
+            }
+            for (int32_t bx = 0; bx < blocksX; ++bx) {
+                if (flags[bx]) {
+                    continue;
+                }
+                const int32_t x0 = bx * blockSize * pixelBytes;
+                const int32_t x1 = std::min(bx * blockSize + blockSize, width) * pixelBytes;
+                if (spanDiffers(p + x0, c + x0, x1 - x0)) {
+                    flags[bx] = 1;
+                    --left;
+                }
+            }
+        }
+    }
+
+    // runs of changed blocks, a run which continues a run of the block row above with the same ends
+    // extends its rectangle
+    dirtyRects->clear();
+    std::vector<OpRect> open, next;
+    for (int32_t by = 0; by < blocksY; ++by) {
+        const uint8_t *flags = &changed[(size_t)by * blocksX];
+        next.clear();
+        for (int32_t bx = 0; bx < blocksX;) {
+            if (!flags[bx]) {
+                ++bx;
+                continue;
+            }
+            int32_t end = bx;
+            while (end < blocksX && flags[end]) {
+                ++end;
+            }
+            OpRect run;
+            run.x      = bx * blockSize;
+            run.y      = by * blockSize;
+            run.width  = std::min(end * blockSize, width) - run.x;
+            run.height = std::min(blockSize, height - run.y);
+            for (size_t i = 0; i < open.size(); ++i) {
+                if (open[i].x == run.x && open[i].width == run.width) {
+                    run.y = open[i].y;
+                    run.height += open[i].height;
+                    open[i].width = 0;
+                    break;
+                }
+            }
+            next.push_back(run);
+            bx = end;
+        }
+        for (size_t i = 0; i < open.size(); ++i) {
+            if (open[i].width > 0) {
+                dirtyRects->push_back(open[i]);
+            }
+        }
+        open.swap(next);
+    }
+    dirtyRects->insert(dirtyRects->end(), open.begin(), open.end());
+}
+
+template <typename T, int32_t nc>
+::ppl::common::RetCode DiffBlocks(
+    int32_t height,
+    int32_t width,
+    int32_t prevWidthStride,
+    const T *prevData,
+    int32_t curWidthStride,
+    const T *curData,
+    int32_t blockSize,
+    std::vector<OpRect> *dirtyRects)
+{
+    if (nullptr == prevData || nullptr == curData || nullptr == dirtyRects) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || prevWidthStride < width * nc || curWidthStride < width * nc || blockSize <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    diffBlocksBytes(height, width, nc * sizeof(T), prevWidthStride * sizeof(T), (const uint8_t *)prevData,
+                    curWidthStride * sizeof(T), (const uint8_t *)curData, blockSize, dirtyRects);
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode DiffBlocks<uint8_t, 1>(int32_t height, int32_t width, int32_t prevWidthStride, const uint8_t *prevData, int32_t curWidthStride, const uint8_t *curData, int32_t blockSize, std::vector<OpRect> *dirtyRects);
+template ::ppl::common::RetCode DiffBlocks<uint8_t, 3>(int32_t height, int32_t width, int32_t prevWidthStride, const uint8_t *prevData, int32_t curWidthStride, const uint8_t *curData, int32_t blockSize, std::vector<OpRect> *dirtyRects);
+template ::ppl::common::RetCode DiffBlocks<uint8_t, 4>(int32_t height, int32_t width, int32_t prevWidthStride, const uint8_t *prevData, int32_t curWidthStride, const uint8_t *curData, int32_t blockSize, std::vector<OpRect> *dirtyRects);
+template ::ppl::common::RetCode DiffBlocks<float, 1>(int32_t height, int32_t width, int32_t prevWidthStride, const float *prevData, int32_t curWidthStride, const float *curData, int32_t blockSize, std::vector<OpRect> *dirtyRects);
+template ::ppl::common::RetCode DiffBlocks<float, 3>(int32_t height, int32_t width, int32_t prevWidthStride, const float *prevData, int32_t curWidthStride, const float *curData, int32_t blockSize, std::vector<OpRect> *dirtyRects);
+template ::ppl::common::RetCode DiffBlocks<float, 4>(int32_t height, int32_t width, int32_t prevWidthStride, const float *prevData, int32_t curWidthStride, const float *curData, int32_t blockSize, std::vector<OpRect> *dirtyRects);
+
+struct IncrementalGraphState {
+    uint8_t *output;   // kept output, rows of OutputWidth() * OutputChannels() elements
+    uint8_t *frame;    // kept input, every row of the input buffer
+    int32_t frameRows; // rows of the input buffer, the UV plane follows the Y plane for NV122BGR
+    int32_t rowBytes;
+    bool valid;
+    std::vector<OpRect> dirty;
+    std::vector<OpRect> updated;
+    std::vector<uint8_t> cells;
+};
+
+// an inclusive box of pixels, with room for the coordinates of warps which leave the image
+struct PixelBox {
+    int64_t x0, y0, x1, y1;
+};
+
+// the output pixels of node which read the input box, false when there is none
+static bool forwardBox(const OpNode &node, PixelBox *box)
+{
+    if (node.type == OP_RESIZE_LINEAR || node.type == OP_WARP_AFFINE_LINEAR) {
+        const double *M = node.affine;
+        double x0 = (double)box->x0, y0 = (double)box->y0, x1 = (double)box->x1, y1 = (double)box->y1;
+        if (node.border == BORDER_TYPE_REPLICATE) {
+            // samples beyond the edges read the edge pixels, so a box on an edge reaches every sample
+            // beyond it: the corners of the output bound them
+            double minx = 0, maxx = 0, miny = 0, maxy = 0;
+            for (int32_t c = 0; c < 4; ++c) {
+                double ox = (c & 1) ? node.outWidth : -1, oy = (c & 2) ? node.outHeight : -1;
+                double sx = M[0] * ox + M[1] * oy + M[2], sy = M[3] * ox + M[4] * oy + M[5];
+                minx = c == 0 ? sx : std::min(minx, sx);
+                maxx = c == 0 ? sx : std::max(maxx, sx);
+                miny = c == 0 ? sy : std::min(miny, sy);
+                maxy = c == 0 ? sy : std::max(maxy, sy);
+            }
+            x0 = box->x0 == 0 ? std::min(x0, std::floor(minx)) : x0;
+            y0 = box->y0 == 0 ? std::min(y0, std::floor(miny)) : y0;
+            x1 = box->x1 == node.inWidth - 1 ? std::max(x1, std::ceil(maxx)) : x1;
+            y1 = box->y1 == node.inHeight - 1 ? std::max(y1, std::ceil(maxy)) : y1;
+        }
+        // the linear interpolation reads the pixel before a sample, the corners of the box mapped back
+        // bound the samples in an affine map
+        x0 -= 1;
+        y0 -= 1;
+        x1 += 1;
+        y1 += 1;
+        const double det = M[0] * M[4] - M[1] * M[3];
+        if (std::fabs(det) < 1e-12) {
+            box->x0 = 0;
+            box->y0 = 0;
+            box->x1 = node.outWidth - 1;
+            box->y1 = node.outHeight - 1;
+            return true;
+        }
+        const double i0 = M[4] / det, i1 = -M[1] / det, i3 = -M[3] / det, i4 = M[0] / det;
+        double minx = 1e300, maxx = -1e300, miny = 1e300, maxy = -1e300;
+        for (int32_t c = 0; c < 4; ++c) {
+            double sx = ((c & 1) ? x1 : x0) - M[2], sy = ((c & 2) ? y1 : y0) - M[5];
+            double ox = i0 * sx + i1 * sy, oy = i3 * sx + i4 * sy;
+            minx      = std::min(minx, ox);
+            maxx      = std::max(maxx, ox);
+            miny      = std::min(miny, oy);
+            maxy      = std::max(maxy, oy);
+        }
+        // one more output pixel covers the rounding of the coordinates
+        const double limit = 1e9;
+        box->x0            = (int64_t)std::floor(std::max(minx, -limit)) - 1;
+        box->y0            = (int64_t)std::floor(std::max(miny, -limit)) - 1;
+        box->x1            = (int64_t)std::ceil(std::min(maxx, limit)) + 1;
+        box->y1            = (int64_t)std::ceil(std::min(maxy, limit)) + 1;
+    } else {
+        int32_t r = 0;
+        if (node.type == OP_GAUSSIAN_BLUR || node.type == OP_BOX_FILTER) {
+            r = node.kernelSize / 2;
+        } else if (node.type == OP_SOBEL) {
+            r = std::max(node.kernelSize, 3) / 2;
+        }
+        // the mirrored borders reflect a pixel within the radius of the edge, whose readers are within the
+        // radius of the pixel as well
+        box->x0 -= r;
+        box->y0 -= r;
+        box->x1 += r;
+        box->y1 += r;
+        if (node.type == OP_NV122BGR) {
+            box->x0 &= ~(int64_t)1;
+            box->y0 &= ~(int64_t)1;
+            box->x1 |= 1;
+            box->y1 |= 1;
+        }
+    }
+    box->x0 = std::max<int64_t>(box->x0, 0);
+    box->y0 = std::max<int64_t>(box->y0, 0);
+    box->x1 = std::min<int64_t>(box->x1, node.outWidth - 1);
+    box->y1 = std::min<int64_t>(box->y1, node.outHeight - 1);
+    return box->x0 <= box->x1 && box->y0 <= box->y1;
+}
+
+IncrementalGraph::IncrementalGraph(const OpGraph &graph, const IncrementalGraphParams &params)
+    : graph_(graph)
+    , params_(params)
+{
+    state_            = new IncrementalGraphState();
+    const bool nv12   = !graph.Nodes().empty() && graph.Nodes()[0].type == OP_NV122BGR;
+    state_->frameRows = nv12 ? graph.InputHeight() + graph.InputHeight() / 2 : graph.InputHeight();
+    state_->rowBytes  = graph.InputWidth() * graph.InputChannels() * (int32_t)opgraph_element_size(graph.InputDataType());
+    state_->valid     = false;
+    const size_t outBytes = (size_t)graph.OutputHeight() * graph.OutputWidth() * graph.OutputChannels() *
+                            opgraph_element_size(graph.OutputDataType());
+    state_->output = (uint8_t *)ppl::common::AlignedAlloc(std::max<size_t>(outBytes, 1), INCREMENTAL_ALIGN);
+    state_->frame  = (uint8_t *)ppl::common::AlignedAlloc(std::max<size_t>((size_t)state_->frameRows * state_->rowBytes, 1), INCREMENTAL_ALIGN);
+}
+
+IncrementalGraph::~IncrementalGraph()
+{
+    ppl::common::AlignedFree(state_->output);
+    ppl::common::AlignedFree(state_->frame);
+    delete state_;
+}
+
+const void *IncrementalGraph::OutputData() const
+{
+    return state_->output;
+}
+
+int32_t IncrementalGraph::OutputWidthStride() const
+{
+    return graph_.OutputWidth() * graph_.OutputChannels();
+}
+
+const std::vector<OpRect> &IncrementalGraph::UpdatedRects() const
+{
+    return state_->updated;
+}
+
+static bool validFrame(const OpGraph &graph, const IncrementalGraphState *state, int32_t inWidthStride, const void *inData)
+{
+    return state->output != NULL && state->frame != NULL && inData != nullptr && graph.InputHeight() > 0 &&
+           graph.InputWidth() > 0 && inWidthStride >= graph.InputWidth() * graph.InputChannels();
+}
+
+::ppl::common::RetCode IncrementalGraph::Reset(int32_t inWidthStride, const void *inData)
+{
+    state_->valid = false;
+    state_->updated.clear();
+    if (!validFrame(graph_, state_, inWidthStride, inData)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    ::ppl::common::RetCode rc = graph_.Execute(inWidthStride, inData, OutputWidthStride(), state_->output);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+    const size_t strideBytes = (size_t)inWidthStride * opgraph_element_size(graph_.InputDataType());
+    for (int32_t y = 0; y < state_->frameRows; ++y) {
+        memcpy(state_->frame + (size_t)y * state_->rowBytes, (const uint8_t *)inData + y * strideBytes, state_->rowBytes);
+    }
+    OpRect all = {0, 0, graph_.OutputWidth(), graph_.OutputHeight()};
+    state_->updated.push_back(all);
+    state_->valid = true;
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode IncrementalGraph::Update(int32_t inWidthStride, const void *inData)
+{
+    if (!state_->valid) {
+        return Reset(inWidthStride, inData);
+    }
+    if (!validFrame(graph_, state_, inWidthStride, inData) || params_.blockSize <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    // every row of the buffer is compared as bytes, which also covers the UV plane of NV122BGR
+    const int32_t elemSize = (int32_t)opgraph_element_size(graph_.InputDataType());
+    const int32_t nc       = graph_.InputChannels();
+    diffBlocksBytes(state_->frameRows, graph_.InputWidth(), nc * elemSize, state_->rowBytes, state_->frame,
+                    inWidthStride * elemSize, (const uint8_t *)inData, params_.blockSize, &state_->dirty);
+
+    // dirty rectangles of the UV plane are turned into the Y pixels which share their chroma
+    std::vector<OpRect> rects;
+    const int32_t height = graph_.InputHeight();
+    for (size_t i = 0; i < state_->dirty.size(); ++i) {
+        OpRect r = state_->dirty[i];
+        if (r.y < height) {
+            OpRect y = r;
+            y.height = std::min(r.y + r.height, height) - r.y;
+            rects.push_back(y);
+        }
+        if (r.y + r.height > height) {
+            const int32_t top = std::max(r.y, height) - height;
+            OpRect uv;
+            uv.x      = r.x & ~1;
+            uv.width  = ((r.x + r.width + 1) & ~1) - uv.x;
+            uv.y      = top * 2;
+            uv.height = std::min((r.y + r.height - height) * 2, height) - uv.y;
+            rects.push_back(uv);
+        }
+    }
+    return Update(inWidthStride, inData, rects.empty() ? NULL : &rects[0], (int32_t)rects.size());
+}
+
+::ppl::common::RetCode IncrementalGraph::Update(
+    int32_t inWidthStride,
+    const void *inData,
+    const OpRect *dirtyRects,
+    int32_t numRects)
+{
+    if (!state_->valid) {
+        return Reset(inWidthStride, inData);
+    }
+    if (!validFrame(graph_, state_, inWidthStride, inData) || numRects < 0 || (numRects > 0 && dirtyRects == nullptr) ||
+        params_.cellSize <= 0 || params_.maxTileSize <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int32_t inHeight = graph_.InputHeight(), inWidth = graph_.InputWidth();
+    const int32_t outHeight = graph_.OutputHeight(), outWidth = graph_.OutputWidth();
+    const int32_t cellSize = params_.cellSize;
+    const int32_t cellsX = (outWidth + cellSize - 1) / cellSize, cellsY = (outHeight + cellSize - 1) / cellSize;
+    std::vector<uint8_t> &cells = state_->cells;
+    cells.assign((size_t)cellsX * cellsY, 0);
+
+    const bool nv12          = !graph_.Nodes().empty() && graph_.Nodes()[0].type == OP_NV122BGR;
+    const size_t pixelBytes  = graph_.InputChannels() * opgraph_element_size(graph_.InputDataType());
+    const size_t strideBytes = (size_t)inWidthStride * opgraph_element_size(graph_.InputDataType());
+    for (int32_t i = 0; i < numRects; ++i) {
+        OpRect r = dirtyRects[i];
+        const int32_t x0 = std::max(r.x, 0), y0 = std::max(r.y, 0);
+        const int32_t x1 = std::min(r.x + r.width, inWidth) - 1, y1 = std::min(r.y + r.height, inHeight) - 1;
+        if (x0 > x1 || y0 > y1) {
+            continue;
+        }
+        // the kept frame follows the new one, NV122BGR also keeps the chroma of the rectangle
+        for (int32_t y = y0; y <= y1; ++y) {
+            memcpy(state_->frame + (size_t)y * state_->rowBytes + x0 * pixelBytes,
+                   (const uint8_t *)inData + y * strideBytes + x0 * pixelBytes, (x1 - x0 + 1) * pixelBytes);
+        }
+        if (nv12) {
+            const int32_t u0 = x0 & ~1, u1 = x1 | 1;
+            for (int32_t y = inHeight + y0 / 2; y <= inHeight + y1 / 2; ++y) {
+                memcpy(state_->frame + (size_t)y * state_->rowBytes + u0, (const uint8_t *)inData + y * strideBytes + u0, u1 - u0 + 1);
+            }
+        }
+
+        PixelBox box = {x0, y0, x1, y1};
+        bool reached = true;
+        for (size_t n = 0; n < graph_.Nodes().size() && reached; ++n) {
+            reached = forwardBox(graph_.Nodes()[n], &box);
+        }
+        if (!reached) {
+            continue;
+        }
+        for (int64_t cy = box.y0 / cellSize; cy <= box.y1 / cellSize; ++cy) {
+            memset(&cells[(size_t)cy * cellsX + box.x0 / cellSize], 1, (size_t)(box.x1 / cellSize - box.x0 / cellSize + 1));
+        }
+    }
+
+    // runs of affected cells become tiles of at most maxTileSize pixels, a tile which continues a tile of
+    // the cell row above with the same ends extends it up to maxTileSize rows
+    const int32_t maxCells = std::max(params_.maxTileSize / cellSize, 1);
+    std::vector<OpRect> &tiles = state_->updated;
+    tiles.clear();
+    std::vector<size_t> open, next;
+    for (int32_t cy = 0; cy < cellsY; ++cy) {
+        const uint8_t *row = &cells[(size_t)cy * cellsX];
+        next.clear();
+        for (int32_t cx = 0; cx < cellsX;) {
+            if (!row[cx]) {
+                ++cx;
+                continue;
+            }
+            int32_t end = cx;
+            while (end < cellsX && row[end] && end - cx < maxCells) {
+                ++end;
+            }
+            OpRect tile;
+            tile.x      = cx * cellSize;
+            tile.y      = cy * cellSize;
+            tile.width  = std::min(end * cellSize, outWidth) - tile.x;
+            tile.height = std::min(cellSize, outHeight - tile.y);
+            bool merged = false;
+            for (size_t i = 0; i < open.size(); ++i) {
+                OpRect &above = tiles[open[i]];
+                if (above.x == tile.x && above.width == tile.width && above.height + tile.height <= maxCells * cellSize) {
+                    above.height += tile.height;
+                    next.push_back(open[i]);
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged) {
+                next.push_back(tiles.size());
+                tiles.push_back(tile);
+            }
+            cx = end;
+        }
+        open.swap(next);
+    }
+    if (tiles.empty()) {
+        return ppl::common::RC_SUCCESS;
+    }
+    return opgraph_run_tiles(graph_, tiles, inWidthStride, inData, OutputWidthStride(), state_->output);
+}
+
+}
+}
+} // namespace ppl::cv::x86
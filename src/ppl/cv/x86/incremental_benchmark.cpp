@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/incremental.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <string.h>
+#include <memory>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// a static scene where a 96 x 96 object moves by a few pixels every frame, the whole frame is recomputed by
+// Execute() when incremental is 0, only the pixels around the object by IncrementalGraph otherwise
+void BM_IncrementalGraph_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    bool incremental = state.range(2) != 0;
+    const int32_t side = 96;
+    std::unique_ptr<uint8_t[]> frame(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> background(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> object(new uint8_t[side * side * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(background.get(), width * height * 3, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(object.get(), side * side * 3, 0, 255);
+    memcpy(frame.get(), background.get(), width * height * 3);
+
+    ppl::cv::x86::OpGraph graph(height, width, 3, ppl::cv::x86::OP_DATA_UINT8);
+    graph.AddGaussianBlur(5, 1.2f);
+    graph.AddResizeLinear(height / 2, width / 2);
+    graph.AddBGR2GRAY();
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[graph.OutputWidth() * graph.OutputHeight()]);
+    ppl::cv::x86::IncrementalGraph kept(graph);
+    kept.Reset(width * 3, frame.get());
+    int32_t x = 0, y = height / 3;
+    for (auto _ : state) {
+        for (int32_t i = 0; i < side; ++i) {
+            memcpy(frame.get() + ((y + i) * width + x) * 3, background.get() + ((y + i) * width + x) * 3, side * 3);
+        }
+        x = (x + 4) % (width - side);
+        for (int32_t i = 0; i < side; ++i) {
+            memcpy(frame.get() + ((y + i) * width + x) * 3, object.get() + i * side * 3, side * 3);
+        }
+        if (incremental) {
+            kept.Update(width * 3, frame.get());
+        } else {
+            graph.Execute(width * 3, frame.get(), graph.OutputWidth(), dst.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_DiffBlocks_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> prev(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> cur(new uint8_t[width * height * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(prev.get(), width * height * 3, 0, 255);
+    memcpy(cur.get(), prev.get(), width * height * 3);
+    cur[(height / 2 * width + width / 2) * 3] ^= 1;
+    std::vector<ppl::cv::x86::OpRect> rects;
+    for (auto _ : state) {
+        ppl::cv::x86::DiffBlocks<uint8_t, 3>(height, width, width * 3, prev.get(), width * 3, cur.get(), 16, &rects);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+BENCHMARK(BM_IncrementalGraph_ppl_x86)->Args({1280, 720, 0})->Args({1280, 720, 1})->Args({1920, 1080, 0})->Args({1920, 1080, 1});
+BENCHMARK(BM_DiffBlocks_ppl_x86)->Args({1280, 720})->Args({1920, 1080});
@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/incremental.h"
+#include "ppl/cv/x86/test.h"
+#include <stdlib.h>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+// overwrites a random rectangle of the frame with noise, one time in four it touches a corner of the image
+template <typename T>
+static ppl::cv::x86::OpRect RandomPatch(int32_t height, int32_t width, int32_t nc, int32_t widthStride, T* data, T maxValue)
+{
+    ppl::cv::x86::OpRect r;
+    r.width  = 1 + rand() % std::max(width / 8, 1);
+    r.height = 1 + rand() % std::max(height / 8, 1);
+    r.x      = rand() % (width - r.width + 1);
+    r.y      = rand() % (height - r.height + 1);
+    if (rand() % 4 == 0) {
+        r.x = (rand() & 1) ? 0 : width - r.width;
+        r.y = (rand() & 1) ? 0 : height - r.height;
+    }
+    std::vector<T> noise((size_t)r.width * nc);
+    for (int32_t y = r.y; y < r.y + r.height; ++y) {
+        ppl::cv::debug::randomFill<T>(noise.data(), noise.size(), 0, maxValue);
+        std::copy(noise.begin(), noise.end(), data + (size_t)y * widthStride + r.x * nc);
+    }
+    return r;
+}
+
+// the rectangles must not overlap and must cover exactly the blocks which changed
+template <typename T, int32_t nc>
+void DiffBlocksTest(int32_t height, int32_t width, int32_t blockSize, int32_t patches)
+{
+    const int32_t stride = width * nc + 5;
+    std::vector<T> prev((size_t)height * stride), cur;
+    ppl::cv::debug::randomFill<T>(prev.data(), prev.size(), 0, 255);
+    cur = prev;
+    for (int32_t i = 0; i < patches; ++i) {
+        RandomPatch<T>(height, width, nc, stride, cur.data(), (T)255);
+    }
+    // a change of a single element, which the block compare must not miss in the tail of a row
+    cur[(size_t)(height - 1) * stride + width * nc - 1] += 1;
+
+    std::vector<ppl::cv::x86::OpRect> rects;
+    ASSERT_EQ(ppl::common::RC_SUCCESS, (ppl::cv::x86::DiffBlocks<T, nc>(height, width, stride, prev.data(), stride, cur.data(), blockSize, &rects)));
+
+    const int32_t blocksX = (width + blockSize - 1) / blockSize, blocksY = (height + blockSize - 1) / blockSize;
+    std::vector<int32_t> covered((size_t)blocksX * blocksY, 0), changed(covered.size(), 0);
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width * nc; ++x) {
+            if (prev[(size_t)y * stride + x] != cur[(size_t)y * stride + x]) {
+                changed[(y / blockSize) * blocksX + x / nc / blockSize] = 1;
+            }
+        }
+    }
+    for (size_t i = 0; i < rects.size(); ++i) {
+        const ppl::cv::x86::OpRect& r = rects[i];
+        ASSERT_EQ(0, r.x % blockSize);
+        ASSERT_EQ(0, r.y % blockSize);
+        ASSERT_LE(r.x + r.width, width);
+        ASSERT_LE(r.y + r.height, height);
+        for (int32_t by = r.y / blockSize; by * blockSize < r.y + r.height; ++by) {
+            for (int32_t bx = r.x / blockSize; bx * blockSize < r.x + r.width; ++bx) {
+                ++covered[by * blocksX + bx];
+            }
+        }
+    }
+    EXPECT_TRUE(covered == changed);
+
+    ASSERT_EQ(ppl::common::RC_SUCCESS, (ppl::cv::x86::DiffBlocks<T, nc>(height, width, stride, cur.data(), stride, cur.data(), blockSize, &rects)));
+    EXPECT_TRUE(rects.empty());
+}
+
+TEST(DiffBlocks_UINT8, x86)
+{
+    DiffBlocksTest<uint8_t, 1>(480, 640, 16, 5);
+    DiffBlocksTest<uint8_t, 3>(720, 1283, 16, 8);
+    DiffBlocksTest<uint8_t, 4>(101, 77, 8, 3);
+}
+
+TEST(DiffBlocks_FP32, x86)
+{
+    DiffBlocksTest<float, 1>(480, 640, 16, 5);
+    DiffBlocksTest<float, 3>(333, 517, 32, 8);
+    DiffBlocksTest<float, 4>(64, 64, 64, 1);
+}
+
+// a stream of frames where a few rectangles change: after each Update() the kept output must match Execute()
+// of the graph on the whole frame. useRects passes the changed rectangles instead of letting the frames be compared
+template <typename T, typename Tout>
+void IncrementalGraphTest(
+    const ppl::cv::x86::OpGraph& graph,
+    int32_t frames,
+    int32_t patches,
+    bool useRects,
+    float diff,
+    int32_t frameRows = 0,
+    const ppl::cv::x86::IncrementalGraphParams& params = ppl::cv::x86::IncrementalGraphParams())
+{
+    const int32_t height = graph.InputHeight(), width = graph.InputWidth(), nc = graph.InputChannels();
+    const int32_t rows = frameRows > 0 ? frameRows : height, stride = width * nc + 3;
+    const int32_t outStride = graph.OutputWidth() * graph.OutputChannels();
+    std::vector<T> frame((size_t)rows * stride);
+    ppl::cv::debug::randomFill<T>(frame.data(), frame.size(), 0, (T)255);
+    std::vector<Tout> expected((size_t)graph.OutputHeight() * outStride);
+
+    ppl::cv::x86::IncrementalGraph incremental(graph, params);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, incremental.Update(stride, frame.data()));
+    ASSERT_EQ(outStride, incremental.OutputWidthStride());
+    for (int32_t f = 0; f < frames; ++f) {
+        std::vector<ppl::cv::x86::OpRect> dirty;
+        for (int32_t i = 0; i < patches; ++i) {
+            dirty.push_back(RandomPatch<T>(rows, width, nc, stride, frame.data(), (T)255));
+            if (frameRows > 0) {
+                // the patches of the UV plane are given as the Y pixels sharing that chroma
+                ppl::cv::x86::OpRect& r = dirty.back();
+                if (r.y + r.height > height) {
+                    const int32_t bottom = r.y < height ? height : (r.y + r.height - height) * 2;
+                    r.y      = r.y < height ? 0 : (r.y - height) * 2;
+                    r.height = bottom - r.y;
+                }
+            }
+        }
+        ppl::common::RetCode rc = useRects ? incremental.Update(stride, frame.data(), dirty.data(), (int32_t)dirty.size())
+                                           : incremental.Update(stride, frame.data());
+        ASSERT_EQ(ppl::common::RC_SUCCESS, rc);
+        ASSERT_EQ(ppl::common::RC_SUCCESS, graph.Execute(stride, frame.data(), outStride, expected.data()));
+        checkResult<Tout, 1>(expected.data(), (const Tout*)incremental.OutputData(), graph.OutputHeight(), outStride, outStride, outStride, diff);
+    }
+
+    // an unchanged frame recomputes nothing
+    ASSERT_EQ(ppl::common::RC_SUCCESS, incremental.Update(stride, frame.data()));
+    EXPECT_TRUE(incremental.UpdatedRects().empty());
+}
+
+TEST(IncrementalGraph_Filters, x86)
+{
+    ppl::cv::x86::OpGraph graph(480, 640, 3, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddGaussianBlur(5, 1.5f));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddBGR2GRAY());
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddSobel(1, 0, 3));
+    IncrementalGraphTest<uint8_t, int16_t>(graph, 6, 3, false, 0.01f);
+    IncrementalGraphTest<uint8_t, int16_t>(graph, 6, 3, true, 0.01f);
+
+    ppl::cv::x86::OpGraph box(301, 257, 1, ppl::cv::x86::OP_DATA_FLOAT32);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, box.AddBoxFilter(7, ppl::cv::BORDER_TYPE_REPLICATE));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, box.AddGaussianBlur(3, 1.f));
+    IncrementalGraphTest<float, float>(box, 6, 4, false, 1e-3f);
+}
+
+TEST(IncrementalGraph_Warps, x86)
+{
+    ppl::cv::x86::OpGraph resize(480, 640, 3, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, resize.AddGaussianBlur(3, 1.f));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, resize.AddResizeLinear(200, 333));
+    IncrementalGraphTest<uint8_t, uint8_t>(resize, 6, 3, false, 1.01f);
+
+    // the warp samples far outside of the image, where the replicated edges decide the output, small cells
+    // leave no slack around the affected pixels
+    const double M[6] = {0.9, 0.2, -50.0, -0.15, 1.1, 40.0};
+    ppl::cv::x86::IncrementalGraphParams params;
+    params.cellSize    = 4;
+    params.maxTileSize = 64;
+    ppl::cv::x86::OpGraph warp(240, 320, 4, ppl::cv::x86::OP_DATA_FLOAT32);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, warp.AddWarpAffineLinear(260, 400, M, ppl::cv::BORDER_TYPE_REPLICATE));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, warp.AddConvertTo(ppl::cv::x86::OP_DATA_UINT8, 1.f));
+    IncrementalGraphTest<float, uint8_t>(warp, 8, 2, true, 1.01f, 0, params);
+    IncrementalGraphTest<float, uint8_t>(warp, 8, 2, false, 1.01f, 0, params);
+
+    ppl::cv::x86::OpGraph constant(240, 320, 1, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, constant.AddWarpAffineLinear(240, 320, M, ppl::cv::BORDER_TYPE_CONSTANT, 7.f));
+    IncrementalGraphTest<uint8_t, uint8_t>(constant, 8, 2, false, 1.01f, 0, params);
+}
+
+TEST(IncrementalGraph_NV12, x86)
+{
+    ppl::cv::x86::OpGraph graph(360, 480, 1, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddNV122BGR());
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddResizeLinear(180, 240));
+    IncrementalGraphTest<uint8_t, uint8_t>(graph, 6, 3, false, 1.01f, 540);
+    IncrementalGraphTest<uint8_t, uint8_t>(graph, 6, 3, true, 1.01f, 540);
+}
+
+TEST(IncrementalGraph_InvalidParams, x86)
+{
+    ppl::cv::x86::OpGraph graph(64, 64, 3, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddGaussianBlur(3, 1.f));
+    ppl::cv::x86::IncrementalGraph incremental(graph);
+    std::vector<uint8_t> frame(64 * 64 * 3);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, incremental.Reset(64, frame.data()));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, incremental.Update(64 * 3, NULL));
+    EXPECT_EQ(ppl::common::RC_SUCCESS, incremental.Reset(64 * 3, frame.data()));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, incremental.Update(64 * 3, frame.data(), NULL, 2));
+
+    std::vector<ppl::cv::x86::OpRect> rects;
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, (ppl::cv::x86::DiffBlocks<uint8_t, 3>(64, 64, 64 * 3, frame.data(), 64 * 3, frame.data(), 0, &rects)));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, (ppl::cv::x86::DiffBlocks<uint8_t, 3>(64, 64, 64 * 3, frame.data(), 64 * 3, frame.data(), 16, NULL)));
+}
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_INPLACE_HPP_
+#define __ST_HPC_PPL_CV_X86_INPLACE_HPP_
+#include "ppl/common/retcode.h"
+#include "ppl/common/sys.h"
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows of output produced per call of the filter, the halo of 2 * radius rows is recomputed for each band
+#define INPLACE_BAND_ROWS 64
+
+// Runs filter over data in place (its input and output are the same rows). filter(height, inWidthStride,
+// inData, outWidthStride, outData) is the out-of-place operation, and every output row may only depend on
+// the input rows within radius of it. The image is filtered in bands of rows: a ring of the original rows
+// around the current band, which carries the 2 * radius halo rows over to the next band, is the input of
+// the filter, and its output goes straight back into data. The radius output rows above the band, which
+// the filter overwrites with values computed against a fake border, are saved and restored afterwards.
+// Scratch memory is O(radius) rows whatever the height. rowLength and widthStride are in elements.
+// Filters that keep running sums down the rows start them again at each band, so float results are only
+// equal to the out-of-place ones up to rounding
+template <typename T, typename Filter>
+::ppl::common::RetCode inplace_filter_rows(
+    int32_t height,
+    int32_t rowLength,
+    int32_t widthStride,
+    T* data,
+    int32_t radius,
+    const Filter& filter)
+{
+    const int32_t maxBandRows = std::max(INPLACE_BAND_ROWS, 8 * (2 * radius + 1));
+    const int32_t numBands    = (height + maxBandRows - 1) / maxBandRows;
+    const int32_t bandRows    = (height + numBands - 1) / numBands;
+    const int32_t ringRows    = std::min(height, bandRows + 2 * radius);
+    const size_t rowBytes     = rowLength * sizeof(T);
+
+    // plus a vector of slack, some kernels load whole vectors past the last pixel of their input
+    T* ring = (T*)ppl::common::AlignedAlloc((ringRows + radius) * rowBytes + 64, 64);
+    if (ring == NULL) {
+        return ppl::common::RC_OUT_OF_MEMORY;
+    }
+    T* saved = ring + (size_t)ringRows * rowLength;
+
+    // the ring holds the original rows [ringTop, ringTop + ringCount)
+    int32_t ringTop = 0, ringCount = 0;
+    ::ppl::common::RetCode rc = ppl::common::RC_SUCCESS;
+    for (int32_t y0 = 0; y0 < height && rc == ppl::common::RC_SUCCESS; y0 += bandRows) {
+        const int32_t y1     = std::min(height, y0 + bandRows);
+        const int32_t top    = std::max(0, y0 - radius);
+        const int32_t bottom = std::min(height, y1 + radius);
+
+        const int32_t drop = top - ringTop;
+        if (drop > 0) {
+            ringCount -= drop;
+            memmove(ring, ring + (size_t)drop * rowLength, ringCount * rowBytes);
+            ringTop = top;
+        }
+        // rows from ringTop + ringCount on have not been written yet
+        for (int32_t i = ringTop + ringCount; i < bottom; ++i, ++ringCount) {
+            memcpy(ring + (size_t)ringCount * rowLength, data + (size_t)i * widthStride, rowBytes);
+        }
+        for (int32_t i = top; i < y0; ++i) {
+            memcpy(saved + (size_t)(i - top) * rowLength, data + (size_t)i * widthStride, rowBytes);
+        }
+
+        rc = filter(bottom - top, rowLength, (const T*)ring, widthStride, data + (size_t)top * widthStride);
+
+        for (int32_t i = top; i < y0; ++i) {
+            memcpy(data + (size_t)i * widthStride, saved + (size_t)(i - top) * rowLength, rowBytes);
+        }
+    }
+    ppl::common::AlignedFree(ring);
+    return rc;
+}
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_INPLACE_HPP_
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/boxfilter.h"
+#include "ppl/cv/x86/medianblur.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+
+namespace {
+
+// state.range(3) selects in place (1) or out of place (0) on the same image
+template<typename T, int32_t nc>
+void BM_GaussianBlur_inplace_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t ksize = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    T* out = state.range(3) ? src.get() : dst.get();
+    for (auto _ : state) {
+        ppl::cv::x86::GaussianBlur<T, nc>(height, width, width * nc, src.get(), ksize, 0.f, width * nc, out, ppl::cv::BORDER_TYPE_REFLECT_101);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template<typename T, int32_t nc>
+void BM_BoxFilter_inplace_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t ksize = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    T* out = state.range(3) ? src.get() : dst.get();
+    for (auto _ : state) {
+        ppl::cv::x86::BoxFilter<T, nc>(height, width, width * nc, src.get(), ksize, ksize, true, width * nc, out, ppl::cv::BORDER_TYPE_REFLECT_101);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_GaussianBlur_inplace_ppl_x86, uint8_t, 3)->Args({640, 480, 5, 0})->Args({640, 480, 5, 1})->Args({1920, 1080, 5, 0})->Args({1920, 1080, 5, 1})->Args({1920, 1080, 31, 0})->Args({1920, 1080, 31, 1});
+BENCHMARK_TEMPLATE(BM_GaussianBlur_inplace_ppl_x86, float, 1)->Args({640, 480, 5, 0})->Args({640, 480, 5, 1})->Args({1920, 1080, 5, 0})->Args({1920, 1080, 5, 1})->Args({1920, 1080, 31, 0})->Args({1920, 1080, 31, 1});
+BENCHMARK_TEMPLATE(BM_BoxFilter_inplace_ppl_x86, uint8_t, 3)->Args({640, 480, 5, 0})->Args({640, 480, 5, 1})->Args({1920, 1080, 5, 0})->Args({1920, 1080, 5, 1});
+BENCHMARK_TEMPLATE(BM_BoxFilter_inplace_ppl_x86, float, 1)->Args({640, 480, 5, 0})->Args({640, 480, 5, 1})->Args({1920, 1080, 5, 0})->Args({1920, 1080, 5, 1});
+
+}
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/boxfilter.h"
+#include "ppl/cv/x86/erode.h"
+#include "ppl/cv/x86/dilate.h"
+#include "ppl/cv/x86/medianblur.h"
+#include "ppl/cv/x86/arithmetic.h"
+#include "ppl/cv/x86/convertto.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include "ppl/cv/types.h"
+#include <vector>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+// op(height, width, inWidthStride, inData, outWidthStride, outData) runs out of place and then in place
+// over a copy of the same image: the results must match and the padding must stay untouched. Filters
+// reject an in-place call with two different strides
+template <typename T, int32_t nc, typename Op>
+void InplaceTest(int32_t height, int32_t width, int32_t padding, const Op& op, float diff, bool filter = true)
+{
+    const int32_t stride = width * nc + padding;
+    // a vector of slack, the vectorized morphology kernels load whole vectors past the last pixel
+    std::vector<T> src((size_t)height * stride + 16), dst(src.size());
+    ppl::cv::debug::randomFill<T>(src.data(), src.size(), 0, 255);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, op(height, width, stride, src.data(), stride, dst.data()));
+
+    std::vector<T> image(src);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, op(height, width, stride, image.data(), stride, image.data()));
+    checkResult<T, nc>(dst.data(), image.data(), height, width, stride, stride, diff);
+    for (int32_t i = 0; i < height; ++i) {
+        for (int32_t j = width * nc; j < stride; ++j) {
+            ASSERT_EQ(src[i * stride + j], image[i * stride + j]);
+        }
+    }
+    if (filter) {
+        EXPECT_EQ(ppl::common::RC_INVALID_VALUE, op(height - 1, width, stride, image.data(), width * nc, image.data()));
+    }
+}
+
+template <typename T, int32_t nc>
+void InplaceFilterTest(int32_t height, int32_t width, ppl::cv::BorderType border_type, float diff)
+{
+    const int32_t ksizes[] = {3, 5, 7, 31};
+    for (int32_t k : ksizes) {
+        InplaceTest<T, nc>(height, width, 7, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+            return ppl::cv::x86::GaussianBlur<T, nc>(h, w, inStride, in, k, 0.f, outStride, out, border_type);
+        }, diff);
+        InplaceTest<T, nc>(height, width, 7, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+            return ppl::cv::x86::BoxFilter<T, nc>(h, w, inStride, in, k, k - 2 > 0 ? k - 2 : k, true, outStride, out, border_type);
+        }, diff);
+    }
+
+    // a full 3x3 and 5x5 mask take the vectorized paths, the cross the generic one
+    std::vector<uint8_t> full(7 * 7, 1), cross(5 * 5, 0);
+    for (int32_t i = 0; i < 5; ++i) {
+        cross[i * 5 + 2] = cross[2 * 5 + i] = 1;
+    }
+    const int32_t morphSizes[] = {3, 5, 7};
+    for (int32_t k : morphSizes) {
+        InplaceTest<T, nc>(height, width, 7, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+            return ppl::cv::x86::Erode<T, nc>(h, w, inStride, in, k, k, full.data(), outStride, out, ppl::cv::BORDER_TYPE_CONSTANT, 255);
+        }, diff);
+        InplaceTest<T, nc>(height, width, 7, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+            return ppl::cv::x86::Dilate<T, nc>(h, w, inStride, in, k, k, full.data(), outStride, out, ppl::cv::BORDER_TYPE_CONSTANT, 0);
+        }, diff);
+    }
+    InplaceTest<T, nc>(height, width, 7, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::Erode<T, nc>(h, w, inStride, in, 5, 5, cross.data(), outStride, out, ppl::cv::BORDER_TYPE_CONSTANT, 255);
+    }, diff);
+    InplaceTest<T, nc>(height, width, 7, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::Dilate<T, nc>(h, w, inStride, in, 5, 5, cross.data(), outStride, out, ppl::cv::BORDER_TYPE_CONSTANT, 0);
+    }, diff);
+
+    const int32_t medianSizes[] = {3, 5};
+    for (int32_t k : medianSizes) {
+        InplaceTest<T, nc>(height, width, 7, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+            return ppl::cv::x86::MedianBlur<T, nc>(h, w, inStride, in, outStride, out, k, border_type);
+        }, diff);
+    }
+}
+
+TEST(Inplace_Filter_FP32, x86)
+{
+    InplaceFilterTest<float, 1>(480, 640, ppl::cv::BORDER_TYPE_REFLECT_101, 1e-3);
+    InplaceFilterTest<float, 3>(241, 321, ppl::cv::BORDER_TYPE_REFLECT_101, 1e-3);
+    InplaceFilterTest<float, 4>(37, 64, ppl::cv::BORDER_TYPE_REFLECT_101, 1e-3);
+}
+
+TEST(Inplace_Filter_UINT8, x86)
+{
+    InplaceFilterTest<uint8_t, 1>(480, 640, ppl::cv::BORDER_TYPE_REFLECT_101, 0.01f);
+    InplaceFilterTest<uint8_t, 3>(241, 321, ppl::cv::BORDER_TYPE_REFLECT, 0.01f);
+    InplaceFilterTest<uint8_t, 4>(200, 97, ppl::cv::BORDER_TYPE_REPLICATE, 0.01f);
+}
+
+template <typename T, int32_t nc>
+void InplaceElementwiseTest(int32_t height, int32_t width, float diff)
+{
+    const int32_t stride = width * nc;
+    std::vector<T> other((size_t)height * stride);
+    ppl::cv::debug::randomFill<T>(other.data(), other.size(), 1, 255);
+    const T* operand = other.data();
+    const T scalar[4] = {3, 50, 100, 200};
+
+    InplaceTest<T, nc>(height, width, 0, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::Add<T, nc>(h, w, inStride, in, stride, operand, outStride, out);
+    }, diff, false);
+    InplaceTest<T, nc>(height, width, 0, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::Mul<T, nc>(h, w, stride, operand, inStride, in, outStride, out, 0.5f);
+    }, diff, false);
+    InplaceTest<T, nc>(height, width, 0, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::Subtract<T, nc>(h, w, inStride, in, scalar, outStride, out);
+    }, diff, false);
+    InplaceTest<T, nc>(height, width, 0, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::AbsDiff<T, nc>(h, w, inStride, in, stride, operand, outStride, out);
+    }, diff, false);
+    InplaceTest<T, nc>(height, width, 0, [&](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::ConvertTo<T, nc, T>(h, w, inStride, in, 0.75f, outStride, out);
+    }, diff, false);
+}
+
+TEST(Inplace_Elementwise_FP32, x86)
+{
+    InplaceElementwiseTest<float, 1>(480, 640, 1e-4);
+    InplaceElementwiseTest<float, 3>(241, 321, 1e-4);
+    InplaceElementwiseTest<float, 4>(37, 65, 1e-4);
+}
+
+TEST(Inplace_Elementwise_UINT8, x86)
+{
+    InplaceElementwiseTest<uint8_t, 1>(480, 640, 0.01f);
+    InplaceElementwiseTest<uint8_t, 3>(241, 321, 0.01f);
+    InplaceElementwiseTest<uint8_t, 4>(37, 65, 0.01f);
+}
+
+template <typename T>
+void InplaceSwapTest(int32_t height, int32_t width)
+{
+    InplaceTest<T, 3>(height, width, 7, [](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::BGR2RGB<T>(h, w, inStride, in, outStride, out);
+    }, 0.01f);
+    InplaceTest<T, 3>(height, width, 7, [](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::RGB2BGR<T>(h, w, inStride, in, outStride, out);
+    }, 0.01f);
+    InplaceTest<T, 4>(height, width, 7, [](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::BGRA2RGBA<T>(h, w, inStride, in, outStride, out);
+    }, 0.01f);
+    InplaceTest<T, 4>(height, width, 7, [](int32_t h, int32_t w, int32_t inStride, const T* in, int32_t outStride, T* out) {
+        return ppl::cv::x86::RGBA2BGRA<T>(h, w, inStride, in, outStride, out);
+    }, 0.01f);
+}
+
+TEST(Inplace_ColorSwap, x86)
+{
+    InplaceSwapTest<float>(241, 321);
+    InplaceSwapTest<uint8_t>(480, 640);
+    InplaceSwapTest<uint8_t>(37, 7);
+}
@@ -18,11 +18,39 @@
 #include "ppl/cv/x86/integral.h"
 #include "ppl/cv/types.h"
 #include <string.h>
+#include <algorithm>
 
 namespace ppl {
 namespace cv {
 namespace x86 {
 
+// columns of one work item of the vertical pass
+#define INTEGRAL_STRIP_LENGTH 256
+
+// Rows are summed from left to right in parallel, then columns from top to bottom in parallel strips. Every
+// output is the sum of the same terms in the same order whatever the number of threads.
+template <typename TDst>
+static void integral_columns(
+    int32_t height,
+    int32_t length,
+    int32_t outWidthStride,
+    TDst *out)
+{
+    const int32_t numStrips = (length + INTEGRAL_STRIP_LENGTH - 1) / INTEGRAL_STRIP_LENGTH;
+#pragma omp parallel for schedule(static)
+    for (int32_t s = 0; s < numStrips; s++) {
+        const int32_t begin = s * INTEGRAL_STRIP_LENGTH;
+        const int32_t end   = std::min(begin + INTEGRAL_STRIP_LENGTH, length);
+        for (int32_t h = 1; h < height; h++) {
+            const TDst *prev = out + (int64_t)(h - 1) * outWidthStride;
+            TDst *cur        = out + (int64_t)h * outWidthStride;
+            for (int32_t w = begin; w < end; w++) {
+                cur[w] = prev[w] + cur[w];
+            }
+        }
+    }
+}
+
 template <typename TSrc, typename TDst, int32_t cn>
 void IntegralImage(
     int32_t height,
@@ -34,26 +62,20 @@ void IntegralImage(
 {
     int32_t outWidth = width + 1;
     memset(out, 0, sizeof(TDst) * outWidth * cn);
+#pragma omp parallel for schedule(static)
     for (int32_t h = 0; h < height; h++) {
         TDst sum[cn] = {0};
-        memset(out + (h + 1) * outWidthStride, 0, sizeof(TDst) * cn);
+        TDst *dst    = out + (int64_t)(h + 1) * outWidthStride;
+        memset(dst, 0, sizeof(TDst) * cn);
         for (int32_t w = 0; w < width; w++) {
             for (int32_t c = 0; c < cn; c++) {
-                TSrc in_v = in[h * inWidthStride + w * cn + c];
+                TSrc in_v = in[(int64_t)h * inWidthStride + w * cn + c];
                 sum[c] += in_v;
-                out[(h + 1) * outWidthStride + (w + 1) * cn + c] = sum[c];
+                dst[(w + 1) * cn + c] = sum[c];
             }
         }
     }
-
-    for (int32_t w = 0; w < width * cn; w++) {
-        TDst sum = (TDst)0;
-        for (int32_t h = 0; h < height; h++) {
-            TDst in_v = out[(h + 1) * outWidthStride + cn + w];
-            sum += in_v;
-            out[(h + 1) * outWidthStride + cn + w] = sum;
-        }
-    }
+    integral_columns<TDst>(height, width * cn, outWidthStride, out + outWidthStride + cn);
 }
 
 template <typename TSrc, typename TDst, int32_t cn>
@@ -66,25 +88,18 @@ void IntegralImageDeprecate(
     TDst *out)
 {
     //integral by row
+#pragma omp parallel for schedule(static)
     for (int32_t h = 0; h < height; h++) {
         TDst sum[cn] = {0};
         for (int32_t w = 0; w < width; w++) {
             for (int32_t c = 0; c < cn; c++) {
-                TSrc in_v = in[h * inWidthStride + w * cn + c];
+                TSrc in_v = in[(int64_t)h * inWidthStride + w * cn + c];
                 sum[c] += in_v;
-                out[h * outWidthStride + w * cn + c] = sum[c];
+                out[(int64_t)h * outWidthStride + w * cn + c] = sum[c];
             }
         }
     }
-
-    for (int32_t w = 0; w < width * cn; w++) {
-        TDst sum = (TDst)0;
-        for (int32_t h = 0; h < height; h++) {
-            TDst in_v = out[h * outWidthStride + w];
-            sum += in_v;
-            out[h * outWidthStride + w] = sum;
-        }
-    }
+    integral_columns<TDst>(height, width * cn, outWidthStride, out);
 }
 
 template <>
@@ -217,4 +217,67 @@ inline void _mm_interleave_epi16(__m128i& v_r0, __m128i& v_r1, __m128i& v_g0, __
     v_r1 = _mm_packus_epi32(_mm_and_si128(layer1_chunk2, v_mask), _mm_and_si128(layer1_chunk3, v_mask));
     v_g1 = _mm_packus_epi32(_mm_srli_epi32(layer1_chunk2, 16), _mm_srli_epi32(layer1_chunk3, 16));
 }
+
+// arc tangent, the Cephes single precision range reduction and polynomial
+inline __m128 v_atan_ps(__m128 x)
+{
+    const __m128 one  = _mm_set1_ps(1.f);
+    const __m128 sign = _mm_and_ps(x, _mm_set1_ps(-0.f));
+    x                 = _mm_xor_ps(x, sign);
+    __m128 big        = _mm_cmpgt_ps(x, _mm_set1_ps(2.414213562373095f));
+    __m128 mid        = _mm_andnot_ps(big, _mm_cmpgt_ps(x, _mm_set1_ps(0.4142135623730950f)));
+    __m128 xb         = _mm_div_ps(_mm_set1_ps(-1.f), x);
+    __m128 xm         = _mm_div_ps(_mm_sub_ps(x, one), _mm_add_ps(x, one));
+    __m128 xr         = _mm_blendv_ps(_mm_blendv_ps(x, xm, mid), xb, big);
+    __m128 y0         = _mm_or_ps(_mm_and_ps(big, _mm_set1_ps(1.5707963267948966f)),
+                          _mm_and_ps(mid, _mm_set1_ps(0.7853981633974483f)));
+    __m128 z          = _mm_mul_ps(xr, xr);
+    __m128 p          = _mm_set1_ps(8.05374449538e-2f);
+    p                 = _mm_sub_ps(_mm_mul_ps(p, z), _mm_set1_ps(1.38776856032e-1f));
+    p                 = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(1.99777106478e-1f));
+    p                 = _mm_sub_ps(_mm_mul_ps(p, z), _mm_set1_ps(3.33329491539e-1f));
+    p                 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), xr), xr);
+    return _mm_xor_ps(_mm_add_ps(y0, p), sign);
+}
+
+// arc tangent of y / x in (-pi, pi], 0 for the origin
+inline __m128 v_atan2_ps(__m128 y, __m128 x)
+{
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 ax             = _mm_and_ps(x, abs_mask);
+    __m128 ay             = _mm_and_ps(y, abs_mask);
+    __m128 num            = _mm_min_ps(ax, ay);
+    __m128 den            = _mm_max_ps(ax, ay);
+    __m128 t              = _mm_andnot_ps(_mm_cmpeq_ps(den, _mm_setzero_ps()), _mm_div_ps(num, den));
+    __m128 a              = v_atan_ps(t);
+    a                     = _mm_blendv_ps(a, _mm_sub_ps(_mm_set1_ps(1.5707963267948966f), a), _mm_cmpgt_ps(ay, ax));
+    a                     = _mm_blendv_ps(a, _mm_sub_ps(_mm_set1_ps(3.14159265358979323f), a), _mm_cmplt_ps(x, _mm_setzero_ps()));
+    return _mm_or_ps(a, _mm_and_ps(y, _mm_set1_ps(-0.f)));
+}
+
+// natural logarithm of positive values, the Cephes single precision polynomial
+inline __m128 v_log_ps(__m128 x)
+{
+    const __m128 one = _mm_set1_ps(1.f);
+    __m128i bits     = _mm_castps_si128(x);
+    __m128 e         = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+    x                = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+    __m128 small     = _mm_cmplt_ps(x, _mm_set1_ps(0.707106781186547524f));
+    e                = _mm_sub_ps(e, _mm_and_ps(small, one));
+    x                = _mm_sub_ps(_mm_add_ps(x, _mm_and_ps(small, x)), one);
+    __m128 z         = _mm_mul_ps(x, x);
+    __m128 p         = _mm_set1_ps(7.0376836292e-2f);
+    p                = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-1.1514610310e-1f));
+    p                = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.1676998740e-1f));
+    p                = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-1.2420140846e-1f));
+    p                = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.4249322787e-1f));
+    p                = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-1.6668057665e-1f));
+    p                = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(2.0000714765e-1f));
+    p                = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-2.4999993993e-1f));
+    p                = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(3.3333331174e-1f));
+    p                = _mm_mul_ps(_mm_mul_ps(p, x), z);
+    p                = _mm_add_ps(p, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+    p                = _mm_sub_ps(p, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    return _mm_add_ps(_mm_add_ps(x, p), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+}
 #endif
@@ -16,6 +16,7 @@
 // under the License.
 
 #include "ppl/cv/x86/laplacian.h"
+#include "ppl/cv/x86/sobel.hpp"
 #include "ppl/cv/types.h"
 #include <string.h>
 #include <cmath>
@@ -285,6 +286,48 @@ void x86laplacian_f_3(
     }
 }
 
+// d2/dx2 + d2/dy2 as two separable terms, so the sum stays in integers until it is scaled
+static ::ppl::common::RetCode laplacian_u8s16(
+    int32_t height,
+    int32_t width,
+    int32_t cn,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t ksize,
+    double scale,
+    double delta,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (inData == nullptr || outData == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || (ksize != 1 && ksize != 3 && ksize != 5 && ksize != 7)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    int16_t kx[2][33];
+    int16_t ky[2][33];
+    int32_t ksizeX = 3;
+    int32_t ksizeY = 3;
+    if (ksize == 1) {
+        // the 3x3 cross: second differences along one axis, the centre tap along the other
+        const int16_t d2[3]     = {1, -2, 1};
+        const int16_t centre[3] = {0, 1, 0};
+        for (int32_t k = 0; k < 3; ++k) {
+            kx[0][k] = d2[k];
+            ky[0][k] = centre[k];
+            kx[1][k] = centre[k];
+            ky[1][k] = d2[k];
+        }
+    } else {
+        getSobelKernels_u8(kx[0], ky[0], ksizeX, ksizeY, 2, 0, 1.0, ksize);
+        getSobelKernels_u8(kx[1], ky[1], ksizeX, ksizeY, 0, 2, 1.0, ksize);
+    }
+    const int16_t* kxs[2] = {kx[0], kx[1]};
+    const int16_t* kys[2] = {ky[0], ky[1]};
+    return sepfilter_u8s16(height, width, cn, inWidthStride, inData, 2, kxs, kys, ksizeX, ksizeY, scale, delta, outWidthStride, outData);
+}
+
 template <>
 ::ppl::common::RetCode Laplacian<uint8_t, 1>(
     int32_t height,
@@ -447,6 +490,63 @@ template <>
     return ppl::common::RC_SUCCESS;
 }
 
+template <>
+::ppl::common::RetCode Laplacian<uint8_t, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    int16_t* outData,
+    int32_t ksize,
+    double scale,
+    double delta,
+    BorderType border_type)
+{
+    if (border_type != ppl::cv::BORDER_TYPE_REFLECT_101) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return laplacian_u8s16(height, width, 1, inWidthStride, inData, ksize, scale, delta, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode Laplacian<uint8_t, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    int16_t* outData,
+    int32_t ksize,
+    double scale,
+    double delta,
+    BorderType border_type)
+{
+    if (border_type != ppl::cv::BORDER_TYPE_REFLECT_101) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return laplacian_u8s16(height, width, 3, inWidthStride, inData, ksize, scale, delta, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode Laplacian<uint8_t, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    int16_t* outData,
+    int32_t ksize,
+    double scale,
+    double delta,
+    BorderType border_type)
+{
+    if (border_type != ppl::cv::BORDER_TYPE_REFLECT_101) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return laplacian_u8s16(height, width, 4, inWidthStride, inData, ksize, scale, delta, outWidthStride, outData);
+}
+
 }
 }
 } // namespace ppl::cv::x86
@@ -60,3 +60,41 @@ TEST(Laplacian_UINT8, x86)
     LaplacianTest<uint8_t, 3, 3>(720, 1080, 2, 1, 1);
     LaplacianTest<uint8_t, 3, 4>(720, 1080, 2, 1, 1);
 }
+
+template<int32_t filter_size, int32_t nc>
+void LaplacianS16Test(int32_t height, int32_t width, double scale, double delta) {
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::unique_ptr<int16_t[]> dst_ref(new int16_t[width * height * nc]);
+    std::unique_ptr<int16_t[]> dst(new int16_t[width * height * nc]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(CV_8U, nc), src.get(), sizeof(uint8_t) * width * nc);
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(CV_16S, nc), dst_ref.get(), sizeof(int16_t) * width * nc);
+
+    cv::Laplacian(src_opencv, dst_opencv, CV_16S, filter_size, scale, delta, cv::BORDER_REFLECT_101);
+    ppl::cv::x86::Laplacian<uint8_t, int16_t, nc>(height, width, width * nc, src.get(), width * nc, dst.get(),
+                            filter_size, scale, delta, ppl::cv::BORDER_TYPE_REFLECT_101);
+
+    checkResult<int16_t, nc>(dst_ref.get(), dst.get(),
+                    height, width,
+                    width * nc, width * nc,
+                    1e-3);
+}
+
+// sums are exact in integers, only scale and delta go through float
+TEST(Laplacian_UINT8_INT16, x86)
+{
+    LaplacianS16Test<1, 1>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<1, 3>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<1, 4>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<3, 1>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<3, 3>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<3, 4>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<5, 1>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<5, 3>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<5, 4>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<7, 1>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<7, 3>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<7, 4>(720, 1080, 1.0, 0.0);
+    LaplacianS16Test<3, 1>(37, 61, 2.0, 5.0);
+    LaplacianS16Test<5, 3>(3, 2, 0.5, -1.0);
+}
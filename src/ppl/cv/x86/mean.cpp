@@ -17,11 +17,109 @@
 
 #include "ppl/cv/x86/mean.h"
 #include "ppl/cv/types.h"
+#include "reduction.hpp"
 
 namespace ppl {
 namespace cv {
 namespace x86 {
 
+// uint8_t sums are exact in integers, float sums are kept in double lanes and, with a mask, per channel
+struct MeanPartial {
+    double lanes[REDUCTION_LANES];
+    double sum[4];
+    int64_t isum[4];
+    int64_t count;
+
+    MeanPartial()
+    {
+        for (int32_t i = 0; i < REDUCTION_LANES; ++i) {
+            lanes[i] = 0;
+        }
+        for (int32_t k = 0; k < 4; ++k) {
+            sum[k]  = 0;
+            isum[k] = 0;
+        }
+        count = 0;
+    }
+    void merge(const MeanPartial& other)
+    {
+        for (int32_t i = 0; i < REDUCTION_LANES; ++i) {
+            lanes[i] += other.lanes[i];
+        }
+        for (int32_t k = 0; k < 4; ++k) {
+            sum[k] += other.sum[k];
+            isum[k] += other.isum[k];
+        }
+        count += other.count;
+    }
+};
+
+template <int32_t nc>
+static void mean_row(const uint8_t* src, int32_t width, MeanPartial& partial)
+{
+    int32_t sum[4] = {0, 0, 0, 0};
+    for (int32_t j = 0; j < width; j++) {
+        for (int32_t k = 0; k < nc; k++) {
+            sum[k] += src[j * nc + k];
+        }
+    }
+    for (int32_t k = 0; k < nc; k++) {
+        partial.isum[k] += sum[k];
+    }
+}
+
+template <int32_t nc>
+static void mean_row(const float* src, int32_t width, MeanPartial& partial)
+{
+    reduction_sum_f32(src, width * nc, partial.lanes);
+}
+
+template <int32_t nc>
+static void mean_masked_row(const uint8_t* src, const uint8_t* mask, int32_t width, MeanPartial& partial)
+{
+    for (int32_t j = 0; j < width; j++) {
+        if (mask[j]) {
+            for (int32_t k = 0; k < nc; k++) {
+                partial.isum[k] += src[j * nc + k];
+            }
+            partial.count++;
+        }
+    }
+}
+
+template <int32_t nc>
+static void mean_masked_row(const float* src, const uint8_t* mask, int32_t width, MeanPartial& partial)
+{
+    for (int32_t j = 0; j < width; j++) {
+        if (mask[j]) {
+            for (int32_t k = 0; k < nc; k++) {
+                partial.sum[k] += src[j * nc + k];
+            }
+            partial.count++;
+        }
+    }
+}
+
+template <typename T, int32_t nc>
+struct MeanKernel {
+    int32_t width;
+    int32_t inWidthStride;
+    const T* inData;
+    int32_t inMaskStride;
+    const uint8_t* inMask;
+
+    void operator()(int32_t rowBegin, int32_t rowEnd, MeanPartial& partial) const
+    {
+        for (int32_t i = rowBegin; i < rowEnd; i++) {
+            if (inMask != NULL) {
+                mean_masked_row<nc>(inData + (int64_t)i * inWidthStride, inMask + (int64_t)i * inMaskStride, width, partial);
+            } else {
+                mean_row<nc>(inData + (int64_t)i * inWidthStride, width, partial);
+            }
+        }
+    }
+};
+
 template <typename T, int32_t nc>
 ::ppl::common::RetCode Mean(
     int32_t height,
@@ -30,7 +128,8 @@ template <typename T, int32_t nc>
     const T* inData,
     float* outMeanData,
     int32_t inMaskStride,
-    uint8_t* inMask)
+    uint8_t* inMask,
+    ReductionMode mode)
 {
     if (inData == nullptr || outMeanData == nullptr) {
         return ppl::common::RC_INVALID_VALUE;
@@ -39,40 +138,18 @@ template <typename T, int32_t nc>
         return ppl::common::RC_INVALID_VALUE;
     } 
 
-    bool useMask = false;
-    if (inMask != NULL)
-        useMask = true;
-
-    double sum[4]    = {0, 0, 0, 0};
-    int32_t count[4] = {0, 0, 0, 0};
-    if (useMask) {
-        for (int32_t i = 0; i < height; i++) {
-            const T* ptr_in = inData + i * inWidthStride;
-            for (int32_t j = 0; j < width; j++) {
-                if (inMask[i * inMaskStride + j]) {
-                    for (int32_t k = 0; k < nc; k++) {
-                        sum[k] += ptr_in[j * nc + k];
-                        count[k]++;
-                    }
-                }
-            }
-        }
-    } else {
-        for (int32_t k = 0; k < nc; ++k) {
-            count[k] = height * width;
-        }
-        for (int32_t i = 0; i < height; i++) {
-            const T* ptr_in = inData + i * inWidthStride;
-            for (int32_t j = 0; j < width; j++) {
-                for (int32_t k = 0; k < nc; k++) {
-                    sum[k] += ptr_in[j * nc + k];
-                }
-            }
-        }
+    MeanKernel<T, nc> kernel = {width, inWidthStride, inData, inMaskStride, inMask};
+    MeanPartial partial;
+    parallel_reduce(height, width * nc, mode, kernel, partial);
+    if (inMask == NULL) {
+        partial.count = (int64_t)height * width;
     }
 
+    double sum[4];
+    reduction_lanes_to_channels(partial.lanes, nc, sum);
     for (int32_t i = 0; i < nc; i++) {
-        outMeanData[i] = (float)(sum[i] / count[i]);
+        sum[i] += partial.sum[i] + (double)partial.isum[i];
+        outMeanData[i] = (float)(sum[i] / partial.count);
     }
     return ppl::common::RC_SUCCESS;
 }
@@ -84,7 +161,8 @@ template ::ppl::common::RetCode Mean<uint8_t, 1>(
     const uint8_t* inData,
     float* outMeanData,
     int32_t inMaskStride,
-    uint8_t* inMask);
+    uint8_t* inMask,
+    ReductionMode mode);
 template ::ppl::common::RetCode Mean<uint8_t, 3>(
     int32_t height,
     int32_t width,
@@ -92,7 +170,8 @@ template ::ppl::common::RetCode Mean<uint8_t, 3>(
     const uint8_t* inData,
     float* outMeanData,
     int32_t inMaskStride,
-    uint8_t* inMask);
+    uint8_t* inMask,
+    ReductionMode mode);
 template ::ppl::common::RetCode Mean<uint8_t, 4>(
     int32_t height,
     int32_t width,
@@ -100,7 +179,8 @@ template ::ppl::common::RetCode Mean<uint8_t, 4>(
     const uint8_t* inData,
     float* outMeanData,
     int32_t inMaskStride,
-    uint8_t* inMask);
+    uint8_t* inMask,
+    ReductionMode mode);
 
 template ::ppl::common::RetCode Mean<float, 1>(
     int32_t height,
@@ -109,7 +189,8 @@ template ::ppl::common::RetCode Mean<float, 1>(
     const float* inData,
     float* outMeanData,
     int32_t inMaskStride,
-    uint8_t* inMask);
+    uint8_t* inMask,
+    ReductionMode mode);
 template ::ppl::common::RetCode Mean<float, 3>(
     int32_t height,
     int32_t width,
@@ -117,7 +198,8 @@ template ::ppl::common::RetCode Mean<float, 3>(
     const float* inData,
     float* outMeanData,
     int32_t inMaskStride,
-    uint8_t* inMask);
+    uint8_t* inMask,
+    ReductionMode mode);
 template ::ppl::common::RetCode Mean<float, 4>(
     int32_t height,
     int32_t width,
@@ -125,7 +207,8 @@ template ::ppl::common::RetCode Mean<float, 4>(
     const float* inData,
     float* outMeanData,
     int32_t inMaskStride,
-    uint8_t* inMask);
+    uint8_t* inMask,
+    ReductionMode mode);
 
 }
 }
@@ -16,6 +16,7 @@
 // under the License.
 
 #include "ppl/cv/x86/meanstddev.h"
+#include "reduction.hpp"
 #include <cmath>
 #include <cstdlib>
 #include <algorithm>
@@ -24,6 +25,104 @@ namespace ppl {
 namespace cv {
 namespace x86 {
 
+// uint8_t sums and sums of squares are exact in integers, float ones are kept in double lanes and, with a
+// mask, per channel
+struct MeanStdDevPartial {
+    double lanes[REDUCTION_LANES];
+    double sqlanes[REDUCTION_LANES];
+    double sum[4];
+    double sqsum[4];
+    int64_t isum[4];
+    int64_t isqsum[4];
+    int64_t count;
+
+    MeanStdDevPartial()
+    {
+        for (int32_t i = 0; i < REDUCTION_LANES; ++i) {
+            lanes[i]   = 0;
+            sqlanes[i] = 0;
+        }
+        for (int32_t c = 0; c < 4; ++c) {
+            sum[c]    = 0;
+            sqsum[c]  = 0;
+            isum[c]   = 0;
+            isqsum[c] = 0;
+        }
+        count = 0;
+    }
+    void merge(const MeanStdDevPartial& other)
+    {
+        for (int32_t i = 0; i < REDUCTION_LANES; ++i) {
+            lanes[i] += other.lanes[i];
+            sqlanes[i] += other.sqlanes[i];
+        }
+        for (int32_t c = 0; c < 4; ++c) {
+            sum[c] += other.sum[c];
+            sqsum[c] += other.sqsum[c];
+            isum[c] += other.isum[c];
+            isqsum[c] += other.isqsum[c];
+        }
+        count += other.count;
+    }
+};
+
+template <int32_t channels>
+static void meanstddev_row(const uint8_t* src, const uint8_t* mask, int32_t width, MeanStdDevPartial& partial)
+{
+    int32_t sum[4] = {0, 0, 0, 0};
+    int64_t sqsum[4] = {0, 0, 0, 0};
+    for (int32_t x = 0; x < width; ++x) {
+        if (mask != nullptr && !mask[x]) {
+            continue;
+        }
+        for (int32_t c = 0; c < channels; c++) {
+            int32_t v = src[channels * x + c];
+            sum[c] += v;
+            sqsum[c] += v * v;
+        }
+        partial.count++;
+    }
+    for (int32_t c = 0; c < channels; c++) {
+        partial.isum[c] += sum[c];
+        partial.isqsum[c] += sqsum[c];
+    }
+}
+
+template <int32_t channels>
+static void meanstddev_row(const float* src, const uint8_t* mask, int32_t width, MeanStdDevPartial& partial)
+{
+    if (mask == nullptr) {
+        reduction_sum_sqsum_f32(src, width * channels, partial.lanes, partial.sqlanes);
+        return;
+    }
+    for (int32_t x = 0; x < width; ++x) {
+        if (mask[x]) {
+            for (int32_t c = 0; c < channels; c++) {
+                double v = src[channels * x + c];
+                partial.sum[c] += v;
+                partial.sqsum[c] += v * v;
+            }
+            partial.count++;
+        }
+    }
+}
+
+template <typename T, int32_t channels>
+struct MeanStdDevKernel {
+    int32_t width;
+    int32_t srcStride;
+    const T* inData;
+    int32_t maskStride;
+    const uint8_t* mask;
+
+    void operator()(int32_t rowBegin, int32_t rowEnd, MeanStdDevPartial& partial) const
+    {
+        for (int32_t y = rowBegin; y < rowEnd; ++y) {
+            meanstddev_row<channels>(inData + (int64_t)y * srcStride, mask == nullptr ? nullptr : mask + (int64_t)y * maskStride, width, partial);
+        }
+    }
+};
+
 template <typename T, int32_t channels>
 ::ppl::common::RetCode MeanStdDev(
     int32_t height,
@@ -33,7 +132,8 @@ template <typename T, int32_t channels>
     float* mean,
     float* stddev,
     int32_t maskStride,
-    const uint8_t* mask)
+    const uint8_t* mask,
+    ReductionMode mode)
 {
     if (inData == nullptr || mean == nullptr || stddev == nullptr) {
         return ppl::common::RC_INVALID_VALUE;
@@ -42,46 +142,23 @@ template <typename T, int32_t channels>
         return ppl::common::RC_INVALID_VALUE;
     } 
 
-    float sum[channels]   = {0};
-    float sqsum[channels] = {0};
-
-    int32_t count = 0;
-    if (nullptr == mask) {
-        count = height * width;
-        for (int32_t y = 0; y < height; ++y) {
-            const T* base_in = inData + y * srcStride;
-            for (int32_t x = 0; x < width; ++x) {
-                for (int32_t c = 0; c < channels; c++) {
-                    float v = (float)(base_in[channels * x + c]);
-                    sum[c] += v;
-                    sqsum[c] += v * v;
-                }
-            }
-        }
-    } else {
-        for (int32_t y = 0; y < height; ++y) {
-            const T* base_in         = inData + y * srcStride;
-            const uint8_t* base_mask = mask + y * maskStride;
-            for (int32_t x = 0; x < width; ++x) {
-                if (base_mask[x]) {
-                    for (int32_t c = 0; c < channels; c++) {
-                        float v = (float)(base_in[channels * x + c]);
-                        sum[c] += v;
-                        sqsum[c] += v * v;
-                    }
-                    count++;
-                }
-            }
-        }
-    }
+    MeanStdDevKernel<T, channels> kernel = {width, srcStride, inData, maskStride, mask};
+    MeanStdDevPartial partial;
+    parallel_reduce(height, width * channels, mode, kernel, partial);
 
-    float scale = 1. / count;
+    double sum[4], sqsum[4];
+    reduction_lanes_to_channels(partial.lanes, channels, sum);
+    reduction_lanes_to_channels(partial.sqlanes, channels, sqsum);
+    // without a mask the float rows do not count their pixels
+    const int64_t count = mask == nullptr ? (int64_t)height * width : partial.count;
+    const double scale  = 1. / count;
     for (int32_t i = 0; i < channels; i++) {
-        mean[i]        = (float)sum[i] * scale;
-        float variance = std::max(sqsum[i] * scale - (mean[i]) * (mean[i]), 0.0f);
-        stddev[i]      = std::sqrt(variance);
+        double m        = (sum[i] + partial.sum[i] + (double)partial.isum[i]) * scale;
+        double variance = std::max((sqsum[i] + partial.sqsum[i] + (double)partial.isqsum[i]) * scale - m * m, 0.0);
+        mean[i]         = (float)m;
+        stddev[i]       = (float)std::sqrt(variance);
     }
-    return 0;
+    return ppl::common::RC_SUCCESS;
 }
 
 template ::ppl::common::RetCode MeanStdDev<uint8_t, 1>(
@@ -92,7 +169,8 @@ template ::ppl::common::RetCode MeanStdDev<uint8_t, 1>(
     float* mean,
     float* stddev,
     int32_t maskStride,
-    const uint8_t* mask);
+    const uint8_t* mask,
+    ReductionMode mode);
 template ::ppl::common::RetCode MeanStdDev<uint8_t, 3>(
     int32_t height,
     int32_t width,
@@ -101,7 +179,8 @@ template ::ppl::common::RetCode MeanStdDev<uint8_t, 3>(
     float* mean,
     float* stddev,
     int32_t maskStride,
-    const uint8_t* mask);
+    const uint8_t* mask,
+    ReductionMode mode);
 template ::ppl::common::RetCode MeanStdDev<uint8_t, 4>(
     int32_t height,
     int32_t width,
@@ -110,7 +189,8 @@ template ::ppl::common::RetCode MeanStdDev<uint8_t, 4>(
     float* mean,
     float* stddev,
     int32_t maskStride,
-    const uint8_t* mask);
+    const uint8_t* mask,
+    ReductionMode mode);
 
 template ::ppl::common::RetCode MeanStdDev<float, 1>(
     int32_t height,
@@ -120,7 +200,8 @@ template ::ppl::common::RetCode MeanStdDev<float, 1>(
     float* mean,
     float* stddev,
     int32_t maskStride,
-    const uint8_t* mask);
+    const uint8_t* mask,
+    ReductionMode mode);
 template ::ppl::common::RetCode MeanStdDev<float, 3>(
     int32_t height,
     int32_t width,
@@ -129,7 +210,8 @@ template ::ppl::common::RetCode MeanStdDev<float, 3>(
     float* mean,
     float* stddev,
     int32_t maskStride,
-    const uint8_t* mask);
+    const uint8_t* mask,
+    ReductionMode mode);
 template ::ppl::common::RetCode MeanStdDev<float, 4>(
     int32_t height,
     int32_t width,
@@ -138,7 +220,8 @@ template ::ppl::common::RetCode MeanStdDev<float, 4>(
     float* mean,
     float* stddev,
     int32_t maskStride,
-    const uint8_t* mask);
+    const uint8_t* mask,
+    ReductionMode mode);
 
 }
 }
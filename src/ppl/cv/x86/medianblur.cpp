@@ -17,7 +17,10 @@
 
 #include "ppl/cv/x86/medianblur.h"
 #include "ppl/cv/x86/copymakeborder.h"
+#include "ppl/cv/x86/inplace.hpp"
 #include "ppl/cv/types.h"
+#include <immintrin.h>
+#include <algorithm>
 
 namespace ppl {
 namespace cv {
@@ -54,6 +57,104 @@ T findKth(T* a, int32_t n, int32_t k)
         return findKth(a, pos + 1, k);
 }
 
+#define MEDIAN_SORT_U16(a, b)                  \
+    {                                          \
+        __m128i t = p[a];                      \
+        p[a]      = _mm_min_epu16(t, p[b]);    \
+        p[b]      = _mm_max_epu16(t, p[b]);    \
+    }
+
+// median of 9 vectors in p[4], a 19 comparator selection network
+static inline __m128i median9_u16(__m128i* p)
+{
+    MEDIAN_SORT_U16(1, 2); MEDIAN_SORT_U16(4, 5); MEDIAN_SORT_U16(7, 8);
+    MEDIAN_SORT_U16(0, 1); MEDIAN_SORT_U16(3, 4); MEDIAN_SORT_U16(6, 7);
+    MEDIAN_SORT_U16(1, 2); MEDIAN_SORT_U16(4, 5); MEDIAN_SORT_U16(7, 8);
+    MEDIAN_SORT_U16(0, 3); MEDIAN_SORT_U16(5, 8); MEDIAN_SORT_U16(4, 7);
+    MEDIAN_SORT_U16(3, 6); MEDIAN_SORT_U16(1, 4); MEDIAN_SORT_U16(2, 5);
+    MEDIAN_SORT_U16(4, 7); MEDIAN_SORT_U16(4, 2); MEDIAN_SORT_U16(6, 4);
+    MEDIAN_SORT_U16(4, 2);
+    return p[4];
+}
+
+// median of 25 vectors in p[12], a 99 comparator selection network
+static inline __m128i median25_u16(__m128i* p)
+{
+    MEDIAN_SORT_U16(0, 1);   MEDIAN_SORT_U16(3, 4);   MEDIAN_SORT_U16(2, 4);   MEDIAN_SORT_U16(2, 3);
+    MEDIAN_SORT_U16(6, 7);   MEDIAN_SORT_U16(5, 7);   MEDIAN_SORT_U16(5, 6);   MEDIAN_SORT_U16(9, 10);
+    MEDIAN_SORT_U16(8, 10);  MEDIAN_SORT_U16(8, 9);   MEDIAN_SORT_U16(12, 13); MEDIAN_SORT_U16(11, 13);
+    MEDIAN_SORT_U16(11, 12); MEDIAN_SORT_U16(15, 16); MEDIAN_SORT_U16(14, 16); MEDIAN_SORT_U16(14, 15);
+    MEDIAN_SORT_U16(18, 19); MEDIAN_SORT_U16(17, 19); MEDIAN_SORT_U16(17, 18); MEDIAN_SORT_U16(21, 22);
+    MEDIAN_SORT_U16(20, 22); MEDIAN_SORT_U16(20, 21); MEDIAN_SORT_U16(23, 24); MEDIAN_SORT_U16(2, 5);
+    MEDIAN_SORT_U16(3, 6);   MEDIAN_SORT_U16(0, 6);   MEDIAN_SORT_U16(0, 3);   MEDIAN_SORT_U16(4, 7);
+    MEDIAN_SORT_U16(1, 7);   MEDIAN_SORT_U16(1, 4);   MEDIAN_SORT_U16(11, 14); MEDIAN_SORT_U16(8, 14);
+    MEDIAN_SORT_U16(8, 11);  MEDIAN_SORT_U16(12, 15); MEDIAN_SORT_U16(9, 15);  MEDIAN_SORT_U16(9, 12);
+    MEDIAN_SORT_U16(13, 16); MEDIAN_SORT_U16(10, 16); MEDIAN_SORT_U16(10, 13); MEDIAN_SORT_U16(20, 23);
+    MEDIAN_SORT_U16(17, 23); MEDIAN_SORT_U16(17, 20); MEDIAN_SORT_U16(21, 24); MEDIAN_SORT_U16(18, 24);
+    MEDIAN_SORT_U16(18, 21); MEDIAN_SORT_U16(19, 22); MEDIAN_SORT_U16(8, 17);  MEDIAN_SORT_U16(9, 18);
+    MEDIAN_SORT_U16(0, 18);  MEDIAN_SORT_U16(0, 9);   MEDIAN_SORT_U16(10, 19); MEDIAN_SORT_U16(1, 19);
+    MEDIAN_SORT_U16(1, 10);  MEDIAN_SORT_U16(11, 20); MEDIAN_SORT_U16(2, 20);  MEDIAN_SORT_U16(2, 11);
+    MEDIAN_SORT_U16(12, 21); MEDIAN_SORT_U16(3, 21);  MEDIAN_SORT_U16(3, 12);  MEDIAN_SORT_U16(13, 22);
+    MEDIAN_SORT_U16(4, 22);  MEDIAN_SORT_U16(4, 13);  MEDIAN_SORT_U16(14, 23); MEDIAN_SORT_U16(5, 23);
+    MEDIAN_SORT_U16(5, 14);  MEDIAN_SORT_U16(15, 24); MEDIAN_SORT_U16(6, 24);  MEDIAN_SORT_U16(6, 15);
+    MEDIAN_SORT_U16(7, 16);  MEDIAN_SORT_U16(7, 19);  MEDIAN_SORT_U16(13, 21); MEDIAN_SORT_U16(15, 23);
+    MEDIAN_SORT_U16(7, 13);  MEDIAN_SORT_U16(7, 15);  MEDIAN_SORT_U16(1, 9);   MEDIAN_SORT_U16(3, 11);
+    MEDIAN_SORT_U16(5, 17);  MEDIAN_SORT_U16(11, 17); MEDIAN_SORT_U16(9, 17);  MEDIAN_SORT_U16(4, 10);
+    MEDIAN_SORT_U16(6, 12);  MEDIAN_SORT_U16(7, 14);  MEDIAN_SORT_U16(4, 6);   MEDIAN_SORT_U16(4, 7);
+    MEDIAN_SORT_U16(12, 14); MEDIAN_SORT_U16(10, 14); MEDIAN_SORT_U16(6, 7);   MEDIAN_SORT_U16(10, 12);
+    MEDIAN_SORT_U16(6, 10);  MEDIAN_SORT_U16(6, 17);  MEDIAN_SORT_U16(12, 17); MEDIAN_SORT_U16(7, 17);
+    MEDIAN_SORT_U16(7, 10);  MEDIAN_SORT_U16(12, 18); MEDIAN_SORT_U16(7, 12);  MEDIAN_SORT_U16(10, 18);
+    MEDIAN_SORT_U16(12, 20); MEDIAN_SORT_U16(10, 20); MEDIAN_SORT_U16(10, 12);
+    return p[12];
+}
+
+// no vector path for the other types, they take the selection below
+template <typename T>
+static bool median_network(int32_t height, int32_t rowLength, int32_t cn, const T* buffer, int32_t bufferStride, int32_t outWidthStride, T* outData, int32_t ksize)
+{
+    return false;
+}
+
+// 3x3 and 5x5 medians of uint16_t run 8 samples at a time through min/max sorting networks. The last vector
+// of a row is moved back to end at the row end, rows shorter than a vector go to the selection below
+static bool median_network(int32_t height, int32_t rowLength, int32_t cn, const uint16_t* buffer, int32_t bufferStride, int32_t outWidthStride, uint16_t* outData, int32_t ksize)
+{
+    if ((ksize != 3 && ksize != 5) || rowLength < 8) {
+        return false;
+    }
+    __m128i p[25];
+    for (int32_t i = 0; i < height; ++i) {
+        for (int32_t x = 0; x < rowLength; x += 8) {
+            x = std::min(x, rowLength - 8);
+            const uint16_t* src = buffer + i * bufferStride + x;
+            for (int32_t ky = 0; ky < ksize; ++ky) {
+                for (int32_t kx = 0; kx < ksize; ++kx) {
+                    p[ky * ksize + kx] = _mm_loadu_si128((const __m128i*)(src + ky * bufferStride + kx * cn));
+                }
+            }
+            __m128i median = ksize == 3 ? median9_u16(p) : median25_u16(p);
+            _mm_storeu_si128((__m128i*)(outData + i * outWidthStride + x), median);
+        }
+    }
+    return true;
+}
+
+template <typename T, int32_t cn>
+struct MedianBlurRows {
+    int32_t width;
+    int32_t ksize;
+    BorderType border_type;
+
+    MedianBlurRows(int32_t width, int32_t ksize, BorderType border_type)
+        : width(width)
+        , ksize(ksize)
+        , border_type(border_type) {}
+    ::ppl::common::RetCode operator()(int32_t height, int32_t inWidthStride, const T* inData, int32_t outWidthStride, T* outData) const
+    {
+        return MedianBlur<T, cn>(height, width, inWidthStride, inData, outWidthStride, outData, ksize, border_type);
+    }
+};
+
 template <typename T, int32_t cn>
 ::ppl::common::RetCode MedianBlur(
     int32_t height,
@@ -75,6 +176,13 @@ template <typename T, int32_t cn>
         border_type != ppl::cv::BORDER_TYPE_CONSTANT && border_type != ppl::cv::BORDER_TYPE_REPLICATE) {
         return ppl::common::RC_INVALID_VALUE;
     }
+    if (inData == outData) {
+        // the rows are filtered band by band through a ring of ksize / 2 halo rows
+        if (inWidthStride != outWidthStride) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        return inplace_filter_rows(height, width * cn, outWidthStride, outData, ksize / 2, MedianBlurRows<T, cn>(width, ksize, border_type));
+    }
     int32_t radius_x = ksize / 2;
     int32_t radius_y = ksize / 2;
 
@@ -83,6 +191,12 @@ template <typename T, int32_t cn>
 
     CopyMakeBorder<T, cn>(height, width, inWidthStride, inData, height + 2 * radius_y, width + 2 * radius_x, (width + 2 * radius_x) * cn, buffer, border_type);
 
+    if (median_network(height, width * cn, cn, buffer, (width + 2 * radius_x) * cn, outWidthStride, outData, ksize)) {
+        free(buffer);
+        free(temp);
+        return ppl::common::RC_SUCCESS;
+    }
+
     int32_t area     = ksize * ksize;
     int32_t midIndex = (area >> 1) + 1;
     for (int32_t i = 0; i < height; ++i) {
@@ -162,6 +276,36 @@ template ::ppl::common::RetCode MedianBlur<uint8_t, 4>(
     int32_t ksize,
     BorderType border_type);
 
+template ::ppl::common::RetCode MedianBlur<uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    int32_t ksize,
+    BorderType border_type);
+
+template ::ppl::common::RetCode MedianBlur<uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    int32_t ksize,
+    BorderType border_type);
+
+template ::ppl::common::RetCode MedianBlur<uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    int32_t ksize,
+    BorderType border_type);
+
 }
 }
 } // namespace ppl::cv::x86
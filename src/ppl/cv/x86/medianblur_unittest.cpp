@@ -24,11 +24,11 @@
 
 
 template<typename T, int32_t filter_size, int32_t nc>
-void MedianBlurTest(int32_t height, int32_t width, float diff) {
+void MedianBlurTest(int32_t height, int32_t width, float diff, T maxValue = 255) {
     std::unique_ptr<T[]> src(new T[width * height * nc]);
     std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
     std::unique_ptr<T[]> dst(new T[width * height * nc]);
-    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, maxValue);
     cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * width * nc);
     cv::Mat dst_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get(), sizeof(T) * width * nc);
 
@@ -62,3 +62,13 @@ TEST(MEDIAN_BLUR_UINT8, x86)
     MedianBlurTest<uint8_t, 3, 4>(720, 1080, 1e-3);
     MedianBlurTest<uint8_t, 5, 4>(720, 1080, 1e-3);
 }
+
+TEST(MEDIAN_BLUR_UINT16, x86)
+{
+    MedianBlurTest<uint16_t, 3, 1>(720, 1080, 1e-3, 65535);
+    MedianBlurTest<uint16_t, 5, 1>(720, 1080, 1e-3, 65535);
+    MedianBlurTest<uint16_t, 3, 3>(720, 1080, 1e-3, 65535);
+    MedianBlurTest<uint16_t, 5, 3>(720, 1080, 1e-3, 65535);
+    MedianBlurTest<uint16_t, 3, 4>(720, 1080, 1e-3, 65535);
+    MedianBlurTest<uint16_t, 5, 4>(720, 1080, 1e-3, 65535);
+}
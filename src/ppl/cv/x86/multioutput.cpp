@@ -0,0 +1,407 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/multioutput.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include "resize_linear.hpp"
+
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// resized rows of one work item, and of one call of the resize inside it
+#define MULTI_BAND_ROWS 32
+#define MULTI_STEP_ROWS 4
+// input rows of one work item when nothing is resized
+#define MULTI_COLOR_ROWS 16
+#define MULTI_SCRATCH_ALIGN 128
+// the histogram is counted into 4 tables, so that runs of equal values do not wait for each other
+#define MULTI_HIST_SIZE (4 * 256 * sizeof(int32_t))
+
+// GRAY of BGR2GRAY, Q15
+#define GRAY_SHIFT 15
+// luma of BGR2NV12, Q20, every coefficient split into a high and a low part of 15 bits for _mm_madd_epi16
+#define Y_SHIFT   20
+#define Y_COEFF_R 269484
+#define Y_COEFF_G 528482
+#define Y_COEFF_B 102760
+
+static inline uint64_t multi_align(uint64_t size)
+{
+    return (size + MULTI_SCRATCH_ALIGN - 1) / MULTI_SCRATCH_ALIGN * MULTI_SCRATCH_ALIGN;
+}
+
+template <bool doGray, bool doY>
+static void multi_bgr_row_u8(const uint8_t *src, int32_t width, uint8_t *gray, uint8_t *y)
+{
+    const int32_t gray_half = 1 << (GRAY_SHIFT - 1);
+    const int32_t y_delta   = (1 << (Y_SHIFT - 1)) + (16 << Y_SHIFT);
+
+    int32_t coeff_b = 0.114f * (1 << GRAY_SHIFT), coeff_g = 0.587f * (1 << GRAY_SHIFT) + 0.5, coeff_r = (1 << GRAY_SHIFT) - coeff_b - coeff_g;
+    const int32_t y_mask = (1 << 15) - 1;
+
+    __m128i v_gray_bg  = _mm_setr_epi16(coeff_b, coeff_g, coeff_b, coeff_g, coeff_b, coeff_g, coeff_b, coeff_g);
+    __m128i v_gray_rc  = _mm_setr_epi16(coeff_r, 1, coeff_r, 1, coeff_r, 1, coeff_r, 1);
+    __m128i v_y_bg_hi  = _mm_setr_epi16(Y_COEFF_B >> 15, Y_COEFF_G >> 15, Y_COEFF_B >> 15, Y_COEFF_G >> 15, Y_COEFF_B >> 15, Y_COEFF_G >> 15, Y_COEFF_B >> 15, Y_COEFF_G >> 15);
+    __m128i v_y_bg_lo  = _mm_setr_epi16(Y_COEFF_B & y_mask, Y_COEFF_G & y_mask, Y_COEFF_B & y_mask, Y_COEFF_G & y_mask, Y_COEFF_B & y_mask, Y_COEFF_G & y_mask, Y_COEFF_B & y_mask, Y_COEFF_G & y_mask);
+    __m128i v_y_rc_hi  = _mm_setr_epi16(Y_COEFF_R >> 15, 0, Y_COEFF_R >> 15, 0, Y_COEFF_R >> 15, 0, Y_COEFF_R >> 15, 0);
+    __m128i v_y_rc_lo  = _mm_setr_epi16(Y_COEFF_R & y_mask, 0, Y_COEFF_R & y_mask, 0, Y_COEFF_R & y_mask, 0, Y_COEFF_R & y_mask, 0);
+    __m128i v_half     = _mm_setr_epi16(0, gray_half, 0, gray_half, 0, gray_half, 0, gray_half);
+    __m128i v_y_delta  = _mm_set1_epi32(y_delta);
+    __m128i v_zero     = _mm_setzero_si128();
+
+    int32_t w = 0;
+    for (; w <= width - 16; w += 16, src += 48) {
+        __m128i data1 = _mm_loadu_si128((const __m128i *)(src + 0));
+        __m128i data2 = _mm_loadu_si128((const __m128i *)(src + 16));
+        __m128i data3 = _mm_loadu_si128((const __m128i *)(src + 32));
+
+        // b and g of pixels 0-7 and 8-15 as byte pairs, r of the same pixels as 16 bits
+        __m128i v_bgl = _mm_shuffle_epi8(data1, _mm_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, 12, 13, 15, -1, -1, -1, -1, -1));
+        v_bgl         = _mm_or_si128(v_bgl, _mm_shuffle_epi8(data2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 3, 5, 6)));
+        __m128i v_bgh = _mm_shuffle_epi8(data2, _mm_setr_epi8(8, 9, 11, 12, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+        v_bgh         = _mm_or_si128(v_bgh, _mm_shuffle_epi8(data3, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 1, 2, 4, 5, 7, 8, 10, 11, 13, 14)));
+        __m128i v_rl  = _mm_shuffle_epi8(data1, _mm_setr_epi8(2, -1, 5, -1, 8, -1, 11, -1, 14, -1, -1, -1, -1, -1, -1, -1));
+        v_rl          = _mm_or_si128(v_rl, _mm_shuffle_epi8(data2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, 4, -1, 7, -1)));
+        __m128i v_rh  = _mm_shuffle_epi8(data2, _mm_setr_epi8(10, -1, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+        v_rh          = _mm_or_si128(v_rh, _mm_shuffle_epi8(data3, _mm_setr_epi8(-1, -1, -1, -1, 0, -1, 3, -1, 6, -1, 9, -1, 12, -1, 15, -1)));
+
+        // (b, g) and (r, half) pairs of 16 bits, 4 pixels each
+        __m128i v_bg[4] = {_mm_unpacklo_epi8(v_bgl, v_zero), _mm_unpackhi_epi8(v_bgl, v_zero), _mm_unpacklo_epi8(v_bgh, v_zero), _mm_unpackhi_epi8(v_bgh, v_zero)};
+        __m128i v_rc[4] = {_mm_or_si128(_mm_unpacklo_epi8(v_rl, v_zero), v_half), _mm_or_si128(_mm_unpackhi_epi8(v_rl, v_zero), v_half), _mm_or_si128(_mm_unpacklo_epi8(v_rh, v_zero), v_half), _mm_or_si128(_mm_unpackhi_epi8(v_rh, v_zero), v_half)};
+
+        if (doGray) {
+            __m128i v_gray[4];
+            for (int32_t i = 0; i < 4; ++i) {
+                v_gray[i] = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(v_bg[i], v_gray_bg), _mm_madd_epi16(v_rc[i], v_gray_rc)), GRAY_SHIFT);
+            }
+            _mm_storeu_si128((__m128i *)(gray + w), _mm_packus_epi16(_mm_packus_epi32(v_gray[0], v_gray[1]), _mm_packus_epi32(v_gray[2], v_gray[3])));
+        }
+        if (doY) {
+            __m128i v_y[4];
+            for (int32_t i = 0; i < 4; ++i) {
+                __m128i v_hi = _mm_add_epi32(_mm_madd_epi16(v_bg[i], v_y_bg_hi), _mm_madd_epi16(v_rc[i], v_y_rc_hi));
+                __m128i v_lo = _mm_add_epi32(_mm_madd_epi16(v_bg[i], v_y_bg_lo), _mm_madd_epi16(v_rc[i], v_y_rc_lo));
+                v_y[i]       = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(v_hi, 15), v_lo), v_y_delta), Y_SHIFT);
+            }
+            _mm_storeu_si128((__m128i *)(y + w), _mm_packus_epi16(_mm_packus_epi32(v_y[0], v_y[1]), _mm_packus_epi32(v_y[2], v_y[3])));
+        }
+    }
+    for (; w < width; ++w, src += 3) {
+        int32_t blue = src[0], green = src[1], red = src[2];
+        if (doGray) {
+            gray[w] = (coeff_b * blue + coeff_g * green + coeff_r * red + gray_half) >> GRAY_SHIFT;
+        }
+        if (doY) {
+            y[w] = sat_cast_u8((Y_COEFF_R * red + Y_COEFF_G * green + Y_COEFF_B * blue + y_delta) >> Y_SHIFT);
+        }
+    }
+}
+
+static void multi_hist_row_u8(const uint8_t *src, int32_t width, int32_t *hist)
+{
+    int32_t w = 0;
+    for (; w <= width - 4; w += 4) {
+        hist[src[w]]++;
+        hist[256 + src[w + 1]]++;
+        hist[512 + src[w + 2]]++;
+        hist[768 + src[w + 3]]++;
+    }
+    for (; w < width; ++w) {
+        hist[src[w]]++;
+    }
+}
+
+// what a band of one thread works with
+struct MultiBandScratch {
+    void *rows;              // rows of resize_linear_band_u8
+    int32_t *hist;           // the 4 histogram tables of the thread
+    uint8_t *gray;           // one GRAY row, when the histogram is requested without GRAY
+    uint8_t *window;         // converted BGR rows of NV12 input
+    int32_t first;           // first and last row in window, first > last when empty
+    int32_t last;
+    const int32_t *h_offset; // input rows of the resized rows
+};
+
+struct MultiSourceBGR {
+    int32_t height;
+    int32_t width;
+    int32_t inWidthStride;
+    const uint8_t *inData;
+
+    static bool needsWindow()
+    {
+        return false;
+    }
+    // the histogram is counted on the GRAY rows
+    static bool histFromGray()
+    {
+        return true;
+    }
+    void color(const MultiColorOutputs &outputs, int32_t row, MultiBandScratch &scratch) const
+    {
+        const uint8_t *src = inData + (int64_t)row * inWidthStride;
+        uint8_t *gray      = outputs.gray ? outputs.gray + (int64_t)row * outputs.grayWidthStride : outputs.hist ? scratch.gray : NULL;
+        uint8_t *y         = outputs.y ? outputs.y + (int64_t)row * outputs.yWidthStride : NULL;
+        if (gray != NULL && y != NULL) {
+            multi_bgr_row_u8<true, true>(src, width, gray, y);
+        } else if (gray != NULL) {
+            multi_bgr_row_u8<true, false>(src, width, gray, y);
+        } else if (y != NULL) {
+            multi_bgr_row_u8<false, true>(src, width, gray, y);
+        }
+        if (outputs.hist != NULL) {
+            multi_hist_row_u8(gray, width, scratch.hist);
+        }
+    }
+    void resize(const MultiColorOutputs &outputs, const void *tables, int32_t hBegin, int32_t hEnd, MultiBandScratch &scratch) const
+    {
+        resize_linear_band_u8(height, width, inWidthStride, inData, 3, outputs.resizedHeight, outputs.resizedWidth, outputs.resizedWidthStride, outputs.resized + (int64_t)hBegin * outputs.resizedWidthStride, tables, hBegin, hEnd, scratch.rows);
+    }
+};
+
+struct MultiSourceNV12 {
+    int32_t height;
+    int32_t width;
+    int32_t inYStride;
+    const uint8_t *inY;
+    int32_t inUVStride;
+    const uint8_t *inUV;
+
+    static bool needsWindow()
+    {
+        return true;
+    }
+    static bool histFromGray()
+    {
+        return false;
+    }
+    void color(const MultiColorOutputs &outputs, int32_t row, MultiBandScratch &scratch) const
+    {
+        const uint8_t *src = inY + (int64_t)row * inYStride;
+        if (outputs.gray != NULL) {
+            memcpy(outputs.gray + (int64_t)row * outputs.grayWidthStride, src, width);
+        }
+        if (outputs.y != NULL) {
+            memcpy(outputs.y + (int64_t)row * outputs.yWidthStride, src, width);
+        }
+        if (outputs.hist != NULL) {
+            multi_hist_row_u8(src, width, scratch.hist);
+        }
+    }
+    // converts the rows the resized rows read into the window, keeping those it already holds, then resizes
+    // from the window addressed as if it were the whole BGR image
+    void resize(const MultiColorOutputs &outputs, const void *tables, int32_t hBegin, int32_t hEnd, MultiBandScratch &scratch) const
+    {
+        const int32_t windowStride = width * 3;
+        int32_t first              = std::max(scratch.h_offset[hBegin], 0) & ~1;
+        int32_t last               = std::min(scratch.h_offset[hEnd - 1] + 1, height - 1) | 1;
+        int32_t from               = first;
+        if (scratch.first <= scratch.last && first <= scratch.last) {
+            memmove(scratch.window, scratch.window + (int64_t)(first - scratch.first) * windowStride, (int64_t)(scratch.last - first + 1) * windowStride);
+            from = scratch.last + 1;
+        }
+        if (from <= last) {
+            NV122BGR<uint8_t>(last - from + 1, width, inYStride, inY + (int64_t)from * inYStride, inUVStride, inUV + (int64_t)(from / 2) * inUVStride, windowStride, scratch.window + (int64_t)(from - first) * windowStride);
+        }
+        scratch.first = first;
+        scratch.last  = last;
+
+        const uint8_t *base = scratch.window - (int64_t)first * windowStride;
+        resize_linear_band_u8(height, width, windowStride, base, 3, outputs.resizedHeight, outputs.resizedWidth, outputs.resizedWidthStride, outputs.resized + (int64_t)hBegin * outputs.resizedWidthStride, tables, hBegin, hEnd, scratch.rows);
+    }
+};
+
+// the input rows a band converts: from the first row its resized rows read, the first band from row 0
+static inline int32_t multi_band_row(const int32_t *h_offset, int32_t band, int32_t numBands, int32_t inHeight)
+{
+    if (band == 0) {
+        return 0;
+    }
+    if (band == numBands) {
+        return inHeight;
+    }
+    return std::max(h_offset[band * MULTI_BAND_ROWS], 0);
+}
+
+template <typename Source>
+static ::ppl::common::RetCode multi_run(const Source &source, const MultiColorOutputs &outputs)
+{
+    const int32_t height = source.height;
+    const int32_t width  = source.width;
+    const bool doColor   = outputs.gray != NULL || outputs.y != NULL || outputs.hist != NULL;
+    const bool doResize  = outputs.resized != NULL;
+    const int32_t outH   = outputs.resizedHeight;
+    const int32_t outW   = outputs.resizedWidth;
+
+    uint64_t tablesSize = doResize ? multi_align(resize_linear_tables_size_u8(3, outH, outW)) : 0;
+    void *tables        = NULL;
+    const int32_t *h_offset = NULL;
+    if (doResize) {
+        tables = ppl::common::AlignedAlloc(tablesSize, MULTI_SCRATCH_ALIGN);
+        if (tables == NULL) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        resize_linear_tables_u8(height, width, 3, outH, outW, tables);
+        h_offset = resize_linear_h_offset_u8(3, outH, outW, tables);
+    }
+
+    // the most rows a resize step reads, even to odd as NV12 rows are converted in pairs
+    int32_t windowRows = 0;
+    if (doResize && Source::needsWindow()) {
+        for (int32_t h = 0; h < outH; h += MULTI_STEP_ROWS) {
+            int32_t hEnd  = std::min(std::min(h + MULTI_STEP_ROWS, outH), (h / MULTI_BAND_ROWS + 1) * MULTI_BAND_ROWS);
+            int32_t first = std::max(h_offset[h], 0) & ~1;
+            int32_t last  = std::min(h_offset[hEnd - 1] + 1, height - 1) | 1;
+            windowRows    = std::max(windowRows, last - first + 1);
+        }
+    }
+
+    const uint64_t rowsSize    = doResize ? multi_align(resize_linear_rows_size_u8(3, outW)) : 0;
+    const uint64_t histSize    = outputs.hist != NULL ? MULTI_HIST_SIZE : 0;
+    const uint64_t graySize    = Source::histFromGray() && outputs.hist != NULL && outputs.gray == NULL ? multi_align(width) : 0;
+    const uint64_t windowSize  = multi_align((uint64_t)windowRows * width * 3);
+    const uint64_t scratchSize = rowsSize + histSize + graySize + windowSize;
+    const int32_t numThreads   = get_max_threads();
+    uint8_t *scratch           = NULL;
+    if (scratchSize > 0) {
+        scratch = (uint8_t *)ppl::common::AlignedAlloc(scratchSize * numThreads, MULTI_SCRATCH_ALIGN);
+        if (scratch == NULL) {
+            ppl::common::AlignedFree(tables);
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+    }
+    for (int32_t t = 0; histSize > 0 && t < numThreads; ++t) {
+        memset(scratch + scratchSize * t + rowsSize, 0, histSize);
+    }
+
+    const int32_t numBands = doResize ? (outH + MULTI_BAND_ROWS - 1) / MULTI_BAND_ROWS : (height + MULTI_COLOR_ROWS - 1) / MULTI_COLOR_ROWS;
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t b = 0; b < numBands; ++b) {
+        uint8_t *base = scratch + scratchSize * get_thread_num();
+        MultiBandScratch band;
+        band.rows     = base;
+        band.hist     = (int32_t *)(base + rowsSize);
+        band.gray     = base + rowsSize + histSize;
+        band.window   = base + rowsSize + histSize + graySize;
+        band.first    = 0;
+        band.last     = -1;
+        band.h_offset = h_offset;
+        if (!doResize) {
+            for (int32_t row = b * MULTI_COLOR_ROWS; row < std::min((b + 1) * MULTI_COLOR_ROWS, height); ++row) {
+                source.color(outputs, row, band);
+            }
+            continue;
+        }
+        // the resize of a few rows follows the conversion of the input rows they read, while those are cached
+        int32_t row    = multi_band_row(h_offset, b, numBands, height);
+        int32_t rowEnd = multi_band_row(h_offset, b + 1, numBands, height);
+        int32_t hEnd   = std::min((b + 1) * MULTI_BAND_ROWS, outH);
+        for (int32_t h = b * MULTI_BAND_ROWS; h < hEnd; h += MULTI_STEP_ROWS) {
+            int32_t stepEnd = std::min(h + MULTI_STEP_ROWS, hEnd);
+            int32_t needed  = std::min(std::min(h_offset[stepEnd - 1] + 2, height), rowEnd);
+            for (; doColor && row < needed; ++row) {
+                source.color(outputs, row, band);
+            }
+            source.resize(outputs, tables, h, stepEnd, band);
+        }
+        for (; doColor && row < rowEnd; ++row) {
+            source.color(outputs, row, band);
+        }
+    }
+
+    if (outputs.hist != NULL) {
+        memset(outputs.hist, 0, sizeof(int32_t) * 256);
+        for (int32_t t = 0; t < numThreads; ++t) {
+            const int32_t *hist = (const int32_t *)(scratch + scratchSize * t + rowsSize);
+            for (int32_t i = 0; i < 256; ++i) {
+                outputs.hist[i] += hist[i] + hist[256 + i] + hist[512 + i] + hist[768 + i];
+            }
+        }
+    }
+    ppl::common::AlignedFree(scratch);
+    ppl::common::AlignedFree(tables);
+    return ppl::common::RC_SUCCESS;
+}
+
+static bool multi_outputs_valid(int32_t width, const MultiColorOutputs &outputs)
+{
+    if (outputs.gray == NULL && outputs.y == NULL && outputs.resized == NULL && outputs.hist == NULL) {
+        return false;
+    }
+    if ((outputs.gray != NULL && outputs.grayWidthStride < width) ||
+        (outputs.y != NULL && outputs.yWidthStride < width)) {
+        return false;
+    }
+    if (outputs.resized != NULL &&
+        (outputs.resizedHeight <= 0 || outputs.resizedWidth <= 0 || outputs.resizedWidthStride < outputs.resizedWidth * 3)) {
+        return false;
+    }
+    return true;
+}
+
+template <>
+::ppl::common::RetCode BGR2Multi<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    const MultiColorOutputs &outputs)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * 3 || !multi_outputs_valid(width, outputs)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    MultiSourceBGR source = {height, width, inWidthStride, inData};
+    return multi_run(source, outputs);
+}
+
+template <>
+::ppl::common::RetCode NV122Multi<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint8_t *inY,
+    int32_t inUVStride,
+    const uint8_t *inUV,
+    const MultiColorOutputs &outputs)
+{
+    if (nullptr == inY || nullptr == inUV) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || height % 2 != 0 || width % 2 != 0 || inYStride < width || inUVStride < width ||
+        !multi_outputs_valid(width, outputs)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    MultiSourceNV12 source = {height, width, inYStride, inY, inUVStride, inUV};
+    return multi_run(source, outputs);
+}
+
+}
+}
+} // namespace ppl::cv::x86
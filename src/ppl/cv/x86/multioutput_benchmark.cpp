@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/multioutput.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/debug.h"
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// full resolution GRAY and a resized BGR copy of one BGR frame in one pass
+void BM_BGR2Multi_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t outWidth = state.range(2);
+    int32_t outHeight = state.range(3);
+    std::vector<uint8_t> src(height * width * 3), gray(height * width), resized(outHeight * outWidth * 3);
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+    ppl::cv::x86::MultiColorOutputs outputs;
+    outputs.gray = gray.data();
+    outputs.grayWidthStride = width;
+    outputs.resized = resized.data();
+    outputs.resizedHeight = outHeight;
+    outputs.resizedWidth = outWidth;
+    outputs.resizedWidthStride = outWidth * 3;
+    for (auto _ : state) {
+        ppl::cv::x86::BGR2Multi<uint8_t>(height, width, width * 3, src.data(), outputs);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+// the same through BGR2GRAY and ResizeLinear, which read the frame twice
+void BM_BGR2GrayResize_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t outWidth = state.range(2);
+    int32_t outHeight = state.range(3);
+    std::vector<uint8_t> src(height * width * 3), gray(height * width), resized(outHeight * outWidth * 3);
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::BGR2GRAY<uint8_t>(height, width, width * 3, src.data(), width, gray.data());
+        ppl::cv::x86::ResizeLinear<uint8_t, 3>(height, width, width * 3, src.data(), outHeight, outWidth, outWidth * 3, resized.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+// a resized BGR copy and the luma histogram of one NV12 frame, without the full resolution BGR image
+void BM_NV122Multi_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t outWidth = state.range(2);
+    int32_t outHeight = state.range(3);
+    std::vector<uint8_t> src(height * width * 3 / 2), resized(outHeight * outWidth * 3);
+    int32_t hist[256];
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+    ppl::cv::x86::MultiColorOutputs outputs;
+    outputs.resized = resized.data();
+    outputs.resizedHeight = outHeight;
+    outputs.resizedWidth = outWidth;
+    outputs.resizedWidthStride = outWidth * 3;
+    outputs.hist = hist;
+    for (auto _ : state) {
+        ppl::cv::x86::NV122Multi<uint8_t>(height, width, width, src.data(), width, src.data() + height * width, outputs);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+BENCHMARK(BM_BGR2Multi_ppl_x86)->Args({1920, 1080, 640, 384})->Args({1920, 1080, 960, 540})->Args({3840, 2160, 640, 384});
+BENCHMARK(BM_BGR2GrayResize_ppl_x86)->Args({1920, 1080, 640, 384})->Args({1920, 1080, 960, 540})->Args({3840, 2160, 640, 384});
+BENCHMARK(BM_NV122Multi_ppl_x86)->Args({1920, 1080, 640, 384})->Args({3840, 2160, 640, 384});
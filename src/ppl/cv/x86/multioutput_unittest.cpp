@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/multioutput.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/calchist.h"
+#include "ppl/cv/x86/test.h"
+#include <opencv2/imgproc.hpp>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+enum MultiOutputMask {
+    MULTI_GRAY    = 1,
+    MULTI_Y       = 2,
+    MULTI_RESIZED = 4,
+    MULTI_HIST    = 8,
+};
+
+struct MultiOutputBuffers {
+    std::vector<uint8_t> gray, y, resized;
+    int32_t hist[256];
+    ppl::cv::x86::MultiColorOutputs outputs;
+
+    MultiOutputBuffers(int32_t height, int32_t width, int32_t outHeight, int32_t outWidth, int32_t mask)
+        : gray((size_t)height * width)
+        , y((size_t)height * width)
+        , resized((size_t)outHeight * outWidth * 3)
+    {
+        if (mask & MULTI_GRAY) {
+            outputs.gray            = gray.data();
+            outputs.grayWidthStride = width;
+        }
+        if (mask & MULTI_Y) {
+            outputs.y            = y.data();
+            outputs.yWidthStride = width;
+        }
+        if (mask & MULTI_RESIZED) {
+            outputs.resized            = resized.data();
+            outputs.resizedHeight      = outHeight;
+            outputs.resizedWidth       = outWidth;
+            outputs.resizedWidthStride = outWidth * 3;
+        }
+        if (mask & MULTI_HIST) {
+            outputs.hist = hist;
+        }
+    }
+};
+
+// every requested output must be the one of its single-output function
+void BGR2MultiTest(int32_t height, int32_t width, int32_t outHeight, int32_t outWidth, int32_t mask)
+{
+    const int32_t inWidthStride = width * 3 + 5;
+    std::vector<uint8_t> src((size_t)height * inWidthStride);
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+    MultiOutputBuffers dst(height, width, outHeight, outWidth, mask);
+    EXPECT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::BGR2Multi<uint8_t>(height, width, inWidthStride, src.data(), dst.outputs));
+
+    cv::Mat src_opencv(height, width, CV_8UC3, src.data(), inWidthStride);
+    cv::Mat gray_opencv;
+    cv::cvtColor(src_opencv, gray_opencv, cv::COLOR_BGR2GRAY);
+    if (mask & MULTI_GRAY) {
+        checkResult<uint8_t, 1>(gray_opencv.data, dst.gray.data(), height, width, width, width, 0.01f);
+    }
+    if (mask & MULTI_Y) {
+        std::vector<uint8_t> nv12((size_t)height * width * 3 / 2);
+        ppl::cv::x86::BGR2NV12<uint8_t>(height, width, inWidthStride, src.data(), width, nv12.data());
+        checkResult<uint8_t, 1>(nv12.data(), dst.y.data(), height, width, width, width, 0.01f);
+    }
+    if (mask & MULTI_RESIZED) {
+        std::vector<uint8_t> resized(dst.resized.size());
+        ppl::cv::x86::ResizeLinear<uint8_t, 3>(height, width, inWidthStride, src.data(), outHeight, outWidth, outWidth * 3, resized.data());
+        checkResult<uint8_t, 3>(resized.data(), dst.resized.data(), outHeight, outWidth, outWidth * 3, outWidth * 3, 0.01f);
+    }
+    if (mask & MULTI_HIST) {
+        int32_t hist[256];
+        ppl::cv::x86::CalcHist<uint8_t>(height, width, gray_opencv.step, gray_opencv.data, hist);
+        for (int32_t i = 0; i < 256; ++i) {
+            EXPECT_EQ(hist[i], dst.hist[i]);
+        }
+    }
+}
+
+void NV122MultiTest(int32_t height, int32_t width, int32_t outHeight, int32_t outWidth, int32_t mask)
+{
+    std::vector<uint8_t> src((size_t)height * width * 3 / 2);
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+    MultiOutputBuffers dst(height, width, outHeight, outWidth, mask);
+    EXPECT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::NV122Multi<uint8_t>(height, width, width, src.data(), width, src.data() + height * width, dst.outputs));
+
+    if (mask & MULTI_GRAY) {
+        checkResult<uint8_t, 1>(src.data(), dst.gray.data(), height, width, width, width, 0.01f);
+    }
+    if (mask & MULTI_Y) {
+        checkResult<uint8_t, 1>(src.data(), dst.y.data(), height, width, width, width, 0.01f);
+    }
+    if (mask & MULTI_RESIZED) {
+        std::vector<uint8_t> bgr((size_t)height * width * 3), resized(dst.resized.size());
+        ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, src.data(), width * 3, bgr.data());
+        ppl::cv::x86::ResizeLinear<uint8_t, 3>(height, width, width * 3, bgr.data(), outHeight, outWidth, outWidth * 3, resized.data());
+        checkResult<uint8_t, 3>(resized.data(), dst.resized.data(), outHeight, outWidth, outWidth * 3, outWidth * 3, 0.01f);
+    }
+    if (mask & MULTI_HIST) {
+        int32_t hist[256];
+        ppl::cv::x86::CalcHist<uint8_t>(height, width, width, src.data(), hist);
+        for (int32_t i = 0; i < 256; ++i) {
+            EXPECT_EQ(hist[i], dst.hist[i]);
+        }
+    }
+}
+
+TEST(BGR2MULTI, x86)
+{
+    BGR2MultiTest(480, 640, 240, 320, MULTI_GRAY | MULTI_RESIZED);
+    BGR2MultiTest(1080, 1920, 384, 640, MULTI_GRAY | MULTI_Y | MULTI_RESIZED | MULTI_HIST);
+    BGR2MultiTest(360, 480, 359, 479, MULTI_Y | MULTI_RESIZED);
+    BGR2MultiTest(37, 53, 71, 101, MULTI_GRAY | MULTI_RESIZED | MULTI_HIST);
+    BGR2MultiTest(101, 99, 33, 17, MULTI_HIST);
+    BGR2MultiTest(720, 1280, 720, 1280, MULTI_GRAY | MULTI_Y);
+}
+
+TEST(NV122MULTI, x86)
+{
+    NV122MultiTest(480, 640, 240, 320, MULTI_GRAY | MULTI_RESIZED);
+    NV122MultiTest(1080, 1920, 384, 640, MULTI_GRAY | MULTI_Y | MULTI_RESIZED | MULTI_HIST);
+    NV122MultiTest(38, 54, 71, 101, MULTI_RESIZED | MULTI_HIST);
+    NV122MultiTest(360, 480, 359, 479, MULTI_RESIZED);
+}
+
+TEST(MULTI_INVALID, x86)
+{
+    std::vector<uint8_t> src(64 * 64 * 3);
+    ppl::cv::x86::MultiColorOutputs outputs;
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::BGR2Multi<uint8_t>(64, 64, 64 * 3, src.data(), outputs));
+    outputs.resized      = src.data();
+    outputs.resizedWidth = 32;
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::BGR2Multi<uint8_t>(64, 64, 64 * 3, src.data(), outputs));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::NV122Multi<uint8_t>(63, 64, 64, src.data(), 64, src.data(), outputs));
+}
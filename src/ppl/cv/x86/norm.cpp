@@ -16,6 +16,7 @@
 // under the License.
 
 #include "ppl/cv/x86/norm.h"
+#include "reduction.hpp"
 #include "ppl/cv/x86/avx/internal_avx.hpp"
 #include "ppl/cv/x86/fma/internal_fma.hpp"
 #include "ppl/cv/types.h"
@@ -29,66 +30,134 @@
 #include <limits.h>
 #include <immintrin.h>
 #include <cassert>
-#ifdef _WIN32
 #include <algorithm>
-#endif
 namespace ppl {
 namespace cv {
 namespace x86 {
 
-inline float norm_l2(const float &v)
-{
-    return v * v;
-}
+// uchar and int16_t sums are exact in integers, float ones are kept in double lanes and, with a mask, in sum
+struct NormPartial {
+    double lanes[REDUCTION_LANES];
+    double sum;
+    float maximum;
+    uint64_t isum;
+    uint32_t imaximum;
 
-inline float norm_l1(const float &v)
-{
-    return std::abs(v);
-}
+    NormPartial()
+        : sum(0)
+        , maximum(0)
+        , isum(0)
+        , imaximum(0)
+    {
+        for (int i = 0; i < REDUCTION_LANES; ++i) {
+            lanes[i] = 0;
+        }
+    }
+    void merge(const NormPartial &other)
+    {
+        for (int i = 0; i < REDUCTION_LANES; ++i) {
+            lanes[i] += other.lanes[i];
+        }
+        sum += other.sum;
+        maximum = std::max(maximum, other.maximum);
+        isum += other.isum;
+        imaximum = std::max(imaximum, other.imaximum);
+    }
+    double result(ppl::cv::NormTypes norm_type) const
+    {
+        if (norm_type == ppl::cv::NORM_INF) {
+            return std::max(static_cast<double>(maximum), static_cast<double>(imaximum));
+        }
+        double total = 0.0;
+        for (int i = 0; i < REDUCTION_LANES; ++i) {
+            total += lanes[i];
+        }
+        total += sum + static_cast<double>(isum);
+        return norm_type == ppl::cv::NORM_L2 ? std::sqrt(total) : total;
+    }
+};
 
-inline float norm_inf(const float &v, const float &maximum)
+template <ppl::cv::NormTypes norm_type>
+static void norm_row(const uchar *src, const uchar *mask, int inWidth, int nc, NormPartial &partial)
 {
-    return std::max(std::abs(v), maximum);
+    uint64_t sum     = 0;
+    uint32_t maximum = partial.imaximum;
+    for (int j = 0; j < inWidth; ++j) {
+        if (mask != NULL && mask[j] == 0) {
+            continue;
+        }
+        for (int k = 0; k < nc; ++k) {
+            uint32_t value = src[j * nc + k];
+            if (norm_type == ppl::cv::NORM_L1) {
+                sum += value;
+            } else if (norm_type == ppl::cv::NORM_L2) {
+                sum += value * value;
+            } else {
+                maximum = std::max(maximum, value);
+            }
+        }
+    }
+    partial.isum += sum;
+    partial.imaximum = maximum;
 }
 
-template <typename T, int nc, bool use_mask, ppl::cv::NormTypes norm_type>
-double Norm(int inHeight,
-            int inWidth,
-            int inWidthStride,
-            const T *inData,
-            int maskWidthStride,
-            const uchar *mask)
+template <ppl::cv::NormTypes norm_type>
+static void norm_row(const float *src, const uchar *mask, int inWidth, int nc, NormPartial &partial)
 {
-    double result    = 0.0;
-    float result_inf = 0.0;
-    for (int i = 0; i < inHeight; ++i) {
-        for (int j = 0; j < inWidth; ++j) {
-            float mask_value;
-            if (use_mask) {
-                mask_value = static_cast<float>(mask[i * maskWidthStride + j] != 0);
-            }
-            for (int k = 0; k < nc; ++k) {
-                float value = inData[i * inWidthStride + j * nc + k];
-                if (use_mask) {
-                    value *= mask_value;
-                }
-                if (norm_type == ppl::cv::NORM_L1) {
-                    result += norm_l1(value);
-                } else if (norm_type == ppl::cv::NORM_L2) {
-                    result += norm_l2(value);
-                } else if (norm_type == ppl::cv::NORM_INF) {
-                    result_inf = norm_inf(value, result_inf);
-                }
+    if (mask == NULL && norm_type == ppl::cv::NORM_L1) {
+        reduction_abs_sum_f32(src, inWidth * nc, partial.lanes);
+        return;
+    }
+    if (mask == NULL && norm_type == ppl::cv::NORM_L2) {
+        reduction_sqsum_f32(src, inWidth * nc, partial.lanes);
+        return;
+    }
+    for (int j = 0; j < inWidth; ++j) {
+        if (mask != NULL && mask[j] == 0) {
+            continue;
+        }
+        for (int k = 0; k < nc; ++k) {
+            double value = src[j * nc + k];
+            if (norm_type == ppl::cv::NORM_L1) {
+                partial.sum += std::fabs(value);
+            } else if (norm_type == ppl::cv::NORM_L2) {
+                partial.sum += value * value;
+            } else {
+                partial.maximum = std::max(partial.maximum, std::abs(src[j * nc + k]));
             }
         }
     }
-    if (norm_type == ppl::cv::NORM_INF) {
-        return static_cast<double>(result_inf);
-    } else if (norm_type == ppl::cv::NORM_L2) {
-        return std::sqrt(result);
-    } else {
-        return result;
+}
+
+template <typename T, int nc, ppl::cv::NormTypes norm_type>
+struct NormKernel {
+    int inWidth;
+    int inWidthStride;
+    const T *inData;
+    int maskWidthStride;
+    const uchar *mask;
+
+    void operator()(int rowBegin, int rowEnd, NormPartial &partial) const
+    {
+        for (int i = rowBegin; i < rowEnd; ++i) {
+            norm_row<norm_type>(inData + (int64_t)i * inWidthStride, mask == NULL ? NULL : mask + (int64_t)i * maskWidthStride, inWidth, nc, partial);
+        }
     }
+};
+
+template <typename T, int nc, ppl::cv::NormTypes norm_type>
+static double norm_reduce(int inHeight,
+                          int inWidth,
+                          int inWidthStride,
+                          const T *inData,
+                          int maskWidthStride,
+                          const uchar *mask,
+                          ReductionMode mode)
+{
+    NormKernel<T, nc, norm_type> kernel = {inWidth, inWidthStride, inData, maskWidthStride, mask};
+    NormPartial partial;
+    parallel_reduce(inHeight, inWidth * nc, mode, kernel, partial);
+    return partial.result(norm_type);
 }
 
 template <typename T, int numChannels>
@@ -98,7 +167,8 @@ double Norm(int inHeight,
             const T *inData,
             ppl::cv::NormTypes norm_type,
             int maskWidthStride,
-            const uchar *mask)
+            const uchar *mask,
+            ReductionMode mode)
 {
     assert(inHeight != 0 && inWidth != 0 && inWidthStride != 0);
     assert(norm_type == ppl::cv::NORM_L1 || norm_type == ppl::cv::NORM_L2 || norm_type == ppl::cv::NORM_INF);
@@ -106,38 +176,151 @@ double Norm(int inHeight,
         assert(maskWidthStride != 0);
     }
     if (norm_type == ppl::cv::NORM_L1) {
-        if (mask == NULL) {
-            return Norm<T, numChannels, false, ppl::cv::NORM_L1>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, nullptr);
-        } else {
-            return Norm<T, numChannels, true, ppl::cv::NORM_L1>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, mask);
-        }
+        return norm_reduce<T, numChannels, ppl::cv::NORM_L1>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, mask, mode);
     } else if (norm_type == ppl::cv::NORM_L2) {
-        if (mask == NULL) {
-            return Norm<T, numChannels, false, ppl::cv::NORM_L2>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, nullptr);
-        } else {
-            return Norm<T, numChannels, true, ppl::cv::NORM_L2>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, mask);
-        }
+        return norm_reduce<T, numChannels, ppl::cv::NORM_L2>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, mask, mode);
     } else if (norm_type == ppl::cv::NORM_INF) {
-        if (mask == NULL) {
-            return Norm<T, numChannels, false, ppl::cv::NORM_INF>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, nullptr);
-        } else {
-            return Norm<T, numChannels, true, ppl::cv::NORM_INF>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, mask);
-        }
+        return norm_reduce<T, numChannels, ppl::cv::NORM_INF>(inHeight, inWidth, inWidthStride, inData, maskWidthStride, mask, mode);
     }
     return 0.0;
 }
 
-template double Norm<uchar, 1>(int inHeight, int inWidth, int inWidthStride, const uchar *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask);
+// int16_t sums are exact in integers: |x| and x * x are accumulated in 32-bit lanes over blocks short
+// enough not to overflow, then in 64 bits
+static void norm_s16_rows(int rowBegin,
+                          int rowEnd,
+                          int inWidth,
+                          int nc,
+                          int inWidthStride,
+                          const int16_t *inData,
+                          ppl::cv::NormTypes norm_type,
+                          int maskWidthStride,
+                          const uchar *mask,
+                          NormPartial &partial)
+{
+    const int blockLength = 1 << 14;
+    const __m128i vzero   = _mm_setzero_si128();
+    uint64_t sum          = 0;
+    uint32_t maximum      = 0;
+    __m128i vmax          = vzero;
+    for (int i = rowBegin; i < rowEnd; ++i) {
+        const int16_t *src = inData + i * inWidthStride;
+        const uchar *m     = mask == NULL ? NULL : mask + i * maskWidthStride;
+        const int len      = inWidth * nc;
+        int j              = 0;
+        // one mask byte per element
+        if (m == NULL || nc == 1) {
+            for (int begin = 0; begin <= len - 8; begin += blockLength) {
+                const int end = std::min(begin + blockLength, len - len % 8);
+                __m128i vsum  = vzero;
+                for (j = begin; j < end; j += 8) {
+                    __m128i v = _mm_loadu_si128((const __m128i *)(src + j));
+                    if (m != NULL) {
+                        __m128i vm = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(m + j)));
+                        v          = _mm_andnot_si128(_mm_cmpeq_epi16(vm, vzero), v);
+                    }
+                    // |-32768| is 0x8000, right as unsigned
+                    __m128i va = _mm_abs_epi16(v);
+                    if (norm_type == ppl::cv::NORM_L1) {
+                        vsum = _mm_add_epi32(vsum, _mm_add_epi32(_mm_unpacklo_epi16(va, vzero), _mm_unpackhi_epi16(va, vzero)));
+                    } else if (norm_type == ppl::cv::NORM_L2) {
+                        // a pair of squares is at most 2^31, unsigned in 32 bits
+                        __m128i vsq = _mm_madd_epi16(v, v);
+                        vsum        = _mm_add_epi64(vsum, _mm_add_epi64(_mm_unpacklo_epi32(vsq, vzero), _mm_unpackhi_epi32(vsq, vzero)));
+                    } else {
+                        vmax = _mm_max_epu16(vmax, va);
+                    }
+                }
+                uint64_t lanes[2];
+                if (norm_type == ppl::cv::NORM_L1) {
+                    vsum = _mm_add_epi64(_mm_unpacklo_epi32(vsum, vzero), _mm_unpackhi_epi32(vsum, vzero));
+                }
+                _mm_storeu_si128((__m128i *)lanes, vsum);
+                sum += lanes[0] + lanes[1];
+            }
+            j = len - len % 8;
+        }
+        for (; j < len; ++j) {
+            if (m != NULL && m[j / nc] == 0) {
+                continue;
+            }
+            const int32_t v = src[j];
+            sum += norm_type == ppl::cv::NORM_L1 ? (uint64_t)std::abs(v) : (uint64_t)(v * v);
+            maximum = std::max(maximum, (uint32_t)std::abs(v));
+        }
+    }
+    uint16_t lanes[8];
+    _mm_storeu_si128((__m128i *)lanes, vmax);
+    for (int k = 0; k < 8; ++k) {
+        maximum = std::max(maximum, (uint32_t)lanes[k]);
+    }
+    partial.isum += sum;
+    partial.imaximum = std::max(partial.imaximum, maximum);
+}
+
+struct NormS16Kernel {
+    int inWidth;
+    int nc;
+    int inWidthStride;
+    const int16_t *inData;
+    ppl::cv::NormTypes norm_type;
+    int maskWidthStride;
+    const uchar *mask;
+
+    void operator()(int rowBegin, int rowEnd, NormPartial &partial) const
+    {
+        norm_s16_rows(rowBegin, rowEnd, inWidth, nc, inWidthStride, inData, norm_type, maskWidthStride, mask, partial);
+    }
+};
+
+static double norm_s16(int inHeight,
+                       int inWidth,
+                       int nc,
+                       int inWidthStride,
+                       const int16_t *inData,
+                       ppl::cv::NormTypes norm_type,
+                       int maskWidthStride,
+                       const uchar *mask,
+                       ReductionMode mode)
+{
+    NormS16Kernel kernel = {inWidth, nc, inWidthStride, inData, norm_type, maskWidthStride, mask};
+    NormPartial partial;
+    parallel_reduce(inHeight, inWidth * nc, mode, kernel, partial);
+    return partial.result(norm_type);
+}
+
+template <>
+double Norm<int16_t, 1>(int inHeight, int inWidth, int inWidthStride, const int16_t *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode)
+{
+    assert(inHeight != 0 && inWidth != 0 && inWidthStride != 0);
+    return norm_s16(inHeight, inWidth, 1, inWidthStride, inData, norm_type, maskWidthStride, mask, mode);
+}
+
+template <>
+double Norm<int16_t, 3>(int inHeight, int inWidth, int inWidthStride, const int16_t *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode)
+{
+    assert(inHeight != 0 && inWidth != 0 && inWidthStride != 0);
+    return norm_s16(inHeight, inWidth, 3, inWidthStride, inData, norm_type, maskWidthStride, mask, mode);
+}
+
+template <>
+double Norm<int16_t, 4>(int inHeight, int inWidth, int inWidthStride, const int16_t *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode)
+{
+    assert(inHeight != 0 && inWidth != 0 && inWidthStride != 0);
+    return norm_s16(inHeight, inWidth, 4, inWidthStride, inData, norm_type, maskWidthStride, mask, mode);
+}
+
+template double Norm<uchar, 1>(int inHeight, int inWidth, int inWidthStride, const uchar *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode);
 
-template double Norm<uchar, 3>(int inHeight, int inWidth, int inWidthStride, const uchar *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask);
+template double Norm<uchar, 3>(int inHeight, int inWidth, int inWidthStride, const uchar *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode);
 
-template double Norm<uchar, 4>(int inHeight, int inWidth, int inWidthStride, const uchar *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask);
+template double Norm<uchar, 4>(int inHeight, int inWidth, int inWidthStride, const uchar *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode);
 
-template double Norm<float, 1>(int inHeight, int inWidth, int inWidthStride, const float *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask);
+template double Norm<float, 1>(int inHeight, int inWidth, int inWidthStride, const float *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode);
 
-template double Norm<float, 3>(int inHeight, int inWidth, int inWidthStride, const float *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask);
+template double Norm<float, 3>(int inHeight, int inWidth, int inWidthStride, const float *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode);
 
-template double Norm<float, 4>(int inHeight, int inWidth, int inWidthStride, const float *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask);
+template double Norm<float, 4>(int inHeight, int inWidth, int inWidthStride, const float *inData, ppl::cv::NormTypes norm_type, int maskWidthStride, const uchar *mask, ReductionMode mode);
 
 }
 }
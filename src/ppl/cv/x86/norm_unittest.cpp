@@ -24,11 +24,11 @@
 #include "ppl/cv/debug.h"
 
 template <typename T, int nc, bool use_mask, ppl::cv::NormTypes norm_type>
-void NormTest(int height, int width)
+void NormTest(int height, int width, T minValue = 0, T maxValue = 255)
 {
     std::unique_ptr<T[]> src(new T[width * height * nc]);
     cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
-    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, minValue, maxValue);
 
     std::unique_ptr<uchar[]> mask(new uchar[width * height]);
     for (int i = 0; i < height * width; ++i) {
@@ -122,3 +122,28 @@ TEST(NORM_INF, x86)
     NormTest<uchar, 3, true, ppl::cv::NORM_INF>(64, 72);
     NormTest<uchar, 4, true, ppl::cv::NORM_INF>(64, 72);
 }
+
+// the sums of int16_t are exact, so they match over the whole range
+TEST(NORM_INT16, x86)
+{
+    NormTest<int16_t, 1, false, ppl::cv::NORM_L1>(64, 72, -32768, 32767);
+    NormTest<int16_t, 3, false, ppl::cv::NORM_L1>(64, 72, -32768, 32767);
+    NormTest<int16_t, 4, false, ppl::cv::NORM_L1>(64, 72, -32768, 32767);
+    NormTest<int16_t, 1, true, ppl::cv::NORM_L1>(64, 72, -32768, 32767);
+    NormTest<int16_t, 3, true, ppl::cv::NORM_L1>(64, 72, -32768, 32767);
+    NormTest<int16_t, 4, true, ppl::cv::NORM_L1>(64, 72, -32768, 32767);
+
+    NormTest<int16_t, 1, false, ppl::cv::NORM_L2>(64, 72, -32768, 32767);
+    NormTest<int16_t, 3, false, ppl::cv::NORM_L2>(64, 72, -32768, 32767);
+    NormTest<int16_t, 4, false, ppl::cv::NORM_L2>(64, 72, -32768, 32767);
+    NormTest<int16_t, 1, true, ppl::cv::NORM_L2>(64, 72, -32768, 32767);
+    NormTest<int16_t, 3, true, ppl::cv::NORM_L2>(64, 72, -32768, 32767);
+    NormTest<int16_t, 4, true, ppl::cv::NORM_L2>(64, 72, -32768, 32767);
+
+    NormTest<int16_t, 1, false, ppl::cv::NORM_INF>(64, 72, -32768, 32767);
+    NormTest<int16_t, 3, false, ppl::cv::NORM_INF>(64, 72, -32768, 32767);
+    NormTest<int16_t, 4, false, ppl::cv::NORM_INF>(64, 72, -32768, 32767);
+    NormTest<int16_t, 1, true, ppl::cv::NORM_INF>(64, 72, -32768, 32767);
+    NormTest<int16_t, 3, true, ppl::cv::NORM_INF>(64, 72, -32768, 32767);
+    NormTest<int16_t, 4, true, ppl::cv::NORM_INF>(64, 72, -32768, 32767);
+}
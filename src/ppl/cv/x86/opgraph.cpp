@@ -0,0 +1,675 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/opgraph.h"
+#include "ppl/cv/x86/opgraph.hpp"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/boxfilter.h"
+#include "ppl/cv/x86/warpaffine.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/sobel.h"
+#include "ppl/cv/x86/convertto.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define OPGRAPH_SCRATCH_ALIGN 64
+// scratch bytes per thread Execute() aims at when it picks the tile size, the operations add some
+// temporary memory of their own
+#define OPGRAPH_L2_BUDGET (256 * 1024)
+
+OpGraph::OpGraph(int32_t height, int32_t width, int32_t channels, OpDataType type)
+    : height_(height)
+    , width_(width)
+    , channels_(channels)
+    , type_(type)
+{
+}
+
+OpNode OpGraph::NextNode(OpType type) const
+{
+    OpNode node;
+    memset(&node, 0, sizeof(node));
+    node.type        = type;
+    node.inHeight    = OutputHeight();
+    node.inWidth     = OutputWidth();
+    node.inChannels  = OutputChannels();
+    node.inType      = OutputDataType();
+    node.outHeight   = node.inHeight;
+    node.outWidth    = node.inWidth;
+    node.outChannels = node.inChannels;
+    node.outType     = node.inType;
+    node.scale       = 1.0;
+    node.border      = BORDER_TYPE_DEFAULT;
+    return node;
+}
+
+static bool validGraphInput(int32_t height, int32_t width, int32_t channels, OpDataType type)
+{
+    if (height <= 0 || width <= 0 || (channels != 1 && channels != 3 && channels != 4)) {
+        return false;
+    }
+    return type == OP_DATA_UINT8 || type == OP_DATA_FLOAT32;
+}
+
+// the image operations of ppl.cv are implemented for uint8_t and float
+static inline bool imageType(OpDataType type)
+{
+    return type == OP_DATA_UINT8 || type == OP_DATA_FLOAT32;
+}
+
+::ppl::common::RetCode OpGraph::AddGaussianBlur(int32_t kernelSize, float sigma, BorderType border)
+{
+    if (!validGraphInput(height_, width_, channels_, type_) || !imageType(OutputDataType()) || kernelSize <= 0 ||
+        kernelSize % 2 == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node     = NextNode(OP_GAUSSIAN_BLUR);
+    node.kernelSize = kernelSize;
+    node.sigma      = sigma;
+    node.border     = border;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddBoxFilter(int32_t kernelSize, BorderType border)
+{
+    if (!validGraphInput(height_, width_, channels_, type_) || !imageType(OutputDataType()) || kernelSize <= 0 ||
+        kernelSize % 2 == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node     = NextNode(OP_BOX_FILTER);
+    node.kernelSize = kernelSize;
+    node.border     = border;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddResizeLinear(int32_t outHeight, int32_t outWidth)
+{
+    if (!validGraphInput(height_, width_, channels_, type_) || !imageType(OutputDataType()) || outHeight <= 0 ||
+        outWidth <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node    = NextNode(OP_RESIZE_LINEAR);
+    node.outHeight = outHeight;
+    node.outWidth  = outWidth;
+    // the pixel centers are aligned: x_in = (x_out + 0.5) * scale - 0.5
+    const double sx = (double)node.inWidth / outWidth, sy = (double)node.inHeight / outHeight;
+    node.affine[0]   = sx;
+    node.affine[1]   = 0.0;
+    node.affine[2]   = 0.5 * sx - 0.5;
+    node.affine[3]   = 0.0;
+    node.affine[4]   = sy;
+    node.affine[5]   = 0.5 * sy - 0.5;
+    node.border      = BORDER_TYPE_REPLICATE;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddWarpAffineLinear(
+    int32_t outHeight,
+    int32_t outWidth,
+    const double *affineMatrix,
+    BorderType border,
+    float borderValue)
+{
+    if (!validGraphInput(height_, width_, channels_, type_) || !imageType(OutputDataType()) || outHeight <= 0 ||
+        outWidth <= 0 || affineMatrix == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border != BORDER_TYPE_CONSTANT && border != BORDER_TYPE_REPLICATE) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node    = NextNode(OP_WARP_AFFINE_LINEAR);
+    node.outHeight = outHeight;
+    node.outWidth  = outWidth;
+    memcpy(node.affine, affineMatrix, sizeof(node.affine));
+    node.border      = border;
+    node.borderValue = borderValue;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddBGR2GRAY()
+{
+    if (!validGraphInput(height_, width_, channels_, type_) || !imageType(OutputDataType()) || OutputChannels() != 3) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node      = NextNode(OP_BGR2GRAY);
+    node.outChannels = 1;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddGRAY2BGR()
+{
+    if (!validGraphInput(height_, width_, channels_, type_) || !imageType(OutputDataType()) || OutputChannels() != 1) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node      = NextNode(OP_GRAY2BGR);
+    node.outChannels = 3;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddSobel(int32_t dx, int32_t dy, int32_t ksize, double scale, double delta, BorderType border)
+{
+    if (!validGraphInput(height_, width_, channels_, type_) || !imageType(OutputDataType())) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border != BORDER_TYPE_DEFAULT && border != BORDER_TYPE_REFLECT_101) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ksize == -1) {
+        if (dx + dy != 1 || dx < 0 || dy < 0) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    } else if ((ksize != 1 && ksize != 3 && ksize != 5 && ksize != 7) || dx < 0 || dy < 0 || dx + dy <= 0 ||
+               dx >= std::max(ksize, 3) || dy >= std::max(ksize, 3)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node     = NextNode(OP_SOBEL);
+    node.outType    = node.inType == OP_DATA_UINT8 ? OP_DATA_INT16 : OP_DATA_FLOAT32;
+    node.kernelSize = ksize;
+    node.dx         = dx;
+    node.dy         = dy;
+    node.scale      = scale;
+    node.delta      = delta;
+    node.border     = BORDER_TYPE_REFLECT_101;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddThreshold(float threshold, float maxValue)
+{
+    if (!validGraphInput(height_, width_, channels_, type_)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node    = NextNode(OP_THRESHOLD);
+    node.threshold = threshold;
+    node.maxValue  = maxValue;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddNV122BGR()
+{
+    if (!validGraphInput(height_, width_, channels_, type_) || !nodes_.empty() || type_ != OP_DATA_UINT8 ||
+        channels_ != 1 || height_ % 2 != 0 || width_ % 2 != 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node      = NextNode(OP_NV122BGR);
+    node.outChannels = 3;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::AddConvertTo(OpDataType type, float scale)
+{
+    // int16_t images, the gradients of Sobel, convert to both image types
+    const OpDataType inType = OutputDataType();
+    if (!validGraphInput(height_, width_, channels_, type_) || (!imageType(inType) && inType != OP_DATA_INT16) ||
+        !imageType(type) || type == inType) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    OpNode node  = NextNode(OP_CONVERT_TO);
+    node.outType = type;
+    node.scale   = scale;
+    nodes_.push_back(node);
+    return ppl::common::RC_SUCCESS;
+}
+
+static inline int32_t clampCoord(int64_t v, int32_t len)
+{
+    return (int32_t)std::min<int64_t>(std::max<int64_t>(v, 0), len - 1);
+}
+
+// half size of the window a neighbourhood operation reads around each pixel
+static inline int32_t nodeRadius(const OpNode &node)
+{
+    if (node.type == OP_GAUSSIAN_BLUR || node.type == OP_BOX_FILTER) {
+        return node.kernelSize / 2;
+    }
+    if (node.type == OP_SOBEL) {
+        return std::max(node.kernelSize, 3) / 2;
+    }
+    return 0;
+}
+
+static inline bool isWarp(const OpNode &node)
+{
+    return node.type == OP_RESIZE_LINEAR || node.type == OP_WARP_AFFINE_LINEAR;
+}
+
+// a downscale maps an output rectangle whose ends fall on input pixels to exactly that input rectangle:
+// ResizeLinear of one to the other samples the same coordinates as the whole resize and never reads
+// outside of it, so the tile is resized directly instead of being warped
+static bool exactResizeRect(const OpNode &node, const OpRect &out, OpRect *in)
+{
+    if (node.type != OP_RESIZE_LINEAR || node.inWidth < node.outWidth || node.inHeight < node.outHeight) {
+        return false;
+    }
+    const int64_t x0 = (int64_t)out.x * node.inWidth, x1 = (int64_t)(out.x + out.width) * node.inWidth;
+    const int64_t y0 = (int64_t)out.y * node.inHeight, y1 = (int64_t)(out.y + out.height) * node.inHeight;
+    if (x0 % node.outWidth != 0 || x1 % node.outWidth != 0 || y0 % node.outHeight != 0 || y1 % node.outHeight != 0) {
+        return false;
+    }
+    in->x      = (int32_t)(x0 / node.outWidth);
+    in->y      = (int32_t)(y0 / node.outHeight);
+    in->width  = (int32_t)(x1 / node.outWidth) - in->x;
+    in->height = (int32_t)(y1 / node.outHeight) - in->y;
+    return true;
+}
+
+// the ends of the rectangles are clamped to the image, not intersected with it: for a warp which reads
+// outside of the image the clamped rectangle still holds the replicated border pixels
+void opgraph_tile_rects(const OpGraph &graph, const OpRect &out, OpRect *rects)
+{
+    const std::vector<OpNode> &nodes = graph.Nodes();
+    const int32_t n                  = (int32_t)nodes.size();
+    rects[n]                         = out;
+    for (int32_t i = n - 1; i >= 0; --i) {
+        const OpNode &node = nodes[i];
+        const OpRect &dst  = rects[i + 1];
+        int64_t x0, y0, x1, y1;
+        if (exactResizeRect(node, dst, &rects[i])) {
+            continue;
+        }
+        if (isWarp(node)) {
+            // an affine map reaches its extremes at the corners, the linear interpolation reads one more
+            // pixel and another one covers the rounding of the coordinates
+            const double *M = node.affine;
+            double cx[2]    = {(double)dst.x, (double)(dst.x + dst.width - 1)};
+            double cy[2]    = {(double)dst.y, (double)(dst.y + dst.height - 1)};
+            double minx = 1e300, maxx = -1e300, miny = 1e300, maxy = -1e300;
+            for (int32_t a = 0; a < 2; ++a) {
+                for (int32_t b = 0; b < 2; ++b) {
+                    double sx = M[0] * cx[a] + M[1] * cy[b] + M[2];
+                    double sy = M[3] * cx[a] + M[4] * cy[b] + M[5];
+                    minx      = std::min(minx, sx);
+                    maxx      = std::max(maxx, sx);
+                    miny      = std::min(miny, sy);
+                    maxy      = std::max(maxy, sy);
+                }
+            }
+            const double limit = 1e9;
+            x0                 = (int64_t)std::floor(std::max(minx, -limit)) - 1;
+            y0                 = (int64_t)std::floor(std::max(miny, -limit)) - 1;
+            x1                 = (int64_t)std::floor(std::min(maxx, limit)) + 2;
+            y1                 = (int64_t)std::floor(std::min(maxy, limit)) + 2;
+        } else {
+            const int32_t r = nodeRadius(node);
+            x0              = dst.x - r;
+            y0              = dst.y - r;
+            x1              = dst.x + dst.width - 1 + r;
+            y1              = dst.y + dst.height - 1 + r;
+            if (node.type == OP_NV122BGR) {
+                // whole 2x2 blocks share their chroma
+                x0 &= ~(int64_t)1;
+                y0 &= ~(int64_t)1;
+                x1 |= 1;
+                y1 |= 1;
+            }
+        }
+        OpRect &src = rects[i];
+        src.x       = clampCoord(x0, node.inWidth);
+        src.y       = clampCoord(y0, node.inHeight);
+        src.width   = clampCoord(x1, node.inWidth) - src.x + 1;
+        src.height  = clampCoord(y1, node.inHeight) - src.y + 1;
+    }
+}
+
+static inline size_t alignScratch(size_t size)
+{
+    return (size + OPGRAPH_SCRATCH_ALIGN - 1) / OPGRAPH_SCRATCH_ALIGN * OPGRAPH_SCRATCH_ALIGN;
+}
+
+// neighbourhood operations and NV122BGR, whose input is aligned to 2x2 blocks, produce their whole input
+// rectangle, the other ones the needed one
+static inline OpRect nodeOutputRect(const OpNode &node, const OpRect &in, const OpRect &out)
+{
+    return (nodeRadius(node) > 0 || node.type == OP_NV122BGR) ? in : out;
+}
+
+static inline bool sameRect(const OpRect &a, const OpRect &b)
+{
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+// buffer planning of a tile: the image of node i lives in slot i % 2 until node i + 1 has read it, so the
+// two slots hold every intermediate image. The last node writes into the output directly when it
+// produces exactly the output rectangle
+static void tileSlotSizes(const OpGraph &graph, const OpRect *rects, size_t *slots)
+{
+    const std::vector<OpNode> &nodes = graph.Nodes();
+    const int32_t n                  = (int32_t)nodes.size();
+    slots[0]                         = 0;
+    slots[1]                         = 0;
+    for (int32_t i = 0; i < n; ++i) {
+        OpRect r = nodeOutputRect(nodes[i], rects[i], rects[i + 1]);
+        if (i == n - 1 && sameRect(r, rects[n])) {
+            break;
+        }
+        size_t size  = (size_t)r.width * r.height * nodes[i].outChannels * opgraph_element_size(nodes[i].outType);
+        slots[i & 1] = std::max(slots[i & 1], alignScratch(size));
+    }
+}
+
+size_t opgraph_tile_scratch_size(const OpGraph &graph, const OpRect *rects)
+{
+    size_t slots[2];
+    tileSlotSizes(graph, rects, slots);
+    return slots[0] + slots[1];
+}
+
+// the comparison is done in float, which holds every uint8_t and int16_t value exactly
+template <typename T>
+static void thresholdBinary(int32_t height, int32_t width, int32_t inWidthStride, const T *inData, float threshold,
+                            T maxValue, int32_t outWidthStride, T *outData)
+{
+    for (int32_t y = 0; y < height; ++y) {
+        const T *src = inData + y * inWidthStride;
+        T *dst       = outData + y * outWidthStride;
+        for (int32_t x = 0; x < width; ++x) {
+            dst[x] = (float)src[x] > threshold ? maxValue : (T)0;
+        }
+    }
+}
+
+template <int32_t nc>
+static ::ppl::common::RetCode runNodeChannels(const OpNode &node, const OpRect &in, const OpRect &out, int32_t inWidthStride,
+                                              const void *inData, int32_t outWidthStride, void *outData)
+{
+    const bool fp = node.inType == OP_DATA_FLOAT32;
+    switch (node.type) {
+        case OP_GAUSSIAN_BLUR:
+            if (fp) {
+                return GaussianBlur<float, nc>(in.height, in.width, inWidthStride, (const float *)inData, node.kernelSize, node.sigma, outWidthStride, (float *)outData, node.border);
+            }
+            return GaussianBlur<uint8_t, nc>(in.height, in.width, inWidthStride, (const uint8_t *)inData, node.kernelSize, node.sigma, outWidthStride, (uint8_t *)outData, node.border);
+        case OP_BOX_FILTER:
+            if (fp) {
+                return BoxFilter<float, nc>(in.height, in.width, inWidthStride, (const float *)inData, node.kernelSize, node.kernelSize, true, outWidthStride, (float *)outData, node.border);
+            }
+            return BoxFilter<uint8_t, nc>(in.height, in.width, inWidthStride, (const uint8_t *)inData, node.kernelSize, node.kernelSize, true, outWidthStride, (uint8_t *)outData, node.border);
+        case OP_RESIZE_LINEAR:
+        case OP_WARP_AFFINE_LINEAR: {
+            OpRect exact;
+            if (exactResizeRect(node, out, &exact) && sameRect(exact, in)) {
+                if (fp) {
+                    return ResizeLinear<float, nc>(in.height, in.width, inWidthStride, (const float *)inData, out.height, out.width, outWidthStride, (float *)outData);
+                }
+                return ResizeLinear<uint8_t, nc>(in.height, in.width, inWidthStride, (const uint8_t *)inData, out.height, out.width, outWidthStride, (uint8_t *)outData);
+            }
+            // the matrix of the tile maps its output pixels to its input pixels
+            double M[6];
+            memcpy(M, node.affine, sizeof(M));
+            M[2] += M[0] * out.x + M[1] * out.y - in.x;
+            M[5] += M[3] * out.x + M[4] * out.y - in.y;
+            if (fp) {
+                return WarpAffineLinear<float, nc>(in.height, in.width, inWidthStride, (const float *)inData, out.height, out.width, outWidthStride, (float *)outData, M, node.border, node.borderValue);
+            }
+            return WarpAffineLinear<uint8_t, nc>(in.height, in.width, inWidthStride, (const uint8_t *)inData, out.height, out.width, outWidthStride, (uint8_t *)outData, M, node.border, (uint8_t)node.borderValue);
+        }
+        case OP_SOBEL:
+            if (fp) {
+                return Sobel<float, float, nc>(in.height, in.width, inWidthStride, (const float *)inData, outWidthStride, (float *)outData, node.dx, node.dy, node.kernelSize, node.scale, node.delta, node.border);
+            }
+            return Sobel<uint8_t, int16_t, nc>(in.height, in.width, inWidthStride, (const uint8_t *)inData, outWidthStride, (int16_t *)outData, node.dx, node.dy, node.kernelSize, node.scale, node.delta, node.border);
+        case OP_CONVERT_TO:
+            if (node.inType == OP_DATA_INT16) {
+                if (node.outType == OP_DATA_FLOAT32) {
+                    return ConvertTo<int16_t, nc, float>(in.height, in.width, inWidthStride, (const int16_t *)inData, (float)node.scale, outWidthStride, (float *)outData);
+                }
+                return ConvertTo<int16_t, nc, uint8_t>(in.height, in.width, inWidthStride, (const int16_t *)inData, (float)node.scale, outWidthStride, (uint8_t *)outData);
+            }
+            if (fp) {
+                return ConvertTo<float, nc, uint8_t>(in.height, in.width, inWidthStride, (const float *)inData, (float)node.scale, outWidthStride, (uint8_t *)outData);
+            }
+            return ConvertTo<uint8_t, nc, float>(in.height, in.width, inWidthStride, (const uint8_t *)inData, (float)node.scale, outWidthStride, (float *)outData);
+        default:
+            break;
+    }
+    return ppl::common::RC_INVALID_VALUE;
+}
+
+static ::ppl::common::RetCode runNode(const OpNode &node, const OpRect &in, const OpRect &out, int32_t inWidthStride,
+                                      const void *inData, const void *inUVData, int32_t outWidthStride, void *outData)
+{
+    const bool fp = node.inType == OP_DATA_FLOAT32;
+    switch (node.type) {
+        case OP_BGR2GRAY:
+            if (fp) {
+                return BGR2GRAY<float>(in.height, in.width, inWidthStride, (const float *)inData, outWidthStride, (float *)outData);
+            }
+            return BGR2GRAY<uint8_t>(in.height, in.width, inWidthStride, (const uint8_t *)inData, outWidthStride, (uint8_t *)outData);
+        case OP_GRAY2BGR:
+            if (fp) {
+                return GRAY2BGR<float>(in.height, in.width, inWidthStride, (const float *)inData, outWidthStride, (float *)outData);
+            }
+            return GRAY2BGR<uint8_t>(in.height, in.width, inWidthStride, (const uint8_t *)inData, outWidthStride, (uint8_t *)outData);
+        case OP_NV122BGR:
+            return NV122BGR<uint8_t>(in.height, in.width, inWidthStride, (const uint8_t *)inData, inWidthStride, (const uint8_t *)inUVData, outWidthStride, (uint8_t *)outData);
+        case OP_THRESHOLD: {
+            const int32_t width = in.width * node.inChannels;
+            if (fp) {
+                thresholdBinary<float>(in.height, width, inWidthStride, (const float *)inData, node.threshold, node.maxValue, outWidthStride, (float *)outData);
+            } else if (node.inType == OP_DATA_INT16) {
+                const int16_t value = (int16_t)std::min(std::max(std::lrint(node.maxValue), -32768L), 32767L);
+                thresholdBinary<int16_t>(in.height, width, inWidthStride, (const int16_t *)inData, node.threshold, value, outWidthStride, (int16_t *)outData);
+            } else {
+                const uint8_t value = (uint8_t)std::min(std::max(std::lrint(node.maxValue), 0L), 255L);
+                thresholdBinary<uint8_t>(in.height, width, inWidthStride, (const uint8_t *)inData, node.threshold, value, outWidthStride, (uint8_t *)outData);
+            }
+            return ppl::common::RC_SUCCESS;
+        }
+        default:
+            break;
+    }
+    switch (node.inChannels) {
+        case 1:
+            return runNodeChannels<1>(node, in, out, inWidthStride, inData, outWidthStride, outData);
+        case 3:
+            return runNodeChannels<3>(node, in, out, inWidthStride, inData, outWidthStride, outData);
+        case 4:
+            return runNodeChannels<4>(node, in, out, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_INVALID_VALUE;
+}
+
+::ppl::common::RetCode opgraph_run_tile(
+    const OpGraph &graph,
+    const OpRect *rects,
+    int32_t inWidthStride,
+    const void *inData,
+    const void *inUVData,
+    int32_t outWidthStride,
+    void *outData,
+    void *scratch)
+{
+    const std::vector<OpNode> &nodes = graph.Nodes();
+    const int32_t n                  = (int32_t)nodes.size();
+    size_t slots[2];
+    tileSlotSizes(graph, rects, slots);
+    uint8_t *buffers[2] = {(uint8_t *)scratch, (uint8_t *)scratch + slots[0]};
+
+    // the current image holds the region `have` of the input of the next node
+    const uint8_t *cur = (const uint8_t *)inData;
+    int32_t stride     = inWidthStride;
+    OpRect have        = rects[0];
+    int32_t nc         = graph.InputChannels();
+    size_t elemSize    = opgraph_element_size(graph.InputDataType());
+    for (int32_t i = 0; i < n; ++i) {
+        const OpNode &node = nodes[i];
+        const OpRect &need = rects[i];
+        const uint8_t *src = cur + ((size_t)(need.y - have.y) * stride + (need.x - have.x) * nc) * elemSize;
+        OpRect produced    = nodeOutputRect(node, need, rects[i + 1]);
+        uint8_t *dst       = buffers[i & 1];
+        int32_t dstStride  = produced.width * node.outChannels;
+        if (i == n - 1 && sameRect(produced, rects[n])) {
+            dst       = (uint8_t *)outData;
+            dstStride = outWidthStride;
+        }
+        ::ppl::common::RetCode rc = runNode(node, need, produced, stride, src, inUVData, dstStride, dst);
+        if (rc != ppl::common::RC_SUCCESS) {
+            return rc;
+        }
+        if (dst == outData) {
+            return ppl::common::RC_SUCCESS;
+        }
+        cur      = dst;
+        stride   = dstStride;
+        have     = produced;
+        nc       = node.outChannels;
+        elemSize = opgraph_element_size(node.outType);
+    }
+
+    const OpRect &out  = rects[n];
+    const uint8_t *src = cur + ((size_t)(out.y - have.y) * stride + (out.x - have.x) * nc) * elemSize;
+    for (int32_t y = 0; y < out.height; ++y) {
+        memcpy((uint8_t *)outData + (size_t)y * outWidthStride * elemSize, src + (size_t)y * stride * elemSize, out.width * nc * elemSize);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+static inline OpRect outputTile(const OpGraph &graph, int32_t tileSize, int32_t tx, int32_t ty)
+{
+    OpRect out;
+    out.x      = tx * tileSize;
+    out.y      = ty * tileSize;
+    out.width  = std::min(tileSize, graph.OutputWidth() - out.x);
+    out.height = std::min(tileSize, graph.OutputHeight() - out.y);
+    return out;
+}
+
+// the largest power-of-two tile whose intermediate images fit in the budget, measured on a tile in the
+// middle of the output where the halos are not clipped
+static int32_t l2TileSize(const OpGraph &graph)
+{
+    std::vector<OpRect> rects(graph.Nodes().size() + 1);
+    int32_t tileSize = 512;
+    for (; tileSize > 32; tileSize /= 2) {
+        OpRect out;
+        out.width  = std::min(tileSize, graph.OutputWidth());
+        out.height = std::min(tileSize, graph.OutputHeight());
+        out.x      = (graph.OutputWidth() - out.width) / 2;
+        out.y      = (graph.OutputHeight() - out.height) / 2;
+        opgraph_tile_rects(graph, out, &rects[0]);
+        if (opgraph_tile_scratch_size(graph, &rects[0]) <= OPGRAPH_L2_BUDGET) {
+            break;
+        }
+    }
+    return tileSize;
+}
+
+::ppl::common::RetCode opgraph_run_tiles(
+    const OpGraph &graph,
+    const std::vector<OpRect> &tiles,
+    int32_t inWidthStride,
+    const void *inData,
+    int32_t outWidthStride,
+    void *outData)
+{
+    const std::vector<OpNode> &nodes = graph.Nodes();
+    const int32_t n                  = (int32_t)nodes.size();
+    const int32_t numTiles           = (int32_t)tiles.size();
+    std::vector<OpRect> rects((size_t)numTiles * (n + 1));
+    size_t scratchSize = OPGRAPH_SCRATCH_ALIGN;
+    for (int32_t t = 0; t < numTiles; ++t) {
+        OpRect *tileRects = &rects[(size_t)t * (n + 1)];
+        opgraph_tile_rects(graph, tiles[t], tileRects);
+        scratchSize = std::max(scratchSize, opgraph_tile_scratch_size(graph, tileRects));
+    }
+
+    // one scratch area per thread, reused by all of its tiles so that it stays in its cache
+    const int32_t numThreads = get_max_threads();
+    uint8_t *scratch         = (uint8_t *)ppl::common::AlignedAlloc(scratchSize * numThreads, OPGRAPH_SCRATCH_ALIGN);
+    if (scratch == NULL) {
+        return ppl::common::RC_OUT_OF_MEMORY;
+    }
+    const bool nv12       = n > 0 && nodes[0].type == OP_NV122BGR;
+    const int32_t inChan  = graph.InputChannels();
+    const size_t inElem   = opgraph_element_size(graph.InputDataType());
+    const size_t outElem  = opgraph_element_size(graph.OutputDataType());
+    const int32_t outChan = graph.OutputChannels();
+    std::vector<int32_t> results(numTiles, ppl::common::RC_SUCCESS);
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t t = 0; t < numTiles; ++t) {
+        const OpRect *tileRects = &rects[(size_t)t * (n + 1)];
+        const OpRect &in        = tileRects[0];
+        const OpRect &out       = tileRects[n];
+        const uint8_t *src      = (const uint8_t *)inData + ((size_t)in.y * inWidthStride + in.x * inChan) * inElem;
+        const uint8_t *srcUV    = NULL;
+        if (nv12) {
+            srcUV = (const uint8_t *)inData + (size_t)(graph.InputHeight() + in.y / 2) * inWidthStride + in.x;
+        }
+        uint8_t *dst = (uint8_t *)outData + ((size_t)out.y * outWidthStride + out.x * outChan) * outElem;
+        results[t]   = opgraph_run_tile(graph, tileRects, inWidthStride, src, srcUV, outWidthStride, dst,
+                                        scratch + scratchSize * get_thread_num());
+    }
+    ppl::common::AlignedFree(scratch);
+
+    for (int32_t t = 0; t < numTiles; ++t) {
+        if (results[t] != ppl::common::RC_SUCCESS) {
+            return (::ppl::common::RetCode)results[t];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode OpGraph::Execute(
+    int32_t inWidthStride,
+    const void *inData,
+    int32_t outWidthStride,
+    void *outData,
+    int32_t tileSize) const
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (!validGraphInput(height_, width_, channels_, type_) || inWidthStride < width_ * channels_ ||
+        outWidthStride < OutputWidth() * OutputChannels() || tileSize < 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (tileSize == 0) {
+        tileSize = l2TileSize(*this);
+    }
+
+    const int32_t tilesX = (OutputWidth() + tileSize - 1) / tileSize;
+    const int32_t tilesY = (OutputHeight() + tileSize - 1) / tileSize;
+    std::vector<OpRect> tiles((size_t)tilesX * tilesY);
+    for (int32_t t = 0; t < tilesX * tilesY; ++t) {
+        tiles[t] = outputTile(*this, tileSize, t % tilesX, t / tilesX);
+    }
+    return opgraph_run_tiles(*this, tiles, inWidthStride, inData, outWidthStride, outData);
+}
+
+}
+}
+} // namespace ppl::cv::x86
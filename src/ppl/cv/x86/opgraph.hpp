@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_OPGRAPH_HPP_
+#define __ST_HPC_PPL_CV_X86_OPGRAPH_HPP_
+#include "ppl/cv/x86/opgraph.h"
+#include <stddef.h>
+#include <vector>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+static inline size_t opgraph_element_size(OpDataType type)
+{
+    return type == OP_DATA_FLOAT32 ? sizeof(float) : (type == OP_DATA_INT16 ? sizeof(int16_t) : sizeof(uint8_t));
+}
+
+// tile execution of an OpGraph, shared by the executors. For one output rectangle rects[n] (n nodes),
+// rects[i] is the part of the input of node i which is needed, rects[0] is the part of the graph input
+void opgraph_tile_rects(const OpGraph& graph, const OpRect& out, OpRect* rects);
+
+// bytes of scratch memory opgraph_run_tile needs for these rectangles
+size_t opgraph_tile_scratch_size(const OpGraph& graph, const OpRect* rects);
+
+// computes the output rectangle rects[n] from the input rectangle rects[0], inData and outData point to
+// the top-left pixels of the rectangles and the strides are in elements. inUVData points to the UV pixel
+// of the top-left pixel of rects[0] when the graph starts with NV122BGR, the UV stride is inWidthStride
+::ppl::common::RetCode opgraph_run_tile(
+    const OpGraph& graph,
+    const OpRect* rects,
+    int32_t inWidthStride,
+    const void* inData,
+    const void* inUVData,
+    int32_t outWidthStride,
+    void* outData,
+    void* scratch);
+
+// runs the graph on every output rectangle of tiles in parallel, inData and outData are whole images with
+// strides in elements. The rectangles must not overlap
+::ppl::common::RetCode opgraph_run_tiles(
+    const OpGraph& graph,
+    const std::vector<OpRect>& tiles,
+    int32_t inWidthStride,
+    const void* inData,
+    int32_t outWidthStride,
+    void* outData);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_OPGRAPH_HPP_
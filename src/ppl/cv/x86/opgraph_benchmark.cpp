@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/opgraph.h"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/sobel.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/convertto.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// the chains are run fused by the graph and op by op with full intermediate frames for comparison
+void BM_OpGraphEdge_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3]);
+    std::unique_ptr<int16_t[]> dst(new int16_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3, 0, 255);
+    ppl::cv::x86::OpGraph graph(height, width, 3, ppl::cv::x86::OP_DATA_UINT8);
+    graph.AddGaussianBlur(5, 1.5f);
+    graph.AddBGR2GRAY();
+    graph.AddSobel(1, 0, 3);
+    graph.AddThreshold(40.f, 255.f);
+    for (auto _ : state) {
+        graph.Execute(width * 3, src.get(), width, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_OpGraphEdgeUnfused_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> blurred(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> gray(new uint8_t[width * height]);
+    std::unique_ptr<int16_t[]> grad(new int16_t[width * height]);
+    std::unique_ptr<int16_t[]> dst(new int16_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::GaussianBlur<uint8_t, 3>(height, width, width * 3, src.get(), 5, 1.5f, width * 3, blurred.get());
+        ppl::cv::x86::BGR2GRAY<uint8_t>(height, width, width * 3, blurred.get(), width, gray.get());
+        ppl::cv::x86::Sobel<uint8_t, int16_t, 1>(height, width, width, gray.get(), width, grad.get(), 1, 0, 3, 1.0, 0.0);
+        for (int32_t i = 0; i < width * height; ++i) {
+            dst[i] = grad[i] > 40 ? 255 : 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_OpGraphNV12_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3 / 2]);
+    std::unique_ptr<float[]> dst(new float[width / 2 * height / 2 * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3 / 2, 0, 255);
+    ppl::cv::x86::OpGraph graph(height, width, 1, ppl::cv::x86::OP_DATA_UINT8);
+    graph.AddNV122BGR();
+    graph.AddResizeLinear(height / 2, width / 2);
+    graph.AddConvertTo(ppl::cv::x86::OP_DATA_FLOAT32, 1.f / 255);
+    for (auto _ : state) {
+        graph.Execute(width, src.get(), width / 2 * 3, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_OpGraphNV12Unfused_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3 / 2]);
+    std::unique_ptr<uint8_t[]> bgr(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> resized(new uint8_t[width / 2 * height / 2 * 3]);
+    std::unique_ptr<float[]> dst(new float[width / 2 * height / 2 * 3]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3 / 2, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, src.get(), width * 3, bgr.get());
+        ppl::cv::x86::ResizeLinear<uint8_t, 3>(height, width, width * 3, bgr.get(), height / 2, width / 2, width / 2 * 3, resized.get());
+        ppl::cv::x86::ConvertTo<uint8_t, 3, float>(height / 2, width / 2, width / 2 * 3, resized.get(), 1.f / 255, width / 2 * 3, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+BENCHMARK(BM_OpGraphEdge_ppl_x86)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK(BM_OpGraphEdgeUnfused_ppl_x86)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK(BM_OpGraphNV12_ppl_x86)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK(BM_OpGraphNV12Unfused_ppl_x86)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
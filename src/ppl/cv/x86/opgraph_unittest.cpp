@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/opgraph.h"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/boxfilter.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/warpaffine.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/sobel.h"
+#include "ppl/cv/x86/convertto.h"
+#include "ppl/cv/x86/test.h"
+#include <vector>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+template <typename T>
+static void ThresholdReference(const std::vector<T>& src, float threshold, T maxValue, std::vector<T>& dst)
+{
+    dst.resize(src.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        dst[i] = (float)src[i] > threshold ? maxValue : (T)0;
+    }
+}
+
+// GaussianBlur -> BGR2GRAY -> Sobel -> Threshold, every operation is computed on the whole image by the
+// reference, so the fused graph must match it exactly
+void OpGraphEdgeTest(int32_t height, int32_t width, int32_t tileSize)
+{
+    std::vector<uint8_t> src((size_t)height * width * 3);
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+
+    ppl::cv::x86::OpGraph graph(height, width, 3, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddGaussianBlur(5, 1.5f));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddBGR2GRAY());
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddSobel(1, 0, 3));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddThreshold(40.f, 255.f));
+    ASSERT_EQ(ppl::cv::x86::OP_DATA_INT16, graph.OutputDataType());
+    ASSERT_EQ(1, graph.OutputChannels());
+    std::vector<int16_t> dst((size_t)height * width);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.Execute(width * 3, src.data(), width, dst.data(), tileSize));
+
+    std::vector<uint8_t> blurred(src.size()), gray((size_t)height * width);
+    std::vector<int16_t> grad((size_t)height * width), expected;
+    ppl::cv::x86::GaussianBlur<uint8_t, 3>(height, width, width * 3, src.data(), 5, 1.5f, width * 3, blurred.data());
+    ppl::cv::x86::BGR2GRAY<uint8_t>(height, width, width * 3, blurred.data(), width, gray.data());
+    ppl::cv::x86::Sobel<uint8_t, int16_t, 1>(height, width, width, gray.data(), width, grad.data(), 1, 0, 3, 1.0, 0.0);
+    ThresholdReference<int16_t>(grad, 40.f, 255, expected);
+    checkResult<int16_t, 1>(expected.data(), dst.data(), height, width, width, width, 0.01f);
+}
+
+// float GaussianBlur -> Sobel -> Threshold
+void OpGraphEdgeFloatTest(int32_t height, int32_t width, int32_t tileSize)
+{
+    std::vector<float> src((size_t)height * width);
+    ppl::cv::debug::randomFill<float>(src.data(), src.size(), 0, 255);
+
+    ppl::cv::x86::OpGraph graph(height, width, 1, ppl::cv::x86::OP_DATA_FLOAT32);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddGaussianBlur(3, 1.f));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddSobel(0, 1, 5, 0.5, 3.0));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddThreshold(20.f, 1.f));
+    std::vector<float> dst((size_t)height * width);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.Execute(width, src.data(), width, dst.data(), tileSize));
+
+    std::vector<float> blurred(src.size()), grad(src.size()), expected;
+    ppl::cv::x86::GaussianBlur<float, 1>(height, width, width, src.data(), 3, 1.f, width, blurred.data());
+    ppl::cv::x86::Sobel<float, float, 1>(height, width, width, blurred.data(), width, grad.data(), 0, 1, 5, 0.5, 3.0);
+    ThresholdReference<float>(grad, 20.f, 1.f, expected);
+    checkResult<float, 1>(expected.data(), dst.data(), height, width, width, width, 1e-4f);
+}
+
+// Sobel -> ConvertTo, the int16_t gradients are converted by the node exactly as ConvertTo converts them
+template <int32_t nc, typename Tdst>
+void OpGraphSobelConvertToTest(int32_t height, int32_t width, int32_t dx, int32_t dy, int32_t ksize, float scale, int32_t tileSize)
+{
+    std::vector<uint8_t> src((size_t)height * width * nc);
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+    const ppl::cv::x86::OpDataType outType =
+        sizeof(Tdst) == 1 ? ppl::cv::x86::OP_DATA_UINT8 : ppl::cv::x86::OP_DATA_FLOAT32;
+
+    ppl::cv::x86::OpGraph graph(height, width, nc, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddSobel(dx, dy, ksize));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddConvertTo(outType, scale));
+    ASSERT_EQ(outType, graph.OutputDataType());
+    std::vector<Tdst> dst((size_t)height * width * nc);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.Execute(width * nc, src.data(), width * nc, dst.data(), tileSize));
+
+    std::vector<int16_t> grad(src.size());
+    std::vector<Tdst> expected(dst.size());
+    ppl::cv::x86::Sobel<uint8_t, int16_t, nc>(height, width, width * nc, src.data(), width * nc, grad.data(), dx, dy, ksize, 1.0, 0.0);
+    ppl::cv::x86::ConvertTo<int16_t, nc, Tdst>(height, width, width * nc, grad.data(), scale, width * nc, expected.data());
+    checkResult<Tdst, nc>(expected.data(), dst.data(), height, width, width * nc, width * nc, 1e-4f);
+}
+
+// NV122BGR -> ResizeLinear -> ConvertTo, the resize runs as an affine warp and can differ by 1 before scaling
+void OpGraphNV12Test(int32_t height, int32_t width, int32_t outHeight, int32_t outWidth, int32_t tileSize)
+{
+    std::vector<uint8_t> src((size_t)height * width * 3 / 2);
+    ppl::cv::debug::randomFill<uint8_t>(src.data(), src.size(), 0, 255);
+
+    ppl::cv::x86::OpGraph graph(height, width, 1, ppl::cv::x86::OP_DATA_UINT8);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddNV122BGR());
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddResizeLinear(outHeight, outWidth));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddConvertTo(ppl::cv::x86::OP_DATA_FLOAT32, 1.f / 255));
+    std::vector<float> dst((size_t)outHeight * outWidth * 3);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.Execute(width, src.data(), outWidth * 3, dst.data(), tileSize));
+
+    std::vector<uint8_t> bgr((size_t)height * width * 3), resized(dst.size());
+    std::vector<float> expected(dst.size());
+    ppl::cv::x86::NV122BGR<uint8_t>(height, width, width, src.data(), width * 3, bgr.data());
+    ppl::cv::x86::ResizeLinear<uint8_t, 3>(height, width, width * 3, bgr.data(), outHeight, outWidth, outWidth * 3, resized.data());
+    ppl::cv::x86::ConvertTo<uint8_t, 3, float>(outHeight, outWidth, outWidth * 3, resized.data(), 1.f / 255, outWidth * 3, expected.data());
+    checkResult<float, 3>(expected.data(), dst.data(), outHeight, outWidth, outWidth * 3, outWidth * 3, 1.01f / 255);
+}
+
+// BoxFilter -> WarpAffineLinear -> ConvertTo back to uint8_t, with padded strides
+void OpGraphWarpTest(int32_t height, int32_t width, int32_t tileSize)
+{
+    const int32_t inStride = width * 4 + 12, outStride = width * 4 + 8;
+    std::vector<float> src((size_t)height * inStride);
+    ppl::cv::debug::randomFill<float>(src.data(), src.size(), 0, 1);
+    const double M[6] = {0.9, 0.2, -10.0, -0.15, 1.1, 20.0};
+
+    ppl::cv::x86::OpGraph graph(height, width, 4, ppl::cv::x86::OP_DATA_FLOAT32);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddBoxFilter(7, ppl::cv::BORDER_TYPE_REPLICATE));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddWarpAffineLinear(height, width, M, ppl::cv::BORDER_TYPE_REPLICATE));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddConvertTo(ppl::cv::x86::OP_DATA_UINT8, 255.f));
+    std::vector<uint8_t> dst((size_t)height * outStride);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.Execute(inStride, src.data(), outStride, dst.data(), tileSize));
+
+    std::vector<float> boxed((size_t)height * width * 4), warped(boxed.size());
+    std::vector<uint8_t> expected(boxed.size());
+    ppl::cv::x86::BoxFilter<float, 4>(height, width, inStride, src.data(), 7, 7, true, width * 4, boxed.data(), ppl::cv::BORDER_TYPE_REPLICATE);
+    ppl::cv::x86::WarpAffineLinear<float, 4>(height, width, width * 4, boxed.data(), height, width, width * 4, warped.data(), M, ppl::cv::BORDER_TYPE_REPLICATE);
+    ppl::cv::x86::ConvertTo<float, 4, uint8_t>(height, width, width * 4, warped.data(), 255.f, width * 4, expected.data());
+    checkResult<uint8_t, 4>(expected.data(), dst.data(), height, width, width * 4, outStride, 1.01f);
+}
+
+TEST(OpGraph_Edge, x86)
+{
+    OpGraphEdgeTest(480, 640, 0);
+    OpGraphEdgeTest(720, 1280, 64);
+    OpGraphEdgeTest(37, 53, 16);
+    OpGraphEdgeFloatTest(480, 640, 0);
+    OpGraphEdgeFloatTest(361, 499, 100);
+}
+
+TEST(OpGraph_SobelConvertTo, x86)
+{
+    OpGraphSobelConvertToTest<1, float>(480, 640, 1, 0, 3, 1.f / 255, 0);
+    OpGraphSobelConvertToTest<3, float>(361, 499, 1, 1, 5, 0.25f, 100);
+    OpGraphSobelConvertToTest<1, uint8_t>(480, 640, 0, 1, 3, 0.5f, 64);
+    OpGraphSobelConvertToTest<4, uint8_t>(37, 53, 1, 0, -1, 1.f, 16);
+}
+
+TEST(OpGraph_NV12, x86)
+{
+    OpGraphNV12Test(480, 640, 240, 320, 0);
+    OpGraphNV12Test(1080, 1920, 540, 960, 128);
+    OpGraphNV12Test(360, 482, 500, 700, 64);
+}
+
+TEST(OpGraph_Warp, x86)
+{
+    OpGraphWarpTest(480, 640, 0);
+    OpGraphWarpTest(301, 405, 50);
+}
+
+TEST(OpGraph_InvalidParams, x86)
+{
+    ppl::cv::x86::OpGraph graph(64, 64, 3, ppl::cv::x86::OP_DATA_UINT8);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddNV122BGR());
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddSobel(0, 0, 3));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddSobel(1, 0, 3, 1.0, 0.0, ppl::cv::BORDER_TYPE_REPLICATE));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddConvertTo(ppl::cv::x86::OP_DATA_UINT8));
+    EXPECT_EQ(ppl::common::RC_SUCCESS, graph.AddSobel(1, 1, 5));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddGaussianBlur(3, 1.f));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddConvertTo(ppl::cv::x86::OP_DATA_INT16));
+    EXPECT_EQ(ppl::common::RC_SUCCESS, graph.AddConvertTo(ppl::cv::x86::OP_DATA_FLOAT32));
+    EXPECT_EQ(ppl::common::RC_SUCCESS, graph.AddThreshold(0.f, 1.f));
+
+    ppl::cv::x86::OpGraph nv12(63, 64, 1, ppl::cv::x86::OP_DATA_UINT8);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, nv12.AddNV122BGR());
+    std::vector<uint8_t> data(64 * 64 * 3);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.Execute(64 * 3, data.data(), 10, data.data()));
+}
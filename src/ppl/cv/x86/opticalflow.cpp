@@ -0,0 +1,907 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/opticalflow.h"
+#include "ppl/cv/x86/pyrdown.h"
+#include "ppl/cv/x86/sobel.h"
+#include "ppl/cv/x86/integral.h"
+#include "ppl/cv/x86/remap.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/copymakeborder.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <float.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// patch rows searched by one task, fixed so that the propagation does not depend on the number of threads
+#define DIS_STRIPE_ROWS  4
+#define DIS_EPSILON      0.001f
+#define DIS_SOR_OMEGA    1.6f
+#define DIS_SOR_SWEEPS   5
+
+struct DISLevel {
+    int32_t height;
+    int32_t width;
+    int32_t stride0;
+    int32_t stride1;
+    const uint8_t *I0;
+    const uint8_t *I1;
+    std::vector<uint8_t> storage;
+    // the next image with a replicated border of one patch size, so that patches may move partially
+    // out of the image like in OpenCV
+    int32_t strideP;
+    const uint8_t *I1P;
+    std::vector<uint8_t> padded;
+};
+
+static inline __m128 load4_u8(const uint8_t *p)
+{
+    int32_t v;
+    memcpy(&v, p, sizeof(v));
+    return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(v)));
+}
+
+static inline float hsum_ps(__m128 v)
+{
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+}
+
+// derivatives of an 8-bit image with the 3x3 Sobel operator, scaled to intensity per pixel
+static void computeGradients(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int16_t *buffer,
+    float *gx,
+    float *gy)
+{
+    for (int32_t k = 0; k < 2; ++k) {
+        float *dst = k == 0 ? gx : gy;
+        Sobel<uint8_t, int16_t, 1>(height, width, inWidthStride, inData, width, buffer, 1 - k, k, 3, 1.0, 0.0, BORDER_TYPE_REFLECT_101);
+        const __m128 scale = _mm_set1_ps(0.125f);
+        int32_t i          = 0;
+        for (; i <= height * width - 8; i += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(buffer + i));
+            _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(v)), scale));
+            _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(v, 8))), scale));
+        }
+        for (; i < height * width; ++i) {
+            dst[i] = buffer[i] * 0.125f;
+        }
+    }
+}
+
+struct DISPatchGrid {
+    int32_t numX;
+    int32_t numY;
+    int32_t size;
+    int32_t stride;
+    // the last patch of a row or column is moved back so that it ends at the image border
+    inline int32_t posX(int32_t i, int32_t width) const { return std::min(i * stride, width - size); }
+    inline int32_t posY(int32_t j, int32_t height) const { return std::min(j * stride, height - size); }
+};
+
+// per patch sums of the template gradients and the inverse of the Gauss-Newton Hessian
+struct DISPatchData {
+    float sumX;
+    float sumY;
+    float invXX;
+    float invXY;
+    float invYY;
+    float mean0;
+    bool flat;
+};
+
+static void precomputePatches(
+    const DISLevel &level,
+    const DISPatchGrid &grid,
+    const float *I0x,
+    const float *I0y,
+    const int32_t *integral0,
+    bool meanNormalization,
+    DISPatchData *patches)
+{
+    const int32_t width = level.width, height = level.height, ps = grid.size;
+    const float area    = (float)(ps * ps);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t j = 0; j < grid.numY; ++j) {
+        const int32_t y0 = grid.posY(j, height);
+        // column sums of Ix, Iy, Ix * Ix, Ix * Iy, Iy * Iy over the rows of this patch row
+        std::vector<float> cols(5 * width, 0.f);
+        float *cx = &cols[0], *cy = cx + width, *cxx = cy + width, *cxy = cxx + width, *cyy = cxy + width;
+        for (int32_t r = 0; r < ps; ++r) {
+            const float *gx = I0x + (y0 + r) * width;
+            const float *gy = I0y + (y0 + r) * width;
+            int32_t x       = 0;
+            for (; x <= width - 4; x += 4) {
+                __m128 vx = _mm_loadu_ps(gx + x), vy = _mm_loadu_ps(gy + x);
+                _mm_storeu_ps(cx + x, _mm_add_ps(_mm_loadu_ps(cx + x), vx));
+                _mm_storeu_ps(cy + x, _mm_add_ps(_mm_loadu_ps(cy + x), vy));
+                _mm_storeu_ps(cxx + x, _mm_add_ps(_mm_loadu_ps(cxx + x), _mm_mul_ps(vx, vx)));
+                _mm_storeu_ps(cxy + x, _mm_add_ps(_mm_loadu_ps(cxy + x), _mm_mul_ps(vx, vy)));
+                _mm_storeu_ps(cyy + x, _mm_add_ps(_mm_loadu_ps(cyy + x), _mm_mul_ps(vy, vy)));
+            }
+            for (; x < width; ++x) {
+                cx[x] += gx[x];
+                cy[x] += gy[x];
+                cxx[x] += gx[x] * gx[x];
+                cxy[x] += gx[x] * gy[x];
+                cyy[x] += gy[x] * gy[x];
+            }
+        }
+        for (int32_t i = 0; i < grid.numX; ++i) {
+            const int32_t x0 = grid.posX(i, width);
+            float sx = 0.f, sy = 0.f, sxx = 0.f, sxy = 0.f, syy = 0.f;
+            for (int32_t k = x0; k < x0 + ps; ++k) {
+                sx += cx[k];
+                sy += cy[k];
+                sxx += cxx[k];
+                sxy += cxy[k];
+                syy += cyy[k];
+            }
+            DISPatchData &p = patches[j * grid.numX + i];
+            const int32_t *top    = integral0 + y0 * (width + 1);
+            const int32_t *bottom = integral0 + (y0 + ps) * (width + 1);
+            // differences of the integral image are exact even if it wrapped around
+            uint32_t sum0 = (uint32_t)bottom[x0 + ps] - (uint32_t)bottom[x0] - (uint32_t)top[x0 + ps] + (uint32_t)top[x0];
+            p.mean0       = sum0 / area;
+            p.sumX        = sx;
+            p.sumY        = sy;
+            if (meanNormalization) {
+                sxx -= sx * sx / area;
+                sxy -= sx * sy / area;
+                syy -= sy * sy / area;
+            }
+            float det = sxx * syy - sxy * sxy;
+            p.flat    = det <= 1e-6f * area * area;
+            if (!p.flat) {
+                p.invXX = syy / det;
+                p.invXY = -sxy / det;
+                p.invYY = sxx / det;
+            }
+        }
+    }
+}
+
+struct DISResidual {
+    float ssd;
+    float bx;
+    float by;
+};
+
+// SSD between the template patch at (x0, y0) and the next image sampled at (x0 + u, y0 + v),
+// plus the steepest descent vector sum((I1(W(x)) - I0(x)) * grad I0(x))
+static inline DISResidual patchResidual(
+    const DISLevel &level,
+    const float *I0x,
+    const float *I0y,
+    int32_t ps,
+    int32_t x0,
+    int32_t y0,
+    float u,
+    float v,
+    const DISPatchData &patch,
+    bool meanNormalization)
+{
+    const int32_t width = level.width;
+    float fx            = std::min(std::max(x0 + u, (float)(1 - ps)), (float)(width - 1));
+    float fy            = std::min(std::max(y0 + v, (float)(1 - ps)), (float)(level.height - 1));
+    int32_t ix          = (int32_t)std::floor(fx);
+    int32_t iy          = (int32_t)std::floor(fy);
+    float ax = fx - ix, ay = fy - iy;
+    const __m128 w00 = _mm_set1_ps((1.f - ax) * (1.f - ay));
+    const __m128 w01 = _mm_set1_ps(ax * (1.f - ay));
+    const __m128 w10 = _mm_set1_ps((1.f - ax) * ay);
+    const __m128 w11 = _mm_set1_ps(ax * ay);
+
+    __m128 vsd = _mm_setzero_ps(), vsdd = _mm_setzero_ps(), vsx = _mm_setzero_ps(), vsy = _mm_setzero_ps();
+    for (int32_t r = 0; r < ps; ++r) {
+        const uint8_t *p0 = level.I1P + (iy + r) * level.strideP + ix;
+        const uint8_t *p1 = p0 + level.strideP;
+        const uint8_t *q  = level.I0 + (y0 + r) * level.stride0 + x0;
+        const float *gx   = I0x + (y0 + r) * width + x0;
+        const float *gy   = I0y + (y0 + r) * width + x0;
+        for (int32_t k = 0; k < ps; k += 4) {
+            __m128 warped = _mm_add_ps(_mm_add_ps(_mm_mul_ps(load4_u8(p0 + k), w00), _mm_mul_ps(load4_u8(p0 + k + 1), w01)),
+                                       _mm_add_ps(_mm_mul_ps(load4_u8(p1 + k), w10), _mm_mul_ps(load4_u8(p1 + k + 1), w11)));
+            __m128 diff   = _mm_sub_ps(warped, load4_u8(q + k));
+            vsd           = _mm_add_ps(vsd, diff);
+            vsdd          = _mm_add_ps(vsdd, _mm_mul_ps(diff, diff));
+            vsx           = _mm_add_ps(vsx, _mm_mul_ps(diff, _mm_loadu_ps(gx + k)));
+            vsy           = _mm_add_ps(vsy, _mm_mul_ps(diff, _mm_loadu_ps(gy + k)));
+        }
+    }
+    DISResidual res;
+    float sd = hsum_ps(vsd);
+    res.ssd  = hsum_ps(vsdd);
+    res.bx   = hsum_ps(vsx);
+    res.by   = hsum_ps(vsy);
+    if (meanNormalization) {
+        float mean = sd / (ps * ps);
+        res.ssd -= sd * mean;
+        res.bx -= mean * patch.sumX;
+        res.by -= mean * patch.sumY;
+    }
+    return res;
+}
+
+// inverse compositional Gauss-Newton search of one patch, starting from the best of the candidates
+static void searchPatch(
+    const DISLevel &level,
+    const DISPatchGrid &grid,
+    const float *I0x,
+    const float *I0y,
+    const DISPatchData &patch,
+    int32_t i,
+    int32_t j,
+    const float *candU,
+    const float *candV,
+    int32_t numCandidates,
+    int32_t iterations,
+    bool meanNormalization,
+    float &u,
+    float &v)
+{
+    const int32_t x0 = grid.posX(i, level.width);
+    const int32_t y0 = grid.posY(j, level.height);
+
+    float bestSSD = FLT_MAX;
+    for (int32_t c = 0; c < numCandidates; ++c) {
+        float ssd = patchResidual(level, I0x, I0y, grid.size, x0, y0, candU[c], candV[c], patch, meanNormalization).ssd;
+        if (ssd < bestSSD) {
+            bestSSD = ssd;
+            u       = candU[c];
+            v       = candV[c];
+        }
+    }
+    if (patch.flat) {
+        return;
+    }
+
+    const float u0 = u, v0 = v;
+    float cu = u, cv = v;
+    for (int32_t it = 0; it < iterations; ++it) {
+        DISResidual res = patchResidual(level, I0x, I0y, grid.size, x0, y0, cu, cv, patch, meanNormalization);
+        if (it > 0 && res.ssd < bestSSD) {
+            bestSSD = res.ssd;
+            u       = cu;
+            v       = cv;
+        }
+        float du = patch.invXX * res.bx + patch.invXY * res.by;
+        float dv = patch.invXY * res.bx + patch.invYY * res.by;
+        cu -= du;
+        cv -= dv;
+        if (std::fabs(du) + std::fabs(dv) < 0.01f) {
+            break;
+        }
+    }
+    if (patchResidual(level, I0x, I0y, grid.size, x0, y0, cu, cv, patch, meanNormalization).ssd < bestSSD) {
+        u = cu;
+        v = cv;
+    }
+    // a patch which slid further than its own size has most likely lost its match
+    if ((u - u0) * (u - u0) + (v - v0) * (v - v0) > (float)(grid.size * grid.size)) {
+        u = u0;
+        v = v0;
+    }
+}
+
+static void searchPatches(
+    const DISLevel &level,
+    const DISPatchGrid &grid,
+    const float *I0x,
+    const float *I0y,
+    const DISPatchData *patches,
+    const DISOpticalFlowParams &params,
+    float *patchU,
+    float *patchV)
+{
+    const int32_t nx         = grid.numX;
+    const int32_t numStripes = (grid.numY + DIS_STRIPE_ROWS - 1) / DIS_STRIPE_ROWS;
+    const bool propagation   = params.useSpatialPropagation;
+    const int32_t iterations = params.gradientDescentIterations;
+    const int32_t forwardIterations = propagation ? (iterations + 1) / 2 : iterations;
+
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t s = 0; s < numStripes; ++s) {
+        const int32_t j0 = s * DIS_STRIPE_ROWS;
+        const int32_t j1 = std::min(j0 + DIS_STRIPE_ROWS, grid.numY);
+        float candU[3], candV[3];
+        for (int32_t j = j0; j < j1; ++j) {
+            for (int32_t i = 0; i < nx; ++i) {
+                const int32_t idx = j * nx + i;
+                int32_t n         = 0;
+                candU[n] = patchU[idx], candV[n++] = patchV[idx];
+                if (propagation && i > 0) candU[n] = patchU[idx - 1], candV[n++] = patchV[idx - 1];
+                if (propagation && j > j0) candU[n] = patchU[idx - nx], candV[n++] = patchV[idx - nx];
+                searchPatch(level, grid, I0x, I0y, patches[idx], i, j, candU, candV, n, forwardIterations,
+                            params.useMeanNormalization, patchU[idx], patchV[idx]);
+            }
+        }
+        if (!propagation) {
+            continue;
+        }
+        for (int32_t j = j1 - 1; j >= j0; --j) {
+            for (int32_t i = nx - 1; i >= 0; --i) {
+                const int32_t idx = j * nx + i;
+                int32_t n         = 0;
+                candU[n] = patchU[idx], candV[n++] = patchV[idx];
+                if (i < nx - 1) candU[n] = patchU[idx + 1], candV[n++] = patchV[idx + 1];
+                if (j < j1 - 1) candU[n] = patchU[idx + nx], candV[n++] = patchV[idx + nx];
+                searchPatch(level, grid, I0x, I0y, patches[idx], i, j, candU, candV, n, iterations - forwardIterations,
+                            params.useMeanNormalization, patchU[idx], patchV[idx]);
+            }
+        }
+    }
+}
+
+static inline float sampleBilinear(const uint8_t *img, int32_t stride, int32_t height, int32_t width, float fx, float fy)
+{
+    fx         = std::min(std::max(fx, 0.f), width - 1.001f);
+    fy         = std::min(std::max(fy, 0.f), height - 1.001f);
+    int32_t ix = (int32_t)fx, iy = (int32_t)fy;
+    float ax = fx - ix, ay = fy - iy;
+    const uint8_t *p = img + iy * stride + ix;
+    return (1.f - ay) * ((1.f - ax) * p[0] + ax * p[1]) + ay * ((1.f - ax) * p[stride] + ax * p[stride + 1]);
+}
+
+// every pixel gets the average flow of the patches covering it, weighted by how well each patch explains the pixel
+static void densifyFlow(
+    const DISLevel &level,
+    const DISPatchGrid &grid,
+    const float *patchU,
+    const float *patchV,
+    float *flowU,
+    float *flowV)
+{
+    const int32_t width = level.width, height = level.height, ps = grid.size;
+
+#pragma omp parallel for schedule(static)
+    for (int32_t y = 0; y < height; ++y) {
+        std::vector<float> acc(3 * width, 0.f);
+        float *accU = &acc[0], *accV = accU + width, *accW = accV + width;
+        const uint8_t *q = level.I0 + y * level.stride0;
+        for (int32_t j = std::max(0, (y - ps) / grid.stride); j < grid.numY; ++j) {
+            const int32_t y0 = grid.posY(j, height);
+            if (y0 > y) break;
+            if (y >= y0 + ps) continue;
+            for (int32_t i = 0; i < grid.numX; ++i) {
+                const int32_t x0 = grid.posX(i, width);
+                const float u = patchU[j * grid.numX + i], v = patchV[j * grid.numX + i];
+                const float fx = x0 + u, fy = y + v;
+                if (fx >= 0.f && fx + ps < width - 1 && fy >= 0.f && fy < height - 1) {
+                    int32_t ix = (int32_t)fx, iy = (int32_t)fy;
+                    float ax = fx - ix, ay = fy - iy;
+                    const __m128 w00 = _mm_set1_ps((1.f - ax) * (1.f - ay)), w01 = _mm_set1_ps(ax * (1.f - ay));
+                    const __m128 w10 = _mm_set1_ps((1.f - ax) * ay), w11 = _mm_set1_ps(ax * ay);
+                    const __m128 one = _mm_set1_ps(1.f), vu = _mm_set1_ps(u), vv = _mm_set1_ps(v);
+                    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+                    const uint8_t *p0 = level.I1 + iy * level.stride1 + ix;
+                    const uint8_t *p1 = p0 + level.stride1;
+                    for (int32_t k = 0; k < ps; k += 4) {
+                        __m128 warped = _mm_add_ps(_mm_add_ps(_mm_mul_ps(load4_u8(p0 + k), w00), _mm_mul_ps(load4_u8(p0 + k + 1), w01)),
+                                                   _mm_add_ps(_mm_mul_ps(load4_u8(p1 + k), w10), _mm_mul_ps(load4_u8(p1 + k + 1), w11)));
+                        __m128 diff   = _mm_and_ps(_mm_sub_ps(warped, load4_u8(q + x0 + k)), absMask);
+                        __m128 w      = _mm_div_ps(one, _mm_max_ps(one, diff));
+                        _mm_storeu_ps(accU + x0 + k, _mm_add_ps(_mm_loadu_ps(accU + x0 + k), _mm_mul_ps(w, vu)));
+                        _mm_storeu_ps(accV + x0 + k, _mm_add_ps(_mm_loadu_ps(accV + x0 + k), _mm_mul_ps(w, vv)));
+                        _mm_storeu_ps(accW + x0 + k, _mm_add_ps(_mm_loadu_ps(accW + x0 + k), w));
+                    }
+                } else {
+                    for (int32_t x = x0; x < x0 + ps; ++x) {
+                        float diff = sampleBilinear(level.I1, level.stride1, height, width, x + u, fy) - q[x];
+                        float w    = 1.f / std::max(1.f, std::fabs(diff));
+                        accU[x] += w * u;
+                        accV[x] += w * v;
+                        accW[x] += w;
+                    }
+                }
+            }
+        }
+        float *du = flowU + y * width;
+        float *dv = flowV + y * width;
+        for (int32_t x = 0; x < width; ++x) {
+            du[x] = accU[x] / accW[x];
+            dv[x] = accV[x] / accW[x];
+        }
+    }
+}
+
+static void toFloat(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, float *outData)
+{
+    for (int32_t y = 0; y < height; ++y) {
+        const uint8_t *src = inData + y * inWidthStride;
+        float *dst         = outData + y * width;
+        int32_t x          = 0;
+        for (; x <= width - 4; x += 4) {
+            _mm_storeu_ps(dst + x, load4_u8(src + x));
+        }
+        for (; x < width; ++x) {
+            dst[x] = src[x];
+        }
+    }
+}
+
+// central differences of an image at one pixel, with the neighbour rows and columns already clamped
+struct DISDerivatives {
+    float fx, fy, fxx, fxy, fyy;
+};
+
+static inline DISDerivatives derivativesAt(const float *up, const float *mid, const float *down, int32_t xl, int32_t x, int32_t xr)
+{
+    DISDerivatives d;
+    d.fx  = 0.5f * (mid[xr] - mid[xl]);
+    d.fy  = 0.5f * (down[x] - up[x]);
+    d.fxx = mid[xr] - 2.f * mid[x] + mid[xl];
+    d.fyy = down[x] - 2.f * mid[x] + up[x];
+    d.fxy = 0.25f * (down[xr] - down[xl] - up[xr] + up[xl]);
+    return d;
+}
+
+// derivative terms of the data and gradient constancy, averaged between the first image and the
+// warped second image and normalized to [0, 1] intensities
+static void computeRefinementTerms(
+    int32_t height,
+    int32_t width,
+    const float *I0,
+    const float *I1w,
+    float *Ix,
+    float *Iy,
+    float *Iz,
+    float *Ixx,
+    float *Ixy,
+    float *Iyy,
+    float *Ixz,
+    float *Iyz)
+{
+    const float norm = 1.f / 255.f;
+#pragma omp parallel for schedule(static)
+    for (int32_t y = 0; y < height; ++y) {
+        const int32_t yu = std::max(y - 1, 0) * width, ym = y * width, yd = std::min(y + 1, height - 1) * width;
+        const float *u0 = I0 + yu, *m0 = I0 + ym, *d0 = I0 + yd;
+        const float *u1 = I1w + yu, *m1 = I1w + ym, *d1 = I1w + yd;
+
+        const __m128 vnorm = _mm_set1_ps(norm), vhalf = _mm_set1_ps(0.5f), vquarter = _mm_set1_ps(0.25f);
+        const __m128 vhalfnorm = _mm_set1_ps(0.5f * norm);
+        int32_t x = 1;
+        for (; x <= width - 5; x += 4) {
+            __m128 fx[2], fy[2], fxx[2], fxy[2], fyy[2], c[2];
+            for (int32_t k = 0; k < 2; ++k) {
+                const float *up = k == 0 ? u0 : u1, *mid = k == 0 ? m0 : m1, *down = k == 0 ? d0 : d1;
+                __m128 l = _mm_loadu_ps(mid + x - 1), r = _mm_loadu_ps(mid + x + 1);
+                __m128 u = _mm_loadu_ps(up + x), d = _mm_loadu_ps(down + x);
+                c[k]     = _mm_loadu_ps(mid + x);
+                __m128 c2 = _mm_add_ps(c[k], c[k]);
+                fx[k]    = _mm_mul_ps(_mm_sub_ps(r, l), vhalf);
+                fy[k]    = _mm_mul_ps(_mm_sub_ps(d, u), vhalf);
+                fxx[k]   = _mm_sub_ps(_mm_add_ps(r, l), c2);
+                fyy[k]   = _mm_sub_ps(_mm_add_ps(d, u), c2);
+                __m128 diag = _mm_sub_ps(_mm_add_ps(_mm_loadu_ps(down + x + 1), _mm_loadu_ps(up + x - 1)),
+                                         _mm_add_ps(_mm_loadu_ps(down + x - 1), _mm_loadu_ps(up + x + 1)));
+                fxy[k]   = _mm_mul_ps(diag, vquarter);
+            }
+            _mm_storeu_ps(Ix + ym + x, _mm_mul_ps(_mm_add_ps(fx[0], fx[1]), vhalfnorm));
+            _mm_storeu_ps(Iy + ym + x, _mm_mul_ps(_mm_add_ps(fy[0], fy[1]), vhalfnorm));
+            _mm_storeu_ps(Iz + ym + x, _mm_mul_ps(_mm_sub_ps(c[1], c[0]), vnorm));
+            _mm_storeu_ps(Ixx + ym + x, _mm_mul_ps(_mm_add_ps(fxx[0], fxx[1]), vhalfnorm));
+            _mm_storeu_ps(Ixy + ym + x, _mm_mul_ps(_mm_add_ps(fxy[0], fxy[1]), vhalfnorm));
+            _mm_storeu_ps(Iyy + ym + x, _mm_mul_ps(_mm_add_ps(fyy[0], fyy[1]), vhalfnorm));
+            _mm_storeu_ps(Ixz + ym + x, _mm_mul_ps(_mm_sub_ps(fx[1], fx[0]), vnorm));
+            _mm_storeu_ps(Iyz + ym + x, _mm_mul_ps(_mm_sub_ps(fy[1], fy[0]), vnorm));
+        }
+        for (int32_t i = 0; i < width; ++i) {
+            if (i > 0 && i < x) continue;
+            const int32_t xl = std::max(i - 1, 0), xr = std::min(i + 1, width - 1);
+            DISDerivatives a = derivativesAt(u0, m0, d0, xl, i, xr);
+            DISDerivatives b = derivativesAt(u1, m1, d1, xl, i, xr);
+            Ix[ym + i]  = 0.5f * norm * (a.fx + b.fx);
+            Iy[ym + i]  = 0.5f * norm * (a.fy + b.fy);
+            Iz[ym + i]  = norm * (m1[i] - m0[i]);
+            Ixx[ym + i] = 0.5f * norm * (a.fxx + b.fxx);
+            Ixy[ym + i] = 0.5f * norm * (a.fxy + b.fxy);
+            Iyy[ym + i] = 0.5f * norm * (a.fyy + b.fyy);
+            Ixz[ym + i] = norm * (b.fx - a.fx);
+            Iyz[ym + i] = norm * (b.fy - a.fy);
+        }
+    }
+}
+
+static inline float robustWeight(float weight, float s2)
+{
+    return weight / std::sqrt(s2 + DIS_EPSILON * DIS_EPSILON);
+}
+
+static inline __m128 robustWeight(__m128 weight, __m128 s2)
+{
+    return _mm_div_ps(weight, _mm_sqrt_ps(_mm_add_ps(s2, _mm_set1_ps(DIS_EPSILON * DIS_EPSILON))));
+}
+
+// one red-black SOR update of the flow at four pixels of the same color, x, x + 2, x + 4 and x + 6
+static inline void sorUpdate4(
+    int32_t i,
+    int32_t width,
+    const float *WR,
+    const float *WD,
+    const float *A12,
+    const float *CU,
+    const float *CV,
+    const float *invU,
+    const float *invV,
+    float *U,
+    float *V)
+{
+#define DIS_EVEN(p) _mm_shuffle_ps(_mm_loadu_ps(p), _mm_loadu_ps((p) + 4), _MM_SHUFFLE(2, 0, 2, 0))
+    const __m128 omega = _mm_set1_ps(DIS_SOR_OMEGA), keep = _mm_set1_ps(1.f - DIS_SOR_OMEGA);
+    __m128 wl = DIS_EVEN(WR + i - 1), wr = DIS_EVEN(WR + i);
+    __m128 wu = DIS_EVEN(WD + i - width), wd = DIS_EVEN(WD + i);
+    __m128 a12 = DIS_EVEN(A12 + i);
+
+    __m128 u0 = _mm_loadu_ps(U + i), u1 = _mm_loadu_ps(U + i + 4);
+    __m128 uc = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 uo = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(3, 1, 3, 1));
+    __m128 v0 = _mm_loadu_ps(V + i), v1 = _mm_loadu_ps(V + i + 4);
+    __m128 vc = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 vo = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+
+    __m128 su = _mm_add_ps(_mm_add_ps(_mm_mul_ps(wl, DIS_EVEN(U + i - 1)), _mm_mul_ps(wr, uo)),
+                           _mm_add_ps(_mm_mul_ps(wu, DIS_EVEN(U + i - width)), _mm_mul_ps(wd, DIS_EVEN(U + i + width))));
+    __m128 sv = _mm_add_ps(_mm_add_ps(_mm_mul_ps(wl, DIS_EVEN(V + i - 1)), _mm_mul_ps(wr, vo)),
+                           _mm_add_ps(_mm_mul_ps(wu, DIS_EVEN(V + i - width)), _mm_mul_ps(wd, DIS_EVEN(V + i + width))));
+    __m128 nu = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(su, DIS_EVEN(CU + i)), _mm_mul_ps(a12, vc)), DIS_EVEN(invU + i));
+    uc        = _mm_add_ps(_mm_mul_ps(keep, uc), _mm_mul_ps(omega, nu));
+    __m128 nv = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(sv, DIS_EVEN(CV + i)), _mm_mul_ps(a12, uc)), DIS_EVEN(invV + i));
+    vc        = _mm_add_ps(_mm_mul_ps(keep, vc), _mm_mul_ps(omega, nv));
+#undef DIS_EVEN
+
+    _mm_storeu_ps(U + i, _mm_unpacklo_ps(uc, uo));
+    _mm_storeu_ps(U + i + 4, _mm_unpackhi_ps(uc, uo));
+    _mm_storeu_ps(V + i, _mm_unpacklo_ps(vc, vo));
+    _mm_storeu_ps(V + i + 4, _mm_unpackhi_ps(vc, vo));
+}
+
+// variational refinement with color and gradient constancy and a smoothness term, the energy is
+// linearized around the current flow and minimized by red-black SOR, iterating on the total flow
+// (U, V) so that each update reads a single value per neighbour
+static void refineFlow(
+    const DISLevel &level,
+    const DISOpticalFlowParams &params,
+    float *flowU,
+    float *flowV)
+{
+    const int32_t width = level.width, height = level.height;
+    const int32_t area  = width * height;
+    const float alpha   = params.variationalRefinementAlpha;
+    const float delta   = params.variationalRefinementDelta;
+    const float gamma   = params.variationalRefinementGamma;
+
+    enum { I0F, I1F, MAPX, MAPY, WARP, IX, IY, IZ, IXX, IXY, IYY, IXZ, IYZ,
+           U, V, PSIS, A11, A12, A22, CU, CV, INVU, INVV, WR, WD, NUM_PLANES };
+    std::vector<float> planes((size_t)NUM_PLANES * area);
+    float *P[NUM_PLANES];
+    for (int32_t k = 0; k < NUM_PLANES; ++k) P[k] = &planes[(size_t)k * area];
+
+    toFloat(height, width, level.stride0, level.I0, P[I0F]);
+    toFloat(height, width, level.stride1, level.I1, P[I1F]);
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            P[MAPX][y * width + x] = x + flowU[y * width + x];
+            P[MAPY][y * width + x] = y + flowV[y * width + x];
+        }
+    }
+    RemapLinear<float, 1>(height, width, width, P[I1F], height, width, width, P[WARP], P[MAPX], P[MAPY], BORDER_TYPE_REPLICATE);
+    computeRefinementTerms(height, width, P[I0F], P[WARP], P[IX], P[IY], P[IZ], P[IXX], P[IXY], P[IYY], P[IXZ], P[IYZ]);
+    memcpy(P[U], flowU, area * sizeof(float));
+    memcpy(P[V], flowV, area * sizeof(float));
+
+    float *U0 = flowU, *V0 = flowV, *Uc = P[U], *Vc = P[V];
+    for (int32_t iter = 0; iter < params.variationalRefinementIterations; ++iter) {
+#pragma omp parallel for schedule(static)
+        for (int32_t y = 0; y < height; ++y) {
+            int32_t x = 0;
+            if (y < height - 1) {
+                const __m128 valpha = _mm_set1_ps(alpha), vdelta = _mm_set1_ps(delta), vgamma = _mm_set1_ps(gamma);
+                for (; x <= width - 5; x += 4) {
+                    const int32_t i = y * width + x;
+                    __m128 u = _mm_loadu_ps(Uc + i), v = _mm_loadu_ps(Vc + i);
+                    __m128 ux = _mm_sub_ps(_mm_loadu_ps(Uc + i + 1), u), uy = _mm_sub_ps(_mm_loadu_ps(Uc + i + width), u);
+                    __m128 vx = _mm_sub_ps(_mm_loadu_ps(Vc + i + 1), v), vy = _mm_sub_ps(_mm_loadu_ps(Vc + i + width), v);
+                    __m128 s2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ux, ux), _mm_mul_ps(uy, uy)),
+                                           _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)));
+                    _mm_storeu_ps(P[PSIS] + i, robustWeight(valpha, s2));
+
+                    __m128 u0 = _mm_loadu_ps(U0 + i), v0 = _mm_loadu_ps(V0 + i);
+                    __m128 du = _mm_sub_ps(u, u0), dv = _mm_sub_ps(v, v0);
+                    __m128 ix = _mm_loadu_ps(P[IX] + i), iy = _mm_loadu_ps(P[IY] + i), iz = _mm_loadu_ps(P[IZ] + i);
+                    __m128 ixx = _mm_loadu_ps(P[IXX] + i), ixy = _mm_loadu_ps(P[IXY] + i), iyy = _mm_loadu_ps(P[IYY] + i);
+                    __m128 ixz = _mm_loadu_ps(P[IXZ] + i), iyz = _mm_loadu_ps(P[IYZ] + i);
+                    __m128 rz = _mm_add_ps(iz, _mm_add_ps(_mm_mul_ps(ix, du), _mm_mul_ps(iy, dv)));
+                    __m128 rx = _mm_add_ps(ixz, _mm_add_ps(_mm_mul_ps(ixx, du), _mm_mul_ps(ixy, dv)));
+                    __m128 ry = _mm_add_ps(iyz, _mm_add_ps(_mm_mul_ps(ixy, du), _mm_mul_ps(iyy, dv)));
+                    __m128 psiI = robustWeight(vdelta, _mm_mul_ps(rz, rz));
+                    __m128 psiG = robustWeight(vgamma, _mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)));
+                    __m128 a11 = _mm_add_ps(_mm_mul_ps(psiI, _mm_mul_ps(ix, ix)),
+                                            _mm_mul_ps(psiG, _mm_add_ps(_mm_mul_ps(ixx, ixx), _mm_mul_ps(ixy, ixy))));
+                    __m128 a12 = _mm_add_ps(_mm_mul_ps(psiI, _mm_mul_ps(ix, iy)),
+                                            _mm_mul_ps(psiG, _mm_add_ps(_mm_mul_ps(ixx, ixy), _mm_mul_ps(ixy, iyy))));
+                    __m128 a22 = _mm_add_ps(_mm_mul_ps(psiI, _mm_mul_ps(iy, iy)),
+                                            _mm_mul_ps(psiG, _mm_add_ps(_mm_mul_ps(ixy, ixy), _mm_mul_ps(iyy, iyy))));
+                    __m128 b1 = _mm_add_ps(_mm_mul_ps(psiI, _mm_mul_ps(ix, iz)),
+                                           _mm_mul_ps(psiG, _mm_add_ps(_mm_mul_ps(ixx, ixz), _mm_mul_ps(ixy, iyz))));
+                    __m128 b2 = _mm_add_ps(_mm_mul_ps(psiI, _mm_mul_ps(iy, iz)),
+                                           _mm_mul_ps(psiG, _mm_add_ps(_mm_mul_ps(ixy, ixz), _mm_mul_ps(iyy, iyz))));
+                    _mm_storeu_ps(P[A11] + i, a11);
+                    _mm_storeu_ps(P[A12] + i, a12);
+                    _mm_storeu_ps(P[A22] + i, a22);
+                    _mm_storeu_ps(P[CU] + i, _mm_sub_ps(_mm_add_ps(_mm_mul_ps(a11, u0), _mm_mul_ps(a12, v0)), b1));
+                    _mm_storeu_ps(P[CV] + i, _mm_sub_ps(_mm_add_ps(_mm_mul_ps(a22, v0), _mm_mul_ps(a12, u0)), b2));
+                }
+            }
+            for (; x < width; ++x) {
+                const int32_t i = y * width + x;
+                float ux = 0.f, uy = 0.f, vx = 0.f, vy = 0.f;
+                if (x < width - 1) {
+                    ux = Uc[i + 1] - Uc[i];
+                    vx = Vc[i + 1] - Vc[i];
+                }
+                if (y < height - 1) {
+                    uy = Uc[i + width] - Uc[i];
+                    vy = Vc[i + width] - Vc[i];
+                }
+                P[PSIS][i] = robustWeight(alpha, ux * ux + uy * uy + vx * vx + vy * vy);
+
+                const float du = Uc[i] - U0[i], dv = Vc[i] - V0[i];
+                const float ix = P[IX][i], iy = P[IY][i], iz = P[IZ][i];
+                const float ixx = P[IXX][i], ixy = P[IXY][i], iyy = P[IYY][i], ixz = P[IXZ][i], iyz = P[IYZ][i];
+                float rz   = iz + ix * du + iy * dv;
+                float rx   = ixz + ixx * du + ixy * dv;
+                float ry   = iyz + ixy * du + iyy * dv;
+                float psiI = robustWeight(delta, rz * rz);
+                float psiG = robustWeight(gamma, rx * rx + ry * ry);
+                float a11  = psiI * ix * ix + psiG * (ixx * ixx + ixy * ixy);
+                float a12  = psiI * ix * iy + psiG * (ixx * ixy + ixy * iyy);
+                float a22  = psiI * iy * iy + psiG * (ixy * ixy + iyy * iyy);
+                P[A11][i]  = a11;
+                P[A12][i]  = a12;
+                P[A22][i]  = a22;
+                P[CU][i]   = a11 * U0[i] + a12 * V0[i] - (psiI * ix * iz + psiG * (ixx * ixz + ixy * iyz));
+                P[CV][i]   = a22 * V0[i] + a12 * U0[i] - (psiI * iy * iz + psiG * (ixy * ixz + iyy * iyz));
+            }
+        }
+#pragma omp parallel for schedule(static)
+        for (int32_t y = 0; y < height; ++y) {
+            for (int32_t x = 0; x < width; ++x) {
+                const int32_t i = y * width + x;
+                P[WR][i]        = x < width - 1 ? 0.5f * (P[PSIS][i] + P[PSIS][i + 1]) : 0.f;
+                P[WD][i]        = y < height - 1 ? 0.5f * (P[PSIS][i] + P[PSIS][i + width]) : 0.f;
+            }
+        }
+#pragma omp parallel for schedule(static)
+        for (int32_t y = 0; y < height; ++y) {
+            for (int32_t x = 0; x < width; ++x) {
+                const int32_t i = y * width + x;
+                float sumW      = P[WR][i] + P[WD][i];
+                if (x > 0) sumW += P[WR][i - 1];
+                if (y > 0) sumW += P[WD][i - width];
+                P[INVU][i] = 1.f / (P[A11][i] + sumW + FLT_EPSILON);
+                P[INVV][i] = 1.f / (P[A22][i] + sumW + FLT_EPSILON);
+            }
+        }
+
+        for (int32_t sweep = 0; sweep < DIS_SOR_SWEEPS; ++sweep) {
+            for (int32_t color = 0; color < 2; ++color) {
+#pragma omp parallel for schedule(static)
+                for (int32_t y = 0; y < height; ++y) {
+                    const bool inner = y > 0 && y < height - 1;
+                    for (int32_t x = (y + color) & 1; x < width; x += 2) {
+                        const int32_t i = y * width + x;
+                        if (inner && x > 0 && x + 8 <= width - 1) {
+                            sorUpdate4(i, width, P[WR], P[WD], P[A12], P[CU], P[CV], P[INVU], P[INVV], Uc, Vc);
+                            x += 6;
+                            continue;
+                        }
+                        float su = 0.f, sv = 0.f;
+                        if (x > 0) {
+                            su += P[WR][i - 1] * Uc[i - 1];
+                            sv += P[WR][i - 1] * Vc[i - 1];
+                        }
+                        if (x < width - 1) {
+                            su += P[WR][i] * Uc[i + 1];
+                            sv += P[WR][i] * Vc[i + 1];
+                        }
+                        if (y > 0) {
+                            su += P[WD][i - width] * Uc[i - width];
+                            sv += P[WD][i - width] * Vc[i - width];
+                        }
+                        if (y < height - 1) {
+                            su += P[WD][i] * Uc[i + width];
+                            sv += P[WD][i] * Vc[i + width];
+                        }
+                        float nu = (su + P[CU][i] - P[A12][i] * Vc[i]) * P[INVU][i];
+                        Uc[i]    = (1.f - DIS_SOR_OMEGA) * Uc[i] + DIS_SOR_OMEGA * nu;
+                        float nv = (sv + P[CV][i] - P[A12][i] * Uc[i]) * P[INVV][i];
+                        Vc[i]    = (1.f - DIS_SOR_OMEGA) * Vc[i] + DIS_SOR_OMEGA * nv;
+                    }
+                }
+            }
+        }
+    }
+
+    memcpy(flowU, Uc, area * sizeof(float));
+    memcpy(flowV, Vc, area * sizeof(float));
+}
+
+::ppl::common::RetCode DISOpticalFlow(
+    int32_t height,
+    int32_t width,
+    int32_t prevWidthStride,
+    const uint8_t *prevData,
+    int32_t nextWidthStride,
+    const uint8_t *nextData,
+    int32_t flowWidthStride,
+    float *flowData,
+    const DISOpticalFlowParams &params)
+{
+    if (prevData == nullptr || nextData == nullptr || flowData == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || prevWidthStride < width || nextWidthStride < width || flowWidthStride < 2 * width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int32_t ps = params.patchSize;
+    if (ps < 4 || ps > 32 || ps % 4 != 0 || params.patchStride < 1 || params.patchStride > ps) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (params.finestScale < 0 || params.gradientDescentIterations < 0 || params.variationalRefinementIterations < 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height < ps + 2 || width < ps + 2) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    // the same coarsest level as OpenCV, further limited so that every level holds a few patches
+    int32_t coarsest = std::min((int32_t)(std::log(std::max(width, height) / (4.0 * ps)) / std::log(2.0) + 0.5),
+                                (int32_t)(std::log(std::min(width, height) / (double)ps) / std::log(2.0)));
+    coarsest = std::max(coarsest, 0);
+    while (coarsest > 0 && (((height - 1) >> coarsest) + 1 < ps + 2 || ((width - 1) >> coarsest) + 1 < ps + 2)) {
+        --coarsest;
+    }
+    const int32_t finest = std::min(params.finestScale, coarsest);
+
+    std::vector<DISLevel> levels(coarsest + 1);
+    levels[0].height  = height;
+    levels[0].width   = width;
+    levels[0].stride0 = prevWidthStride;
+    levels[0].stride1 = nextWidthStride;
+    levels[0].I0      = prevData;
+    levels[0].I1      = nextData;
+    for (int32_t s = 1; s <= coarsest; ++s) {
+        DISLevel &up  = levels[s - 1];
+        DISLevel &cur = levels[s];
+        cur.height    = (up.height + 1) / 2;
+        cur.width     = (up.width + 1) / 2;
+        cur.stride0   = cur.width;
+        cur.stride1   = cur.width;
+        cur.storage.resize(2 * cur.height * cur.width);
+        PyrDown<uint8_t, 1>(up.height, up.width, up.stride0, up.I0, cur.width, &cur.storage[0], BORDER_TYPE_REFLECT_101);
+        PyrDown<uint8_t, 1>(up.height, up.width, up.stride1, up.I1, cur.width, &cur.storage[cur.height * cur.width], BORDER_TYPE_REFLECT_101);
+        cur.I0 = &cur.storage[0];
+        cur.I1 = &cur.storage[cur.height * cur.width];
+    }
+
+    std::vector<float> flowU, flowV;
+    for (int32_t s = coarsest; s >= finest; --s) {
+        DISLevel &level = levels[s];
+        const int32_t h = level.height, w = level.width;
+        level.strideP   = w + 2 * ps;
+        level.padded.resize((h + 2 * ps) * level.strideP);
+        CopyMakeBorder<uint8_t, 1>(h, w, level.stride1, level.I1, h + 2 * ps, level.strideP, level.strideP, &level.padded[0], BORDER_TYPE_REPLICATE);
+        level.I1P = &level.padded[ps * level.strideP + ps];
+
+        std::vector<int16_t> sobelBuffer(h * w);
+        std::vector<float> grads(2 * h * w);
+        float *I0x = &grads[0], *I0y = I0x + h * w;
+        computeGradients(h, w, level.stride0, level.I0, &sobelBuffer[0], I0x, I0y);
+        std::vector<int32_t> integral0((h + 1) * (w + 1));
+        Integral<uint8_t, int32_t, 1>(h, w, level.stride0, level.I0, h + 1, w + 1, w + 1, &integral0[0]);
+
+        DISPatchGrid grid;
+        grid.size   = ps;
+        grid.stride = params.patchStride;
+        grid.numX   = 1 + (w - ps + grid.stride - 1) / grid.stride;
+        grid.numY   = 1 + (h - ps + grid.stride - 1) / grid.stride;
+        std::vector<DISPatchData> patches(grid.numX * grid.numY);
+        precomputePatches(level, grid, I0x, I0y, &integral0[0], params.useMeanNormalization, &patches[0]);
+
+        // patches start from the upsampled flow of the coarser level at their centers
+        std::vector<float> patchU(grid.numX * grid.numY, 0.f), patchV(grid.numX * grid.numY, 0.f);
+        std::vector<float> denseU(h * w), denseV(h * w);
+        if (s < coarsest) {
+            const DISLevel &coarse = levels[s + 1];
+            ResizeLinear<float, 1>(coarse.height, coarse.width, coarse.width, &flowU[0], h, w, w, &denseU[0]);
+            ResizeLinear<float, 1>(coarse.height, coarse.width, coarse.width, &flowV[0], h, w, w, &denseV[0]);
+            for (int32_t i = 0; i < h * w; ++i) {
+                denseU[i] *= 2.f;
+                denseV[i] *= 2.f;
+            }
+            for (int32_t j = 0; j < grid.numY; ++j) {
+                for (int32_t i = 0; i < grid.numX; ++i) {
+                    int32_t c = (grid.posY(j, h) + ps / 2) * w + grid.posX(i, w) + ps / 2;
+                    patchU[j * grid.numX + i] = denseU[c];
+                    patchV[j * grid.numX + i] = denseV[c];
+                }
+            }
+        }
+
+        searchPatches(level, grid, I0x, I0y, &patches[0], params, &patchU[0], &patchV[0]);
+        densifyFlow(level, grid, &patchU[0], &patchV[0], &denseU[0], &denseV[0]);
+        if (params.variationalRefinementIterations > 0) {
+            refineFlow(level, params, &denseU[0], &denseV[0]);
+        }
+        flowU.swap(denseU);
+        flowV.swap(denseV);
+    }
+
+    const DISLevel &last = levels[finest];
+    const float scale    = (float)(1 << finest);
+    std::vector<float> fullU, fullV;
+    if (finest > 0) {
+        fullU.resize(height * width);
+        fullV.resize(height * width);
+        ResizeLinear<float, 1>(last.height, last.width, last.width, &flowU[0], height, width, width, &fullU[0]);
+        ResizeLinear<float, 1>(last.height, last.width, last.width, &flowV[0], height, width, width, &fullV[0]);
+    } else {
+        fullU.swap(flowU);
+        fullV.swap(flowV);
+    }
+    const __m128 vscale = _mm_set1_ps(scale);
+    for (int32_t y = 0; y < height; ++y) {
+        const float *u = &fullU[y * width];
+        const float *v = &fullV[y * width];
+        float *dst     = flowData + y * flowWidthStride;
+        int32_t x      = 0;
+        for (; x <= width - 4; x += 4) {
+            __m128 vu = _mm_mul_ps(_mm_loadu_ps(u + x), vscale);
+            __m128 vv = _mm_mul_ps(_mm_loadu_ps(v + x), vscale);
+            _mm_storeu_ps(dst + 2 * x, _mm_unpacklo_ps(vu, vv));
+            _mm_storeu_ps(dst + 2 * x + 4, _mm_unpackhi_ps(vu, vv));
+        }
+        for (; x < width; ++x) {
+            dst[2 * x]     = u[x] * scale;
+            dst[2 * x + 1] = v[x] * scale;
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/opticalflow.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+void BM_DISOpticalFlow_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> prev(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> next(new uint8_t[width * height]);
+    std::unique_ptr<float[]> flow(new float[2 * width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(prev.get(), width * height, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(next.get(), width * height, 0, 255);
+    ppl::cv::x86::DISOpticalFlowParams params;
+    params.variationalRefinementIterations = state.range(2);
+    for (auto _ : state) {
+        ppl::cv::x86::DISOpticalFlow(height, width, width, prev.get(), width, next.get(), 2 * width, flow.get(), params);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK(BM_DISOpticalFlow_ppl_x86)->Args({640, 480, 0})->Args({640, 480, 5})->Args({1280, 720, 5});
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/opticalflow.h"
+#include "ppl/cv/x86/test.h"
+#include <vector>
+#include <cmath>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+
+// a smooth random texture, and the same texture moved by a smoothly varying flow
+static void MakeFlowPair(cv::Mat& prev, cv::Mat& next, cv::Mat& truth)
+{
+    const int32_t height = prev.rows, width = prev.cols;
+    cv::Mat noise(height / 8 + 2, width / 8 + 2, CV_32FC1);
+    cv::randu(noise, cv::Scalar(0), cv::Scalar(256));
+    cv::Mat texture;
+    cv::resize(noise, texture, cv::Size(width, height), 0, 0, cv::INTER_CUBIC);
+    cv::GaussianBlur(texture, texture, cv::Size(5, 5), 1.0);
+
+    cv::Mat mapX(height, width, CV_32FC1), mapY(height, width, CV_32FC1);
+    for (int32_t i = 0; i < height; ++i) {
+        for (int32_t j = 0; j < width; ++j) {
+            float u = 3.f + 2.f * std::sin(i / 40.f);
+            float v = -1.5f + 1.5f * std::cos(j / 50.f);
+            truth.at<cv::Vec2f>(i, j) = cv::Vec2f(u, v);
+            mapX.at<float>(i, j)      = j - u;
+            mapY.at<float>(i, j)      = i - v;
+        }
+    }
+    cv::Mat moved;
+    cv::remap(texture, moved, mapX, mapY, cv::INTER_LINEAR, cv::BORDER_REFLECT);
+    texture.convertTo(prev, CV_8UC1);
+    moved.convertTo(next, CV_8UC1);
+}
+
+// DIS has no bit exact reference, the mean end point error is checked away from the borders
+void DISOpticalFlowTest(int32_t height, int32_t width, int32_t finestScale, int32_t refinementIterations, float maxError)
+{
+    cv::Mat prev(height, width, CV_8UC1), next(height, width, CV_8UC1), truth(height, width, CV_32FC2);
+    MakeFlowPair(prev, next, truth);
+
+    ppl::cv::x86::DISOpticalFlowParams params;
+    params.finestScale                     = finestScale;
+    params.variationalRefinementIterations = refinementIterations;
+    cv::Mat flow(height, width, CV_32FC2);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::DISOpticalFlow(height, width, width, prev.ptr<uint8_t>(), width, next.ptr<uint8_t>(), 2 * width, flow.ptr<float>(), params));
+
+    const int32_t margin = 32;
+    double error         = 0.0;
+    for (int32_t i = margin; i < height - margin; ++i) {
+        for (int32_t j = margin; j < width - margin; ++j) {
+            cv::Vec2f d = flow.at<cv::Vec2f>(i, j) - truth.at<cv::Vec2f>(i, j);
+            error += std::sqrt(d[0] * d[0] + d[1] * d[1]);
+        }
+    }
+    error /= (double)(height - 2 * margin) * (width - 2 * margin);
+    EXPECT_LT(error, maxError);
+}
+
+TEST(DISOpticalFlow_UINT8, x86)
+{
+    DISOpticalFlowTest(480, 640, 1, 5, 0.25f);
+    DISOpticalFlowTest(480, 640, 1, 0, 0.25f);
+    DISOpticalFlowTest(480, 640, 0, 5, 0.2f);
+    DISOpticalFlowTest(241, 321, 1, 5, 0.3f);
+}
+
+TEST(DISOpticalFlow_InvalidParams, x86)
+{
+    // the smallest image is patchSize + 2 on both sides
+    ppl::cv::x86::DISOpticalFlowParams params;
+    params.patchSize = 8;
+    std::vector<uint8_t> image(16 * 16);
+    std::vector<float> flow(16 * 16 * 2);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::DISOpticalFlow(9, 16, 16, image.data(), 16, image.data(), 32, flow.data(), params));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::DISOpticalFlow(16, 9, 16, image.data(), 16, image.data(), 32, flow.data(), params));
+    EXPECT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::DISOpticalFlow(10, 10, 16, image.data(), 16, image.data(), 32, flow.data(), params));
+    params.patchSize = 12;
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::DISOpticalFlow(13, 16, 16, image.data(), 16, image.data(), 32, flow.data(), params));
+}
@@ -0,0 +1,387 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/planar.h"
+#include "ppl/cv/x86/batch.h"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// output rows of one work item of WarpAffineLinearPlanar
+#define PLANAR_BAND_ROWS 16
+#define PLANAR_SCRATCH_ALIGN 128
+
+template <typename T, int32_t numPlanes>
+static bool planar_valid(int32_t height, int32_t width, const int32_t *widthStrides, const T *const *planes)
+{
+    if (height <= 0 || width <= 0 || widthStrides == NULL || planes == NULL) {
+        return false;
+    }
+    for (int32_t p = 0; p < numPlanes; ++p) {
+        if (planes[p] == NULL || widthStrides[p] < width) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*********************************** GaussianBlur ***********************************/
+
+template <typename T, int32_t numPlanes>
+::ppl::common::RetCode GaussianBlurPlanar(
+    int32_t height,
+    int32_t width,
+    const int32_t *inWidthStrides,
+    const T *const *inPlanes,
+    int32_t kernel_len,
+    float sigma,
+    const int32_t *outWidthStrides,
+    T *const *outPlanes,
+    BorderType border_type)
+{
+    if (!planar_valid<T, numPlanes>(height, width, inWidthStrides, inPlanes) ||
+        !planar_valid<T, numPlanes>(height, width, outWidthStrides, outPlanes)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    int32_t results[numPlanes];
+#pragma omp parallel for
+    for (int32_t p = 0; p < numPlanes; ++p) {
+        results[p] = GaussianBlur<T, 1>(height, width, inWidthStrides[p], inPlanes[p], kernel_len, sigma, outWidthStrides[p], outPlanes[p], border_type);
+    }
+    for (int32_t p = 0; p < numPlanes; ++p) {
+        if (results[p] != ppl::common::RC_SUCCESS) {
+            return (::ppl::common::RetCode)results[p];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+/*********************************** WarpAffineLinear ***********************************/
+
+// uint8_t planes take Q16 weights, truncated like the ones of WarpAffineLinear
+#define PLANAR_WARP_BITS 16
+#define PLANAR_WARP_ONE  (1 << PLANAR_WARP_BITS)
+#define PLANAR_WARP_BIAS (1 << (PLANAR_WARP_BITS - 1))
+
+template <typename T>
+struct PlanarWarpTraits;
+
+template <>
+struct PlanarWarpTraits<uint8_t> {
+    typedef int32_t weight_t;
+    static inline void store(int32_t *dst, __m128 w)
+    {
+        _mm_storeu_si128((__m128i *)dst, _mm_cvttps_epi32(_mm_mul_ps(w, _mm_set1_ps(PLANAR_WARP_ONE))));
+    }
+    static inline int32_t weight(float w)
+    {
+        return (int32_t)(w * PLANAR_WARP_ONE);
+    }
+    static inline uint8_t blend(const int32_t *tab, int32_t v0, int32_t v1, int32_t v2, int32_t v3)
+    {
+        return (uint8_t)((tab[0] * v0 + tab[1] * v1 + tab[2] * v2 + tab[3] * v3 + PLANAR_WARP_BIAS) >> PLANAR_WARP_BITS);
+    }
+    // four pixels whose 2x2 neighbourhoods are inside the plane
+    static inline void blend4(const int32_t *w0, const int32_t *w1, const int32_t *w2, const int32_t *w3, const uint8_t **p, int32_t stride, uint8_t *dst)
+    {
+        __m128i v0      = _mm_setr_epi32(p[0][0], p[1][0], p[2][0], p[3][0]);
+        __m128i v1      = _mm_setr_epi32(p[0][1], p[1][1], p[2][1], p[3][1]);
+        __m128i v2      = _mm_setr_epi32(p[0][stride], p[1][stride], p[2][stride], p[3][stride]);
+        __m128i v3      = _mm_setr_epi32(p[0][stride + 1], p[1][stride + 1], p[2][stride + 1], p[3][stride + 1]);
+        __m128i sum     = _mm_add_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_loadu_si128((const __m128i *)w0), v0), _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)w1), v1)),
+                                        _mm_add_epi32(_mm_mullo_epi32(_mm_loadu_si128((const __m128i *)w2), v2), _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)w3), v3)));
+        sum             = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(PLANAR_WARP_BIAS)), PLANAR_WARP_BITS);
+        sum             = _mm_packus_epi16(_mm_packs_epi32(sum, sum), sum);
+        *(int32_t *)dst = _mm_cvtsi128_si32(sum);
+    }
+};
+
+template <>
+struct PlanarWarpTraits<float> {
+    typedef float weight_t;
+    static inline void store(float *dst, __m128 w)
+    {
+        _mm_storeu_ps(dst, w);
+    }
+    static inline float weight(float w)
+    {
+        return w;
+    }
+    static inline float blend(const float *tab, float v0, float v1, float v2, float v3)
+    {
+        return tab[0] * v0 + tab[1] * v1 + tab[2] * v2 + tab[3] * v3;
+    }
+    static inline void blend4(const float *w0, const float *w1, const float *w2, const float *w3, const float **p, int32_t stride, float *dst)
+    {
+        __m128 v0  = _mm_setr_ps(p[0][0], p[1][0], p[2][0], p[3][0]);
+        __m128 v1  = _mm_setr_ps(p[0][1], p[1][1], p[2][1], p[3][1]);
+        __m128 v2  = _mm_setr_ps(p[0][stride], p[1][stride], p[2][stride], p[3][stride]);
+        __m128 v3  = _mm_setr_ps(p[0][stride + 1], p[1][stride + 1], p[2][stride + 1], p[3][stride + 1]);
+        __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(w0), v0), _mm_mul_ps(_mm_loadu_ps(w1), v1)),
+                                _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(w2), v2), _mm_mul_ps(_mm_loadu_ps(w3), v3)));
+        _mm_storeu_ps(dst, sum);
+    }
+};
+
+// source coordinates and the four weights of every pixel of output row i, shared by all planes. The weights
+// are stored as four arrays of outWidth
+template <typename T>
+static void planar_warp_coords(
+    const double *M,
+    int32_t i,
+    int32_t outWidth,
+    int32_t *sx,
+    int32_t *sy,
+    typename PlanarWarpTraits<T>::weight_t *tab)
+{
+    const float base_x = M[1] * i + M[2];
+    const float base_y = M[4] * i + M[5];
+    const float m0     = M[0];
+    const float m3     = M[3];
+    __m128 one_vec     = _mm_set1_ps(1.0f);
+    int32_t j          = 0;
+    for (; j <= outWidth - 4; j += 4) {
+        __m128 seq   = _mm_setr_ps(j, j + 1, j + 2, j + 3);
+        __m128 x     = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m0), seq), _mm_set1_ps(base_x));
+        __m128 y     = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m3), seq), _mm_set1_ps(base_y));
+        __m128 fx    = _mm_floor_ps(x);
+        __m128 fy    = _mm_floor_ps(y);
+        __m128 u     = _mm_sub_ps(x, fx);
+        __m128 v     = _mm_sub_ps(y, fy);
+        __m128 taby0 = _mm_sub_ps(one_vec, v);
+        __m128 tabx0 = _mm_sub_ps(one_vec, u);
+        _mm_storeu_si128((__m128i *)(sx + j), _mm_cvttps_epi32(fx));
+        _mm_storeu_si128((__m128i *)(sy + j), _mm_cvttps_epi32(fy));
+        PlanarWarpTraits<T>::store(tab + j, _mm_mul_ps(taby0, tabx0));
+        PlanarWarpTraits<T>::store(tab + outWidth + j, _mm_mul_ps(taby0, u));
+        PlanarWarpTraits<T>::store(tab + outWidth * 2 + j, _mm_mul_ps(v, tabx0));
+        PlanarWarpTraits<T>::store(tab + outWidth * 3 + j, _mm_mul_ps(v, u));
+    }
+    for (; j < outWidth; ++j) {
+        float x               = m0 * j + base_x;
+        float y               = m3 * j + base_y;
+        float fx              = std::floor(x);
+        float fy              = std::floor(y);
+        float u               = x - fx;
+        float v               = y - fy;
+        sx[j]                 = (int32_t)fx;
+        sy[j]                 = (int32_t)fy;
+        tab[j]                = PlanarWarpTraits<T>::weight((1.0f - v) * (1.0f - u));
+        tab[outWidth + j]     = PlanarWarpTraits<T>::weight((1.0f - v) * u);
+        tab[outWidth * 2 + j] = PlanarWarpTraits<T>::weight(v * (1.0f - u));
+        tab[outWidth * 3 + j] = PlanarWarpTraits<T>::weight(v * u);
+    }
+}
+
+// one output row of one plane from the shared coordinates
+template <typename T, BorderType borderMode>
+static void planar_warp_row(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *src,
+    int32_t outWidth,
+    T *dst,
+    const int32_t *sx,
+    const int32_t *sy,
+    const typename PlanarWarpTraits<T>::weight_t *tab,
+    T delta)
+{
+    typedef typename PlanarWarpTraits<T>::weight_t weight_t;
+    __m128i min_vec = _mm_set1_epi32(-1);
+    __m128i maxx    = _mm_set1_epi32(inWidth - 1);
+    __m128i maxy    = _mm_set1_epi32(inHeight - 1);
+    int32_t j       = 0;
+    while (j < outWidth) {
+        if (j <= outWidth - 4) {
+            __m128i x      = _mm_loadu_si128((const __m128i *)(sx + j));
+            __m128i y      = _mm_loadu_si128((const __m128i *)(sy + j));
+            __m128i inside = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(x, min_vec), _mm_cmplt_epi32(x, maxx)),
+                                           _mm_and_si128(_mm_cmpgt_epi32(y, min_vec), _mm_cmplt_epi32(y, maxy)));
+            if (_mm_movemask_ps(_mm_castsi128_ps(inside)) == 0xF) {
+                const T *p[4];
+                for (int32_t k = 0; k < 4; ++k) {
+                    p[k] = src + sy[j + k] * inWidthStride + sx[j + k];
+                }
+                PlanarWarpTraits<T>::blend4(tab + j, tab + outWidth + j, tab + outWidth * 2 + j, tab + outWidth * 3 + j, p, inWidthStride, dst + j);
+                j += 4;
+                continue;
+            }
+        }
+        int32_t x0      = sx[j];
+        int32_t y0      = sy[j];
+        weight_t w[4]   = {tab[j], tab[outWidth + j], tab[outWidth * 2 + j], tab[outWidth * 3 + j]};
+        bool all_inside = x0 >= 0 && x0 < inWidth - 1 && y0 >= 0 && y0 < inHeight - 1;
+        if (borderMode == ppl::cv::BORDER_TYPE_TRANSPARENT && !all_inside) {
+            ++j;
+            continue;
+        }
+        if (borderMode == ppl::cv::BORDER_TYPE_CONSTANT && !all_inside) {
+            bool fx0    = x0 >= 0 && x0 < inWidth;
+            bool fx1    = x0 + 1 >= 0 && x0 + 1 < inWidth;
+            bool fy0    = y0 >= 0 && y0 < inHeight;
+            bool fy1    = y0 + 1 >= 0 && y0 + 1 < inHeight;
+            const T *t0 = src + y0 * inWidthStride + x0;
+            const T *t2 = t0 + inWidthStride;
+            dst[j]      = PlanarWarpTraits<T>::blend(w, fx0 && fy0 ? t0[0] : delta, fx1 && fy0 ? t0[1] : delta, fx0 && fy1 ? t2[0] : delta, fx1 && fy1 ? t2[1] : delta);
+            ++j;
+            continue;
+        }
+        int32_t x1 = x0 + 1;
+        int32_t y1 = y0 + 1;
+        if (!all_inside) {
+            x0 = std::min(std::max(x0, 0), inWidth - 1);
+            x1 = std::min(std::max(x1, 0), inWidth - 1);
+            y0 = std::min(std::max(y0, 0), inHeight - 1);
+            y1 = std::min(std::max(y1, 0), inHeight - 1);
+        }
+        const T *r0 = src + y0 * inWidthStride;
+        const T *r1 = src + y1 * inWidthStride;
+        dst[j]      = PlanarWarpTraits<T>::blend(w, r0[x0], r0[x1], r1[x0], r1[x1]);
+        ++j;
+    }
+}
+
+template <typename T, int32_t numPlanes, BorderType borderMode>
+static ::ppl::common::RetCode planar_warp_affine_linear(
+    int32_t inHeight,
+    int32_t inWidth,
+    const int32_t *inWidthStrides,
+    const T *const *inPlanes,
+    int32_t outHeight,
+    int32_t outWidth,
+    const int32_t *outWidthStrides,
+    T *const *outPlanes,
+    const double *M,
+    T delta)
+{
+    typedef typename PlanarWarpTraits<T>::weight_t weight_t;
+    const uint64_t scratchSize = ((uint64_t)outWidth * 2 * sizeof(int32_t) + (uint64_t)outWidth * 4 * sizeof(weight_t) + PLANAR_SCRATCH_ALIGN - 1) /
+                                 PLANAR_SCRATCH_ALIGN * PLANAR_SCRATCH_ALIGN;
+    uint8_t *scratch = (uint8_t *)ppl::common::AlignedAlloc(scratchSize * get_max_threads(), PLANAR_SCRATCH_ALIGN);
+    if (scratch == NULL) {
+        return ppl::common::RC_OUT_OF_MEMORY;
+    }
+    const int32_t numBands = (outHeight + PLANAR_BAND_ROWS - 1) / PLANAR_BAND_ROWS;
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t b = 0; b < numBands; ++b) {
+        int32_t *sx   = (int32_t *)(scratch + scratchSize * get_thread_num());
+        int32_t *sy   = sx + outWidth;
+        weight_t *tab = (weight_t *)(sy + outWidth);
+        for (int32_t i = b * PLANAR_BAND_ROWS; i < std::min((b + 1) * PLANAR_BAND_ROWS, outHeight); ++i) {
+            planar_warp_coords<T>(M, i, outWidth, sx, sy, tab);
+            for (int32_t p = 0; p < numPlanes; ++p) {
+                planar_warp_row<T, borderMode>(inHeight, inWidth, inWidthStrides[p], inPlanes[p], outWidth, outPlanes[p] + (int64_t)i * outWidthStrides[p], sx, sy, tab, delta);
+            }
+        }
+    }
+    ppl::common::AlignedFree(scratch);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t numPlanes>
+::ppl::common::RetCode WarpAffineLinearPlanar(
+    int32_t inHeight,
+    int32_t inWidth,
+    const int32_t *inWidthStrides,
+    const T *const *inPlanes,
+    int32_t outHeight,
+    int32_t outWidth,
+    const int32_t *outWidthStrides,
+    T *const *outPlanes,
+    const double *affineMatrix,
+    BorderType border_type,
+    T border_value)
+{
+    if (!planar_valid<T, numPlanes>(inHeight, inWidth, inWidthStrides, inPlanes) ||
+        !planar_valid<T, numPlanes>(outHeight, outWidth, outWidthStrides, outPlanes) || affineMatrix == NULL) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type == ppl::cv::BORDER_TYPE_CONSTANT) {
+        return planar_warp_affine_linear<T, numPlanes, ppl::cv::BORDER_TYPE_CONSTANT>(inHeight, inWidth, inWidthStrides, inPlanes, outHeight, outWidth, outWidthStrides, outPlanes, affineMatrix, border_value);
+    } else if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
+        return planar_warp_affine_linear<T, numPlanes, ppl::cv::BORDER_TYPE_REPLICATE>(inHeight, inWidth, inWidthStrides, inPlanes, outHeight, outWidth, outWidthStrides, outPlanes, affineMatrix, border_value);
+    } else if (border_type == ppl::cv::BORDER_TYPE_TRANSPARENT) {
+        return planar_warp_affine_linear<T, numPlanes, ppl::cv::BORDER_TYPE_TRANSPARENT>(inHeight, inWidth, inWidthStrides, inPlanes, outHeight, outWidth, outWidthStrides, outPlanes, affineMatrix, border_value);
+    }
+    return ppl::common::RC_INVALID_VALUE;
+}
+
+/*********************************** ResizeLinear ***********************************/
+
+// the planes are the images of a batch of single-channel images of one shape, which share one set of tables
+template <typename T, int32_t numPlanes>
+::ppl::common::RetCode ResizeLinearPlanar(
+    int32_t inHeight,
+    int32_t inWidth,
+    const int32_t *inWidthStrides,
+    const T *const *inPlanes,
+    int32_t outHeight,
+    int32_t outWidth,
+    const int32_t *outWidthStrides,
+    T *const *outPlanes)
+{
+    if (!planar_valid<T, numPlanes>(inHeight, inWidth, inWidthStrides, inPlanes) ||
+        !planar_valid<T, numPlanes>(outHeight, outWidth, outWidthStrides, outPlanes)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    BatchImage src[numPlanes], dst[numPlanes];
+    for (int32_t p = 0; p < numPlanes; ++p) {
+        src[p] = BatchImage(inHeight, inWidth, inWidthStrides[p], (void *)inPlanes[p]);
+        dst[p] = BatchImage(outHeight, outWidth, outWidthStrides[p], outPlanes[p]);
+    }
+    return ResizeLinearBatch<T, 1>(numPlanes, src, dst);
+}
+
+template ::ppl::common::RetCode GaussianBlurPlanar<uint8_t, 1>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, float, const int32_t *, uint8_t *const *, BorderType);
+template ::ppl::common::RetCode GaussianBlurPlanar<uint8_t, 3>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, float, const int32_t *, uint8_t *const *, BorderType);
+template ::ppl::common::RetCode GaussianBlurPlanar<uint8_t, 4>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, float, const int32_t *, uint8_t *const *, BorderType);
+template ::ppl::common::RetCode GaussianBlurPlanar<uint16_t, 1>(int32_t, int32_t, const int32_t *, const uint16_t *const *, int32_t, float, const int32_t *, uint16_t *const *, BorderType);
+template ::ppl::common::RetCode GaussianBlurPlanar<uint16_t, 3>(int32_t, int32_t, const int32_t *, const uint16_t *const *, int32_t, float, const int32_t *, uint16_t *const *, BorderType);
+template ::ppl::common::RetCode GaussianBlurPlanar<uint16_t, 4>(int32_t, int32_t, const int32_t *, const uint16_t *const *, int32_t, float, const int32_t *, uint16_t *const *, BorderType);
+template ::ppl::common::RetCode GaussianBlurPlanar<float, 1>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, float, const int32_t *, float *const *, BorderType);
+template ::ppl::common::RetCode GaussianBlurPlanar<float, 3>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, float, const int32_t *, float *const *, BorderType);
+template ::ppl::common::RetCode GaussianBlurPlanar<float, 4>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, float, const int32_t *, float *const *, BorderType);
+
+template ::ppl::common::RetCode WarpAffineLinearPlanar<uint8_t, 1>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, int32_t, const int32_t *, uint8_t *const *, const double *, BorderType, uint8_t);
+template ::ppl::common::RetCode WarpAffineLinearPlanar<uint8_t, 3>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, int32_t, const int32_t *, uint8_t *const *, const double *, BorderType, uint8_t);
+template ::ppl::common::RetCode WarpAffineLinearPlanar<uint8_t, 4>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, int32_t, const int32_t *, uint8_t *const *, const double *, BorderType, uint8_t);
+template ::ppl::common::RetCode WarpAffineLinearPlanar<float, 1>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, int32_t, const int32_t *, float *const *, const double *, BorderType, float);
+template ::ppl::common::RetCode WarpAffineLinearPlanar<float, 3>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, int32_t, const int32_t *, float *const *, const double *, BorderType, float);
+template ::ppl::common::RetCode WarpAffineLinearPlanar<float, 4>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, int32_t, const int32_t *, float *const *, const double *, BorderType, float);
+
+template ::ppl::common::RetCode ResizeLinearPlanar<uint8_t, 1>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, int32_t, const int32_t *, uint8_t *const *);
+template ::ppl::common::RetCode ResizeLinearPlanar<uint8_t, 3>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, int32_t, const int32_t *, uint8_t *const *);
+template ::ppl::common::RetCode ResizeLinearPlanar<uint8_t, 4>(int32_t, int32_t, const int32_t *, const uint8_t *const *, int32_t, int32_t, const int32_t *, uint8_t *const *);
+template ::ppl::common::RetCode ResizeLinearPlanar<float, 1>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, int32_t, const int32_t *, float *const *);
+template ::ppl::common::RetCode ResizeLinearPlanar<float, 3>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, int32_t, const int32_t *, float *const *);
+template ::ppl::common::RetCode ResizeLinearPlanar<float, 4>(int32_t, int32_t, const int32_t *, const float *const *, int32_t, int32_t, const int32_t *, float *const *);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/planar.h"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/warpaffine.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/merge.h"
+#include "ppl/cv/x86/split.h"
+#include "ppl/cv/debug.h"
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+enum PlanarBenchOp {
+    PLANAR_BENCH_GAUSSIAN = 0,
+    PLANAR_BENCH_WARP     = 1,
+    PLANAR_BENCH_RESIZE   = 2,
+};
+
+// a 3-plane image through one operation, output as large as the input except for resize, which halves it
+template <typename T>
+void BM_Planar_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t op = state.range(2);
+    int32_t outHeight = op == PLANAR_BENCH_RESIZE ? height / 2 : height;
+    int32_t outWidth = op == PLANAR_BENCH_RESIZE ? width / 2 : width;
+    std::vector<T> src(3 * width * height), dst(3 * width * height);
+    ppl::cv::debug::randomFill<T>(src.data(), src.size(), 0, 255);
+    const T *in[3] = {&src[0], &src[width * height], &src[2 * width * height]};
+    T *out[3] = {&dst[0], &dst[outWidth * outHeight], &dst[2 * outWidth * outHeight]};
+    int32_t inStrides[3] = {width, width, width};
+    int32_t outStrides[3] = {outWidth, outWidth, outWidth};
+    double M[6] = {0.9, 0.1, 10.0, -0.1, 0.9, 20.0};
+    for (auto _ : state) {
+        if (op == PLANAR_BENCH_GAUSSIAN) {
+            ppl::cv::x86::GaussianBlurPlanar<T, 3>(height, width, inStrides, in, 5, 1.2f, outStrides, out);
+        } else if (op == PLANAR_BENCH_WARP) {
+            ppl::cv::x86::WarpAffineLinearPlanar<T, 3>(height, width, inStrides, in, outHeight, outWidth, outStrides, out, M);
+        } else {
+            ppl::cv::x86::ResizeLinearPlanar<T, 3>(height, width, inStrides, in, outHeight, outWidth, outStrides, out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+// the same through Merge3Channels, the interleaved operation and Split3Channels
+template <typename T>
+void BM_PlanarMergeSplit_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t op = state.range(2);
+    int32_t outHeight = op == PLANAR_BENCH_RESIZE ? height / 2 : height;
+    int32_t outWidth = op == PLANAR_BENCH_RESIZE ? width / 2 : width;
+    std::vector<T> src(3 * width * height), dst(3 * width * height), merged(3 * width * height), result(3 * width * height);
+    ppl::cv::debug::randomFill<T>(src.data(), src.size(), 0, 255);
+    double M[6] = {0.9, 0.1, 10.0, -0.1, 0.9, 20.0};
+    for (auto _ : state) {
+        ppl::cv::x86::Merge3Channels<T>(height, width, width, &src[0], &src[width * height], &src[2 * width * height], width * 3, merged.data());
+        if (op == PLANAR_BENCH_GAUSSIAN) {
+            ppl::cv::x86::GaussianBlur<T, 3>(height, width, width * 3, merged.data(), 5, 1.2f, width * 3, result.data());
+        } else if (op == PLANAR_BENCH_WARP) {
+            ppl::cv::x86::WarpAffineLinear<T, 3>(height, width, width * 3, merged.data(), outHeight, outWidth, outWidth * 3, result.data(), M);
+        } else {
+            ppl::cv::x86::ResizeLinear<T, 3>(height, width, width * 3, merged.data(), outHeight, outWidth, outWidth * 3, result.data());
+        }
+        ppl::cv::x86::Split3Channels<T>(outHeight, outWidth, outWidth * 3, result.data(), outWidth, &dst[0], &dst[outWidth * outHeight], &dst[2 * outWidth * outHeight]);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+BENCHMARK_TEMPLATE(BM_Planar_ppl_x86, uint8_t)->Args({640, 480, PLANAR_BENCH_GAUSSIAN})->Args({640, 480, PLANAR_BENCH_WARP})->Args({1920, 1080, PLANAR_BENCH_RESIZE});
+BENCHMARK_TEMPLATE(BM_PlanarMergeSplit_ppl_x86, uint8_t)->Args({640, 480, PLANAR_BENCH_GAUSSIAN})->Args({640, 480, PLANAR_BENCH_WARP})->Args({1920, 1080, PLANAR_BENCH_RESIZE});
+BENCHMARK_TEMPLATE(BM_Planar_ppl_x86, float)->Args({640, 480, PLANAR_BENCH_GAUSSIAN})->Args({640, 480, PLANAR_BENCH_WARP})->Args({1920, 1080, PLANAR_BENCH_RESIZE});
+BENCHMARK_TEMPLATE(BM_PlanarMergeSplit_ppl_x86, float)->Args({640, 480, PLANAR_BENCH_GAUSSIAN})->Args({640, 480, PLANAR_BENCH_WARP})->Args({1920, 1080, PLANAR_BENCH_RESIZE});
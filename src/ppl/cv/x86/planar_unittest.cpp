@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/planar.h"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/test.h"
+#include <opencv2/imgproc.hpp>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+// np planes of height x width, the row stride is padded so that the planes are not contiguous
+template <typename T, int32_t np>
+struct PlanarImage {
+    int32_t stride;
+    std::vector<T> data;
+    const T* in[np];
+    T* out[np];
+    int32_t strides[np];
+
+    PlanarImage(int32_t height, int32_t width)
+        : stride(width + 7)
+        , data((size_t)np * height * stride)
+    {
+        for (int32_t p = 0; p < np; ++p) {
+            in[p]      = data.data() + (size_t)p * height * stride;
+            out[p]     = data.data() + (size_t)p * height * stride;
+            strides[p] = stride;
+        }
+    }
+};
+
+// every plane must be the single-channel result
+template <typename T, int32_t np>
+void GaussianBlurPlanarTest(int32_t height, int32_t width, int32_t kernel_len, float sigma)
+{
+    PlanarImage<T, np> src(height, width), dst(height, width), ref(height, width);
+    ppl::cv::debug::randomFill<T>(src.data.data(), src.data.size(), 0, 255);
+    EXPECT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::GaussianBlurPlanar<T, np>(height, width, src.strides, src.in, kernel_len, sigma, dst.strides, dst.out));
+    for (int32_t p = 0; p < np; ++p) {
+        ppl::cv::x86::GaussianBlur<T, 1>(height, width, src.stride, src.in[p], kernel_len, sigma, ref.stride, ref.out[p]);
+        checkResult<T, 1>(ref.in[p], dst.in[p], height, width, ref.stride, dst.stride, 1e-5);
+    }
+}
+
+template <typename T, int32_t np>
+void ResizeLinearPlanarTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth)
+{
+    PlanarImage<T, np> src(inHeight, inWidth), dst(outHeight, outWidth), ref(outHeight, outWidth);
+    ppl::cv::debug::randomFill<T>(src.data.data(), src.data.size(), 0, 255);
+    EXPECT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::ResizeLinearPlanar<T, np>(inHeight, inWidth, src.strides, src.in, outHeight, outWidth, dst.strides, dst.out));
+    for (int32_t p = 0; p < np; ++p) {
+        ppl::cv::x86::ResizeLinear<T, 1>(inHeight, inWidth, src.stride, src.in[p], outHeight, outWidth, ref.stride, ref.out[p]);
+        checkResult<T, 1>(ref.in[p], dst.in[p], outHeight, outWidth, ref.stride, dst.stride, 1e-3);
+    }
+}
+
+// the matrix maps to quarter pixels, which OpenCV's 1/32 pixel tables represent exactly
+template <typename T, int32_t np, ppl::cv::BorderType border_type>
+void WarpAffineLinearPlanarTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, float diff)
+{
+    double M[6] = {0.75, 0.25, -8.5, -0.25, 1.5, 12.25};
+    PlanarImage<T, np> src(inHeight, inWidth), dst(outHeight, outWidth);
+    ppl::cv::debug::randomFill<T>(src.data.data(), src.data.size(), 0, 255);
+    ppl::cv::debug::randomFill<T>(dst.data.data(), dst.data.size(), 0, 255);
+    EXPECT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::WarpAffineLinearPlanar<T, np>(inHeight, inWidth, src.strides, src.in, outHeight, outWidth, dst.strides, dst.out, M, border_type, 17));
+
+    cv::Mat inv_mat(2, 3, CV_64FC1, M);
+    int32_t cv_border = border_type == ppl::cv::BORDER_TYPE_CONSTANT ? cv::BORDER_CONSTANT : cv::BORDER_REPLICATE;
+    for (int32_t p = 0; p < np; ++p) {
+        cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, 1), (void*)src.in[p], sizeof(T) * src.stride);
+        cv::Mat dst_opencv;
+        cv::warpAffine(src_opencv, dst_opencv, inv_mat, cv::Size(outWidth, outHeight), cv::WARP_INVERSE_MAP | cv::INTER_LINEAR, cv_border, cv::Scalar(17));
+        checkResult<T, 1>((const T*)dst_opencv.data, dst.in[p], outHeight, outWidth, outWidth, dst.stride, diff);
+    }
+}
+
+TEST(GAUSSIANBLUR_PLANAR, x86)
+{
+    GaussianBlurPlanarTest<uint8_t, 3>(480, 640, 5, 1.2f);
+    GaussianBlurPlanarTest<uint8_t, 4>(37, 59, 7, 0.f);
+    GaussianBlurPlanarTest<uint16_t, 3>(480, 640, 3, 1.f);
+    GaussianBlurPlanarTest<float, 1>(240, 320, 5, 1.2f);
+    GaussianBlurPlanarTest<float, 3>(480, 640, 11, 2.f);
+}
+
+TEST(RESIZELINEAR_PLANAR, x86)
+{
+    ResizeLinearPlanarTest<uint8_t, 3>(480, 640, 224, 224);
+    ResizeLinearPlanarTest<uint8_t, 4>(67, 45, 130, 91);
+    ResizeLinearPlanarTest<float, 1>(480, 640, 240, 320);
+    ResizeLinearPlanarTest<float, 3>(1080, 1920, 224, 224);
+}
+
+TEST(WARPAFFINELINEAR_PLANAR, x86)
+{
+    WarpAffineLinearPlanarTest<uint8_t, 3, ppl::cv::BORDER_TYPE_CONSTANT>(123, 157, 99, 211, 1.01f);
+    WarpAffineLinearPlanarTest<uint8_t, 3, ppl::cv::BORDER_TYPE_REPLICATE>(123, 157, 99, 211, 1.01f);
+    WarpAffineLinearPlanarTest<uint8_t, 4, ppl::cv::BORDER_TYPE_CONSTANT>(480, 640, 480, 640, 1.01f);
+    WarpAffineLinearPlanarTest<uint8_t, 1, ppl::cv::BORDER_TYPE_REPLICATE>(480, 640, 480, 640, 1.01f);
+    WarpAffineLinearPlanarTest<float, 3, ppl::cv::BORDER_TYPE_CONSTANT>(123, 157, 99, 211, 1e-3);
+    WarpAffineLinearPlanarTest<float, 3, ppl::cv::BORDER_TYPE_REPLICATE>(480, 640, 480, 640, 1e-3);
+    WarpAffineLinearPlanarTest<float, 4, ppl::cv::BORDER_TYPE_REPLICATE>(64, 80, 33, 37, 1e-3);
+}
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/reduction.h"
+#include "reduction.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+static std::atomic<int32_t> g_reduction_mode(REDUCTION_MODE_FAST);
+
+void SetReductionMode(ReductionMode mode)
+{
+    g_reduction_mode = mode == REDUCTION_MODE_DEFAULT ? REDUCTION_MODE_FAST : mode;
+}
+
+ReductionMode GetReductionMode()
+{
+    return (ReductionMode)g_reduction_mode.load();
+}
+
+ReductionMode reduction_mode(ReductionMode mode)
+{
+    return mode == REDUCTION_MODE_DEFAULT ? GetReductionMode() : mode;
+}
+
+enum ReductionLaneOp {
+    REDUCTION_SUM       = 0,
+    REDUCTION_SUM_SQSUM = 1,
+    REDUCTION_ABS_SUM   = 2,
+    REDUCTION_SQSUM     = 3,
+};
+
+// 12 floats per iteration, widened to 6 vectors of 2 double lanes; the tail goes to the same lanes one by one
+template <ReductionLaneOp op>
+static void reduction_lanes_f32(const float *src, int32_t length, double *sum, double *sqsum)
+{
+    const __m128d v_abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    __m128d v_sum[6], v_sqsum[6];
+    for (int32_t i = 0; i < 6; ++i) {
+        v_sum[i]   = _mm_loadu_pd(sum + 2 * i);
+        v_sqsum[i] = op == REDUCTION_SUM_SQSUM ? _mm_loadu_pd(sqsum + 2 * i) : _mm_setzero_pd();
+    }
+    int32_t j = 0;
+    for (; j <= length - REDUCTION_LANES; j += REDUCTION_LANES) {
+        __m128 v_data[3] = {_mm_loadu_ps(src + j), _mm_loadu_ps(src + j + 4), _mm_loadu_ps(src + j + 8)};
+        for (int32_t k = 0; k < 3; ++k) {
+            __m128d v_lo = _mm_cvtps_pd(v_data[k]);
+            __m128d v_hi = _mm_cvtps_pd(_mm_movehl_ps(v_data[k], v_data[k]));
+            if (op == REDUCTION_SUM) {
+                v_sum[2 * k]     = _mm_add_pd(v_sum[2 * k], v_lo);
+                v_sum[2 * k + 1] = _mm_add_pd(v_sum[2 * k + 1], v_hi);
+            } else if (op == REDUCTION_SUM_SQSUM) {
+                v_sum[2 * k]       = _mm_add_pd(v_sum[2 * k], v_lo);
+                v_sum[2 * k + 1]   = _mm_add_pd(v_sum[2 * k + 1], v_hi);
+                v_sqsum[2 * k]     = _mm_add_pd(v_sqsum[2 * k], _mm_mul_pd(v_lo, v_lo));
+                v_sqsum[2 * k + 1] = _mm_add_pd(v_sqsum[2 * k + 1], _mm_mul_pd(v_hi, v_hi));
+            } else if (op == REDUCTION_ABS_SUM) {
+                v_sum[2 * k]     = _mm_add_pd(v_sum[2 * k], _mm_and_pd(v_lo, v_abs_mask));
+                v_sum[2 * k + 1] = _mm_add_pd(v_sum[2 * k + 1], _mm_and_pd(v_hi, v_abs_mask));
+            } else {
+                v_sum[2 * k]     = _mm_add_pd(v_sum[2 * k], _mm_mul_pd(v_lo, v_lo));
+                v_sum[2 * k + 1] = _mm_add_pd(v_sum[2 * k + 1], _mm_mul_pd(v_hi, v_hi));
+            }
+        }
+    }
+    for (int32_t i = 0; i < 6; ++i) {
+        _mm_storeu_pd(sum + 2 * i, v_sum[i]);
+        if (op == REDUCTION_SUM_SQSUM) {
+            _mm_storeu_pd(sqsum + 2 * i, v_sqsum[i]);
+        }
+    }
+    for (int32_t lane = 0; j < length; ++j, ++lane) {
+        double v = src[j];
+        if (op == REDUCTION_SUM) {
+            sum[lane] += v;
+        } else if (op == REDUCTION_SUM_SQSUM) {
+            sum[lane] += v;
+            sqsum[lane] += v * v;
+        } else if (op == REDUCTION_ABS_SUM) {
+            sum[lane] += std::fabs(v);
+        } else {
+            sum[lane] += v * v;
+        }
+    }
+}
+
+void reduction_sum_f32(const float *src, int32_t length, double *sum)
+{
+    reduction_lanes_f32<REDUCTION_SUM>(src, length, sum, NULL);
+}
+
+void reduction_sum_sqsum_f32(const float *src, int32_t length, double *sum, double *sqsum)
+{
+    reduction_lanes_f32<REDUCTION_SUM_SQSUM>(src, length, sum, sqsum);
+}
+
+void reduction_abs_sum_f32(const float *src, int32_t length, double *sum)
+{
+    reduction_lanes_f32<REDUCTION_ABS_SUM>(src, length, sum, NULL);
+}
+
+void reduction_sqsum_f32(const float *src, int32_t length, double *sqsum)
+{
+    reduction_lanes_f32<REDUCTION_SQSUM>(src, length, sqsum, NULL);
+}
+
+void reduction_lanes_to_channels(const double *lanes, int32_t channels, double *sums)
+{
+    for (int32_t c = 0; c < channels; ++c) {
+        sums[c] = 0;
+    }
+    for (int32_t lane = 0; lane < REDUCTION_LANES; ++lane) {
+        sums[lane % channels] += lanes[lane];
+    }
+}
+
+}
+}
+} // namespace ppl::cv::x86
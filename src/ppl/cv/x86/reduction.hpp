@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_REDUCTION_HPP_
+#define __ST_HPC_PPL_CV_X86_REDUCTION_HPP_
+#include "ppl/cv/x86/reduction.h"
+#include "ppl/cv/x86/util.hpp"
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// lanes of the float row sums, a multiple of 1, 3 and 4 so that lane % channels is the channel of a lane
+#define REDUCTION_LANES 12
+// elements of a block of the reproducible mode
+#define REDUCTION_BLOCK_ELEMENTS (1 << 16)
+
+// the mode of a call, REDUCTION_MODE_DEFAULT replaced by the global one
+ReductionMode reduction_mode(ReductionMode mode);
+
+// Sums of float rows in REDUCTION_LANES double lanes, element j of the row goes to lane j % REDUCTION_LANES.
+// The lanes are in the same order for any instruction set.
+void reduction_sum_f32(const float *src, int32_t length, double *sum);
+void reduction_sum_sqsum_f32(const float *src, int32_t length, double *sum, double *sqsum);
+void reduction_abs_sum_f32(const float *src, int32_t length, double *sum);
+void reduction_sqsum_f32(const float *src, int32_t length, double *sqsum);
+// adds the lanes of every channel in lane order
+void reduction_lanes_to_channels(const double *lanes, int32_t channels, double *sums);
+
+// Reduces rows [0, height) of an image of rowElements elements per row. kernel(rowBegin, rowEnd, partial) adds
+// the rows to partial, a Partial which is zero when constructed and has merge(const Partial &). The fast mode
+// sums one range of rows per thread and merges them in thread order. The reproducible mode sums blocks of
+// REDUCTION_BLOCK_ELEMENTS elements, whose rows do not depend on the thread count, and merges them by a
+// pairwise tree, always the same for the same image shape.
+template <typename Partial, typename Kernel>
+void parallel_reduce(int32_t height, int32_t rowElements, ReductionMode mode, const Kernel &kernel, Partial &result)
+{
+    if (reduction_mode(mode) == REDUCTION_MODE_REPRODUCIBLE) {
+        const int32_t blockRows = std::max(REDUCTION_BLOCK_ELEMENTS / std::max(rowElements, 1), 1);
+        const int32_t numBlocks = (height + blockRows - 1) / blockRows;
+        std::vector<Partial> partials(numBlocks);
+#pragma omp parallel for schedule(dynamic)
+        for (int32_t b = 0; b < numBlocks; ++b) {
+            kernel(b * blockRows, std::min((b + 1) * blockRows, height), partials[b]);
+        }
+        for (int32_t step = 1; step < numBlocks; step *= 2) {
+            for (int32_t b = 0; b + step < numBlocks; b += 2 * step) {
+                partials[b].merge(partials[b + step]);
+            }
+        }
+        result = partials[0];
+        return;
+    }
+    const int32_t numParts = std::max(std::min(get_max_threads(), height), 1);
+    std::vector<Partial> partials(numParts);
+#pragma omp parallel for schedule(static)
+    for (int32_t t = 0; t < numParts; ++t) {
+        kernel((int64_t)height * t / numParts, (int64_t)height * (t + 1) / numParts, partials[t]);
+    }
+    for (int32_t t = 1; t < numParts; ++t) {
+        partials[0].merge(partials[t]);
+    }
+    result = partials[0];
+}
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_REDUCTION_HPP_
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/reduction.h"
+#include "ppl/cv/x86/mean.h"
+#include "ppl/cv/x86/meanstddev.h"
+#include "ppl/cv/x86/norm.h"
+#include "ppl/cv/debug.h"
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+enum ReductionBenchOp {
+    REDUCTION_BENCH_MEAN       = 0,
+    REDUCTION_BENCH_MEANSTDDEV = 1,
+    REDUCTION_BENCH_NORM_L2    = 2,
+};
+
+// a float image through one reduction in the given mode
+template <int32_t nc>
+void BM_Reduction_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t op = state.range(2);
+    ppl::cv::x86::ReductionMode mode = (ppl::cv::x86::ReductionMode)state.range(3);
+    std::vector<float> src(width * height * nc);
+    ppl::cv::debug::randomFill<float>(src.data(), src.size(), 0, 255);
+    float mean[4], stddev[4];
+    for (auto _ : state) {
+        if (op == REDUCTION_BENCH_MEAN) {
+            ppl::cv::x86::Mean<float, nc>(height, width, width * nc, src.data(), mean, 0, NULL, mode);
+        } else if (op == REDUCTION_BENCH_MEANSTDDEV) {
+            ppl::cv::x86::MeanStdDev<float, nc>(height, width, width * nc, src.data(), mean, stddev, 0, NULL, mode);
+        } else {
+            benchmark::DoNotOptimize(ppl::cv::x86::Norm<float, nc>(height, width, width * nc, src.data(), ppl::cv::NORM_L2, 0, NULL, mode));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+    state.SetBytesProcessed(state.iterations() * width * height * nc * sizeof(float));
+}
+}
+
+using namespace ppl::cv::debug;
+using ppl::cv::x86::REDUCTION_MODE_FAST;
+using ppl::cv::x86::REDUCTION_MODE_REPRODUCIBLE;
+
+BENCHMARK_TEMPLATE(BM_Reduction_ppl_x86, c1)->Args({1920, 1080, REDUCTION_BENCH_MEAN, REDUCTION_MODE_FAST})->Args({1920, 1080, REDUCTION_BENCH_MEAN, REDUCTION_MODE_REPRODUCIBLE});
+BENCHMARK_TEMPLATE(BM_Reduction_ppl_x86, c3)->Args({1920, 1080, REDUCTION_BENCH_MEAN, REDUCTION_MODE_FAST})->Args({1920, 1080, REDUCTION_BENCH_MEAN, REDUCTION_MODE_REPRODUCIBLE});
+BENCHMARK_TEMPLATE(BM_Reduction_ppl_x86, c3)->Args({1920, 1080, REDUCTION_BENCH_MEANSTDDEV, REDUCTION_MODE_FAST})->Args({1920, 1080, REDUCTION_BENCH_MEANSTDDEV, REDUCTION_MODE_REPRODUCIBLE});
+BENCHMARK_TEMPLATE(BM_Reduction_ppl_x86, c1)->Args({1920, 1080, REDUCTION_BENCH_NORM_L2, REDUCTION_MODE_FAST})->Args({1920, 1080, REDUCTION_BENCH_NORM_L2, REDUCTION_MODE_REPRODUCIBLE});
+BENCHMARK_TEMPLATE(BM_Reduction_ppl_x86, c4)->Args({640, 480, REDUCTION_BENCH_NORM_L2, REDUCTION_MODE_FAST})->Args({640, 480, REDUCTION_BENCH_NORM_L2, REDUCTION_MODE_REPRODUCIBLE});
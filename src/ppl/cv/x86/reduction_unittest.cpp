@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/reduction.h"
+#include "ppl/cv/x86/mean.h"
+#include "ppl/cv/x86/meanstddev.h"
+#include "ppl/cv/x86/norm.h"
+#include "ppl/cv/x86/integral.h"
+#include "ppl/cv/x86/test.h"
+#include <string.h>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static void setThreads(int32_t threads)
+{
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#endif
+}
+
+struct ReductionResults {
+    float mean[4];
+    float meanStd[4];
+    float stddev[4];
+    double l1;
+    double l2;
+    std::vector<float> integral;
+};
+
+template <int32_t nc>
+static void computeReductions(int32_t height, int32_t width, const float* src, const uint8_t* mask, ppl::cv::x86::ReductionMode mode, ReductionResults& out)
+{
+    ppl::cv::x86::Mean<float, nc>(height, width, width * nc, src, out.mean, width, (uint8_t*)mask, mode);
+    ppl::cv::x86::MeanStdDev<float, nc>(height, width, width * nc, src, out.meanStd, out.stddev, width, mask, mode);
+    out.l1 = ppl::cv::x86::Norm<float, nc>(height, width, width * nc, src, ppl::cv::NORM_L1, width, mask, mode);
+    out.l2 = ppl::cv::x86::Norm<float, nc>(height, width, width * nc, src, ppl::cv::NORM_L2, width, mask, mode);
+    out.integral.resize((size_t)(height + 1) * (width + 1) * nc);
+    ppl::cv::x86::Integral<float, float, nc>(height, width, width * nc, src, height + 1, width + 1, (width + 1) * nc, out.integral.data());
+}
+
+// the reproducible mode must give the same bits for every thread count, the fast mode stays close to it
+template <int32_t nc>
+void ReproducibleTest(int32_t height, int32_t width, bool useMask)
+{
+    std::vector<float> src((size_t)height * width * nc);
+    std::vector<uint8_t> mask((size_t)height * width);
+    ppl::cv::debug::randomFill<float>(src.data(), src.size(), -1000, 1000);
+    for (size_t i = 0; i < mask.size(); ++i) {
+        mask[i] = std::rand() % 2;
+    }
+    const uint8_t* maskData = useMask ? mask.data() : nullptr;
+
+    ReductionResults base, fast, results;
+    setThreads(1);
+    computeReductions<nc>(height, width, src.data(), maskData, ppl::cv::x86::REDUCTION_MODE_REPRODUCIBLE, base);
+    const int32_t threads[] = {2, 3, 7};
+    for (int32_t t : threads) {
+        setThreads(t);
+        computeReductions<nc>(height, width, src.data(), maskData, ppl::cv::x86::REDUCTION_MODE_REPRODUCIBLE, results);
+        EXPECT_EQ(0, memcmp(base.mean, results.mean, sizeof(float) * nc));
+        EXPECT_EQ(0, memcmp(base.meanStd, results.meanStd, sizeof(float) * nc));
+        EXPECT_EQ(0, memcmp(base.stddev, results.stddev, sizeof(float) * nc));
+        EXPECT_EQ(base.l1, results.l1);
+        EXPECT_EQ(base.l2, results.l2);
+        EXPECT_EQ(0, memcmp(base.integral.data(), results.integral.data(), sizeof(float) * base.integral.size()));
+
+        computeReductions<nc>(height, width, src.data(), maskData, ppl::cv::x86::REDUCTION_MODE_FAST, fast);
+        for (int32_t c = 0; c < nc; ++c) {
+            EXPECT_NEAR(base.mean[c], fast.mean[c], 1e-3);
+            EXPECT_NEAR(base.stddev[c], fast.stddev[c], 1e-3);
+        }
+        EXPECT_NEAR(base.l1, fast.l1, 1e-9 * base.l1);
+        EXPECT_NEAR(base.l2, fast.l2, 1e-9 * base.l2);
+    }
+    setThreads(1);
+}
+
+TEST(REDUCTION_REPRODUCIBLE, x86)
+{
+    ReproducibleTest<1>(480, 640, false);
+    ReproducibleTest<1>(1080, 1920, true);
+    ReproducibleTest<3>(480, 640, false);
+    ReproducibleTest<3>(37, 53, true);
+    ReproducibleTest<4>(720, 1280, false);
+    ReproducibleTest<4>(333, 1, true);
+}
+
+// REDUCTION_MODE_DEFAULT follows the global mode
+TEST(REDUCTION_GLOBAL_MODE, x86)
+{
+    EXPECT_EQ(ppl::cv::x86::REDUCTION_MODE_FAST, ppl::cv::x86::GetReductionMode());
+    const int32_t height = 720, width = 1280;
+    std::vector<float> src((size_t)height * width);
+    ppl::cv::debug::randomFill<float>(src.data(), src.size(), -1000, 1000);
+
+    ppl::cv::x86::SetReductionMode(ppl::cv::x86::REDUCTION_MODE_REPRODUCIBLE);
+    EXPECT_EQ(ppl::cv::x86::REDUCTION_MODE_REPRODUCIBLE, ppl::cv::x86::GetReductionMode());
+    double global = ppl::cv::x86::Norm<float, 1>(height, width, width, src.data(), ppl::cv::NORM_L2);
+    double call   = ppl::cv::x86::Norm<float, 1>(height, width, width, src.data(), ppl::cv::NORM_L2, 0, NULL, ppl::cv::x86::REDUCTION_MODE_REPRODUCIBLE);
+    EXPECT_EQ(call, global);
+
+    ppl::cv::x86::SetReductionMode(ppl::cv::x86::REDUCTION_MODE_DEFAULT);
+    EXPECT_EQ(ppl::cv::x86::REDUCTION_MODE_FAST, ppl::cv::x86::GetReductionMode());
+}
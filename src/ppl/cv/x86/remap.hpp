@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_REMAP_HPP_
+#define __ST_HPC_PPL_CV_X86_REMAP_HPP_
+#include <algorithm>
+#include <cmath>
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// per-pixel samplers shared by remap and the warps that compute their coordinates on the fly
+
+template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
+inline void remap_nearest_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* src,
+    float x,
+    float y,
+    T* dst,
+    T delta)
+{
+    int32_t sy = static_cast<int32_t>(std::round(y));
+    int32_t sx = static_cast<int32_t>(std::round(x));
+    if (borderMode == ppl::cv::BORDER_TYPE_CONSTANT) {
+        if (sx >= 0 && sx < inWidth && sy >= 0 && sy < inHeight) {
+            const T* p = src + sy * inWidthStride + sx * nc;
+            for (int32_t i = 0; i < nc; i++) {
+                dst[i] = p[i];
+            }
+        } else {
+            for (int32_t i = 0; i < nc; i++) {
+                dst[i] = delta;
+            }
+        }
+    } else if (borderMode == ppl::cv::BORDER_TYPE_REPLICATE) {
+        sx         = std::min(std::max(sx, 0), inWidth - 1);
+        sy         = std::min(std::max(sy, 0), inHeight - 1);
+        const T* p = src + sy * inWidthStride + sx * nc;
+        for (int32_t i = 0; i < nc; i++) {
+            dst[i] = p[i];
+        }
+    } else if (borderMode == ppl::cv::BORDER_TYPE_TRANSPARENT) {
+        if (sx >= 0 && sx < inWidth && sy >= 0 && sy < inHeight) {
+            const T* p = src + sy * inWidthStride + sx * nc;
+            for (int32_t i = 0; i < nc; i++) {
+                dst[i] = p[i];
+            }
+        }
+    }
+}
+
+template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
+void remap_linear_border_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* src,
+    int32_t sx0,
+    int32_t sy0,
+    const float* tab,
+    T* dst,
+    T delta)
+{
+    if (borderMode == ppl::cv::BORDER_TYPE_CONSTANT || borderMode == ppl::cv::BORDER_TYPE_TRANSPARENT) {
+        bool flag0 = (sx0 >= 0 && sx0 < inWidth && sy0 >= 0 && sy0 < inHeight);
+        bool flag1 = (sx0 + 1 >= 0 && sx0 + 1 < inWidth && sy0 >= 0 && sy0 < inHeight);
+        bool flag2 = (sx0 >= 0 && sx0 < inWidth && sy0 + 1 >= 0 && sy0 + 1 < inHeight);
+        bool flag3 = (sx0 + 1 >= 0 && sx0 + 1 < inWidth && sy0 + 1 >= 0 && sy0 + 1 < inHeight);
+        if (borderMode == ppl::cv::BORDER_TYPE_TRANSPARENT && !(flag0 && flag1 && flag2 && flag3)) {
+            return;
+        }
+        const T* p0 = src + sy0 * inWidthStride + sx0 * nc;
+        const T* p1 = p0 + inWidthStride;
+        for (int32_t k = 0; k < nc; k++) {
+            float v0 = flag0 ? p0[k] : delta;
+            float v1 = flag1 ? p0[nc + k] : delta;
+            float v2 = flag2 ? p1[k] : delta;
+            float v3 = flag3 ? p1[nc + k] : delta;
+            dst[k]   = static_cast<T>(v0 * tab[0] + v1 * tab[1] + v2 * tab[2] + v3 * tab[3]);
+        }
+    } else if (borderMode == ppl::cv::BORDER_TYPE_REPLICATE) {
+        int32_t sx1 = std::min(std::max(sx0 + 1, 0), inWidth - 1);
+        int32_t sy1 = std::min(std::max(sy0 + 1, 0), inHeight - 1);
+        sx0         = std::min(std::max(sx0, 0), inWidth - 1);
+        sy0         = std::min(std::max(sy0, 0), inHeight - 1);
+        const T* t0 = src + sy0 * inWidthStride + sx0 * nc;
+        const T* t1 = src + sy0 * inWidthStride + sx1 * nc;
+        const T* t2 = src + sy1 * inWidthStride + sx0 * nc;
+        const T* t3 = src + sy1 * inWidthStride + sx1 * nc;
+        for (int32_t k = 0; k < nc; ++k) {
+            dst[k] = static_cast<T>(t0[k] * tab[0] + t1[k] * tab[1] + t2[k] * tab[2] + t3[k] * tab[3]);
+        }
+    }
+}
+
+// the pixels whose four neighbours are inside the image take the short path, the others go to the border handler
+template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
+inline void remap_linear_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* src,
+    float x,
+    float y,
+    T* dst,
+    T delta)
+{
+    int32_t sx0 = static_cast<int32_t>(std::floor(x));
+    int32_t sy0 = static_cast<int32_t>(std::floor(y));
+    float u     = x - sx0;
+    float v     = y - sy0;
+
+    float tab[4];
+    tab[0] = (1.0f - v) * (1.0f - u);
+    tab[1] = (1.0f - v) * u;
+    tab[2] = v * (1.0f - u);
+    tab[3] = v * u;
+
+    if ((uint32_t)sx0 < (uint32_t)(inWidth - 1) && (uint32_t)sy0 < (uint32_t)(inHeight - 1)) {
+        const T* p0 = src + sy0 * inWidthStride + sx0 * nc;
+        const T* p1 = p0 + inWidthStride;
+        for (int32_t k = 0; k < nc; k++) {
+            dst[k] = static_cast<T>(p0[k] * tab[0] + p0[nc + k] * tab[1] + p1[k] * tab[2] + p1[nc + k] * tab[3]);
+        }
+    } else {
+        remap_linear_border_pixel<T, nc, borderMode>(inHeight, inWidth, inWidthStride, src, sx0, sy0, tab, dst, delta);
+    }
+}
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_REMAP_HPP_
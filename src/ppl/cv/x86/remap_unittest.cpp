@@ -24,7 +24,7 @@
 #include "ppl/cv/debug.h"
 
 template <typename T, int nc, ppl::cv::BorderType border_type, bool inter_linear>
-void RemapTest(int inHeight, int inWidth, int outHeight, int outWidth, T diff)
+void RemapTest(int inHeight, int inWidth, int outHeight, int outWidth, float diff)
 {
     std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
     std::unique_ptr<T[]> dst_ref(new T[inWidth * inHeight * nc]);
@@ -66,7 +66,7 @@ void RemapTest(int inHeight, int inWidth, int outHeight, int outWidth, T diff)
             cv::remap(srcMat, dstMat, xMat, yMat, cv::INTER_NEAREST, cv::BORDER_TRANSPARENT);
         }
     }
-    checkResult<T, nc>(dst.get(), dst_ref.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, 1.01f);
+    checkResult<T, nc>(dst.get(), dst_ref.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
 }
 
 TEST(REMAP_UINT8_LINEAR, x86)
@@ -84,6 +84,22 @@ TEST(REMAP_UINT8_LINEAR, x86)
     RemapTest<uint8_t, 4, ppl::cv::BORDER_TYPE_TRANSPARENT, true>(480, 640, 480, 640, 1.01f);
 }
 
+// OpenCV interpolates 16-bit data at 1/32 pixel, which moves results by a few levels
+TEST(REMAP_UINT16_LINEAR, x86)
+{
+    RemapTest<uint16_t, 1, ppl::cv::BORDER_TYPE_CONSTANT, true>(480, 640, 480, 640, 8.01f);
+    RemapTest<uint16_t, 3, ppl::cv::BORDER_TYPE_CONSTANT, true>(480, 640, 480, 640, 8.01f);
+    RemapTest<uint16_t, 4, ppl::cv::BORDER_TYPE_CONSTANT, true>(480, 640, 480, 640, 8.01f);
+
+    RemapTest<uint16_t, 1, ppl::cv::BORDER_TYPE_REPLICATE, true>(480, 640, 480, 640, 8.01f);
+    RemapTest<uint16_t, 3, ppl::cv::BORDER_TYPE_REPLICATE, true>(480, 640, 480, 640, 8.01f);
+    RemapTest<uint16_t, 4, ppl::cv::BORDER_TYPE_REPLICATE, true>(480, 640, 480, 640, 8.01f);
+
+    RemapTest<uint16_t, 1, ppl::cv::BORDER_TYPE_TRANSPARENT, true>(480, 640, 480, 640, 8.01f);
+    RemapTest<uint16_t, 3, ppl::cv::BORDER_TYPE_TRANSPARENT, true>(480, 640, 480, 640, 8.01f);
+    RemapTest<uint16_t, 4, ppl::cv::BORDER_TYPE_TRANSPARENT, true>(480, 640, 480, 640, 8.01f);
+}
+
 TEST(REMAP_FP32_LINEAR, x86)
 {
     RemapTest<float, 1, ppl::cv::BORDER_TYPE_CONSTANT, true>(480, 640, 480, 640, 1.01f);
@@ -114,6 +130,21 @@ TEST(REMAP_UINT8_NEAREST, x86)
     RemapTest<uint8_t, 4, ppl::cv::BORDER_TYPE_TRANSPARENT, false>(48, 64, 48, 64, 1.01f);
 }
 
+TEST(REMAP_UINT16_NEAREST, x86)
+{
+    RemapTest<uint16_t, 1, ppl::cv::BORDER_TYPE_CONSTANT, false>(48, 64, 48, 64, 1.01f);
+    RemapTest<uint16_t, 3, ppl::cv::BORDER_TYPE_CONSTANT, false>(48, 64, 48, 64, 1.01f);
+    RemapTest<uint16_t, 4, ppl::cv::BORDER_TYPE_CONSTANT, false>(48, 64, 48, 64, 1.01f);
+
+    RemapTest<uint16_t, 1, ppl::cv::BORDER_TYPE_REPLICATE, false>(48, 64, 48, 64, 1.01f);
+    RemapTest<uint16_t, 3, ppl::cv::BORDER_TYPE_REPLICATE, false>(48, 64, 48, 64, 1.01f);
+    RemapTest<uint16_t, 4, ppl::cv::BORDER_TYPE_REPLICATE, false>(48, 64, 48, 64, 1.01f);
+
+    RemapTest<uint16_t, 1, ppl::cv::BORDER_TYPE_TRANSPARENT, false>(48, 64, 48, 64, 1.01f);
+    RemapTest<uint16_t, 3, ppl::cv::BORDER_TYPE_TRANSPARENT, false>(48, 64, 48, 64, 1.01f);
+    RemapTest<uint16_t, 4, ppl::cv::BORDER_TYPE_TRANSPARENT, false>(48, 64, 48, 64, 1.01f);
+}
+
 TEST(REMAP_FP32_NEAREST, x86)
 {
     RemapTest<float, 1, ppl::cv::BORDER_TYPE_CONSTANT, false>(48, 64, 48, 64, 1.01f);
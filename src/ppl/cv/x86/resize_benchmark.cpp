@@ -132,9 +132,44 @@ BENCHMARK_TEMPLATE(BM_Resize_ppl_x86, uint8_t, c3, INTERPOLATION_TYPE_LINEAR)->A
 BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c3, INTERPOLATION_TYPE_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
 BENCHMARK_TEMPLATE(BM_Resize_ppl_x86, uint8_t, c4, INTERPOLATION_TYPE_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
 BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c4, INTERPOLATION_TYPE_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_ppl_x86, uint8_t, c1, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c1, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_ppl_x86, uint8_t, c3, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c3, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_ppl_x86, uint8_t, c4, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c4, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_ppl_x86, uint8_t, c1, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({640, 480, 2560, 1920})->Args({2560, 1920, 640, 480});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c1, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({640, 480, 2560, 1920})->Args({2560, 1920, 640, 480});
+BENCHMARK_TEMPLATE(BM_Resize_ppl_x86, uint8_t, c3, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({640, 480, 2560, 1920})->Args({2560, 1920, 640, 480});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c3, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({640, 480, 2560, 1920})->Args({2560, 1920, 640, 480});
+BENCHMARK_TEMPLATE(BM_Resize_ppl_x86, uint8_t, c4, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({640, 480, 2560, 1920})->Args({2560, 1920, 640, 480});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c4, INTERPOLATION_TYPE_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({640, 480, 2560, 1920})->Args({2560, 1920, 640, 480});
+
+template<typename T, int32_t channels, ppl::cv::x86::ResizeFilterType filter>
+static void BM_ResizeFiltered_ppl_x86(benchmark::State &state) {
+    ResizeBenchmark<T, channels, ppl::cv::INTERPOLATION_TYPE_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    ppl::cv::x86::ResizeFilterPlan plan(bm.inHeight, bm.inWidth, bm.outHeight, bm.outWidth, filter);
+    for (auto _: state) {
+        plan.Apply<T, channels>(bm.inWidth * channels, bm.dev_iImage, bm.outWidth * channels, bm.dev_oImage);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename T, int32_t channels, int32_t interpolation>
+static void BM_ResizeFiltered_opencv_x86(benchmark::State &state) {
+    ResizeBenchmark<T, channels, ppl::cv::INTERPOLATION_TYPE_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    cv::Mat src_opencv(bm.inHeight, bm.inWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), bm.dev_iImage);
+    cv::Mat dst_opencv(bm.outHeight, bm.outWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), bm.dev_oImage);
+    for (auto _: state) {
+        cv::resize(src_opencv, dst_opencv, cv::Size(bm.outWidth, bm.outHeight), 0, 0, interpolation);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+using ppl::cv::x86::RESIZE_FILTER_TRIANGLE;
+using ppl::cv::x86::RESIZE_FILTER_MITCHELL;
+using ppl::cv::x86::RESIZE_FILTER_LANCZOS4;
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_ppl_x86, uint8_t, c1, RESIZE_FILTER_TRIANGLE)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_ppl_x86, uint8_t, c3, RESIZE_FILTER_TRIANGLE)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_ppl_x86, uint8_t, c3, RESIZE_FILTER_MITCHELL)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_ppl_x86, uint8_t, c3, RESIZE_FILTER_LANCZOS4)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_ppl_x86, uint8_t, c4, RESIZE_FILTER_LANCZOS4)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_opencv_x86, uint8_t, c3, cv::INTER_AREA)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_opencv_x86, uint8_t, c3, cv::INTER_LANCZOS4)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_ppl_x86, float, c1, RESIZE_FILTER_LANCZOS4)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_ppl_x86, float, c3, RESIZE_FILTER_LANCZOS4)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeFiltered_opencv_x86, float, c3, cv::INTER_AREA)->Args({3840, 2160, 256, 144})->Args({1280, 720, 640, 360});
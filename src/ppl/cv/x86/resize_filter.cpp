@@ -0,0 +1,547 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define CV_PI 3.1415926535897932384626433832795
+
+#define RESIZE_FILTER_COEF_BITS 14
+#define RESIZE_FILTER_COEF_ONE  (1 << RESIZE_FILTER_COEF_BITS)
+#define RESIZE_FILTER_TAP_ALIGN 8
+#define RESIZE_FILTER_BAND_ROWS 16
+
+// weights of one axis, the window of output i starts at start[i] and has count[i] taps, its weights are
+// stored at i * ksize and zero-padded up to ksize so that single channel rows can be filtered in whole vectors
+struct ResizeFilterAxis {
+    int32_t ksize;
+    std::vector<int32_t> start;
+    std::vector<int32_t> count;
+    std::vector<float> fweights;
+    std::vector<int16_t> iweights;
+};
+
+struct ResizeFilterTables {
+    ResizeFilterAxis horizontal;
+    ResizeFilterAxis vertical;
+};
+
+static double sinc(double x)
+{
+    if (x == 0.0) {
+        return 1.0;
+    }
+    x *= CV_PI;
+    return std::sin(x) / x;
+}
+
+static double filterSupport(ResizeFilterType filter)
+{
+    switch (filter) {
+        case RESIZE_FILTER_TRIANGLE:
+            return 1.0;
+        case RESIZE_FILTER_MITCHELL:
+            return 2.0;
+        default:
+            return 4.0;
+    }
+}
+
+static double filterValue(ResizeFilterType filter, double x)
+{
+    x = std::fabs(x);
+    switch (filter) {
+        case RESIZE_FILTER_TRIANGLE:
+            return x < 1.0 ? 1.0 - x : 0.0;
+        case RESIZE_FILTER_MITCHELL: {
+            const double B = 1.0 / 3.0, C = 1.0 / 3.0;
+            if (x < 1.0) {
+                return ((12.0 - 9.0 * B - 6.0 * C) * x * x * x + (-18.0 + 12.0 * B + 6.0 * C) * x * x + (6.0 - 2.0 * B)) / 6.0;
+            }
+            if (x < 2.0) {
+                return ((-B - 6.0 * C) * x * x * x + (6.0 * B + 30.0 * C) * x * x + (-12.0 * B - 48.0 * C) * x + (8.0 * B + 24.0 * C)) / 6.0;
+            }
+            return 0.0;
+        }
+        default:
+            return x < 4.0 ? sinc(x) * sinc(x * 0.25) : 0.0;
+    }
+}
+
+// the filter is stretched by the scale factor when shrinking so that it covers the footprint of the output
+// pixel, taps falling outside of the image are dropped and the remaining weights renormalized
+static void buildAxis(int32_t inSize, int32_t outSize, ResizeFilterType filter, ResizeFilterAxis &axis)
+{
+    const double scale       = (double)inSize / outSize;
+    const double filterScale = std::max(scale, 1.0);
+    const double support     = filterSupport(filter) * filterScale;
+
+    std::vector<double> w;
+    axis.start.resize(outSize);
+    axis.count.resize(outSize);
+    int32_t maxCount = 0;
+    for (int32_t i = 0; i < outSize; ++i) {
+        const double center = (i + 0.5) * scale;
+        int32_t xmin        = std::max((int32_t)std::floor(center - support + 0.5), 0);
+        int32_t xmax        = std::min((int32_t)std::floor(center + support + 0.5), inSize);
+        if (xmax <= xmin) {
+            xmin = std::min(std::max((int32_t)center, 0), inSize - 1);
+            xmax = xmin + 1;
+        }
+        axis.start[i] = xmin;
+        axis.count[i] = xmax - xmin;
+        maxCount      = std::max(maxCount, xmax - xmin);
+    }
+    axis.ksize = (maxCount + RESIZE_FILTER_TAP_ALIGN - 1) / RESIZE_FILTER_TAP_ALIGN * RESIZE_FILTER_TAP_ALIGN;
+    axis.fweights.assign((size_t)outSize * axis.ksize, 0.f);
+    axis.iweights.assign((size_t)outSize * axis.ksize, 0);
+
+    w.resize(maxCount);
+    for (int32_t i = 0; i < outSize; ++i) {
+        const double center = (i + 0.5) * scale;
+        const int32_t n     = axis.count[i];
+        double sum          = 0.0;
+        for (int32_t k = 0; k < n; ++k) {
+            w[k] = filterValue(filter, (axis.start[i] + k - center + 0.5) / filterScale);
+            sum += w[k];
+        }
+        if (sum == 0.0) {
+            for (int32_t k = 0; k < n; ++k) {
+                w[k] = 1.0 / n;
+            }
+            sum = 1.0;
+        }
+
+        float *fw   = &axis.fweights[(size_t)i * axis.ksize];
+        int16_t *iw = &axis.iweights[(size_t)i * axis.ksize];
+        int32_t isum = 0, kmax = 0;
+        for (int32_t k = 0; k < n; ++k) {
+            w[k] /= sum;
+            fw[k] = (float)w[k];
+            iw[k] = (int16_t)std::lrint(w[k] * RESIZE_FILTER_COEF_ONE);
+            isum += iw[k];
+            if (w[k] > w[kmax]) {
+                kmax = k;
+            }
+        }
+        // the fixed-point weights sum to exactly one, flat areas are reproduced without drift
+        iw[kmax] += RESIZE_FILTER_COEF_ONE - isum;
+    }
+}
+
+static inline uint8_t saturate_u8(int32_t v)
+{
+    return (uint8_t)std::min(std::max(v, 0), 255);
+}
+
+static inline int32_t descale(int32_t v)
+{
+    return (v + (1 << (RESIZE_FILTER_COEF_BITS - 1))) >> RESIZE_FILTER_COEF_BITS;
+}
+
+static inline __m128i descale_epi32(__m128i v)
+{
+    return _mm_srai_epi32(_mm_add_epi32(v, _mm_set1_epi32(1 << (RESIZE_FILTER_COEF_BITS - 1))), RESIZE_FILTER_COEF_BITS);
+}
+
+static inline int32_t load_pair(const int16_t *w)
+{
+    int32_t v;
+    memcpy(&v, w, sizeof(v));
+    return v;
+}
+
+// single channel rows, four outputs at a time, eight taps per madd
+static void horizontal_u8_c1(const uint8_t *src, int32_t outWidth, const ResizeFilterAxis &axis, uint8_t *dst)
+{
+    const int32_t ksize = axis.ksize;
+    const int32_t *xs   = &axis.start[0];
+    const int16_t *wt   = &axis.iweights[0];
+    int32_t i           = 0;
+    for (; i <= outWidth - 4; i += 4) {
+        const uint8_t *s0 = src + xs[i], *s1 = src + xs[i + 1], *s2 = src + xs[i + 2], *s3 = src + xs[i + 3];
+        const int16_t *w0 = wt + (size_t)i * ksize;
+        __m128i a0 = _mm_setzero_si128(), a1 = a0, a2 = a0, a3 = a0;
+        for (int32_t k = 0; k < ksize; k += 8) {
+            a0 = _mm_add_epi32(a0, _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(s0 + k))), _mm_loadu_si128((const __m128i *)(w0 + k))));
+            a1 = _mm_add_epi32(a1, _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(s1 + k))), _mm_loadu_si128((const __m128i *)(w0 + ksize + k))));
+            a2 = _mm_add_epi32(a2, _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(s2 + k))), _mm_loadu_si128((const __m128i *)(w0 + 2 * ksize + k))));
+            a3 = _mm_add_epi32(a3, _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(s3 + k))), _mm_loadu_si128((const __m128i *)(w0 + 3 * ksize + k))));
+        }
+        __m128i v = descale_epi32(_mm_hadd_epi32(_mm_hadd_epi32(a0, a1), _mm_hadd_epi32(a2, a3)));
+        v         = _mm_packus_epi16(_mm_packs_epi32(v, v), v);
+        int32_t packed = _mm_cvtsi128_si32(v);
+        memcpy(dst + i, &packed, sizeof(packed));
+    }
+    for (; i < outWidth; ++i) {
+        const uint8_t *s  = src + xs[i];
+        const int16_t *w0 = wt + (size_t)i * ksize;
+        int32_t sum       = 0;
+        for (int32_t k = 0; k < axis.count[i]; ++k) {
+            sum += s[k] * w0[k];
+        }
+        dst[i] = saturate_u8(descale(sum));
+    }
+}
+
+// interleaved rows, two taps of every channel per madd, the pixels are spread as (tap0, tap1) pairs
+template<int32_t nc>
+static void horizontal_u8_cn(const uint8_t *src, int32_t outWidth, const ResizeFilterAxis &axis, uint8_t *dst)
+{
+    const __m128i shuffle = nc == 4 ? _mm_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, -1, -1, -1, -1, -1, -1, -1, -1)
+                                    : _mm_setr_epi8(0, 3, 1, 4, 2, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const int32_t ksize = axis.ksize;
+    for (int32_t i = 0; i < outWidth; ++i) {
+        const uint8_t *s  = src + axis.start[i] * nc;
+        const int16_t *w0 = &axis.iweights[(size_t)i * ksize];
+        const int32_t n   = axis.count[i];
+        __m128i acc       = _mm_setzero_si128();
+        for (int32_t k = 0; k < n; k += 2) {
+            __m128i px = _mm_cvtepu8_epi16(_mm_shuffle_epi8(_mm_loadl_epi64((const __m128i *)(s + k * nc)), shuffle));
+            acc        = _mm_add_epi32(acc, _mm_madd_epi16(px, _mm_set1_epi32(load_pair(w0 + k))));
+        }
+        __m128i v = descale_epi32(acc);
+        v         = _mm_packus_epi16(_mm_packs_epi32(v, v), v);
+        int32_t packed = _mm_cvtsi128_si32(v);
+        // the destination rows are padded, the fourth byte of a 3-channel pixel is overwritten by the next one
+        memcpy(dst + i * nc, &packed, sizeof(packed));
+    }
+}
+
+static void horizontal_f32_c1(const float *src, int32_t outWidth, const ResizeFilterAxis &axis, float *dst)
+{
+    const int32_t ksize = axis.ksize;
+    const int32_t *xs   = &axis.start[0];
+    const float *wt     = &axis.fweights[0];
+    int32_t i           = 0;
+    for (; i <= outWidth - 4; i += 4) {
+        const float *s0 = src + xs[i], *s1 = src + xs[i + 1], *s2 = src + xs[i + 2], *s3 = src + xs[i + 3];
+        const float *w0 = wt + (size_t)i * ksize;
+        __m128 a0 = _mm_setzero_ps(), a1 = a0, a2 = a0, a3 = a0;
+        for (int32_t k = 0; k < ksize; k += 4) {
+            a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(s0 + k), _mm_loadu_ps(w0 + k)));
+            a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_loadu_ps(s1 + k), _mm_loadu_ps(w0 + ksize + k)));
+            a2 = _mm_add_ps(a2, _mm_mul_ps(_mm_loadu_ps(s2 + k), _mm_loadu_ps(w0 + 2 * ksize + k)));
+            a3 = _mm_add_ps(a3, _mm_mul_ps(_mm_loadu_ps(s3 + k), _mm_loadu_ps(w0 + 3 * ksize + k)));
+        }
+        _mm_storeu_ps(dst + i, _mm_hadd_ps(_mm_hadd_ps(a0, a1), _mm_hadd_ps(a2, a3)));
+    }
+    for (; i < outWidth; ++i) {
+        const float *s  = src + xs[i];
+        const float *w0 = wt + (size_t)i * ksize;
+        float sum       = 0.f;
+        for (int32_t k = 0; k < axis.count[i]; ++k) {
+            sum += s[k] * w0[k];
+        }
+        dst[i] = sum;
+    }
+}
+
+template<int32_t nc>
+static void horizontal_f32_cn(const float *src, int32_t outWidth, const ResizeFilterAxis &axis, float *dst)
+{
+    const int32_t ksize = axis.ksize;
+    for (int32_t i = 0; i < outWidth; ++i) {
+        const float *s  = src + axis.start[i] * nc;
+        const float *w0 = &axis.fweights[(size_t)i * ksize];
+        const int32_t n = axis.count[i];
+        __m128 acc      = _mm_setzero_ps();
+        for (int32_t k = 0; k < n; ++k) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(s + k * nc), _mm_set1_ps(w0[k])));
+        }
+        // the destination rows are padded, the fourth lane of a 3-channel pixel is overwritten by the next one
+        _mm_storeu_ps(dst + i * nc, acc);
+    }
+}
+
+// weighted sum of n rows, pairs of rows are interleaved so that one madd applies two taps
+static void vertical_u8(const uint8_t *src, size_t srcStride, int32_t n, const int16_t *w, int32_t width, uint8_t *dst)
+{
+    int32_t x = 0;
+    for (; x <= width - 16; x += 16) {
+        __m128i a0 = _mm_setzero_si128(), a1 = a0, a2 = a0, a3 = a0;
+        const __m128i zero = _mm_setzero_si128();
+        for (int32_t k = 0; k < n; k += 2) {
+            const uint8_t *r0 = src + k * srcStride + x;
+            const uint8_t *r1 = k + 1 < n ? r0 + srcStride : r0;
+            const __m128i wk  = _mm_set1_epi32(k + 1 < n ? load_pair(w + k) : (uint16_t)w[k]);
+            __m128i v0 = _mm_loadu_si128((const __m128i *)r0);
+            __m128i v1 = _mm_loadu_si128((const __m128i *)r1);
+            __m128i lo = _mm_unpacklo_epi8(v0, v1), hi = _mm_unpackhi_epi8(v0, v1);
+            a0 = _mm_add_epi32(a0, _mm_madd_epi16(_mm_unpacklo_epi8(lo, zero), wk));
+            a1 = _mm_add_epi32(a1, _mm_madd_epi16(_mm_unpackhi_epi8(lo, zero), wk));
+            a2 = _mm_add_epi32(a2, _mm_madd_epi16(_mm_unpacklo_epi8(hi, zero), wk));
+            a3 = _mm_add_epi32(a3, _mm_madd_epi16(_mm_unpackhi_epi8(hi, zero), wk));
+        }
+        __m128i lo = _mm_packs_epi32(descale_epi32(a0), descale_epi32(a1));
+        __m128i hi = _mm_packs_epi32(descale_epi32(a2), descale_epi32(a3));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(lo, hi));
+    }
+    for (; x < width; ++x) {
+        int32_t sum = 0;
+        for (int32_t k = 0; k < n; ++k) {
+            sum += src[k * srcStride + x] * w[k];
+        }
+        dst[x] = saturate_u8(descale(sum));
+    }
+}
+
+static void vertical_f32(const float *src, size_t srcStride, int32_t n, const float *w, int32_t width, float *dst)
+{
+    int32_t x = 0;
+    for (; x <= width - 16; x += 16) {
+        __m128 a0 = _mm_setzero_ps(), a1 = a0, a2 = a0, a3 = a0;
+        for (int32_t k = 0; k < n; ++k) {
+            const float *r = src + k * srcStride + x;
+            const __m128 wk = _mm_set1_ps(w[k]);
+            a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(r), wk));
+            a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_loadu_ps(r + 4), wk));
+            a2 = _mm_add_ps(a2, _mm_mul_ps(_mm_loadu_ps(r + 8), wk));
+            a3 = _mm_add_ps(a3, _mm_mul_ps(_mm_loadu_ps(r + 12), wk));
+        }
+        _mm_storeu_ps(dst + x, a0);
+        _mm_storeu_ps(dst + x + 4, a1);
+        _mm_storeu_ps(dst + x + 8, a2);
+        _mm_storeu_ps(dst + x + 12, a3);
+    }
+    for (; x <= width - 4; x += 4) {
+        __m128 a0 = _mm_setzero_ps();
+        for (int32_t k = 0; k < n; ++k) {
+            a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(src + k * srcStride + x), _mm_set1_ps(w[k])));
+        }
+        _mm_storeu_ps(dst + x, a0);
+    }
+    for (; x < width; ++x) {
+        float sum = 0.f;
+        for (int32_t k = 0; k < n; ++k) {
+            sum += src[k * srcStride + x] * w[k];
+        }
+        dst[x] = sum;
+    }
+}
+
+template<int32_t nc>
+static void horizontal_row(const uint8_t *src, int32_t outWidth, const ResizeFilterAxis &axis, bool, uint8_t *dst)
+{
+    if (nc == 1) {
+        horizontal_u8_c1(src, outWidth, axis, dst);
+    } else {
+        horizontal_u8_cn<nc>(src, outWidth, axis, dst);
+    }
+}
+
+template<int32_t nc>
+static void horizontal_row(const float *src, int32_t outWidth, const ResizeFilterAxis &axis, bool useFMA, float *dst)
+{
+    if (useFMA) {
+        fma::resize_filter_horizontal_f32_fma(src, nc, outWidth, &axis.start[0], &axis.count[0], &axis.fweights[0], axis.ksize, dst);
+    } else if (nc == 1) {
+        horizontal_f32_c1(src, outWidth, axis, dst);
+    } else {
+        horizontal_f32_cn<nc>(src, outWidth, axis, dst);
+    }
+}
+
+static void vertical_row(const uint8_t *src, size_t srcStride, const ResizeFilterAxis &axis, int32_t i, int32_t width, bool, uint8_t *dst)
+{
+    vertical_u8(src, srcStride, axis.count[i], &axis.iweights[(size_t)i * axis.ksize], width, dst);
+}
+
+static void vertical_row(const float *src, size_t srcStride, const ResizeFilterAxis &axis, int32_t i, int32_t width, bool useFMA, float *dst)
+{
+    const float *w = &axis.fweights[(size_t)i * axis.ksize];
+    if (useFMA) {
+        fma::resize_filter_vertical_f32_fma(src, srcStride, axis.count[i], w, width, dst);
+    } else {
+        vertical_f32(src, srcStride, axis.count[i], w, width, dst);
+    }
+}
+
+// resamples the source rows read by the vertical filter horizontally into an intermediate image, then
+// filters its columns
+template<typename T, int32_t channels>
+static void resizeHorizontalFirst(
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const ResizeFilterAxis &hAxis,
+    const ResizeFilterAxis &vAxis)
+{
+    const bool useFMA      = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t rowBegin = vAxis.start[0];
+    const int32_t rowEnd   = vAxis.start[outHeight - 1] + vAxis.count[outHeight - 1];
+    const int32_t midWidth = outWidth * channels;
+    // rows are padded by one vector for the whole-pixel stores of the horizontal kernels
+    const size_t midStride = midWidth + 16;
+    std::vector<T> mid((size_t)(rowEnd - rowBegin) * midStride);
+
+    // the input rows are copied into zero-padded buffers, so that the kernels may read whole vectors and
+    // whole ksize windows past the last pixel
+    const size_t padWidth = (size_t)(inWidth + hAxis.ksize + 4) * channels;
+#pragma omp parallel for schedule(static)
+    for (int32_t y0 = rowBegin; y0 < rowEnd; y0 += RESIZE_FILTER_BAND_ROWS) {
+        std::vector<T> row(padWidth, T(0));
+        const int32_t y1 = std::min(y0 + RESIZE_FILTER_BAND_ROWS, rowEnd);
+        for (int32_t y = y0; y < y1; ++y) {
+            memcpy(&row[0], inData + (size_t)y * inWidthStride, (size_t)inWidth * channels * sizeof(T));
+            horizontal_row<channels>(&row[0], outWidth, hAxis, useFMA, &mid[(size_t)(y - rowBegin) * midStride]);
+        }
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int32_t i = 0; i < outHeight; ++i) {
+        const T *src = &mid[(size_t)(vAxis.start[i] - rowBegin) * midStride];
+        vertical_row(src, midStride, vAxis, i, midWidth, useFMA, outData + (size_t)i * outWidthStride);
+    }
+}
+
+// filters the source columns for one output row into a zero-padded buffer and resamples it horizontally,
+// no intermediate image is needed
+template<typename T, int32_t channels>
+static void resizeVerticalFirst(
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const ResizeFilterAxis &hAxis,
+    const ResizeFilterAxis &vAxis)
+{
+    const bool useFMA     = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const size_t padWidth = (size_t)(inWidth + hAxis.ksize + 4) * channels;
+    const size_t outWidthElems = (size_t)outWidth * channels;
+#pragma omp parallel for schedule(static)
+    for (int32_t i0 = 0; i0 < outHeight; i0 += RESIZE_FILTER_BAND_ROWS) {
+        std::vector<T> row(padWidth, T(0));
+        std::vector<T> dst(outWidthElems + 16);
+        const int32_t i1 = std::min(i0 + RESIZE_FILTER_BAND_ROWS, outHeight);
+        for (int32_t i = i0; i < i1; ++i) {
+            const T *src = inData + (size_t)vAxis.start[i] * inWidthStride;
+            vertical_row(src, inWidthStride, vAxis, i, inWidth * channels, useFMA, &row[0]);
+            horizontal_row<channels>(&row[0], outWidth, hAxis, useFMA, &dst[0]);
+            memcpy(outData + (size_t)i * outWidthStride, &dst[0], outWidthElems * sizeof(T));
+        }
+    }
+}
+
+ResizeFilterPlan::ResizeFilterPlan(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, ResizeFilterType filter)
+    : inHeight_(inHeight)
+    , inWidth_(inWidth)
+    , outHeight_(outHeight)
+    , outWidth_(outWidth)
+    , tables_(NULL)
+{
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0) {
+        return;
+    }
+    if (filter != RESIZE_FILTER_TRIANGLE && filter != RESIZE_FILTER_MITCHELL && filter != RESIZE_FILTER_LANCZOS4) {
+        return;
+    }
+    tables_ = new ResizeFilterTables;
+    buildAxis(inWidth, outWidth, filter, tables_->horizontal);
+    buildAxis(inHeight, outHeight, filter, tables_->vertical);
+}
+
+ResizeFilterPlan::~ResizeFilterPlan()
+{
+    delete tables_;
+}
+
+template<typename T, int32_t channels>
+::ppl::common::RetCode ResizeFilterPlan::Apply(
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData) const
+{
+    if (nullptr == tables_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inWidthStride < inWidth_ * channels || outWidthStride < outWidth_ * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const ResizeFilterAxis &hAxis = tables_->horizontal;
+    const ResizeFilterAxis &vAxis = tables_->vertical;
+    // the horizontal kernels gather a window per output pixel while the vertical ones stream whole rows, so
+    // a horizontal tap is counted twice. Shrinking both axes usually favours filtering the columns first
+    const int64_t hFirstCost = 2 * (int64_t)inHeight_ * outWidth_ * hAxis.ksize + (int64_t)outHeight_ * outWidth_ * vAxis.ksize;
+    const int64_t vFirstCost = (int64_t)outHeight_ * inWidth_ * vAxis.ksize + 2 * (int64_t)outHeight_ * outWidth_ * hAxis.ksize;
+    if (vFirstCost < hFirstCost) {
+        resizeVerticalFirst<T, channels>(inWidth_, inWidthStride, inData, outHeight_, outWidth_, outWidthStride, outData, hAxis, vAxis);
+    } else {
+        resizeHorizontalFirst<T, channels>(inWidth_, inWidthStride, inData, outHeight_, outWidth_, outWidthStride, outData, hAxis, vAxis);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template<typename T, int32_t channels>
+::ppl::common::RetCode ResizeFiltered(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    ResizeFilterType filter)
+{
+    ResizeFilterPlan plan(inHeight, inWidth, outHeight, outWidth, filter);
+    return plan.Apply<T, channels>(inWidthStride, inData, outWidthStride, outData);
+}
+
+template ::ppl::common::RetCode ResizeFilterPlan::Apply<uint8_t, 1>(int32_t, const uint8_t *, int32_t, uint8_t *) const;
+template ::ppl::common::RetCode ResizeFilterPlan::Apply<uint8_t, 3>(int32_t, const uint8_t *, int32_t, uint8_t *) const;
+template ::ppl::common::RetCode ResizeFilterPlan::Apply<uint8_t, 4>(int32_t, const uint8_t *, int32_t, uint8_t *) const;
+template ::ppl::common::RetCode ResizeFilterPlan::Apply<float, 1>(int32_t, const float *, int32_t, float *) const;
+template ::ppl::common::RetCode ResizeFilterPlan::Apply<float, 3>(int32_t, const float *, int32_t, float *) const;
+template ::ppl::common::RetCode ResizeFilterPlan::Apply<float, 4>(int32_t, const float *, int32_t, float *) const;
+
+template ::ppl::common::RetCode ResizeFiltered<uint8_t, 1>(int32_t, int32_t, int32_t, const uint8_t *, int32_t, int32_t, int32_t, uint8_t *, ResizeFilterType);
+template ::ppl::common::RetCode ResizeFiltered<uint8_t, 3>(int32_t, int32_t, int32_t, const uint8_t *, int32_t, int32_t, int32_t, uint8_t *, ResizeFilterType);
+template ::ppl::common::RetCode ResizeFiltered<uint8_t, 4>(int32_t, int32_t, int32_t, const uint8_t *, int32_t, int32_t, int32_t, uint8_t *, ResizeFilterType);
+template ::ppl::common::RetCode ResizeFiltered<float, 1>(int32_t, int32_t, int32_t, const float *, int32_t, int32_t, int32_t, float *, ResizeFilterType);
+template ::ppl::common::RetCode ResizeFiltered<float, 3>(int32_t, int32_t, int32_t, const float *, int32_t, int32_t, int32_t, float *, ResizeFilterType);
+template ::ppl::common::RetCode ResizeFiltered<float, 4>(int32_t, int32_t, int32_t, const float *, int32_t, int32_t, int32_t, float *, ResizeFilterType);
+
+}
+}
+} // namespace ppl::cv::x86
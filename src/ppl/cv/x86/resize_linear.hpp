@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_RESIZE_LINEAR_HPP_
+#define __ST_HPC_PPL_CV_X86_RESIZE_LINEAR_HPP_
+#include <stdint.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// Linear resize split into coefficient tables and a kernel over a band of output rows. The tables only
+// depend on the shape, so images of the same shape can share them, and bands of one image can run on
+// different threads. A band writes output rows [hBegin, hEnd), outData points to row hBegin. The caller
+// allocates the tables and, per concurrent band, the row buffers, both 128-byte aligned.
+
+uint64_t resize_linear_tables_size_u8(int32_t channels, int32_t outHeight, int32_t outWidth);
+uint64_t resize_linear_rows_size_u8(int32_t channels, int32_t outWidth);
+void resize_linear_tables_u8(int32_t inHeight, int32_t inWidth, int32_t channels, int32_t outHeight, int32_t outWidth, void *tables);
+// the first source row of every output row in tables, -1 above the image, the band reads it and the next one
+const int32_t *resize_linear_h_offset_u8(int32_t channels, int32_t outHeight, int32_t outWidth, const void *tables);
+void resize_linear_band_u8(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const void *tables,
+    int32_t hBegin,
+    int32_t hEnd,
+    void *rows);
+
+uint64_t resize_linear_tables_size_fp32(int32_t channels, int32_t outHeight, int32_t outWidth);
+uint64_t resize_linear_rows_size_fp32(int32_t channels, int32_t outWidth);
+void resize_linear_tables_fp32(int32_t inHeight, int32_t inWidth, int32_t channels, int32_t outHeight, int32_t outWidth, void *tables);
+void resize_linear_band_fp32(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const void *tables,
+    int32_t hBegin,
+    int32_t hEnd,
+    void *rows);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_RESIZE_LINEAR_HPP_
@@ -30,6 +30,7 @@
 #include <math.h>
 
 #include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/resize_linear.hpp"
 
 namespace ppl {
 namespace cv {
@@ -109,7 +110,6 @@ static void resize_linear_twoline_fp32(
     int32_t w_max,
     const int32_t *w_offset,
     const float *w_coeff,
-    int32_t h_idx,
     float h_coeff,
     float *row_0,
     float *row_1,
@@ -270,7 +270,6 @@ static void resize_linear_h_fp32(
     int32_t channels,
     const float *row_0,
     const float *row_1,
-    int32_t h_idx,
     float h_coeff,
     float *outData)
 {
@@ -290,99 +289,6 @@ static void resize_linear_h_fp32(
     }
 }
 
-static void resize_linear_kernel_fp32(
-    int32_t inHeight,
-    int32_t inWidth,
-    int32_t inWidthStride,
-    const float *inData,
-    int32_t channels,
-    int32_t outHeight,
-    int32_t outWidth,
-    int32_t outWidthStride,
-    float *outData)
-{
-    int32_t cn_width           = channels * outWidth;
-    uint64_t size_for_h_offset = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
-    uint64_t size_for_w_offset = (cn_width * sizeof(int32_t) + 128 - 1) / 128 * 128;
-    uint64_t size_for_h_coeff  = (outHeight * sizeof(float) + 128 - 1) / 128 * 128;
-    uint64_t size_for_w_coeff  = (cn_width * sizeof(float) + 128 - 1) / 128 * 128;
-    uint64_t size_for_row_0    = (cn_width * sizeof(float) + 128 - 1) / 128 * 128;
-    uint64_t size_for_row_1    = (cn_width * sizeof(float) + 128 - 1) / 128 * 128;
-
-    uint64_t total_size = size_for_h_offset + size_for_w_offset + size_for_h_coeff + size_for_w_coeff + size_for_row_0 + size_for_row_1;
-
-    void *temp_buffer = ppl::common::AlignedAlloc(total_size, 128);
-
-    int32_t *h_offset = (int32_t *)temp_buffer;
-    int32_t *w_offset = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
-    float *h_coeff    = (float *)((unsigned char *)w_offset + size_for_w_offset);
-    float *w_coeff    = (float *)((unsigned char *)h_coeff + size_for_h_coeff);
-    float *row_0      = (float *)((unsigned char *)w_coeff + size_for_w_coeff);
-    float *row_1      = (float *)((unsigned char *)row_0 + size_for_row_0);
-
-    int32_t w_max = 0;
-    resize_linear_calc_offset_fp32(inHeight, inWidth, channels, outHeight, outWidth, w_max, h_offset, w_offset, h_coeff, w_coeff);
-
-    int32_t prev_h[2]  = {-1, -1};
-    float *prev_ptr[2] = {nullptr, nullptr};
-
-    int32_t reuse_count;
-    float *row_ptr[2];
-
-    for (int32_t h = 0; h < outHeight; ++h) {
-        reuse_count = 0;
-        row_ptr[0]  = nullptr;
-        row_ptr[1]  = nullptr;
-
-        int32_t src_h_idx_0 = h_offset[h];
-        int32_t src_h_idx_1 = src_h_idx_0 == inHeight - 1 ? src_h_idx_0 : src_h_idx_0 + 1;
-
-        if (src_h_idx_0 == prev_h[0]) {
-            reuse_count++;
-            row_ptr[0] = prev_ptr[0];
-
-            if (src_h_idx_1 == prev_h[0]) {
-                reuse_count++;
-                row_ptr[1] = prev_ptr[0];
-            } else if (src_h_idx_1 == prev_h[1]) {
-                reuse_count++;
-                row_ptr[1] = prev_ptr[1];
-            }
-        } else if (src_h_idx_0 == prev_h[1]) {
-            reuse_count++;
-            row_ptr[0] = prev_ptr[1];
-
-            if (src_h_idx_1 == prev_h[1]) {
-                reuse_count++;
-                row_ptr[1] = prev_ptr[1];
-            }
-        }
-
-        if (reuse_count == 0) {
-            row_ptr[0] = row_0;
-            row_ptr[1] = row_1;
-
-            resize_linear_twoline_fp32(inWidth, outWidth, channels, inData + src_h_idx_0 * inWidthStride, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, h_offset[h], h_coeff[h], row_ptr[0], row_ptr[1], outData + h * outWidthStride);
-        } else {
-            if (reuse_count == 1) {
-                if (row_ptr[0] == row_0) {
-                    row_ptr[1] = row_1;
-                } else {
-                    row_ptr[1] = row_0;
-                }
-                resize_linear_w_oneline_fp32(inWidth, outWidth, channels, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[1]);
-            }
-            resize_linear_h_fp32(outWidth, channels, row_ptr[0], row_ptr[1], h_offset[h], h_coeff[h], outData + h * outWidthStride);
-        }
-
-        prev_h[0]   = src_h_idx_0;
-        prev_h[1]   = src_h_idx_1;
-        prev_ptr[0] = row_ptr[0];
-        prev_ptr[1] = row_ptr[1];
-    }
-    ppl::common::AlignedFree(temp_buffer);
-}
-
 static void resize_linear_shrink2_c1_kernel_fp32(
     const float *inData,
     int32_t inWidthStride,
@@ -486,6 +392,187 @@ static void resize_linear_shrink2_c4_kernel_fp32(
     }
 }
 
+static inline bool resize_linear_is_shrink2_fp32(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth)
+{
+    return outHeight * 2 == inHeight && outWidth * 2 == inWidth;
+}
+
+// tables layout: w_max, h_offset, w_offset, h_coeff, w_coeff, each padded to 128 bytes
+uint64_t resize_linear_tables_size_fp32(
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth)
+{
+    int32_t cn_width = channels * outWidth;
+    return 128 +
+           (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128 +
+           (cn_width * sizeof(int32_t) + 128 - 1) / 128 * 128 +
+           (outHeight * sizeof(float) + 128 - 1) / 128 * 128 +
+           (cn_width * sizeof(float) + 128 - 1) / 128 * 128;
+}
+
+uint64_t resize_linear_rows_size_fp32(
+    int32_t channels,
+    int32_t outWidth)
+{
+    return (channels * outWidth * sizeof(float) + 128 - 1) / 128 * 128 * 2;
+}
+
+static void resize_linear_tables_unpack_fp32(
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    const void *tables,
+    int32_t *&w_max,
+    int32_t *&h_offset,
+    int32_t *&w_offset,
+    float *&h_coeff,
+    float *&w_coeff)
+{
+    int32_t cn_width           = channels * outWidth;
+    uint64_t size_for_h_offset = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_w_offset = (cn_width * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_h_coeff  = (outHeight * sizeof(float) + 128 - 1) / 128 * 128;
+
+    w_max    = (int32_t *)tables;
+    h_offset = (int32_t *)((unsigned char *)tables + 128);
+    w_offset = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
+    h_coeff  = (float *)((unsigned char *)w_offset + size_for_w_offset);
+    w_coeff  = (float *)((unsigned char *)h_coeff + size_for_h_coeff);
+}
+
+void resize_linear_tables_fp32(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    void *tables)
+{
+    int32_t *w_max, *h_offset, *w_offset;
+    float *h_coeff, *w_coeff;
+    resize_linear_tables_unpack_fp32(channels, outHeight, outWidth, tables, w_max, h_offset, w_offset, h_coeff, w_coeff);
+    resize_linear_calc_offset_fp32(inHeight, inWidth, channels, outHeight, outWidth, *w_max, h_offset, w_offset, h_coeff, w_coeff);
+}
+
+void resize_linear_band_fp32(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const void *tables,
+    int32_t hBegin,
+    int32_t hEnd,
+    void *rows)
+{
+    if (resize_linear_is_shrink2_fp32(inHeight, inWidth, outHeight, outWidth)) {
+        const float *src = inData + hBegin * 2 * inWidthStride;
+        if (1 == channels) {
+            resize_linear_shrink2_c1_kernel_fp32(src, inWidthStride, hEnd - hBegin, outWidth, outWidthStride, outData);
+        } else if (3 == channels) {
+            resize_linear_shrink2_c3_kernel_fp32(src, inWidthStride, hEnd - hBegin, outWidth, outWidthStride, outData);
+        } else {
+            resize_linear_shrink2_c4_kernel_fp32(src, inWidthStride, hEnd - hBegin, outWidth, outWidthStride, outData);
+        }
+        return;
+    }
+
+    int32_t *w_max_ptr, *h_offset, *w_offset;
+    float *h_coeff, *w_coeff;
+    resize_linear_tables_unpack_fp32(channels, outHeight, outWidth, tables, w_max_ptr, h_offset, w_offset, h_coeff, w_coeff);
+    int32_t w_max = *w_max_ptr;
+
+    float *row_0 = (float *)rows;
+    float *row_1 = (float *)((unsigned char *)rows + resize_linear_rows_size_fp32(channels, outWidth) / 2);
+
+    int32_t prev_h[2]  = {-1, -1};
+    float *prev_ptr[2] = {nullptr, nullptr};
+
+    int32_t reuse_count;
+    float *row_ptr[2];
+
+    for (int32_t h = hBegin; h < hEnd; ++h) {
+        reuse_count = 0;
+        row_ptr[0]  = nullptr;
+        row_ptr[1]  = nullptr;
+
+        int32_t src_h_idx_0 = h_offset[h];
+        int32_t src_h_idx_1 = src_h_idx_0 == inHeight - 1 ? src_h_idx_0 : src_h_idx_0 + 1;
+
+        if (src_h_idx_0 == prev_h[0]) {
+            reuse_count++;
+            row_ptr[0] = prev_ptr[0];
+
+            if (src_h_idx_1 == prev_h[0]) {
+                reuse_count++;
+                row_ptr[1] = prev_ptr[0];
+            } else if (src_h_idx_1 == prev_h[1]) {
+                reuse_count++;
+                row_ptr[1] = prev_ptr[1];
+            }
+        } else if (src_h_idx_0 == prev_h[1]) {
+            reuse_count++;
+            row_ptr[0] = prev_ptr[1];
+
+            if (src_h_idx_1 == prev_h[1]) {
+                reuse_count++;
+                row_ptr[1] = prev_ptr[1];
+            }
+        }
+
+        if (reuse_count == 0) {
+            row_ptr[0] = row_0;
+            row_ptr[1] = row_1;
+
+            resize_linear_twoline_fp32(inWidth, outWidth, channels, inData + src_h_idx_0 * inWidthStride, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, h_coeff[h], row_ptr[0], row_ptr[1], outData + (h - hBegin) * outWidthStride);
+        } else {
+            if (reuse_count == 1) {
+                if (row_ptr[0] == row_0) {
+                    row_ptr[1] = row_1;
+                } else {
+                    row_ptr[1] = row_0;
+                }
+                resize_linear_w_oneline_fp32(inWidth, outWidth, channels, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[1]);
+            }
+            resize_linear_h_fp32(outWidth, channels, row_ptr[0], row_ptr[1], h_coeff[h], outData + (h - hBegin) * outWidthStride);
+        }
+
+        prev_h[0]   = src_h_idx_0;
+        prev_h[1]   = src_h_idx_1;
+        prev_ptr[0] = row_ptr[0];
+        prev_ptr[1] = row_ptr[1];
+    }
+}
+
+static void resize_linear_kernel_fp32(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData)
+{
+    uint64_t size_for_tables = resize_linear_tables_size_fp32(channels, outHeight, outWidth);
+    uint64_t size_for_rows   = resize_linear_rows_size_fp32(channels, outWidth);
+
+    void *temp_buffer = ppl::common::AlignedAlloc(size_for_tables + size_for_rows, 128);
+    void *tables      = temp_buffer;
+    void *rows        = (unsigned char *)temp_buffer + size_for_tables;
+
+    resize_linear_tables_fp32(inHeight, inWidth, channels, outHeight, outWidth, tables);
+    resize_linear_band_fp32(inHeight, inWidth, inWidthStride, inData, channels, outHeight, outWidth, outWidthStride, outData, tables, 0, outHeight, rows);
+
+    ppl::common::AlignedFree(temp_buffer);
+}
+
 template <>
 ::ppl::common::RetCode ResizeLinear<float, 1>(
     int32_t inHeight,
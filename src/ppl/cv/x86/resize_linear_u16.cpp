@@ -0,0 +1,280 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/resize.h"
+
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <immintrin.h>
+#include <stdint.h>
+#include <cmath>
+#include <algorithm>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// 16-bit samples use Q15 weights: a product of a sample and a weight, and the sum of two of them with weights
+// adding up to 1, stay below 2^31
+#define INTER_RESIZE_U16_COEF_BITS  (15)
+#define INTER_RESIZE_U16_COEF_SCALE (1 << INTER_RESIZE_U16_COEF_BITS)
+#define INTER_RESIZE_U16_ROUND      (1 << (INTER_RESIZE_U16_COEF_BITS - 1))
+
+static inline int32_t resize_img_floor(float a)
+{
+    return (((a) >= 0) ? ((int32_t)a) : ((int32_t)a - 1));
+}
+
+static inline uint16_t resize_coeff_u16(float weight)
+{
+    return (uint16_t)std::min(std::max((int32_t)std::lround(weight * INTER_RESIZE_U16_COEF_SCALE), 0), INTER_RESIZE_U16_COEF_SCALE);
+}
+
+static void resize_linear_calc_offset_u16(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t *h_offset,
+    int32_t *w_offset,
+    uint16_t *h_coeff,
+    uint16_t *w_coeff)
+{
+    double scale_h = (double)inHeight / outHeight;
+    for (int32_t h = 0; h < outHeight; ++h) {
+        float float_h = (h + 0.5) * scale_h - 0.5;
+        int32_t int_h = resize_img_floor(float_h);
+        float_h -= int_h;
+        if (int_h < 0) {
+            int_h   = 0;
+            float_h = 0;
+        }
+        if (int_h + 1 >= inHeight) {
+            int_h   = inHeight - 1;
+            float_h = 0;
+        }
+        h_offset[h] = int_h;
+        h_coeff[h]  = resize_coeff_u16(1.0f - float_h);
+    }
+
+    double scale_w = (double)inWidth / outWidth;
+    for (int32_t w = 0; w < outWidth; ++w) {
+        float float_w = (w + 0.5) * scale_w - 0.5;
+        int32_t int_w = resize_img_floor(float_w);
+        float_w -= int_w;
+        if (int_w < 0) {
+            int_w   = 0;
+            float_w = 0;
+        }
+        if (int_w + 1 >= inWidth) {
+            int_w   = inWidth - 1;
+            float_w = 0;
+        }
+        w_offset[w] = int_w * channels;
+        w_coeff[w]  = resize_coeff_u16(1.0f - float_w);
+    }
+}
+
+// horizontal pass of one source row, rounded back to 16 bits
+static void resize_linear_w_oneline_u16(
+    int32_t inWidth,
+    int32_t outWidth,
+    int32_t channels,
+    const uint16_t *inData,
+    const int32_t *w_offset,
+    const uint16_t *w_coeff,
+    uint16_t *row)
+{
+    const int32_t last = (inWidth - 1) * channels;
+    for (int32_t w = 0; w < outWidth; ++w) {
+        const int32_t x0 = w_offset[w];
+        const int32_t x1 = x0 == last ? x0 : x0 + channels;
+        const uint32_t c0 = w_coeff[w];
+        const uint32_t c1 = INTER_RESIZE_U16_COEF_SCALE - c0;
+        for (int32_t c = 0; c < channels; ++c) {
+            row[w * channels + c] = (uint16_t)((inData[x0 + c] * c0 + inData[x1 + c] * c1 + INTER_RESIZE_U16_ROUND) >> INTER_RESIZE_U16_COEF_BITS);
+        }
+    }
+}
+
+// vertical pass, 8 samples per step with 32-bit products built from the low and high halves of 16x16 multiplies
+static void resize_linear_h_u16(
+    int32_t length,
+    const uint16_t *row_0,
+    const uint16_t *row_1,
+    uint16_t h_coeff,
+    uint16_t *outData)
+{
+    const uint32_t c0 = h_coeff;
+    const uint32_t c1 = INTER_RESIZE_U16_COEF_SCALE - c0;
+
+    __m128i m_coeff_0 = _mm_set1_epi16((int16_t)c0);
+    __m128i m_coeff_1 = _mm_set1_epi16((int16_t)c1);
+    __m128i m_round   = _mm_set1_epi32(INTER_RESIZE_U16_ROUND);
+
+    int32_t i = 0;
+    for (; i <= length - 8; i += 8) {
+        __m128i m_row_0 = _mm_loadu_si128((const __m128i *)(row_0 + i));
+        __m128i m_row_1 = _mm_loadu_si128((const __m128i *)(row_1 + i));
+
+        __m128i m_lo_0 = _mm_mullo_epi16(m_row_0, m_coeff_0);
+        __m128i m_hi_0 = _mm_mulhi_epu16(m_row_0, m_coeff_0);
+        __m128i m_lo_1 = _mm_mullo_epi16(m_row_1, m_coeff_1);
+        __m128i m_hi_1 = _mm_mulhi_epu16(m_row_1, m_coeff_1);
+
+        __m128i m_sum_l = _mm_add_epi32(_mm_unpacklo_epi16(m_lo_0, m_hi_0), _mm_unpacklo_epi16(m_lo_1, m_hi_1));
+        __m128i m_sum_h = _mm_add_epi32(_mm_unpackhi_epi16(m_lo_0, m_hi_0), _mm_unpackhi_epi16(m_lo_1, m_hi_1));
+        m_sum_l         = _mm_srli_epi32(_mm_add_epi32(m_sum_l, m_round), INTER_RESIZE_U16_COEF_BITS);
+        m_sum_h         = _mm_srli_epi32(_mm_add_epi32(m_sum_h, m_round), INTER_RESIZE_U16_COEF_BITS);
+        _mm_storeu_si128((__m128i *)(outData + i), _mm_packus_epi32(m_sum_l, m_sum_h));
+    }
+    for (; i < length; ++i) {
+        outData[i] = (uint16_t)((row_0[i] * c0 + row_1[i] * c1 + INTER_RESIZE_U16_ROUND) >> INTER_RESIZE_U16_COEF_BITS);
+    }
+}
+
+static void resize_linear_kernel_u16(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    const int32_t cn_width     = channels * outWidth;
+    uint64_t size_for_h_offset = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_w_offset = (outWidth * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_h_coeff  = (outHeight * sizeof(uint16_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_w_coeff  = (outWidth * sizeof(uint16_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_row      = (cn_width * sizeof(uint16_t) + 128 - 1) / 128 * 128;
+
+    void *temp_buffer  = ppl::common::AlignedAlloc(size_for_h_offset + size_for_w_offset + size_for_h_coeff + size_for_w_coeff + size_for_row * 2, 128);
+    int32_t *h_offset  = (int32_t *)temp_buffer;
+    int32_t *w_offset  = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
+    uint16_t *h_coeff  = (uint16_t *)((unsigned char *)w_offset + size_for_w_offset);
+    uint16_t *w_coeff  = (uint16_t *)((unsigned char *)h_coeff + size_for_h_coeff);
+    uint16_t *rows[2]  = {(uint16_t *)((unsigned char *)w_coeff + size_for_w_coeff),
+                          (uint16_t *)((unsigned char *)w_coeff + size_for_w_coeff + size_for_row)};
+
+    resize_linear_calc_offset_u16(inHeight, inWidth, channels, outHeight, outWidth, h_offset, w_offset, h_coeff, w_coeff);
+
+    // the two filtered source rows are kept, so that enlarging filters each source row only once
+    int32_t row_h[2] = {-1, -1};
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const int32_t src_h_0 = h_offset[h];
+        const int32_t src_h_1 = std::min(src_h_0 + 1, inHeight - 1);
+        if (row_h[0] != src_h_0) {
+            if (row_h[1] == src_h_0) {
+                std::swap(rows[0], rows[1]);
+                std::swap(row_h[0], row_h[1]);
+            } else {
+                resize_linear_w_oneline_u16(inWidth, outWidth, channels, inData + src_h_0 * inWidthStride, w_offset, w_coeff, rows[0]);
+                row_h[0] = src_h_0;
+            }
+        }
+        if (row_h[1] != src_h_1) {
+            resize_linear_w_oneline_u16(inWidth, outWidth, channels, inData + src_h_1 * inWidthStride, w_offset, w_coeff, rows[1]);
+            row_h[1] = src_h_1;
+        }
+        resize_linear_h_u16(cn_width, rows[0], rows[1], h_coeff[h], outData + h * outWidthStride);
+    }
+
+    ppl::common::AlignedFree(temp_buffer);
+}
+
+template <>
+::ppl::common::RetCode ResizeLinear<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    resize_linear_kernel_u16(
+        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode ResizeLinear<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    resize_linear_kernel_u16(
+        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode ResizeLinear<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    resize_linear_kernel_u16(
+        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
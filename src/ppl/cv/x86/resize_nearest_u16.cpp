@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/resize.h"
+
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <stdint.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+static inline int32_t resize_img_floor(float a)
+{
+    return (((a) >= 0) ? ((int32_t)a) : ((int32_t)a - 1));
+}
+
+static void resize_nearest_calc_offset_u16(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t *h_offset,
+    int32_t *w_offset)
+{
+    double scale_h = (double)inHeight / outHeight;
+    for (int32_t h = 0; h < outHeight; ++h) {
+        int32_t int_h = resize_img_floor(h * scale_h);
+        h_offset[h]   = int_h >= inHeight - 1 ? inHeight - 1 : int_h;
+    }
+
+    double scale_w = (double)inWidth / outWidth;
+    for (int32_t w = 0; w < outWidth; ++w) {
+        int32_t int_w = resize_img_floor(w * scale_w);
+        w_offset[w]   = (int_w >= inWidth - 1 ? inWidth - 1 : int_w) * channels;
+    }
+}
+
+// samples are copied, never blended, so zero (invalid) depth stays zero and no value is invented next to it
+template <int32_t channels>
+static void resize_nearest_kernel_u16(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    uint64_t size_for_h_offset = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_w_offset = (outWidth * sizeof(int32_t) + 128 - 1) / 128 * 128;
+
+    void *temp_buffer = ppl::common::AlignedAlloc(size_for_h_offset + size_for_w_offset, 128);
+    int32_t *h_offset = (int32_t *)temp_buffer;
+    int32_t *w_offset = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
+
+    resize_nearest_calc_offset_u16(inHeight, inWidth, channels, outHeight, outWidth, h_offset, w_offset);
+
+    for (int32_t h = 0; h < outHeight; ++h) {
+        uint16_t *dst = outData + h * outWidthStride;
+        if (h > 0 && h_offset[h] == h_offset[h - 1]) {
+            memcpy(dst, dst - outWidthStride, outWidth * channels * sizeof(uint16_t));
+            continue;
+        }
+        const uint16_t *src = inData + h_offset[h] * inWidthStride;
+        for (int32_t w = 0; w < outWidth; ++w) {
+            for (int32_t c = 0; c < channels; ++c) {
+                dst[w * channels + c] = src[w_offset[w] + c];
+            }
+        }
+    }
+
+    ppl::common::AlignedFree(temp_buffer);
+}
+
+template <>
+::ppl::common::RetCode ResizeNearestPoint<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    resize_nearest_kernel_u16<1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode ResizeNearestPoint<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    resize_nearest_kernel_u16<3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode ResizeNearestPoint<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    resize_nearest_kernel_u16<4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
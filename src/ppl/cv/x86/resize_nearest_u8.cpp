@@ -27,6 +27,7 @@
 #include <float.h>
 #include <stdint.h>
 #include <math.h>
+#include <algorithm>
 
 namespace ppl {
 namespace cv {
@@ -74,7 +75,7 @@ static void resize_nearest_c1_w_fourline_kernel_u8(
     const uint8_t *inData_2,
     const uint8_t *inData_3,
     int32_t outWidth,
-    int32_t *w_offset,
+    const int32_t *w_offset,
     uint8_t *outData_0,
     uint8_t *outData_1,
     uint8_t *outData_2,
@@ -109,7 +110,7 @@ static void resize_nearest_c3_w_fourline_kernel_u8(
     const uint8_t *inData_2,
     const uint8_t *inData_3,
     int32_t outWidth,
-    int32_t *w_offset,
+    const int32_t *w_offset,
     uint8_t *outData_0,
     uint8_t *outData_1,
     uint8_t *outData_2,
@@ -138,7 +139,7 @@ static void resize_nearest_c4_w_fourline_kernel_u8(
     const uint8_t *inData_2,
     const uint8_t *inData_3,
     int32_t outWidth,
-    int32_t *w_offset,
+    const int32_t *w_offset,
     uint8_t *outData_0,
     uint8_t *outData_1,
     uint8_t *outData_2,
@@ -179,7 +180,7 @@ static void resize_nearest_c4_w_fourline_kernel_u8(
 static void resize_nearest_c1_w_oneline_kernel_u8(
     const uint8_t *inData,
     int32_t outWidth,
-    int32_t *w_offset,
+    const int32_t *w_offset,
     uint8_t *outData)
 {
     int32_t i = 0;
@@ -197,7 +198,7 @@ static void resize_nearest_c1_w_oneline_kernel_u8(
 static void resize_nearest_c3_w_oneline_kernel_u8(
     const uint8_t *inData,
     int32_t outWidth,
-    int32_t *w_offset,
+    const int32_t *w_offset,
     uint8_t *outData)
 {
     int32_t i = 0;
@@ -211,7 +212,7 @@ static void resize_nearest_c3_w_oneline_kernel_u8(
 static void resize_nearest_c4_w_oneline_kernel_u8(
     const uint8_t *inData,
     int32_t outWidth,
-    int32_t *w_offset,
+    const int32_t *w_offset,
     uint8_t *outData)
 {
     for (int32_t i = 0; i < outWidth; ++i) {
@@ -219,6 +220,329 @@ static void resize_nearest_c4_w_oneline_kernel_u8(
     }
 }
 
+static inline void resize_nearest_tail_u8(
+    const uint8_t *inData,
+    int32_t channels,
+    int32_t start,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    for (int32_t i = start; i < outWidth; ++i) {
+        for (int32_t c = 0; c < channels; ++c) {
+            outData[i * channels + c] = inData[w_offset[i] * channels + c];
+        }
+    }
+}
+
+static void resize_nearest_c1_up2_kernel_u8(
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    int32_t i = 0;
+    for (; i <= outWidth - 32; i += 32) {
+        __m128i m_src = _mm_loadu_si128((const __m128i *)(inData + (i >> 1)));
+        _mm_storeu_si128((__m128i *)(outData + i), _mm_unpacklo_epi8(m_src, m_src));
+        _mm_storeu_si128((__m128i *)(outData + i + 16), _mm_unpackhi_epi8(m_src, m_src));
+    }
+    resize_nearest_tail_u8(inData, 1, i, outWidth, w_offset, outData);
+}
+
+static void resize_nearest_c1_up4_kernel_u8(
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    int32_t i = 0;
+    for (; i <= outWidth - 64; i += 64) {
+        __m128i m_src = _mm_loadu_si128((const __m128i *)(inData + (i >> 2)));
+        __m128i m_lo  = _mm_unpacklo_epi8(m_src, m_src);
+        __m128i m_hi  = _mm_unpackhi_epi8(m_src, m_src);
+        _mm_storeu_si128((__m128i *)(outData + i), _mm_unpacklo_epi16(m_lo, m_lo));
+        _mm_storeu_si128((__m128i *)(outData + i + 16), _mm_unpackhi_epi16(m_lo, m_lo));
+        _mm_storeu_si128((__m128i *)(outData + i + 32), _mm_unpacklo_epi16(m_hi, m_hi));
+        _mm_storeu_si128((__m128i *)(outData + i + 48), _mm_unpackhi_epi16(m_hi, m_hi));
+    }
+    resize_nearest_tail_u8(inData, 1, i, outWidth, w_offset, outData);
+}
+
+static void resize_nearest_c1_down2_kernel_u8(
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    __m128i m_mask = _mm_set1_epi16(0x00ff);
+    int32_t i      = 0;
+    for (; i <= outWidth - 16; i += 16) {
+        __m128i m_src0 = _mm_and_si128(_mm_loadu_si128((const __m128i *)(inData + i * 2)), m_mask);
+        __m128i m_src1 = _mm_and_si128(_mm_loadu_si128((const __m128i *)(inData + i * 2 + 16)), m_mask);
+        _mm_storeu_si128((__m128i *)(outData + i), _mm_packus_epi16(m_src0, m_src1));
+    }
+    resize_nearest_tail_u8(inData, 1, i, outWidth, w_offset, outData);
+}
+
+static void resize_nearest_c1_down4_kernel_u8(
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    __m128i m_mask = _mm_set1_epi32(0x000000ff);
+    int32_t i      = 0;
+    for (; i <= outWidth - 16; i += 16) {
+        __m128i m_src0 = _mm_and_si128(_mm_loadu_si128((const __m128i *)(inData + i * 4)), m_mask);
+        __m128i m_src1 = _mm_and_si128(_mm_loadu_si128((const __m128i *)(inData + i * 4 + 16)), m_mask);
+        __m128i m_src2 = _mm_and_si128(_mm_loadu_si128((const __m128i *)(inData + i * 4 + 32)), m_mask);
+        __m128i m_src3 = _mm_and_si128(_mm_loadu_si128((const __m128i *)(inData + i * 4 + 48)), m_mask);
+        __m128i m_lo   = _mm_packus_epi32(m_src0, m_src1);
+        __m128i m_hi   = _mm_packus_epi32(m_src2, m_src3);
+        _mm_storeu_si128((__m128i *)(outData + i), _mm_packus_epi16(m_lo, m_hi));
+    }
+    resize_nearest_tail_u8(inData, 1, i, outWidth, w_offset, outData);
+}
+
+static void resize_nearest_c4_up2_kernel_u8(
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    int32_t i = 0;
+    for (; i <= outWidth - 8; i += 8) {
+        __m128i m_src = _mm_loadu_si128((const __m128i *)(inData + (i >> 1) * 4));
+        _mm_storeu_si128((__m128i *)(outData + i * 4), _mm_unpacklo_epi32(m_src, m_src));
+        _mm_storeu_si128((__m128i *)(outData + i * 4 + 16), _mm_unpackhi_epi32(m_src, m_src));
+    }
+    resize_nearest_tail_u8(inData, 4, i, outWidth, w_offset, outData);
+}
+
+static void resize_nearest_c4_up4_kernel_u8(
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    int32_t i = 0;
+    for (; i <= outWidth - 16; i += 16) {
+        __m128i m_src = _mm_loadu_si128((const __m128i *)(inData + (i >> 2) * 4));
+        _mm_storeu_si128((__m128i *)(outData + i * 4), _mm_shuffle_epi32(m_src, 0x00));
+        _mm_storeu_si128((__m128i *)(outData + i * 4 + 16), _mm_shuffle_epi32(m_src, 0x55));
+        _mm_storeu_si128((__m128i *)(outData + i * 4 + 32), _mm_shuffle_epi32(m_src, 0xaa));
+        _mm_storeu_si128((__m128i *)(outData + i * 4 + 48), _mm_shuffle_epi32(m_src, 0xff));
+    }
+    resize_nearest_tail_u8(inData, 4, i, outWidth, w_offset, outData);
+}
+
+static void resize_nearest_c4_down2_kernel_u8(
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    int32_t i = 0;
+    for (; i <= outWidth - 4; i += 4) {
+        __m128 m_src0 = _mm_loadu_ps((const float *)(inData + i * 8));
+        __m128 m_src1 = _mm_loadu_ps((const float *)(inData + i * 8 + 16));
+        _mm_storeu_ps((float *)(outData + i * 4), _mm_shuffle_ps(m_src0, m_src1, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+    resize_nearest_tail_u8(inData, 4, i, outWidth, w_offset, outData);
+}
+
+static void resize_nearest_c4_down4_kernel_u8(
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    uint8_t *outData)
+{
+    int32_t i = 0;
+    for (; i <= outWidth - 4; i += 4) {
+        __m128i m_src0 = _mm_loadu_si128((const __m128i *)(inData + i * 16));
+        __m128i m_src1 = _mm_loadu_si128((const __m128i *)(inData + i * 16 + 16));
+        __m128i m_src2 = _mm_loadu_si128((const __m128i *)(inData + i * 16 + 32));
+        __m128i m_src3 = _mm_loadu_si128((const __m128i *)(inData + i * 16 + 48));
+        __m128i m_lo   = _mm_unpacklo_epi32(m_src0, m_src1);
+        __m128i m_hi   = _mm_unpacklo_epi32(m_src2, m_src3);
+        _mm_storeu_si128((__m128i *)(outData + i * 4), _mm_unpacklo_epi64(m_lo, m_hi));
+    }
+    resize_nearest_tail_u8(inData, 4, i, outWidth, w_offset, outData);
+}
+
+#define RESIZE_NEAREST_BLOCK_BYTES  16
+#define RESIZE_NEAREST_WINDOW_BYTES 32
+
+// a run of at most 16 output bytes gathered by two pshufb from the 32 source bytes at src
+struct ResizeNearestBlock {
+    __m128i mask_lo;
+    __m128i mask_hi;
+    int32_t src;
+    int32_t dst;
+    int32_t len;
+};
+
+// splits the output row into blocks whose source pixels fit in one window, inRowBytes must be at least
+// one window. Returns the number of blocks
+static int32_t resize_nearest_build_blocks_u8(
+    int32_t inRowBytes,
+    int32_t channels,
+    int32_t outWidth,
+    const int32_t *w_offset,
+    ResizeNearestBlock *blocks)
+{
+    int32_t count = 0;
+    int32_t w     = 0;
+    while (w < outWidth) {
+        // the window is moved back at the end of the row so that its loads stay inside it
+        int32_t src = std::min(w_offset[w] * channels, inRowBytes - RESIZE_NEAREST_WINDOW_BYTES);
+        int32_t end = w;
+        while (end < outWidth && (end - w + 1) * channels <= RESIZE_NEAREST_BLOCK_BYTES &&
+               (w_offset[end] + 1) * channels - src <= RESIZE_NEAREST_WINDOW_BYTES) {
+            ++end;
+        }
+
+        uint8_t mask_lo[16], mask_hi[16];
+        memset(mask_lo, 0x80, sizeof(mask_lo));
+        memset(mask_hi, 0x80, sizeof(mask_hi));
+        for (int32_t k = w; k < end; ++k) {
+            for (int32_t c = 0; c < channels; ++c) {
+                int32_t j   = (k - w) * channels + c;
+                int32_t pos = w_offset[k] * channels + c - src;
+                if (pos < 16) {
+                    mask_lo[j] = (uint8_t)pos;
+                } else {
+                    mask_hi[j] = (uint8_t)(pos - 16);
+                }
+            }
+        }
+        blocks[count].mask_lo = _mm_loadu_si128((const __m128i *)mask_lo);
+        blocks[count].mask_hi = _mm_loadu_si128((const __m128i *)mask_hi);
+        blocks[count].src     = src;
+        blocks[count].dst     = w * channels;
+        blocks[count].len     = (end - w) * channels;
+        ++count;
+        w = end;
+    }
+    return count;
+}
+
+static void resize_nearest_shuffle_kernel_u8(
+    const uint8_t *inData,
+    int32_t outRowBytes,
+    const ResizeNearestBlock *blocks,
+    int32_t numBlocks,
+    uint8_t *outData)
+{
+    // each store runs past its block into the next one, which overwrites it
+    int32_t b = 0;
+    for (; b < numBlocks && blocks[b].dst + RESIZE_NEAREST_BLOCK_BYTES <= outRowBytes; ++b) {
+        __m128i m_src0 = _mm_loadu_si128((const __m128i *)(inData + blocks[b].src));
+        __m128i m_src1 = _mm_loadu_si128((const __m128i *)(inData + blocks[b].src + 16));
+        __m128i m_dst  = _mm_or_si128(_mm_shuffle_epi8(m_src0, blocks[b].mask_lo),
+                                     _mm_shuffle_epi8(m_src1, blocks[b].mask_hi));
+        _mm_storeu_si128((__m128i *)(outData + blocks[b].dst), m_dst);
+    }
+    for (; b < numBlocks; ++b) {
+        uint8_t temp[16];
+        __m128i m_src0 = _mm_loadu_si128((const __m128i *)(inData + blocks[b].src));
+        __m128i m_src1 = _mm_loadu_si128((const __m128i *)(inData + blocks[b].src + 16));
+        __m128i m_dst  = _mm_or_si128(_mm_shuffle_epi8(m_src0, blocks[b].mask_lo),
+                                     _mm_shuffle_epi8(m_src1, blocks[b].mask_hi));
+        _mm_storeu_si128((__m128i *)temp, m_dst);
+        memcpy(outData + blocks[b].dst, temp, blocks[b].len);
+    }
+}
+
+enum ResizeNearestRowMode {
+    RESIZE_NEAREST_ROW_GATHER = 0,
+    RESIZE_NEAREST_ROW_UP2,
+    RESIZE_NEAREST_ROW_UP4,
+    RESIZE_NEAREST_ROW_DOWN2,
+    RESIZE_NEAREST_ROW_DOWN4,
+    RESIZE_NEAREST_ROW_SHUFFLE,
+};
+
+// 2x and 4x ratios, only when they reproduce w_offset exactly
+static ResizeNearestRowMode resize_nearest_ratio_mode(
+    int32_t inWidth,
+    int32_t outWidth,
+    const int32_t *w_offset)
+{
+    ResizeNearestRowMode mode = RESIZE_NEAREST_ROW_GATHER;
+    if (outWidth == inWidth * 2) {
+        mode = RESIZE_NEAREST_ROW_UP2;
+    } else if (outWidth == inWidth * 4) {
+        mode = RESIZE_NEAREST_ROW_UP4;
+    } else if (inWidth == outWidth * 2) {
+        mode = RESIZE_NEAREST_ROW_DOWN2;
+    } else if (inWidth == outWidth * 4) {
+        mode = RESIZE_NEAREST_ROW_DOWN4;
+    }
+    for (int32_t w = 0; mode != RESIZE_NEAREST_ROW_GATHER && w < outWidth; ++w) {
+        int32_t expected = w * 4;
+        if (mode == RESIZE_NEAREST_ROW_UP2) {
+            expected = w / 2;
+        } else if (mode == RESIZE_NEAREST_ROW_UP4) {
+            expected = w / 4;
+        } else if (mode == RESIZE_NEAREST_ROW_DOWN2) {
+            expected = w * 2;
+        }
+        if (w_offset[w] != expected) {
+            mode = RESIZE_NEAREST_ROW_GATHER;
+        }
+    }
+    return mode;
+}
+
+struct ResizeNearestRowPlan {
+    ResizeNearestRowMode mode;
+    int32_t channels;
+    int32_t outWidth;
+    const int32_t *w_offset;
+    const ResizeNearestBlock *blocks;
+    int32_t numBlocks;
+};
+
+static void resize_nearest_row_u8(
+    const ResizeNearestRowPlan &plan,
+    const uint8_t *inData,
+    uint8_t *outData)
+{
+    if (plan.mode == RESIZE_NEAREST_ROW_SHUFFLE) {
+        resize_nearest_shuffle_kernel_u8(inData, plan.outWidth * plan.channels, plan.blocks, plan.numBlocks, outData);
+        return;
+    }
+    if (plan.channels == 1) {
+        if (plan.mode == RESIZE_NEAREST_ROW_UP2) {
+            resize_nearest_c1_up2_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        } else if (plan.mode == RESIZE_NEAREST_ROW_UP4) {
+            resize_nearest_c1_up4_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        } else if (plan.mode == RESIZE_NEAREST_ROW_DOWN2) {
+            resize_nearest_c1_down2_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        } else if (plan.mode == RESIZE_NEAREST_ROW_DOWN4) {
+            resize_nearest_c1_down4_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        } else {
+            resize_nearest_c1_w_oneline_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        }
+    } else if (plan.channels == 3) {
+        resize_nearest_c3_w_oneline_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+    } else {
+        if (plan.mode == RESIZE_NEAREST_ROW_UP2) {
+            resize_nearest_c4_up2_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        } else if (plan.mode == RESIZE_NEAREST_ROW_UP4) {
+            resize_nearest_c4_up4_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        } else if (plan.mode == RESIZE_NEAREST_ROW_DOWN2) {
+            resize_nearest_c4_down2_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        } else if (plan.mode == RESIZE_NEAREST_ROW_DOWN4) {
+            resize_nearest_c4_down4_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        } else {
+            resize_nearest_c4_w_oneline_kernel_u8(inData, plan.outWidth, plan.w_offset, outData);
+        }
+    }
+}
+
 static void resize_nearest_kernel_u8(
     int32_t inHeight,
     int32_t inWidth,
@@ -241,70 +565,63 @@ static void resize_nearest_kernel_u8(
 
     resize_nearest_calc_offset_u8(inHeight, inWidth, outHeight, outWidth, h_offset, w_offset);
 
-    int32_t i = 0;
-    for (; i <= outHeight - 4; i += 4) {
-        if (channels == 1) {
-            resize_nearest_c1_w_fourline_kernel_u8(
-                inData + h_offset[i + 0] * inWidthStride,
-                inData + h_offset[i + 1] * inWidthStride,
-                inData + h_offset[i + 2] * inWidthStride,
-                inData + h_offset[i + 3] * inWidthStride,
-                outWidth,
-                w_offset,
-                outData + (i + 0) * outWidthStride,
-                outData + (i + 1) * outWidthStride,
-                outData + (i + 2) * outWidthStride,
-                outData + (i + 3) * outWidthStride);
-        }
-        if (channels == 3) {
-            resize_nearest_c3_w_fourline_kernel_u8(
-                inData + h_offset[i + 0] * inWidthStride,
-                inData + h_offset[i + 1] * inWidthStride,
-                inData + h_offset[i + 2] * inWidthStride,
-                inData + h_offset[i + 3] * inWidthStride,
-                outWidth,
-                w_offset,
-                outData + (i + 0) * outWidthStride,
-                outData + (i + 1) * outWidthStride,
-                outData + (i + 2) * outWidthStride,
-                outData + (i + 3) * outWidthStride);
-        }
-        if (channels == 4) {
-            resize_nearest_c4_w_fourline_kernel_u8(
-                inData + h_offset[i + 0] * inWidthStride,
-                inData + h_offset[i + 1] * inWidthStride,
-                inData + h_offset[i + 2] * inWidthStride,
-                inData + h_offset[i + 3] * inWidthStride,
-                outWidth,
-                w_offset,
-                outData + (i + 0) * outWidthStride,
-                outData + (i + 1) * outWidthStride,
-                outData + (i + 2) * outWidthStride,
-                outData + (i + 3) * outWidthStride);
-        }
+    ResizeNearestRowPlan plan;
+    plan.mode      = resize_nearest_ratio_mode(inWidth, outWidth, w_offset);
+    plan.channels  = channels;
+    plan.outWidth  = outWidth;
+    plan.w_offset  = w_offset;
+    plan.blocks    = NULL;
+    plan.numBlocks = 0;
+
+    // 1 and 3 channels gather with pshufb tables unless the source is too sparse to put 8 output bytes per
+    // block on average, 4 channels already gather a whole pixel per lane
+    ResizeNearestBlock *blocks = NULL;
+    if ((channels == 3 || (channels == 1 && plan.mode == RESIZE_NEAREST_ROW_GATHER)) &&
+        inWidth * channels >= RESIZE_NEAREST_WINDOW_BYTES) {
+        blocks         = (ResizeNearestBlock *)ppl::common::AlignedAlloc(outWidth * sizeof(ResizeNearestBlock), 64);
+        plan.numBlocks = resize_nearest_build_blocks_u8(inWidth * channels, channels, outWidth, w_offset, blocks);
+        plan.blocks    = blocks;
+        plan.mode      = plan.numBlocks * 8 <= outWidth * channels ? RESIZE_NEAREST_ROW_SHUFFLE : RESIZE_NEAREST_ROW_GATHER;
     }
-    for (; i < outHeight; ++i) {
-        int32_t h_idx = h_offset[i];
-        if (channels == 1) {
-            resize_nearest_c1_w_oneline_kernel_u8(inData + h_idx * inWidthStride,
-                                                  outWidth,
-                                                  w_offset,
-                                                  outData + i * outWidthStride);
-        }
-        if (channels == 3) {
-            resize_nearest_c3_w_oneline_kernel_u8(inData + h_idx * inWidthStride,
-                                                  outWidth,
-                                                  w_offset,
-                                                  outData + i * outWidthStride);
+
+    int32_t i = 0;
+    while (i < outHeight) {
+        uint8_t *dst = outData + i * outWidthStride;
+        // upscaled rows repeat the previous output row
+        if (i > 0 && h_offset[i] == h_offset[i - 1]) {
+            memcpy(dst, dst - outWidthStride, outWidth * channels);
+            ++i;
+            continue;
         }
-        if (channels == 4) {
-            resize_nearest_c4_w_oneline_kernel_u8(inData + h_idx * inWidthStride,
-                                                  outWidth,
-                                                  w_offset,
-                                                  outData + i * outWidthStride);
+        // the scalar gathers share the offsets among four distinct rows
+        if (plan.mode == RESIZE_NEAREST_ROW_GATHER && i + 4 <= outHeight && h_offset[i + 1] != h_offset[i] &&
+            h_offset[i + 2] != h_offset[i + 1] && h_offset[i + 3] != h_offset[i + 2]) {
+            const uint8_t *src_0 = inData + h_offset[i + 0] * inWidthStride;
+            const uint8_t *src_1 = inData + h_offset[i + 1] * inWidthStride;
+            const uint8_t *src_2 = inData + h_offset[i + 2] * inWidthStride;
+            const uint8_t *src_3 = inData + h_offset[i + 3] * inWidthStride;
+            if (channels == 1) {
+                resize_nearest_c1_w_fourline_kernel_u8(
+                    src_0, src_1, src_2, src_3, outWidth, w_offset, dst, dst + outWidthStride, dst + 2 * outWidthStride, dst + 3 * outWidthStride);
+            }
+            if (channels == 3) {
+                resize_nearest_c3_w_fourline_kernel_u8(
+                    src_0, src_1, src_2, src_3, outWidth, w_offset, dst, dst + outWidthStride, dst + 2 * outWidthStride, dst + 3 * outWidthStride);
+            }
+            if (channels == 4) {
+                resize_nearest_c4_w_fourline_kernel_u8(
+                    src_0, src_1, src_2, src_3, outWidth, w_offset, dst, dst + outWidthStride, dst + 2 * outWidthStride, dst + 3 * outWidthStride);
+            }
+            i += 4;
+            continue;
         }
+        resize_nearest_row_u8(plan, inData + h_offset[i] * inWidthStride, dst);
+        ++i;
     }
 
+    if (blocks != NULL) {
+        ppl::common::AlignedFree(blocks);
+    }
     ppl::common::AlignedFree(temp_buffer);
 }
 
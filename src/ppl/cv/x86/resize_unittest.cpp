@@ -19,6 +19,9 @@
 #include "ppl/cv/x86/test.h"
 #include <opencv2/imgproc.hpp>
 #include <memory>
+#include <vector>
+#include <cmath>
+#include <algorithm>
 #include <gtest/gtest.h>
 #include "ppl/cv/debug.h"
 #include "ppl/common/retcode.h"
@@ -26,11 +29,11 @@
 
 template<typename T, int32_t nc>
 void ResizeLinearTest(int32_t inHeight, int32_t inWidth,
-                    int32_t outHeight, int32_t outWidth, T diff) {
+                    int32_t outHeight, int32_t outWidth, T diff, T maxValue = 255) {
     std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
     std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
     std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
-    ppl::cv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, 255);
+    ppl::cv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, maxValue);
 
     cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * inWidth * nc);
     cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get(), sizeof(T) * outWidth * nc);
@@ -49,11 +52,11 @@ void ResizeLinearTest(int32_t inHeight, int32_t inWidth,
 
 template<typename T, int32_t nc>
 void ResizeNearestTest(int32_t inHeight, int32_t inWidth,
-                    int32_t outHeight, int32_t outWidth, T diff) {
+                    int32_t outHeight, int32_t outWidth, T diff, T maxValue = 255) {
     std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
     std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
     std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
-    ppl::cv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, 255);
+    ppl::cv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, maxValue);
     cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * inWidth * nc);
     cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get(), sizeof(T) * outWidth * nc);
 
@@ -106,6 +109,25 @@ TEST(RESIZE_LINEAR_UINT8, x86)
     ResizeLinearTest<uint8_t, 4>(640, 480, 360, 540, 1);
 }
 
+// 16-bit data over its whole range, as from depth sensors
+TEST(RESIZE_LINEAR_UINT16, x86)
+{
+    ResizeLinearTest<uint16_t, 1>(360, 540, 720, 1080, 4, 65535);
+    ResizeLinearTest<uint16_t, 1>(720, 1080, 360, 540, 4, 65535);
+    ResizeLinearTest<uint16_t, 1>(360, 540, 640, 480, 4, 65535);
+    ResizeLinearTest<uint16_t, 1>(640, 480, 360, 540, 4, 65535);
+
+    ResizeLinearTest<uint16_t, 3>(360, 540, 720, 1080, 4, 65535);
+    ResizeLinearTest<uint16_t, 3>(720, 1080, 360, 540, 4, 65535);
+    ResizeLinearTest<uint16_t, 3>(360, 540, 640, 480, 4, 65535);
+    ResizeLinearTest<uint16_t, 3>(640, 480, 360, 540, 4, 65535);
+
+    ResizeLinearTest<uint16_t, 4>(360, 540, 720, 1080, 4, 65535);
+    ResizeLinearTest<uint16_t, 4>(720, 1080, 360, 540, 4, 65535);
+    ResizeLinearTest<uint16_t, 4>(360, 540, 640, 480, 4, 65535);
+    ResizeLinearTest<uint16_t, 4>(640, 480, 360, 540, 4, 65535);
+}
+
 TEST(RESIZE_NEAREST_FP32, x86)
 {
     ResizeNearestTest<float, 1>(360, 540, 720, 1080, 1);
@@ -141,3 +163,183 @@ TEST(RESIZE_NEAREST_UINT8, x86)
     ResizeNearestTest<uint8_t, 4>(360, 540, 640, 480, 1);
     ResizeNearestTest<uint8_t, 4>(640, 480, 360, 540, 1);
 }
+
+TEST(RESIZE_NEAREST_UINT8_INTEGER_RATIO, x86)
+{
+    ResizeNearestTest<uint8_t, 1>(123, 301, 246, 602, 1);
+    ResizeNearestTest<uint8_t, 1>(123, 301, 492, 1204, 1);
+    ResizeNearestTest<uint8_t, 1>(246, 602, 123, 301, 1);
+    ResizeNearestTest<uint8_t, 1>(492, 1204, 123, 301, 1);
+
+    ResizeNearestTest<uint8_t, 3>(123, 301, 246, 602, 1);
+    ResizeNearestTest<uint8_t, 3>(123, 301, 492, 1204, 1);
+    ResizeNearestTest<uint8_t, 3>(246, 602, 123, 301, 1);
+    ResizeNearestTest<uint8_t, 3>(492, 1204, 123, 301, 1);
+
+    ResizeNearestTest<uint8_t, 4>(123, 301, 246, 602, 1);
+    ResizeNearestTest<uint8_t, 4>(123, 301, 492, 1204, 1);
+    ResizeNearestTest<uint8_t, 4>(246, 602, 123, 301, 1);
+    ResizeNearestTest<uint8_t, 4>(492, 1204, 123, 301, 1);
+}
+
+TEST(RESIZE_NEAREST_UINT16, x86)
+{
+    ResizeNearestTest<uint16_t, 1>(360, 540, 720, 1080, 1, 65535);
+    ResizeNearestTest<uint16_t, 1>(720, 1080, 360, 540, 1, 65535);
+    ResizeNearestTest<uint16_t, 1>(360, 540, 640, 480, 1, 65535);
+    ResizeNearestTest<uint16_t, 1>(640, 480, 360, 540, 1, 65535);
+
+    ResizeNearestTest<uint16_t, 3>(360, 540, 720, 1080, 1, 65535);
+    ResizeNearestTest<uint16_t, 3>(720, 1080, 360, 540, 1, 65535);
+    ResizeNearestTest<uint16_t, 3>(360, 540, 640, 480, 1, 65535);
+    ResizeNearestTest<uint16_t, 3>(640, 480, 360, 540, 1, 65535);
+
+    ResizeNearestTest<uint16_t, 4>(360, 540, 720, 1080, 1, 65535);
+    ResizeNearestTest<uint16_t, 4>(720, 1080, 360, 540, 1, 65535);
+    ResizeNearestTest<uint16_t, 4>(360, 540, 640, 480, 1, 65535);
+    ResizeNearestTest<uint16_t, 4>(640, 480, 360, 540, 1, 65535);
+}
+
+static double ResizeFilterKernel(ppl::cv::x86::ResizeFilterType filter, double x) {
+    x = std::fabs(x);
+    if (filter == ppl::cv::x86::RESIZE_FILTER_TRIANGLE) {
+        return x < 1.0 ? 1.0 - x : 0.0;
+    }
+    if (filter == ppl::cv::x86::RESIZE_FILTER_MITCHELL) {
+        if (x < 1.0) return (7.0 * x * x * x - 12.0 * x * x + 16.0 / 3.0) / 6.0;
+        if (x < 2.0) return (-7.0 / 3.0 * x * x * x + 12.0 * x * x - 20.0 * x + 32.0 / 3.0) / 6.0;
+        return 0.0;
+    }
+    if (x >= 4.0) return 0.0;
+    if (x == 0.0) return 1.0;
+    const double pi = 3.1415926535897932384626433832795;
+    return 4.0 * std::sin(pi * x) * std::sin(pi * x / 4.0) / (pi * pi * x * x);
+}
+
+// dense resampling matrix of one axis, the double-precision reference of the weight tables
+static std::vector<double> ResizeFilterMatrix(int32_t inSize, int32_t outSize, ppl::cv::x86::ResizeFilterType filter) {
+    const double support = filter == ppl::cv::x86::RESIZE_FILTER_TRIANGLE ? 1.0 : (filter == ppl::cv::x86::RESIZE_FILTER_MITCHELL ? 2.0 : 4.0);
+    const double scale = (double)inSize / outSize;
+    const double filterScale = std::max(scale, 1.0);
+    std::vector<double> m((size_t)outSize * inSize, 0.0);
+    for (int32_t i = 0; i < outSize; ++i) {
+        double center = (i + 0.5) * scale;
+        int32_t x0 = std::max((int32_t)std::floor(center - support * filterScale + 0.5), 0);
+        int32_t x1 = std::min((int32_t)std::floor(center + support * filterScale + 0.5), inSize);
+        double sum = 0.0;
+        for (int32_t x = x0; x < x1; ++x) {
+            m[(size_t)i * inSize + x] = ResizeFilterKernel(filter, (x - center + 0.5) / filterScale);
+            sum += m[(size_t)i * inSize + x];
+        }
+        for (int32_t x = x0; x < x1; ++x) {
+            m[(size_t)i * inSize + x] /= sum;
+        }
+    }
+    return m;
+}
+
+template<typename T, int32_t nc>
+void ResizeFilteredTest(int32_t inHeight, int32_t inWidth,
+                    int32_t outHeight, int32_t outWidth,
+                    ppl::cv::x86::ResizeFilterType filter, float diff) {
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    // the negative lobes of the filters overshoot on noise, the range is kept away from the clipping
+    // of uint8_t between the two passes
+    ppl::cv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 64, 192);
+
+    std::vector<double> mh = ResizeFilterMatrix(inWidth, outWidth, filter);
+    std::vector<double> mv = ResizeFilterMatrix(inHeight, outHeight, filter);
+    std::vector<double> tmp((size_t)inHeight * outWidth * nc, 0.0);
+    for (int32_t y = 0; y < inHeight; ++y) {
+        for (int32_t i = 0; i < outWidth; ++i) {
+            for (int32_t x = 0; x < inWidth; ++x) {
+                double w = mh[(size_t)i * inWidth + x];
+                if (w == 0.0) continue;
+                for (int32_t c = 0; c < nc; ++c) {
+                    tmp[((size_t)y * outWidth + i) * nc + c] += w * src[((size_t)y * inWidth + x) * nc + c];
+                }
+            }
+        }
+    }
+    for (int32_t j = 0; j < outHeight; ++j) {
+        for (int32_t k = 0; k < outWidth * nc; ++k) {
+            double sum = 0.0;
+            for (int32_t y = 0; y < inHeight; ++y) {
+                sum += mv[(size_t)j * inHeight + y] * tmp[(size_t)y * outWidth * nc + k];
+            }
+            if (sizeof(T) == 1) {
+                sum = std::min(std::max(std::round(sum), 0.0), 255.0);
+            }
+            dst_ref[(size_t)j * outWidth * nc + k] = (T)sum;
+        }
+    }
+
+    ppl::cv::x86::ResizeFilterPlan plan(inHeight, inWidth, outHeight, outWidth, filter);
+    auto rst = plan.Apply<T, nc>(inWidth * nc, src.get(), outWidth * nc, dst.get());
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+
+    checkResult<T, nc>(dst_ref.get(), dst.get(),
+                    outHeight, outWidth,
+                    outWidth * nc, outWidth * nc,
+                    diff);
+}
+
+// a one pixel checkerboard has no content below the Nyquist frequency of a 8x smaller image, an antialiased
+// resize must turn it into flat grey instead of picking every eighth sample. The windows of the outer pixels
+// are cut by the image border and are not checked
+template<typename T, int32_t nc>
+void ResizeFilteredAliasTest(ppl::cv::x86::ResizeFilterType filter, float diff) {
+    const int32_t inHeight = 256, inWidth = 384, outHeight = 32, outWidth = 48;
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    for (int32_t y = 0; y < inHeight; ++y) {
+        for (int32_t x = 0; x < inWidth * nc; ++x) {
+            src[y * inWidth * nc + x] = ((y + x / nc) & 1) ? 254 : 0;
+        }
+    }
+    for (int32_t i = 0; i < outWidth * outHeight * nc; ++i) {
+        dst_ref[i] = 127;
+    }
+    auto rst = ppl::cv::x86::ResizeFiltered<T, nc>(inHeight, inWidth, inWidth * nc, src.get(),
+                                                   outHeight, outWidth, outWidth * nc,
+                                                   dst.get(), filter);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+
+    const int32_t margin = 4;
+    const int32_t offset = (margin * outWidth + margin) * nc;
+    checkResult<T, nc>(dst_ref.get() + offset, dst.get() + offset,
+                    outHeight - 2 * margin, outWidth - 2 * margin,
+                    outWidth * nc, outWidth * nc,
+                    diff);
+}
+
+TEST(RESIZE_FILTERED_FP32, x86)
+{
+    ResizeFilteredTest<float, 1>(720, 1080, 45, 64, ppl::cv::x86::RESIZE_FILTER_LANCZOS4, 1e-3f);
+    ResizeFilteredTest<float, 3>(360, 540, 97, 131, ppl::cv::x86::RESIZE_FILTER_MITCHELL, 1e-3f);
+    ResizeFilteredTest<float, 4>(360, 540, 120, 180, ppl::cv::x86::RESIZE_FILTER_TRIANGLE, 1e-3f);
+    ResizeFilteredTest<float, 1>(60, 90, 127, 181, ppl::cv::x86::RESIZE_FILTER_LANCZOS4, 1e-3f);
+    ResizeFilteredTest<float, 3>(60, 90, 45, 181, ppl::cv::x86::RESIZE_FILTER_MITCHELL, 1e-3f);
+    ResizeFilteredTest<float, 4>(5, 7, 3, 2, ppl::cv::x86::RESIZE_FILTER_LANCZOS4, 1e-3f);
+
+    ResizeFilteredAliasTest<float, 1>(ppl::cv::x86::RESIZE_FILTER_TRIANGLE, 1.01f);
+    ResizeFilteredAliasTest<float, 3>(ppl::cv::x86::RESIZE_FILTER_MITCHELL, 1.01f);
+    ResizeFilteredAliasTest<float, 4>(ppl::cv::x86::RESIZE_FILTER_LANCZOS4, 1.01f);
+}
+
+TEST(RESIZE_FILTERED_UINT8, x86)
+{
+    ResizeFilteredTest<uint8_t, 1>(720, 1080, 45, 64, ppl::cv::x86::RESIZE_FILTER_LANCZOS4, 2.01f);
+    ResizeFilteredTest<uint8_t, 3>(360, 540, 97, 131, ppl::cv::x86::RESIZE_FILTER_MITCHELL, 2.01f);
+    ResizeFilteredTest<uint8_t, 4>(360, 540, 120, 180, ppl::cv::x86::RESIZE_FILTER_TRIANGLE, 2.01f);
+    ResizeFilteredTest<uint8_t, 1>(60, 90, 127, 181, ppl::cv::x86::RESIZE_FILTER_LANCZOS4, 2.01f);
+    ResizeFilteredTest<uint8_t, 3>(60, 90, 45, 181, ppl::cv::x86::RESIZE_FILTER_MITCHELL, 2.01f);
+    ResizeFilteredTest<uint8_t, 4>(5, 7, 3, 2, ppl::cv::x86::RESIZE_FILTER_LANCZOS4, 2.01f);
+
+    ResizeFilteredAliasTest<uint8_t, 1>(ppl::cv::x86::RESIZE_FILTER_TRIANGLE, 1.01f);
+    ResizeFilteredAliasTest<uint8_t, 3>(ppl::cv::x86::RESIZE_FILTER_MITCHELL, 1.01f);
+    ResizeFilteredAliasTest<uint8_t, 4>(ppl::cv::x86::RESIZE_FILTER_LANCZOS4, 1.01f);
+}
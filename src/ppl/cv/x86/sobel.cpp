@@ -16,6 +16,7 @@
 // under the License.
 
 #include "ppl/cv/x86/sobel.h"
+#include "ppl/cv/x86/sobel.hpp"
 #include "ppl/cv/x86/avx/internal_avx.hpp"
 #include "ppl/cv/x86/fma/internal_fma.hpp"
 #include "intrinutils.hpp"
@@ -25,6 +26,7 @@
 #include "ppl/common/x86/sysinfo.h"
 #include <string.h>
 #include <cmath>
+#include <algorithm>
 #include <assert.h>
 #include <immintrin.h>
 
@@ -320,66 +322,167 @@ void getSobelKernels_u8(
     }
 }
 
-void sobel_kernel_reflect101_u8(
+static inline int32_t sepfilter_reflect101(int32_t p, int32_t len)
+{
+    if (len == 1) {
+        return 0;
+    }
+    while (p < 0 || p >= len) {
+        p = p < 0 ? -p : 2 * len - 2 - p;
+    }
+    return p;
+}
+
+::ppl::common::RetCode sepfilter_u8s16(
     int32_t height,
     int32_t width,
     int32_t channels,
     int32_t inWidthStride,
     const uint8_t *inData,
-    int32_t dx,
-    int32_t dy,
-    int32_t ksize,
+    int32_t numTerms,
+    const int16_t *const *kx,
+    const int16_t *const *ky,
+    int32_t ksizeX,
+    int32_t ksizeY,
     double scale,
     double delta,
     int32_t outWidthStride,
     int16_t *outData)
 {
-    int16_t kx[33];
-    int16_t ky[33];
-    int32_t ksizeX = 0;
-    int32_t ksizeY = 0;
-
-    getSobelKernels_u8(kx, ky, ksizeX, ksizeY, dx, dy, scale, ksize);
-
-    int32_t x_r = ksizeX / 2;
-    int32_t y_r = ksizeY / 2;
+    const int32_t rx        = ksizeX / 2;
+    const int32_t ry        = ksizeY / 2;
+    const int32_t rowLength = width * channels;
+    // the column sums of one row, with rx reflected pixels on both sides and a vector of slack for the
+    // odd tap of the row pass
+    int16_t *column = (int16_t *)ppl::common::AlignedAlloc(((width + 2 * rx) * channels + 8) * sizeof(int16_t), 64);
+    int32_t *acc    = (int32_t *)ppl::common::AlignedAlloc(rowLength * sizeof(int32_t), 64);
+    if (column == NULL || acc == NULL) {
+        ppl::common::AlignedFree(column);
+        ppl::common::AlignedFree(acc);
+        return ppl::common::RC_OUT_OF_MEMORY;
+    }
+    int16_t *mid = column + rx * channels;
 
-    int16_t sum[4] = {};
+    const bool unit   = scale == 1.0 && delta == 0.0;
+    const __m128 vsc  = _mm_set1_ps((float)scale);
+    const __m128 vdel = _mm_set1_ps((float)delta);
+    const uint8_t *rows[33];
 
     for (int32_t i = 0; i < height; ++i) {
-        for (int32_t j = 0; j < width; ++j) {
-            for (int32_t c = 0; c < channels; ++c) {
-                sum[c] = delta;
-            }
-
-            for (int32_t ii = -y_r; ii <= y_r; ++ii) {
-                for (int32_t jj = -x_r; jj <= x_r; ++jj) {
-                    int32_t y = i + ii;
-                    int32_t x = j + jj;
-                    if (y < 0) {
-                        y = -y;
-                    }
-                    if (x < 0) {
-                        x = -x;
-                    }
-                    if (y >= height) {
-                        y = (height - 2 - (y - height));
-                    }
-                    if (x >= width) {
-                        x = (width - 2 - (x - width));
+        for (int32_t k = 0; k < ksizeY; ++k) {
+            rows[k] = inData + sepfilter_reflect101(i + k - ry, height) * inWidthStride;
+        }
+        for (int32_t t = 0; t < numTerms; ++t) {
+            const int16_t *kyt = ky[t];
+            const int16_t *kxt = kx[t];
+            int32_t x          = 0;
+            for (; x <= rowLength - 8; x += 8) {
+                __m128i vsum = _mm_setzero_si128();
+                for (int32_t k = 0; k < ksizeY; ++k) {
+                    if (kyt[k] == 0) {
+                        continue;
                     }
+                    __m128i v = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(rows[k] + x)));
+                    vsum      = _mm_add_epi16(vsum, _mm_mullo_epi16(v, _mm_set1_epi16(kyt[k])));
+                }
+                _mm_storeu_si128((__m128i *)(mid + x), vsum);
+            }
+            for (; x < rowLength; ++x) {
+                int32_t sum = 0;
+                for (int32_t k = 0; k < ksizeY; ++k) {
+                    sum += kyt[k] * rows[k][x];
+                }
+                mid[x] = sum;
+            }
+            for (int32_t j = 1; j <= rx; ++j) {
+                const int16_t *left  = mid + sepfilter_reflect101(-j, width) * channels;
+                const int16_t *right = mid + sepfilter_reflect101(width - 1 + j, width) * channels;
+                for (int32_t c = 0; c < channels; ++c) {
+                    mid[-j * channels + c]              = left[c];
+                    mid[(width - 1 + j) * channels + c] = right[c];
+                }
+            }
 
-                    for (int32_t c = 0; c < channels; ++c) {
-                        sum[c] += ky[ii + y_r] * kx[jj + x_r] * inData[y * inWidthStride + x * channels + c];
+            // two taps per _mm_madd_epi16, an odd last tap pairs with a zero weight
+            x = 0;
+            for (; x <= rowLength - 8; x += 8) {
+                __m128i vlo = t == 0 ? _mm_setzero_si128() : _mm_loadu_si128((const __m128i *)(acc + x));
+                __m128i vhi = t == 0 ? _mm_setzero_si128() : _mm_loadu_si128((const __m128i *)(acc + x + 4));
+                for (int32_t k = 0; k < ksizeX; k += 2) {
+                    const int16_t w1 = k + 1 < ksizeX ? kxt[k + 1] : 0;
+                    if (kxt[k] == 0 && w1 == 0) {
+                        continue;
                     }
+                    __m128i va = _mm_loadu_si128((const __m128i *)(column + x + k * channels));
+                    __m128i vb = _mm_loadu_si128((const __m128i *)(column + x + (k + 1) * channels));
+                    __m128i vw = _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)w1 << 16) | (uint16_t)kxt[k]));
+                    vlo        = _mm_add_epi32(vlo, _mm_madd_epi16(_mm_unpacklo_epi16(va, vb), vw));
+                    vhi        = _mm_add_epi32(vhi, _mm_madd_epi16(_mm_unpackhi_epi16(va, vb), vw));
+                }
+                _mm_storeu_si128((__m128i *)(acc + x), vlo);
+                _mm_storeu_si128((__m128i *)(acc + x + 4), vhi);
+            }
+            for (; x < rowLength; ++x) {
+                int32_t sum = t == 0 ? 0 : acc[x];
+                for (int32_t k = 0; k < ksizeX; ++k) {
+                    sum += kxt[k] * column[x + k * channels];
                 }
+                acc[x] = sum;
             }
+        }
 
-            for (int32_t c = 0; c < channels; ++c) {
-                outData[i * outWidthStride + j * channels + c] = sum[c];
+        int16_t *out = outData + i * outWidthStride;
+        int32_t x    = 0;
+        for (; x <= rowLength - 8; x += 8) {
+            __m128i vlo = _mm_loadu_si128((const __m128i *)(acc + x));
+            __m128i vhi = _mm_loadu_si128((const __m128i *)(acc + x + 4));
+            if (!unit) {
+                vlo = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(vlo), vsc), vdel));
+                vhi = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(vhi), vsc), vdel));
             }
+            _mm_storeu_si128((__m128i *)(out + x), _mm_packs_epi32(vlo, vhi));
+        }
+        for (; x < rowLength; ++x) {
+            float value = unit ? (float)acc[x] : (float)acc[x] * (float)scale + (float)delta;
+            out[x]      = (int16_t)std::min(std::max((int32_t)std::lrint(value), -32768), 32767);
         }
     }
+
+    ppl::common::AlignedFree(column);
+    ppl::common::AlignedFree(acc);
+    return ppl::common::RC_SUCCESS;
+}
+
+static ::ppl::common::RetCode sobel_u8s16(
+    int32_t height,
+    int32_t width,
+    int32_t channels,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t dx,
+    int32_t dy,
+    int32_t ksize,
+    double scale,
+    double delta,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (inData == nullptr || outData == nullptr || height <= 0 || width <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    // larger kernels could overflow the int16 column sums
+    if (ksize != -1 && ksize != 1 && ksize != 3 && ksize != 5 && ksize != 7) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    int16_t kx[33];
+    int16_t ky[33];
+    int32_t ksizeX = 0;
+    int32_t ksizeY = 0;
+    getSobelKernels_u8(kx, ky, ksizeX, ksizeY, dx, dy, 1.0, ksize);
+
+    const int16_t *kxs[1] = {kx};
+    const int16_t *kys[1] = {ky};
+    return sepfilter_u8s16(height, width, channels, inWidthStride, inData, 1, kxs, kys, ksizeX, ksizeY, scale, delta, outWidthStride, outData);
 }
 
 template <>
@@ -458,8 +561,7 @@ template <>
     BorderType border_type)
 {
     assert(border_type == ppl::cv::BORDER_TYPE_REFLECT_101);
-    sobel_kernel_reflect101_u8(height, width, 1, inWidthStride, inData, dx, dy, ksize, scale, delta, outWidthStride, outData);
-    return ppl::common::RC_SUCCESS;
+    return sobel_u8s16(height, width, 1, inWidthStride, inData, dx, dy, ksize, scale, delta, outWidthStride, outData);
 }
 
 template <>
@@ -478,8 +580,7 @@ template <>
     BorderType border_type)
 {
     assert(border_type == ppl::cv::BORDER_TYPE_REFLECT_101);
-    sobel_kernel_reflect101_u8(height, width, 3, inWidthStride, inData, dx, dy, ksize, scale, delta, outWidthStride, outData);
-    return ppl::common::RC_SUCCESS;
+    return sobel_u8s16(height, width, 3, inWidthStride, inData, dx, dy, ksize, scale, delta, outWidthStride, outData);
 }
 
 template <>
@@ -498,8 +599,7 @@ template <>
     BorderType border_type)
 {
     assert(border_type == ppl::cv::BORDER_TYPE_REFLECT_101);
-    sobel_kernel_reflect101_u8(height, width, 4, inWidthStride, inData, dx, dy, ksize, scale, delta, outWidthStride, outData);
-    return ppl::common::RC_SUCCESS;
+    return sobel_u8s16(height, width, 4, inWidthStride, inData, dx, dy, ksize, scale, delta, outWidthStride, outData);
 }
 
 }
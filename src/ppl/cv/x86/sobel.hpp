@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_SOBEL_HPP_
+#define __ST_HPC_PPL_CV_X86_SOBEL_HPP_
+#include "ppl/common/retcode.h"
+#include <stdint.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// Integer taps of the Sobel kernels of orders dx and dy, or of the Scharr kernels when ksize == -1.
+void getSobelKernels_u8(
+    int16_t *kx,
+    int16_t *ky,
+    int32_t &ksizeX,
+    int32_t &ksizeY,
+    int32_t dx,
+    int32_t dy,
+    double scale,
+    int32_t ksize);
+
+// Sum of numTerms separable integer kernels over an 8-bit image with reflect-101 borders, stored as
+// saturate(round(scale * sum + delta)) in int16. Term t runs ky[t] down the columns, then kx[t] along
+// the rows, with ksizeX and ksizeY taps for every term. The column pass keeps int16 rows, so the
+// absolute taps of each ky[t] may add up to at most 128; the row pass accumulates in int32.
+::ppl::common::RetCode sepfilter_u8s16(
+    int32_t height,
+    int32_t width,
+    int32_t channels,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t numTerms,
+    const int16_t *const *kx,
+    const int16_t *const *ky,
+    int32_t ksizeX,
+    int32_t ksizeY,
+    double scale,
+    double delta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+}
+}
+} // namespace ppl::cv::x86
+#endif //! __ST_HPC_PPL_CV_X86_SOBEL_HPP_
@@ -82,3 +82,12 @@ R(Sobel_f32c4, float, 4, float)
 R(Sobel_u8c1, uint8_t, 1, int16_t)
 R(Sobel_u8c3, uint8_t, 3, int16_t)
 R(Sobel_u8c4, uint8_t, 4, int16_t)
+
+// uint8_t to int16_t on images wider than a vector, with 7x7 kernels, scale and delta
+INSTANTIATE_TEST_CASE_P(wide, Sobel_u8c1, ::testing::Combine(::testing::Values(Size{67, 45}), ::testing::Values(0, 1, 2), ::testing::Values(1, 2), ::testing::Values(1, 3, 5, 7), ::testing::Values(1.0, 2.0), ::testing::Values(0.0, 3.0)));
+INSTANTIATE_TEST_CASE_P(wide, Sobel_u8c3, ::testing::Combine(::testing::Values(Size{67, 45}), ::testing::Values(0, 1, 2), ::testing::Values(1, 2), ::testing::Values(1, 3, 5, 7), ::testing::Values(1.0), ::testing::Values(0.0)));
+INSTANTIATE_TEST_CASE_P(wide, Sobel_u8c4, ::testing::Combine(::testing::Values(Size{67, 45}), ::testing::Values(0, 1, 2), ::testing::Values(1, 2), ::testing::Values(1, 3, 5, 7), ::testing::Values(1.0), ::testing::Values(0.0)));
+
+// Scharr
+INSTANTIATE_TEST_CASE_P(scharr, Sobel_u8c1, ::testing::Values(std::make_tuple(Size{67, 45}, 1, 0, -1, 1.0, 0.0), std::make_tuple(Size{67, 45}, 0, 1, -1, 2.0, 1.0)));
+INSTANTIATE_TEST_CASE_P(scharr, Sobel_u8c3, ::testing::Values(std::make_tuple(Size{67, 45}, 1, 0, -1, 1.0, 0.0), std::make_tuple(Size{67, 45}, 0, 1, -1, 1.0, 0.0)));
@@ -0,0 +1,702 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/stereobm.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include "ppl/common/x86/sysinfo.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows of one matching task, fixed so that SGM results do not depend on the number of threads
+#define STEREO_MIN_STRIP_HEIGHT 64
+// rows the SGM vertical paths are started above a strip
+#define STEREO_SGM_WARMUP_ROWS 32
+// padding of every SGM cost block, filled with 0xffff to terminate the j - 1 and j + 1 neighbours
+#define STEREO_SGM_PAD 8
+
+struct StereoThreadBuffers {
+    uint16_t *colCost; // width x numDisparities, column sums of absolute differences
+    uint16_t *rowCost; // width x numDisparities, window costs of the current row
+    uint16_t *colTexture; // width, column sums of the left texture
+    int32_t *vsum; // width + preFilterSize + 1, column sums of the normalized response prefilter
+    uint16_t *sgmPaths; // 2 rows x 3 vertical paths x width x (numDisparities + 2 * STEREO_SGM_PAD)
+    uint16_t *sgmMins; // 2 rows x 3 vertical paths x width
+    uint16_t *sgmLeft; // 2 x (numDisparities + 2 * STEREO_SGM_PAD)
+};
+
+struct StereoBMBuffers {
+    int32_t pad; // columns on both sides of the prefiltered rows, covers all disparity shifts
+    int32_t stride;
+    int32_t stripHeight;
+    uint8_t *prefiltered; // left and right prefiltered images, height x stride each
+    std::vector<StereoThreadBuffers> threads;
+};
+
+static bool validateParams(int32_t height, int32_t width, const StereoBMParams &p)
+{
+    if (height <= 0 || width <= 0) {
+        return false;
+    }
+    if (p.numDisparities <= 0 || p.numDisparities % 16 != 0) {
+        return false;
+    }
+    if (p.blockSize < 5 || p.blockSize > 255 || p.blockSize % 2 == 0) {
+        return false;
+    }
+    if (p.preFilterType != STEREO_PREFILTER_XSOBEL && p.preFilterType != STEREO_PREFILTER_NORMALIZED_RESPONSE) {
+        return false;
+    }
+    if (p.preFilterSize < 5 || p.preFilterSize > 255 || p.preFilterSize % 2 == 0) {
+        return false;
+    }
+    if (p.preFilterCap < 1 || p.preFilterCap > 63) {
+        return false;
+    }
+    if (p.textureThreshold < 0 || p.uniquenessRatio < 0 || p.uniquenessRatio >= 100) {
+        return false;
+    }
+    // window costs are kept in 16 bits
+    if (p.blockSize * p.blockSize * 2 * p.preFilterCap > USHRT_MAX) {
+        return false;
+    }
+    if (p.useSGM && (p.P1 < 0 || p.P2 < p.P1 || p.P2 > USHRT_MAX)) {
+        return false;
+    }
+    return true;
+}
+
+StereoBM::StereoBM(int32_t height, int32_t width, const StereoBMParams &params)
+    : height_(height)
+    , width_(width)
+    , params_(params)
+    , buffers_(NULL)
+{
+    if (params_.useSGM) {
+        int32_t area = params_.blockSize * params_.blockSize;
+        if (params_.P1 == 0) params_.P1 = 8 * area;
+        if (params_.P2 == 0) params_.P2 = std::max(32 * area, params_.P1);
+    }
+    if (!validateParams(height_, width_, params_)) {
+        return;
+    }
+
+    const int32_t numD   = params_.numDisparities;
+    const int32_t blocks = numD + 2 * STEREO_SGM_PAD;
+    buffers_             = new StereoBMBuffers;
+    buffers_->pad        = round_up(numD + abs(params_.minDisparity) + 1, 16);
+    buffers_->stride     = width_ + 2 * buffers_->pad;
+    buffers_->stripHeight = std::max(STEREO_MIN_STRIP_HEIGHT, 4 * params_.blockSize);
+    buffers_->prefiltered = (uint8_t *)ppl::common::AlignedAlloc(2 * height_ * buffers_->stride, 64);
+    // the padding is never written, cost values computed from it are never selected
+    memset(buffers_->prefiltered, params_.preFilterCap, 2 * height_ * buffers_->stride);
+
+    buffers_->threads.resize(get_max_threads());
+    for (size_t t = 0; t < buffers_->threads.size(); ++t) {
+        StereoThreadBuffers &tb = buffers_->threads[t];
+        tb.colCost              = (uint16_t *)ppl::common::AlignedAlloc(width_ * numD * sizeof(uint16_t), 64);
+        tb.rowCost              = (uint16_t *)ppl::common::AlignedAlloc(width_ * numD * sizeof(uint16_t), 64);
+        tb.colTexture           = (uint16_t *)ppl::common::AlignedAlloc(width_ * sizeof(uint16_t), 64);
+        tb.vsum                 = (int32_t *)ppl::common::AlignedAlloc((width_ + params_.preFilterSize + 1) * sizeof(int32_t), 64);
+        tb.sgmPaths             = NULL;
+        tb.sgmMins              = NULL;
+        tb.sgmLeft              = NULL;
+        if (params_.useSGM) {
+            tb.sgmPaths = (uint16_t *)ppl::common::AlignedAlloc(6 * width_ * blocks * sizeof(uint16_t), 64);
+            tb.sgmMins  = (uint16_t *)ppl::common::AlignedAlloc(6 * width_ * sizeof(uint16_t), 64);
+            tb.sgmLeft  = (uint16_t *)ppl::common::AlignedAlloc(2 * blocks * sizeof(uint16_t), 64);
+            memset(tb.sgmPaths, 0xff, 6 * width_ * blocks * sizeof(uint16_t));
+            memset(tb.sgmLeft, 0xff, 2 * blocks * sizeof(uint16_t));
+        }
+    }
+}
+
+StereoBM::~StereoBM()
+{
+    if (buffers_ == NULL) {
+        return;
+    }
+    ppl::common::AlignedFree(buffers_->prefiltered);
+    for (size_t t = 0; t < buffers_->threads.size(); ++t) {
+        StereoThreadBuffers &tb = buffers_->threads[t];
+        ppl::common::AlignedFree(tb.colCost);
+        ppl::common::AlignedFree(tb.rowCost);
+        ppl::common::AlignedFree(tb.colTexture);
+        ppl::common::AlignedFree(tb.vsum);
+        if (tb.sgmPaths) {
+            ppl::common::AlignedFree(tb.sgmPaths);
+            ppl::common::AlignedFree(tb.sgmMins);
+            ppl::common::AlignedFree(tb.sgmLeft);
+        }
+    }
+    delete buffers_;
+}
+
+static inline uint8_t clipPrefiltered(int32_t v, int32_t cap)
+{
+    return (uint8_t)(v < -cap ? 0 : (v > cap ? 2 * cap : v + cap));
+}
+
+// OpenCV's x-Sobel prefilter, 3x3 derivative with reflect 101 rows, clipped to [0, 2 * cap]
+static void prefilterXSobelRows(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t cap,
+    int32_t yBegin,
+    int32_t yEnd,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const __m128i vcap  = _mm_set1_epi16(cap);
+    const __m128i vcap2 = _mm_set1_epi8(2 * cap);
+    const __m128i zero  = _mm_setzero_si128();
+    for (int32_t y = yBegin; y < yEnd; ++y) {
+        const uint8_t *src0 = inData + (y > 0 ? y - 1 : (height > 1 ? 1 : 0)) * inWidthStride;
+        const uint8_t *src1 = inData + y * inWidthStride;
+        const uint8_t *src2 = inData + (y < height - 1 ? y + 1 : (height > 1 ? height - 2 : 0)) * inWidthStride;
+        uint8_t *dst        = outData + y * outWidthStride;
+        // OpenCV filters rows in pairs and leaves the last row of an odd height flat
+        if (y == height - 1 && height % 2 == 1) {
+            memset(dst, cap, width);
+            continue;
+        }
+        dst[0]    = (uint8_t)cap;
+        int32_t x = 1;
+        for (; x + 16 < width; x += 16) {
+            __m128i p0 = _mm_loadu_si128((const __m128i *)(src0 + x + 1));
+            __m128i m0 = _mm_loadu_si128((const __m128i *)(src0 + x - 1));
+            __m128i p1 = _mm_loadu_si128((const __m128i *)(src1 + x + 1));
+            __m128i m1 = _mm_loadu_si128((const __m128i *)(src1 + x - 1));
+            __m128i p2 = _mm_loadu_si128((const __m128i *)(src2 + x + 1));
+            __m128i m2 = _mm_loadu_si128((const __m128i *)(src2 + x - 1));
+
+            __m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(p0, zero), _mm_unpacklo_epi8(m0, zero));
+            lo         = _mm_add_epi16(lo, _mm_slli_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(p1, zero), _mm_unpacklo_epi8(m1, zero)), 1));
+            lo         = _mm_add_epi16(lo, _mm_sub_epi16(_mm_unpacklo_epi8(p2, zero), _mm_unpacklo_epi8(m2, zero)));
+            __m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(p0, zero), _mm_unpackhi_epi8(m0, zero));
+            hi         = _mm_add_epi16(hi, _mm_slli_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(p1, zero), _mm_unpackhi_epi8(m1, zero)), 1));
+            hi         = _mm_add_epi16(hi, _mm_sub_epi16(_mm_unpackhi_epi8(p2, zero), _mm_unpackhi_epi8(m2, zero)));
+
+            // v + cap saturated to [0, 255] then limited to 2 * cap
+            __m128i v = _mm_packus_epi16(_mm_add_epi16(lo, vcap), _mm_add_epi16(hi, vcap));
+            _mm_storeu_si128((__m128i *)(dst + x), _mm_min_epu8(v, vcap2));
+        }
+        for (; x < width - 1; ++x) {
+            int32_t v = (src0[x + 1] - src0[x - 1]) + 2 * (src1[x + 1] - src1[x - 1]) + (src2[x + 1] - src2[x - 1]);
+            dst[x]    = clipPrefiltered(v, cap);
+        }
+        dst[width - 1] = (uint8_t)cap;
+    }
+}
+
+// OpenCV's normalized response prefilter, the pixel minus the local mean with replicated borders
+static void prefilterNormRows(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t winSize,
+    int32_t cap,
+    int32_t yBegin,
+    int32_t yEnd,
+    int32_t *vsumBuf,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const int32_t r       = winSize / 2;
+    const int32_t scale   = winSize * winSize / 8;
+    const int32_t scale_s = (1024 + scale) / (scale * 2);
+    const int32_t scale_g = scale * scale_s;
+    int32_t *vsum         = vsumBuf + r + 1;
+
+    memset(vsum, 0, width * sizeof(int32_t));
+    for (int32_t k = yBegin - r; k <= yBegin + r; ++k) {
+        const uint8_t *src = inData + std::min(std::max(k, 0), height - 1) * inWidthStride;
+        int32_t x          = 0;
+        for (; x <= width - 8; x += 8) {
+            __m128i s  = _mm_loadl_epi64((const __m128i *)(src + x));
+            __m128i v0 = _mm_loadu_si128((const __m128i *)(vsum + x));
+            __m128i v1 = _mm_loadu_si128((const __m128i *)(vsum + x + 4));
+            _mm_storeu_si128((__m128i *)(vsum + x), _mm_add_epi32(v0, _mm_cvtepu8_epi32(s)));
+            _mm_storeu_si128((__m128i *)(vsum + x + 4), _mm_add_epi32(v1, _mm_cvtepu8_epi32(_mm_srli_si128(s, 4))));
+        }
+        for (; x < width; ++x) {
+            vsum[x] += src[x];
+        }
+    }
+
+    for (int32_t y = yBegin; y < yEnd; ++y) {
+        if (y > yBegin) {
+            const uint8_t *top    = inData + std::max(y - r - 1, 0) * inWidthStride;
+            const uint8_t *bottom = inData + std::min(y + r, height - 1) * inWidthStride;
+            int32_t x             = 0;
+            for (; x <= width - 8; x += 8) {
+                __m128i t  = _mm_loadl_epi64((const __m128i *)(top + x));
+                __m128i b  = _mm_loadl_epi64((const __m128i *)(bottom + x));
+                __m128i v0 = _mm_loadu_si128((const __m128i *)(vsum + x));
+                __m128i v1 = _mm_loadu_si128((const __m128i *)(vsum + x + 4));
+                v0         = _mm_sub_epi32(_mm_add_epi32(v0, _mm_cvtepu8_epi32(b)), _mm_cvtepu8_epi32(t));
+                v1         = _mm_sub_epi32(_mm_add_epi32(v1, _mm_cvtepu8_epi32(_mm_srli_si128(b, 4))), _mm_cvtepu8_epi32(_mm_srli_si128(t, 4)));
+                _mm_storeu_si128((__m128i *)(vsum + x), v0);
+                _mm_storeu_si128((__m128i *)(vsum + x + 4), v1);
+            }
+            for (; x < width; ++x) {
+                vsum[x] += bottom[x] - top[x];
+            }
+        }
+        for (int32_t x = 0; x <= r; ++x) {
+            vsum[-x - 1]    = vsum[0];
+            vsum[width + x] = vsum[width - 1];
+        }
+
+        const uint8_t *prev = inData + std::max(y - 1, 0) * inWidthStride;
+        const uint8_t *curr = inData + y * inWidthStride;
+        const uint8_t *next = inData + std::min(y + 1, height - 1) * inWidthStride;
+        uint8_t *dst        = outData + y * outWidthStride;
+
+        int32_t sum = vsum[0] * (r + 1);
+        for (int32_t x = 1; x <= r; ++x) {
+            sum += vsum[x];
+        }
+        for (int32_t x = 0; x < width; ++x) {
+            if (x > 0) {
+                sum += vsum[x + r] - vsum[x - r - 1];
+            }
+            int32_t left  = curr[x > 0 ? x - 1 : 0];
+            int32_t right = curr[x < width - 1 ? x + 1 : width - 1];
+            int32_t val   = ((curr[x] * 4 + left + right + prev[x] + next[x]) * scale_g - sum * scale_s) >> 10;
+            dst[x]        = clipPrefiltered(val, cap);
+        }
+    }
+}
+
+// colCost[x * numD + j] += |addL[x] - addR[x + j]| - |subL[x] - subR[x + j]|, the sub rows are optional
+static void updateColumnCost(
+    const uint8_t *addL,
+    const uint8_t *addR,
+    const uint8_t *subL,
+    const uint8_t *subR,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t numD,
+    uint16_t *colCost)
+{
+    const __m128i zero = _mm_setzero_si128();
+    for (int32_t x = xBegin; x < xEnd; ++x) {
+        uint16_t *cost = colCost + x * numD;
+        __m128i al     = _mm_set1_epi8((char)addL[x]);
+        __m128i sl     = _mm_set1_epi8((char)(subL ? subL[x] : 0));
+        for (int32_t j = 0; j < numD; j += 16) {
+            __m128i ar = _mm_loadu_si128((const __m128i *)(addR + x + j));
+            __m128i ad = _mm_or_si128(_mm_subs_epu8(al, ar), _mm_subs_epu8(ar, al));
+            __m128i c0 = _mm_loadu_si128((const __m128i *)(cost + j));
+            __m128i c1 = _mm_loadu_si128((const __m128i *)(cost + j + 8));
+            c0         = _mm_add_epi16(c0, _mm_unpacklo_epi8(ad, zero));
+            c1         = _mm_add_epi16(c1, _mm_unpackhi_epi8(ad, zero));
+            if (subL) {
+                __m128i sr = _mm_loadu_si128((const __m128i *)(subR + x + j));
+                __m128i sd = _mm_or_si128(_mm_subs_epu8(sl, sr), _mm_subs_epu8(sr, sl));
+                c0         = _mm_sub_epi16(c0, _mm_unpacklo_epi8(sd, zero));
+                c1         = _mm_sub_epi16(c1, _mm_unpackhi_epi8(sd, zero));
+            }
+            _mm_storeu_si128((__m128i *)(cost + j), c0);
+            _mm_storeu_si128((__m128i *)(cost + j + 8), c1);
+        }
+    }
+}
+
+// with a negative minDisparity OpenCV stops the right window of every disparity at the one of column
+// width - 1 + minDisparity, the columns past it are matched against that window
+static void updateColumnCostClamped(
+    bool useFma,
+    const uint8_t *addL,
+    const uint8_t *addR,
+    const uint8_t *subL,
+    const uint8_t *subR,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t clampX,
+    int32_t numD,
+    uint16_t *colCost)
+{
+    const int32_t split = std::min(xEnd, std::max(xBegin, clampX + 1));
+    if (useFma) {
+        fma::stereo_update_column_cost_fma(addL, addR, subL, subR, xBegin, split, numD, colCost);
+    } else {
+        updateColumnCost(addL, addR, subL, subR, xBegin, split, numD, colCost);
+    }
+    for (int32_t x = split; x < xEnd; ++x) {
+        const uint8_t *clampedAddR = addR + clampX - x;
+        const uint8_t *clampedSubR = subR ? subR + clampX - x : NULL;
+        if (useFma) {
+            fma::stereo_update_column_cost_fma(addL, clampedAddR, subL, clampedSubR, x, x + 1, numD, colCost);
+        } else {
+            updateColumnCost(addL, clampedAddR, subL, clampedSubR, x, x + 1, numD, colCost);
+        }
+    }
+}
+
+// rowCost[x] = sum of colCost[x - radius .. x + radius], slid along the row
+static void aggregateRowCost(
+    const uint16_t *colCost,
+    int32_t radius,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t numD,
+    uint16_t *rowCost)
+{
+    uint16_t *first = rowCost + xBegin * numD;
+    memcpy(first, colCost + (xBegin - radius) * numD, numD * sizeof(uint16_t));
+    for (int32_t k = xBegin - radius + 1; k <= xBegin + radius; ++k) {
+        const uint16_t *col = colCost + k * numD;
+        for (int32_t j = 0; j < numD; j += 8) {
+            __m128i s = _mm_loadu_si128((const __m128i *)(first + j));
+            _mm_storeu_si128((__m128i *)(first + j), _mm_add_epi16(s, _mm_loadu_si128((const __m128i *)(col + j))));
+        }
+    }
+    for (int32_t x = xBegin + 1; x < xEnd; ++x) {
+        const uint16_t *prev = rowCost + (x - 1) * numD;
+        const uint16_t *add  = colCost + (x + radius) * numD;
+        const uint16_t *sub  = colCost + (x - radius - 1) * numD;
+        uint16_t *cur        = rowCost + x * numD;
+        for (int32_t j = 0; j < numD; j += 8) {
+            __m128i s = _mm_loadu_si128((const __m128i *)(prev + j));
+            s         = _mm_add_epi16(s, _mm_loadu_si128((const __m128i *)(add + j)));
+            s         = _mm_sub_epi16(s, _mm_loadu_si128((const __m128i *)(sub + j)));
+            _mm_storeu_si128((__m128i *)(cur + j), s);
+        }
+    }
+}
+
+static inline uint16_t minCost(const uint16_t *cost, int32_t numD, int32_t *index)
+{
+    uint16_t best = USHRT_MAX;
+    int32_t idx   = 0;
+    for (int32_t j = 0; j < numD; j += 8) {
+        __m128i m = _mm_minpos_epu16(_mm_loadu_si128((const __m128i *)(cost + j)));
+        uint16_t v = (uint16_t)_mm_extract_epi16(m, 0);
+        if (v < best || j == 0) {
+            best = v;
+            idx  = j + _mm_extract_epi16(m, 1);
+        }
+    }
+    if (index) *index = idx;
+    return best;
+}
+
+// winner-take-all with OpenCV's uniqueness check and subpixel interpolation,
+// cost[j] is the cost of disparity minD + numD - 1 - j
+static inline int16_t selectDisparity(
+    const uint16_t *cost,
+    int32_t numD,
+    int32_t minD,
+    int32_t uniquenessRatio,
+    int16_t invalid)
+{
+    int32_t mind;
+    int32_t minsad = minCost(cost, numD, &mind);
+
+    if (uniquenessRatio > 0) {
+        int32_t thresh      = std::min(minsad + minsad * uniquenessRatio / 100, (int32_t)USHRT_MAX);
+        const __m128i vthr  = _mm_set1_epi16((int16_t)thresh);
+        const __m128i vmind = _mm_set1_epi16((int16_t)mind);
+        const __m128i one   = _mm_set1_epi16(1);
+        __m128i idx         = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+        __m128i rejected    = _mm_setzero_si128();
+        for (int32_t j = 0; j < numD; j += 8) {
+            __m128i c    = _mm_loadu_si128((const __m128i *)(cost + j));
+            __m128i low  = _mm_cmpeq_epi16(_mm_min_epu16(c, vthr), c);
+            __m128i dist = _mm_abs_epi16(_mm_sub_epi16(idx, vmind));
+            rejected     = _mm_or_si128(rejected, _mm_and_si128(low, _mm_cmpgt_epi16(dist, one)));
+            idx          = _mm_add_epi16(idx, _mm_set1_epi16(8));
+        }
+        if (!_mm_testz_si128(rejected, rejected)) {
+            return invalid;
+        }
+    }
+
+    if (0 < mind && mind < numD - 1) {
+        int32_t p = cost[mind + 1], n = cost[mind - 1];
+        int32_t d = p + n - 2 * minsad + abs(p - n);
+        return (int16_t)(((numD - mind - 1 + minD) * 256 + (d != 0 ? (p - n) * 256 / d : 0) + 15) >> 4);
+    }
+    return (int16_t)((numD - mind - 1 + minD) * 16);
+}
+
+// one step of a SGM path, Lr = C + min(Lp(j), Lp(j -+ 1) + P1, min(Lp) + P2) - min(Lp)
+static inline uint16_t sgmPathStep(
+    const uint16_t *cost,
+    const uint16_t *prev,
+    uint16_t prevMin,
+    int32_t numD,
+    __m128i vP1,
+    __m128i vP2,
+    uint16_t *cur)
+{
+    __m128i vmin  = _mm_set1_epi16((int16_t)prevMin);
+    __m128i bound = _mm_adds_epu16(vmin, vP2);
+    __m128i best  = _mm_set1_epi16(-1);
+    for (int32_t j = 0; j < numD; j += 8) {
+        __m128i lp = _mm_loadu_si128((const __m128i *)(prev + j));
+        __m128i lm = _mm_adds_epu16(_mm_loadu_si128((const __m128i *)(prev + j - 1)), vP1);
+        __m128i ln = _mm_adds_epu16(_mm_loadu_si128((const __m128i *)(prev + j + 1)), vP1);
+        __m128i m  = _mm_min_epu16(_mm_min_epu16(lp, bound), _mm_min_epu16(lm, ln));
+        __m128i lr = _mm_subs_epu16(_mm_adds_epu16(_mm_loadu_si128((const __m128i *)(cost + j)), m), vmin);
+        _mm_storeu_si128((__m128i *)(cur + j), lr);
+        best = _mm_min_epu16(best, lr);
+    }
+    return (uint16_t)_mm_extract_epi16(_mm_minpos_epu16(best), 0);
+}
+
+static inline uint16_t sgmPathStart(const uint16_t *cost, int32_t numD, uint16_t *cur)
+{
+    memcpy(cur, cost, numD * sizeof(uint16_t));
+    return minCost(cost, numD, NULL);
+}
+
+// aggregates the window costs of one row along the left, top-left, top and top-right paths,
+// rowCost is replaced by the average of the 4 path costs
+static void aggregateSGMRow(
+    const StereoBMParams &params,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t width,
+    bool firstRow,
+    int32_t parity,
+    StereoThreadBuffers &tb,
+    uint16_t *rowCost)
+{
+    const int32_t numD   = params.numDisparities;
+    const int32_t blocks = numD + 2 * STEREO_SGM_PAD;
+    const __m128i vP1    = _mm_set1_epi16((int16_t)params.P1);
+    const __m128i vP2    = _mm_set1_epi16((int16_t)params.P2);
+
+    uint16_t *prevPaths = tb.sgmPaths + (1 - parity) * 3 * width * blocks + STEREO_SGM_PAD;
+    uint16_t *curPaths  = tb.sgmPaths + parity * 3 * width * blocks + STEREO_SGM_PAD;
+    uint16_t *prevMins  = tb.sgmMins + (1 - parity) * 3 * width;
+    uint16_t *curMins   = tb.sgmMins + parity * 3 * width;
+    uint16_t *left[2]   = {tb.sgmLeft + STEREO_SGM_PAD, tb.sgmLeft + blocks + STEREO_SGM_PAD};
+    uint16_t leftMin    = 0;
+
+    for (int32_t x = xBegin; x < xEnd; ++x) {
+        uint16_t *cost   = rowCost + x * numD;
+        uint16_t *lcur   = left[x & 1];
+        uint16_t *lprev  = left[(x & 1) ^ 1];
+        // vertical paths: 0 from top-left, 1 from top, 2 from top-right
+        uint16_t *cur[3] = {curPaths + x * blocks,
+                            curPaths + (width + x) * blocks,
+                            curPaths + (2 * width + x) * blocks};
+        leftMin = x == xBegin ? sgmPathStart(cost, numD, lcur)
+                              : sgmPathStep(cost, lprev, leftMin, numD, vP1, vP2, lcur);
+        for (int32_t k = 0; k < 3; ++k) {
+            int32_t px = x + k - 1;
+            if (firstRow || px < xBegin || px >= xEnd) {
+                curMins[k * width + x] = sgmPathStart(cost, numD, cur[k]);
+            } else {
+                curMins[k * width + x] = sgmPathStep(cost, prevPaths + (k * width + px) * blocks, prevMins[k * width + px], numD, vP1, vP2, cur[k]);
+            }
+        }
+        for (int32_t j = 0; j < numD; j += 8) {
+            __m128i a = _mm_avg_epu16(_mm_loadu_si128((const __m128i *)(lcur + j)), _mm_loadu_si128((const __m128i *)(cur[0] + j)));
+            __m128i b = _mm_avg_epu16(_mm_loadu_si128((const __m128i *)(cur[1] + j)), _mm_loadu_si128((const __m128i *)(cur[2] + j)));
+            _mm_storeu_si128((__m128i *)(cost + j), _mm_avg_epu16(a, b));
+        }
+    }
+}
+
+static void updateColumnTexture(
+    const uint8_t *addL,
+    const uint8_t *subL,
+    int32_t xBegin,
+    int32_t xEnd,
+    int32_t cap,
+    uint16_t *colTexture)
+{
+    const __m128i vcap = _mm_set1_epi8((char)cap);
+    const __m128i zero = _mm_setzero_si128();
+    int32_t x          = xBegin;
+    for (; x <= xEnd - 16; x += 16) {
+        __m128i a  = _mm_loadu_si128((const __m128i *)(addL + x));
+        __m128i ad = _mm_or_si128(_mm_subs_epu8(a, vcap), _mm_subs_epu8(vcap, a));
+        __m128i c0 = _mm_add_epi16(_mm_loadu_si128((const __m128i *)(colTexture + x)), _mm_unpacklo_epi8(ad, zero));
+        __m128i c1 = _mm_add_epi16(_mm_loadu_si128((const __m128i *)(colTexture + x + 8)), _mm_unpackhi_epi8(ad, zero));
+        if (subL) {
+            __m128i s  = _mm_loadu_si128((const __m128i *)(subL + x));
+            __m128i sd = _mm_or_si128(_mm_subs_epu8(s, vcap), _mm_subs_epu8(vcap, s));
+            c0         = _mm_sub_epi16(c0, _mm_unpacklo_epi8(sd, zero));
+            c1         = _mm_sub_epi16(c1, _mm_unpackhi_epi8(sd, zero));
+        }
+        _mm_storeu_si128((__m128i *)(colTexture + x), c0);
+        _mm_storeu_si128((__m128i *)(colTexture + x + 8), c1);
+    }
+    for (; x < xEnd; ++x) {
+        colTexture[x] += abs(addL[x] - cap) - (subL ? abs(subL[x] - cap) : 0);
+    }
+}
+
+static void matchStrip(
+    int32_t height,
+    int32_t width,
+    const StereoBMParams &params,
+    const StereoBMBuffers &buffers,
+    StereoThreadBuffers &tb,
+    int32_t y0,
+    int32_t y1,
+    int32_t outWidthStride,
+    int16_t *disparity)
+{
+    const int32_t numD    = params.numDisparities;
+    const int32_t minD    = params.minDisparity;
+    const int32_t r       = params.blockSize / 2;
+    const int32_t cap     = params.preFilterCap;
+    const int16_t invalid = (int16_t)((minD - 1) * 16);
+    const int32_t stride  = buffers.stride;
+    const uint8_t *left   = buffers.prefiltered + buffers.pad;
+    // lane j of a cost vector is disparity minD + numD - 1 - j
+    const uint8_t *right  = buffers.prefiltered + height * stride + buffers.pad - minD - numD + 1;
+
+    const int32_t xBegin = std::max(r, r + minD + numD - 1);
+    // OpenCV computes the columns before width + minDisparity, whose windows may still reach past it
+    const int32_t xEnd   = std::min(width - r, width + minD);
+    const int32_t ys     = std::max(y0, r);
+    const int32_t ye     = std::min(y1, height - r);
+
+    for (int32_t y = y0; y < y1; ++y) {
+        int16_t *dst = disparity + y * outWidthStride;
+        if (y < ys || y >= ye || xBegin >= xEnd) {
+            for (int32_t x = 0; x < width; ++x) dst[x] = invalid;
+        } else {
+            for (int32_t x = 0; x < xBegin; ++x) dst[x] = invalid;
+            for (int32_t x = xEnd; x < width; ++x) dst[x] = invalid;
+        }
+    }
+    if (ys >= ye || xBegin >= xEnd) {
+        return;
+    }
+
+    const bool useFma    = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t cBegin = xBegin - r;
+    const int32_t cEnd   = xEnd + r;
+    const int32_t clampX = width - 1 + std::min(minD, 0);
+    const int32_t yStart = params.useSGM ? std::max(r, ys - STEREO_SGM_WARMUP_ROWS) : ys;
+
+    memset(tb.colCost + cBegin * numD, 0, (cEnd - cBegin) * numD * sizeof(uint16_t));
+    memset(tb.colTexture + cBegin, 0, (cEnd - cBegin) * sizeof(uint16_t));
+
+    for (int32_t y = yStart; y < ye; ++y) {
+        if (y == yStart) {
+            for (int32_t k = y - r; k <= y + r; ++k) {
+                updateColumnCostClamped(useFma, left + k * stride, right + k * stride, NULL, NULL, cBegin, cEnd, clampX, numD, tb.colCost);
+                updateColumnTexture(left + k * stride, NULL, cBegin, cEnd, cap, tb.colTexture);
+            }
+        } else {
+            const int32_t ka = y + r, ks = y - r - 1;
+            updateColumnCostClamped(useFma, left + ka * stride, right + ka * stride, left + ks * stride, right + ks * stride, cBegin, cEnd, clampX, numD, tb.colCost);
+            updateColumnTexture(left + ka * stride, left + ks * stride, cBegin, cEnd, cap, tb.colTexture);
+        }
+
+        if (useFma) {
+            fma::stereo_aggregate_row_cost_fma(tb.colCost, r, xBegin, xEnd, numD, tb.rowCost);
+        } else {
+            aggregateRowCost(tb.colCost, r, xBegin, xEnd, numD, tb.rowCost);
+        }
+        if (params.useSGM) {
+            aggregateSGMRow(params, xBegin, xEnd, width, y == yStart, (y - yStart) & 1, tb, tb.rowCost);
+        }
+        if (y < ys) {
+            continue;
+        }
+
+        int16_t *dst    = disparity + y * outWidthStride;
+        int32_t texture = 0;
+        for (int32_t k = xBegin - r; k <= xBegin + r; ++k) {
+            texture += tb.colTexture[k];
+        }
+        for (int32_t x = xBegin; x < xEnd; ++x) {
+            if (x > xBegin) {
+                texture += tb.colTexture[x + r] - tb.colTexture[x - r - 1];
+            }
+            if (texture < params.textureThreshold) {
+                dst[x] = invalid;
+            } else {
+                dst[x] = selectDisparity(tb.rowCost + x * numD, numD, minD, params.uniquenessRatio, invalid);
+            }
+        }
+    }
+}
+
+::ppl::common::RetCode StereoBM::Compute(
+    int32_t leftWidthStride,
+    const uint8_t *left,
+    int32_t rightWidthStride,
+    const uint8_t *right,
+    int32_t outWidthStride,
+    int16_t *disparity)
+{
+    if (buffers_ == NULL || left == NULL || right == NULL || disparity == NULL) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (leftWidthStride < width_ || rightWidthStride < width_ || outWidthStride < width_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int32_t stripHeight = buffers_->stripHeight;
+    const int32_t numStrips   = (height_ + stripHeight - 1) / stripHeight;
+    const int32_t stride      = buffers_->stride;
+
+#pragma omp parallel for schedule(dynamic) num_threads((int32_t)buffers_->threads.size())
+    for (int32_t task = 0; task < 2 * numStrips; ++task) {
+        const int32_t image   = task / numStrips;
+        const int32_t y0      = (task % numStrips) * stripHeight;
+        const int32_t y1      = std::min(y0 + stripHeight, height_);
+        const uint8_t *src    = image == 0 ? left : right;
+        const int32_t srcStep = image == 0 ? leftWidthStride : rightWidthStride;
+        uint8_t *dst          = buffers_->prefiltered + image * height_ * stride + buffers_->pad;
+        if (params_.preFilterType == STEREO_PREFILTER_XSOBEL) {
+            prefilterXSobelRows(height_, width_, srcStep, src, params_.preFilterCap, y0, y1, stride, dst);
+        } else {
+            prefilterNormRows(height_, width_, srcStep, src, params_.preFilterSize, params_.preFilterCap, y0, y1,
+                              buffers_->threads[get_thread_num()].vsum, stride, dst);
+        }
+    }
+
+#pragma omp parallel for schedule(dynamic) num_threads((int32_t)buffers_->threads.size())
+    for (int32_t strip = 0; strip < numStrips; ++strip) {
+        const int32_t y0 = strip * stripHeight;
+        const int32_t y1 = std::min(y0 + stripHeight, height_);
+        matchStrip(height_, width_, params_, *buffers_, buffers_->threads[get_thread_num()], y0, y1, outWidthStride, disparity);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
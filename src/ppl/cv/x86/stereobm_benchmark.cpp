@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/stereobm.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+#include <opencv2/calib3d.hpp>
+
+namespace {
+
+void BM_StereoBM_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> left(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> right(new uint8_t[width * height]);
+    std::unique_ptr<int16_t[]> dst(new int16_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(left.get(), width * height, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(right.get(), width * height, 0, 255);
+    ppl::cv::x86::StereoBMParams params;
+    params.numDisparities = 64;
+    params.blockSize = 15;
+    ppl::cv::x86::StereoBM matcher(height, width, params);
+    for (auto _ : state) {
+        matcher.Compute(width, left.get(), width, right.get(), width, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_StereoSGM_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> left(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> right(new uint8_t[width * height]);
+    std::unique_ptr<int16_t[]> dst(new int16_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(left.get(), width * height, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(right.get(), width * height, 0, 255);
+    ppl::cv::x86::StereoBMParams params;
+    params.numDisparities = 64;
+    params.blockSize = 7;
+    params.useSGM = true;
+    ppl::cv::x86::StereoBM matcher(height, width, params);
+    for (auto _ : state) {
+        matcher.Compute(width, left.get(), width, right.get(), width, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK(BM_StereoBM_ppl_x86)->Args({640, 480})->Args({1280, 720});
+BENCHMARK(BM_StereoSGM_ppl_x86)->Args({640, 480})->Args({1280, 720});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+static void BM_StereoBM_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> left(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> right(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(left.get(), width * height, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(right.get(), width * height, 0, 255);
+    cv::Mat leftMat(height, width, CV_8UC1, left.get());
+    cv::Mat rightMat(height, width, CV_8UC1, right.get());
+    cv::Mat dstMat;
+    cv::Ptr<cv::StereoBM> matcher = cv::StereoBM::create(64, 15);
+    for (auto _ : state) {
+        matcher->compute(leftMat, rightMat, dstMat);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK(BM_StereoBM_opencv_x86)->Args({640, 480})->Args({1280, 720});
+#endif //! PPLCV_BENCHMARK_OPENCV
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/stereobm.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+#include <opencv2/calib3d.hpp>
+
+// a textured background shifted by 16 pixels, and a box in front of it shifted by 32 pixels
+static void MakeStereoPair(cv::Mat& left, cv::Mat& right, cv::Mat& truth)
+{
+    const int32_t height = left.rows, width = left.cols;
+    cv::Mat noise(height / 4 + 1, (width + 64) / 4 + 1, CV_8UC1);
+    cv::randu(noise, cv::Scalar(0), cv::Scalar(256));
+    cv::Mat texture;
+    cv::resize(noise, texture, cv::Size(width + 64, height), 0, 0, cv::INTER_LINEAR);
+    cv::GaussianBlur(texture, texture, cv::Size(3, 3), 0);
+
+    texture(cv::Rect(32, 0, width, height)).copyTo(left);
+    texture(cv::Rect(48, 0, width, height)).copyTo(right);
+    cv::Rect box(width / 3, height / 4, width / 3, height / 2);
+    left(box).copyTo(right(box - cv::Point(32, 0)));
+    truth.setTo(16);
+    truth(box).setTo(32);
+}
+
+void StereoBMTest(int32_t height, int32_t width, int32_t numDisparities, int32_t blockSize, ppl::cv::x86::StereoPreFilterType preFilterType, int32_t minDisparity = 0)
+{
+    cv::Mat left(height, width, CV_8UC1), right(height, width, CV_8UC1), truth(height, width, CV_32SC1);
+    MakeStereoPair(left, right, truth);
+
+    ppl::cv::x86::StereoBMParams params;
+    params.numDisparities = numDisparities;
+    params.blockSize      = blockSize;
+    params.preFilterType  = preFilterType;
+    params.minDisparity   = minDisparity;
+    ppl::cv::x86::StereoBM matcher(height, width, params);
+    cv::Mat dst(height, width, CV_16SC1);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, matcher.Compute(width, left.ptr<uint8_t>(), width, right.ptr<uint8_t>(), width, dst.ptr<int16_t>()));
+
+    cv::Ptr<cv::StereoBM> ref = cv::StereoBM::create(numDisparities, blockSize);
+    ref->setMinDisparity(minDisparity);
+    ref->setPreFilterType(preFilterType == ppl::cv::x86::STEREO_PREFILTER_XSOBEL ? cv::StereoBM::PREFILTER_XSOBEL : cv::StereoBM::PREFILTER_NORMALIZED_RESPONSE);
+    cv::Mat dst_ref;
+    ref->compute(left, right, dst_ref);
+
+    checkResult<int16_t, 1>(dst_ref.ptr<int16_t>(), dst.ptr<int16_t>(), height, width, width, width, 0.f);
+}
+
+// SGM has no OpenCV counterpart, its result is checked against the known disparities
+void StereoSGMTest(int32_t height, int32_t width, int32_t numDisparities, int32_t blockSize)
+{
+    cv::Mat left(height, width, CV_8UC1), right(height, width, CV_8UC1), truth(height, width, CV_32SC1);
+    MakeStereoPair(left, right, truth);
+
+    ppl::cv::x86::StereoBMParams params;
+    params.numDisparities = numDisparities;
+    params.blockSize      = blockSize;
+    params.useSGM         = true;
+    ppl::cv::x86::StereoBM matcher(height, width, params);
+    cv::Mat dst(height, width, CV_16SC1);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, matcher.Compute(width, left.ptr<uint8_t>(), width, right.ptr<uint8_t>(), width, dst.ptr<int16_t>()));
+
+    int32_t valid = 0, bad = 0;
+    for (int32_t i = 0; i < height; ++i) {
+        for (int32_t j = 0; j < width; ++j) {
+            int16_t d = dst.at<int16_t>(i, j);
+            if (d < 0) continue;
+            ++valid;
+            bad += std::abs(d / 16.f - truth.at<int32_t>(i, j)) > 1.f;
+        }
+    }
+    EXPECT_GT(valid, height * width / 2);
+    EXPECT_LT(bad, valid / 10);
+}
+
+TEST(StereoBM_UINT8, x86)
+{
+    StereoBMTest(480, 640, 64, 21, ppl::cv::x86::STEREO_PREFILTER_XSOBEL);
+    StereoBMTest(480, 640, 48, 9, ppl::cv::x86::STEREO_PREFILTER_NORMALIZED_RESPONSE);
+    StereoBMTest(241, 321, 32, 15, ppl::cv::x86::STEREO_PREFILTER_XSOBEL);
+    StereoBMTest(480, 640, 64, 21, ppl::cv::x86::STEREO_PREFILTER_XSOBEL, -16);
+    StereoBMTest(240, 320, 32, 9, ppl::cv::x86::STEREO_PREFILTER_NORMALIZED_RESPONSE, -40);
+}
+
+TEST(StereoSGM_UINT8, x86)
+{
+    StereoSGMTest(480, 640, 64, 7);
+    StereoSGMTest(241, 321, 48, 5);
+}
@@ -0,0 +1,277 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/temporaldenoiser.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define DENOISER_MAX_HISTORY      4
+#define DENOISER_MAX_SEARCH_RANGE 16
+
+// previous outputs in a ring, each frame is the luma plane followed by the interleaved chroma plane
+struct TemporalDenoiserBuffers {
+    uint8_t *frames;
+    size_t frameSize;
+    int32_t newest;
+    int32_t count;
+};
+
+struct MotionVector {
+    int32_t dx;
+    int32_t dy;
+};
+
+template <int32_t bs>
+static inline int32_t blockSad(const uint8_t *cur, int32_t curStride, const uint8_t *ref, int32_t refStride)
+{
+    __m128i acc = _mm_setzero_si128();
+    for (int32_t i = 0; i < bs; ++i) {
+        if (bs == 16) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(cur + i * curStride));
+            __m128i b = _mm_loadu_si128((const __m128i *)(ref + i * refStride));
+            acc       = _mm_add_epi64(acc, _mm_sad_epu8(a, b));
+        } else {
+            __m128i a = _mm_loadl_epi64((const __m128i *)(cur + i * curStride));
+            __m128i b = _mm_loadl_epi64((const __m128i *)(ref + i * refStride));
+            acc       = _mm_add_epi64(acc, _mm_sad_epu8(a, b));
+        }
+    }
+    return _mm_cvtsi128_si32(acc) + _mm_extract_epi32(acc, 2);
+}
+
+// full search of the block at (x0, y0) in the reference, vectors which would leave the frame are skipped.
+// A block that matches the co-located one within the noise keeps the zero vector
+template <int32_t bs>
+static MotionVector searchBlock(int32_t height, int32_t width, int32_t range, int32_t staticSad, int32_t x0, int32_t y0,
+                                int32_t curStride, const uint8_t *cur, const uint8_t *ref)
+{
+    MotionVector best = {0, 0};
+    const uint8_t *blk = cur + y0 * curStride + x0;
+    const uint8_t *co  = ref + y0 * width + x0;
+    int32_t bestSad    = blockSad<bs>(blk, curStride, co, width);
+    if (bestSad <= staticSad) {
+        return best;
+    }
+    const int32_t dy0 = std::max(-range, -y0), dy1 = std::min(range, height - bs - y0);
+    const int32_t dx0 = std::max(-range, -x0), dx1 = std::min(range, width - bs - x0);
+    for (int32_t dy = dy0; dy <= dy1; ++dy) {
+        for (int32_t dx = dx0; dx <= dx1; ++dx) {
+            int32_t sad = blockSad<bs>(blk, curStride, co + dy * width + dx, width);
+            // the shorter vector wins ties, so that flat areas do not drift
+            if (sad < bestSad || (sad == bestSad && std::abs(dx) + std::abs(dy) < std::abs(best.dx) + std::abs(best.dy))) {
+                bestSad = sad;
+                best.dx = dx;
+                best.dy = dy;
+            }
+        }
+    }
+    return best;
+}
+
+// weighted average of the current pixels and the motion-compensated references, every reference pixel
+// weighs max(threshold - |reference - current|, 0) and the current one weighs threshold
+static void blendRow(int32_t len, const uint8_t *cur, const uint8_t *const *refs, int32_t numRefs, int32_t threshold, uint8_t *dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vt   = _mm_set1_epi16((int16_t)threshold);
+    int32_t i          = 0;
+    for (; i <= len - 8; i += 8) {
+        __m128i p[DENOISER_MAX_HISTORY + 2], w[DENOISER_MAX_HISTORY + 2];
+        p[0]        = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(cur + i)));
+        w[0]        = vt;
+        __m128i den = vt;
+        for (int32_t r = 0; r < numRefs; ++r) {
+            p[r + 1] = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(refs[r] + i)));
+            w[r + 1] = _mm_max_epi16(_mm_sub_epi16(vt, _mm_abs_epi16(_mm_sub_epi16(p[r + 1], p[0]))), zero);
+            den      = _mm_add_epi16(den, w[r + 1]);
+        }
+        int32_t n = numRefs + 1;
+        if (n & 1) {
+            p[n] = zero;
+            w[n] = zero;
+            ++n;
+        }
+        // pairs of sources are multiplied and added in 32 bits by madd
+        __m128i numLo = zero, numHi = zero;
+        for (int32_t k = 0; k < n; k += 2) {
+            numLo = _mm_add_epi32(numLo, _mm_madd_epi16(_mm_unpacklo_epi16(p[k], p[k + 1]), _mm_unpacklo_epi16(w[k], w[k + 1])));
+            numHi = _mm_add_epi32(numHi, _mm_madd_epi16(_mm_unpackhi_epi16(p[k], p[k + 1]), _mm_unpackhi_epi16(w[k], w[k + 1])));
+        }
+        __m128 lo  = _mm_div_ps(_mm_cvtepi32_ps(numLo), _mm_cvtepi32_ps(_mm_unpacklo_epi16(den, zero)));
+        __m128 hi  = _mm_div_ps(_mm_cvtepi32_ps(numHi), _mm_cvtepi32_ps(_mm_unpackhi_epi16(den, zero)));
+        __m128i v  = _mm_packs_epi32(_mm_cvtps_epi32(lo), _mm_cvtps_epi32(hi));
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(v, v));
+    }
+    for (; i < len; ++i) {
+        int32_t num = cur[i] * threshold, den = threshold;
+        for (int32_t r = 0; r < numRefs; ++r) {
+            int32_t wr = std::max(threshold - std::abs((int32_t)refs[r][i] - cur[i]), 0);
+            num += refs[r][i] * wr;
+            den += wr;
+        }
+        dst[i] = (uint8_t)std::min((int32_t)std::lrint((float)num / den), 255);
+    }
+}
+
+static bool validateParams(int32_t height, int32_t width, const TemporalDenoiserParams &p)
+{
+    if (p.historyLength < 1 || p.historyLength > DENOISER_MAX_HISTORY) {
+        return false;
+    }
+    if ((p.blockSize != 8 && p.blockSize != 16) || p.searchRange < 0 || p.searchRange > DENOISER_MAX_SEARCH_RANGE) {
+        return false;
+    }
+    if (!(p.noiseLevel > 0.f)) {
+        return false;
+    }
+    return height >= p.blockSize && width >= p.blockSize && height % 2 == 0 && width % 2 == 0;
+}
+
+TemporalDenoiser::TemporalDenoiser(int32_t height, int32_t width, const TemporalDenoiserParams &params)
+    : height_(height)
+    , width_(width)
+    , params_(params)
+    , buffers_(NULL)
+{
+    if (!validateParams(height_, width_, params_)) {
+        return;
+    }
+    buffers_            = new TemporalDenoiserBuffers;
+    buffers_->frameSize = (size_t)height_ * width_ + (size_t)(height_ / 2) * width_;
+    buffers_->frames    = (uint8_t *)ppl::common::AlignedAlloc(buffers_->frameSize * params_.historyLength, 64);
+    buffers_->newest    = 0;
+    buffers_->count     = 0;
+    // without its history the denoiser is left invalid, like with wrong parameters
+    if (buffers_->frames == NULL) {
+        delete buffers_;
+        buffers_ = NULL;
+    }
+}
+
+TemporalDenoiser::~TemporalDenoiser()
+{
+    if (buffers_ == NULL) {
+        return;
+    }
+    ppl::common::AlignedFree(buffers_->frames);
+    delete buffers_;
+}
+
+void TemporalDenoiser::Reset()
+{
+    if (buffers_ != NULL) {
+        buffers_->count = 0;
+    }
+}
+
+template <int32_t bs>
+static void denoiseBlockRow(int32_t height, int32_t width, const TemporalDenoiserParams &params, const uint8_t *const *refs,
+                            int32_t numRefs, int32_t by, int32_t inYStride, const uint8_t *inY, int32_t inUVStride,
+                            const uint8_t *inUV, int32_t outYStride, uint8_t *outY, int32_t outUVStride, uint8_t *outUV)
+{
+    const int32_t threshold = std::min(std::max((int32_t)std::lrint(3.f * params.noiseLevel), 1), 255);
+    const int32_t staticSad = (int32_t)(bs * bs * params.noiseLevel);
+    const size_t lumaSize   = (size_t)height * width;
+    const int32_t y0        = std::min(by * bs, height - bs);
+    const int32_t ys = by * bs, ye = std::min(ys + bs, height);
+    for (int32_t xs = 0; xs < width; xs += bs) {
+        const int32_t x0 = std::min(xs, width - bs);
+        const int32_t xe = std::min(xs + bs, width);
+        MotionVector mv[DENOISER_MAX_HISTORY];
+        for (int32_t r = 0; r < numRefs; ++r) {
+            mv[r] = searchBlock<bs>(height, width, params.searchRange, staticSad, x0, y0, inYStride, inY, refs[r]);
+        }
+
+        // the pixels of a clipped last block are compensated with the vector of the block shifted inside
+        const uint8_t *rows[DENOISER_MAX_HISTORY];
+        for (int32_t y = ys; y < ye; ++y) {
+            for (int32_t r = 0; r < numRefs; ++r) {
+                rows[r] = refs[r] + (y + mv[r].dy) * width + xs + mv[r].dx;
+            }
+            blendRow(xe - xs, inY + y * inYStride + xs, rows, numRefs, threshold, outY + y * outYStride + xs);
+        }
+        // chroma follows the luma vectors at half resolution, a chroma pixel is two bytes of the UV plane
+        for (int32_t y = ys / 2; y < ye / 2; ++y) {
+            for (int32_t r = 0; r < numRefs; ++r) {
+                rows[r] = refs[r] + lumaSize + (y + (mv[r].dy >> 1)) * width + xs + 2 * (mv[r].dx >> 1);
+            }
+            blendRow(xe - xs, inUV + y * inUVStride + xs, rows, numRefs, threshold, outUV + y * outUVStride + xs);
+        }
+    }
+}
+
+::ppl::common::RetCode TemporalDenoiser::Apply(
+    int32_t inYStride,
+    const uint8_t *inY,
+    int32_t inUVStride,
+    const uint8_t *inUV,
+    int32_t outYStride,
+    uint8_t *outY,
+    int32_t outUVStride,
+    uint8_t *outUV)
+{
+    if (buffers_ == NULL || inY == NULL || inUV == NULL || outY == NULL || outUV == NULL) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inYStride < width_ || inUVStride < width_ || outYStride < width_ || outUVStride < width_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int32_t numRefs = buffers_->count;
+    const uint8_t *refs[DENOISER_MAX_HISTORY];
+    for (int32_t r = 0; r < numRefs; ++r) {
+        int32_t slot = (buffers_->newest - r + params_.historyLength) % params_.historyLength;
+        refs[r]      = buffers_->frames + slot * buffers_->frameSize;
+    }
+
+    const int32_t blockRows = (height_ + params_.blockSize - 1) / params_.blockSize;
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t by = 0; by < blockRows; ++by) {
+        if (params_.blockSize == 16) {
+            denoiseBlockRow<16>(height_, width_, params_, refs, numRefs, by, inYStride, inY, inUVStride, inUV, outYStride, outY, outUVStride, outUV);
+        } else {
+            denoiseBlockRow<8>(height_, width_, params_, refs, numRefs, by, inYStride, inY, inUVStride, inUV, outYStride, outY, outUVStride, outUV);
+        }
+    }
+
+    // the output becomes the newest reference, in place of the oldest one
+    const int32_t slot = numRefs == 0 ? 0 : (buffers_->newest + 1) % params_.historyLength;
+    uint8_t *frame     = buffers_->frames + slot * buffers_->frameSize;
+    for (int32_t y = 0; y < height_; ++y) {
+        memcpy(frame + y * width_, outY + y * outYStride, width_);
+    }
+    for (int32_t y = 0; y < height_ / 2; ++y) {
+        memcpy(frame + (size_t)height_ * width_ + y * width_, outUV + y * outUVStride, width_);
+    }
+    buffers_->newest = slot;
+    buffers_->count  = std::min(numRefs + 1, params_.historyLength);
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
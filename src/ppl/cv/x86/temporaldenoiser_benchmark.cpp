@@ -0,0 +1,44 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/temporaldenoiser.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+template <int32_t blockSize>
+void BM_TemporalDenoiser_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3 / 2]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3 / 2]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3 / 2, 0, 255);
+    ppl::cv::x86::TemporalDenoiserParams params;
+    params.blockSize = blockSize;
+    ppl::cv::x86::TemporalDenoiser denoiser(height, width, params);
+    for (auto _ : state) {
+        denoiser.Apply(width, src.get(), width, src.get() + width * height, width, dst.get(), width, dst.get() + width * height);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+}
+
+BENCHMARK_TEMPLATE(BM_TemporalDenoiser_ppl_x86, 16)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_TemporalDenoiser_ppl_x86, 8)->Args({640, 480})->Args({1920, 1080});
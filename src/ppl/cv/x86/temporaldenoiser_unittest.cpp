@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/temporaldenoiser.h"
+#include "ppl/cv/x86/test.h"
+#include <vector>
+#include <cmath>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+
+// the denoiser has no OpenCV counterpart, it is checked on a smooth scene which moves by (2, 1) pixels per
+// frame: the output must be closer to the clean frames than the noisy input
+static void MakeSequence(int32_t height, int32_t width, int32_t numFrames, std::vector<cv::Mat>& clean, std::vector<cv::Mat>& noisy)
+{
+    cv::Mat scene(height + 2 * numFrames, width + 2 * numFrames, CV_32FC3);
+    cv::randu(scene, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::GaussianBlur(scene, scene, cv::Size(0, 0), 4);
+    cv::normalize(scene, scene, 0, 255, cv::NORM_MINMAX);
+    for (int32_t i = 0; i < numFrames; ++i) {
+        cv::Mat bgr, yuv;
+        scene(cv::Rect(2 * i, i, width, height)).convertTo(bgr, CV_8U);
+        cv::cvtColor(bgr, yuv, cv::COLOR_BGR2YUV_I420);
+        // I420 to NV12: the U and V planes are interleaved
+        cv::Mat nv12(height * 3 / 2, width, CV_8UC1);
+        yuv(cv::Rect(0, 0, width, height)).copyTo(nv12(cv::Rect(0, 0, width, height)));
+        const uint8_t* u = yuv.ptr<uint8_t>(height);
+        const uint8_t* v = u + height / 2 * width / 2;
+        for (int32_t y = 0; y < height / 2; ++y) {
+            uint8_t* uv = nv12.ptr<uint8_t>(height + y);
+            for (int32_t x = 0; x < width / 2; ++x) {
+                uv[2 * x]     = u[y * width / 2 + x];
+                uv[2 * x + 1] = v[y * width / 2 + x];
+            }
+        }
+        cv::Mat noise(nv12.size(), CV_32FC1), frame;
+        cv::randn(noise, cv::Scalar(0), cv::Scalar(6));
+        nv12.convertTo(frame, CV_32F);
+        cv::Mat(frame + noise).convertTo(frame, CV_8U);
+        clean.push_back(nv12);
+        noisy.push_back(frame);
+    }
+}
+
+void TemporalDenoiserTest(int32_t height, int32_t width, int32_t blockSize, int32_t historyLength)
+{
+    const int32_t numFrames = 12;
+    std::vector<cv::Mat> clean, noisy;
+    MakeSequence(height, width, numFrames, clean, noisy);
+
+    ppl::cv::x86::TemporalDenoiserParams params;
+    params.blockSize     = blockSize;
+    params.historyLength = historyLength;
+    ppl::cv::x86::TemporalDenoiser denoiser(height, width, params);
+    cv::Mat dst(height * 3 / 2, width, CV_8UC1);
+    double noisyPsnr = 0.0, dstPsnr = 0.0;
+    for (int32_t i = 0; i < numFrames; ++i) {
+        const cv::Mat& src = noisy[i];
+        ASSERT_EQ(ppl::common::RC_SUCCESS, denoiser.Apply(width, src.ptr<uint8_t>(), width, src.ptr<uint8_t>(height), width, dst.ptr<uint8_t>(), width, dst.ptr<uint8_t>(height)));
+        if (i == 0) {
+            // without history the frame is passed through
+            checkResult<uint8_t, 1>(src.ptr<uint8_t>(), dst.ptr<uint8_t>(), height * 3 / 2, width, width, width, 1.f);
+        } else if (i >= numFrames / 2) {
+            noisyPsnr += cv::PSNR(src, clean[i]);
+            dstPsnr += cv::PSNR(dst, clean[i]);
+        }
+    }
+    EXPECT_GT(dstPsnr - noisyPsnr, 2.0 * (numFrames - numFrames / 2));
+
+    // after a reset the next frame is passed through again
+    denoiser.Reset();
+    ASSERT_EQ(ppl::common::RC_SUCCESS, denoiser.Apply(width, noisy[0].ptr<uint8_t>(), width, noisy[0].ptr<uint8_t>(height), width, dst.ptr<uint8_t>(), width, dst.ptr<uint8_t>(height)));
+    checkResult<uint8_t, 1>(noisy[0].ptr<uint8_t>(), dst.ptr<uint8_t>(), height * 3 / 2, width, width, width, 1.f);
+}
+
+TEST(TemporalDenoiser_UINT8, x86)
+{
+    TemporalDenoiserTest(240, 320, 16, 2);
+    TemporalDenoiserTest(240, 320, 8, 3);
+    TemporalDenoiserTest(122, 166, 16, 4);
+}
+
+TEST(TemporalDenoiser_InvalidParams, x86)
+{
+    std::vector<uint8_t> src(64 * 96), dst(64 * 96);
+    ppl::cv::x86::TemporalDenoiserParams params;
+    params.blockSize = 12;
+    ppl::cv::x86::TemporalDenoiser badBlock(64, 64, params);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, badBlock.Apply(64, src.data(), 64, src.data() + 64 * 64, 64, dst.data(), 64, dst.data() + 64 * 64));
+
+    ppl::cv::x86::TemporalDenoiser oddHeight(63, 64, ppl::cv::x86::TemporalDenoiserParams());
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, oddHeight.Apply(64, src.data(), 64, src.data() + 64 * 64, 64, dst.data(), 64, dst.data() + 64 * 64));
+}
@@ -0,0 +1,364 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/tiledexecutor.h"
+#include "ppl/cv/x86/opgraph.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+struct MappedImageBuffers {
+    uint8_t *map;
+    size_t mapSize;
+    uint8_t *data;
+    size_t pageSize;
+};
+
+static bool validDesc(const MappedImageDesc &desc)
+{
+    if (desc.height <= 0 || desc.width <= 0 || desc.channels <= 0 || desc.offset < 0) {
+        return false;
+    }
+    if (desc.type != OP_DATA_UINT8 && desc.type != OP_DATA_FLOAT32 && desc.type != OP_DATA_INT16) {
+        return false;
+    }
+    if (desc.layout == MAPPED_LAYOUT_TILED) {
+        return desc.tileSize > 0;
+    }
+    return desc.layout == MAPPED_LAYOUT_INTERLEAVED || desc.layout == MAPPED_LAYOUT_PLANAR;
+}
+
+static size_t dataSize(const MappedImageDesc &desc)
+{
+    const size_t pixelSize = desc.channels * opgraph_element_size(desc.type);
+    if (desc.layout == MAPPED_LAYOUT_TILED) {
+        const size_t tilesX = (desc.width + desc.tileSize - 1) / desc.tileSize;
+        const size_t tilesY = (desc.height + desc.tileSize - 1) / desc.tileSize;
+        return tilesX * tilesY * desc.tileSize * desc.tileSize * pixelSize;
+    }
+    return (size_t)desc.height * desc.width * pixelSize;
+}
+
+MappedImage::MappedImage()
+    : writable_(false)
+    , buffers_(NULL)
+{
+}
+
+MappedImage::~MappedImage()
+{
+    Close();
+}
+
+#ifndef _WIN32
+
+::ppl::common::RetCode MappedImage::Map(const char *path, const MappedImageDesc &desc, bool create)
+{
+    Close();
+    if (path == nullptr || !validDesc(desc)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const size_t mapSize = desc.offset + dataSize(desc);
+    int fd               = create ? open(path, O_RDWR | O_CREAT | O_TRUNC, 0644) : open(path, O_RDONLY);
+    if (fd < 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (create) {
+        if (ftruncate(fd, (off_t)mapSize) != 0) {
+            close(fd);
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    } else {
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < mapSize) {
+            close(fd);
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    }
+    void *map = mmap(NULL, mapSize, create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    // tiles are visited in an order which is unrelated to the file, read-ahead would load pages for nothing
+    madvise(map, mapSize, MADV_RANDOM);
+
+    buffers_           = new MappedImageBuffers;
+    buffers_->map      = (uint8_t *)map;
+    buffers_->mapSize  = mapSize;
+    buffers_->data     = (uint8_t *)map + desc.offset;
+    buffers_->pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    desc_              = desc;
+    writable_          = create;
+    return ppl::common::RC_SUCCESS;
+}
+
+void MappedImage::Close()
+{
+    if (buffers_ == NULL) {
+        return;
+    }
+    if (writable_) {
+        msync(buffers_->map, buffers_->mapSize, MS_SYNC);
+    }
+    munmap(buffers_->map, buffers_->mapSize);
+    delete buffers_;
+    buffers_  = NULL;
+    writable_ = false;
+}
+
+// the whole pages which hold [begin, end)
+static void willNeed(const MappedImageBuffers *buffers, size_t begin, size_t end)
+{
+    const size_t first = (buffers->data - buffers->map + begin) / buffers->pageSize * buffers->pageSize;
+    const size_t last  = buffers->data - buffers->map + end;
+    madvise(buffers->map + first, last - first, MADV_WILLNEED);
+}
+
+#else
+
+::ppl::common::RetCode MappedImage::Map(const char *path, const MappedImageDesc &desc, bool create)
+{
+    return ppl::common::RC_UNSUPPORTED;
+}
+
+void MappedImage::Close() {}
+
+static void willNeed(const MappedImageBuffers *buffers, size_t begin, size_t end) {}
+
+#endif
+
+::ppl::common::RetCode MappedImage::Open(const char *path, const MappedImageDesc &desc)
+{
+    return Map(path, desc, false);
+}
+
+::ppl::common::RetCode MappedImage::Create(const char *path, const MappedImageDesc &desc)
+{
+    return Map(path, desc, true);
+}
+
+static inline bool rectInside(const MappedImageDesc &desc, const OpRect &rect)
+{
+    return rect.x >= 0 && rect.y >= 0 && rect.width > 0 && rect.height > 0 &&
+           rect.x + rect.width <= desc.width && rect.y + rect.height <= desc.height;
+}
+
+// copies one row of a rectangle between the file and an interleaved buffer
+template <bool toFile>
+static void copyRow(const MappedImageDesc &desc, uint8_t *file, int32_t x, int32_t y, int32_t width, uint8_t *buffer)
+{
+    const size_t elemSize  = opgraph_element_size(desc.type);
+    const size_t pixelSize = desc.channels * elemSize;
+    if (desc.layout == MAPPED_LAYOUT_INTERLEAVED) {
+        uint8_t *row = file + ((size_t)y * desc.width + x) * pixelSize;
+        if (toFile) {
+            memcpy(row, buffer, width * pixelSize);
+        } else {
+            memcpy(buffer, row, width * pixelSize);
+        }
+    } else if (desc.layout == MAPPED_LAYOUT_PLANAR) {
+        const size_t planeSize = (size_t)desc.height * desc.width * elemSize;
+        for (int32_t c = 0; c < desc.channels; ++c) {
+            uint8_t *row = file + c * planeSize + ((size_t)y * desc.width + x) * elemSize;
+            for (int32_t i = 0; i < width; ++i) {
+                uint8_t *pixel = buffer + i * pixelSize + c * elemSize;
+                if (toFile) {
+                    memcpy(row + i * elemSize, pixel, elemSize);
+                } else {
+                    memcpy(pixel, row + i * elemSize, elemSize);
+                }
+            }
+        }
+    } else {
+        const int32_t ts     = desc.tileSize;
+        const size_t tilesX  = (desc.width + ts - 1) / ts;
+        const size_t tileRow = ((size_t)(y / ts) * tilesX) * ts * ts + (size_t)(y % ts) * ts;
+        for (int32_t i = 0; i < width;) {
+            const int32_t xi = x + i;
+            const int32_t n  = std::min(width - i, ts - xi % ts);
+            uint8_t *row     = file + (tileRow + (size_t)(xi / ts) * ts * ts + xi % ts) * pixelSize;
+            if (toFile) {
+                memcpy(row, buffer + i * pixelSize, n * pixelSize);
+            } else {
+                memcpy(buffer + i * pixelSize, row, n * pixelSize);
+            }
+            i += n;
+        }
+    }
+}
+
+::ppl::common::RetCode MappedImage::ReadRect(const OpRect &rect, int32_t widthStride, void *data) const
+{
+    if (buffers_ == NULL || data == nullptr || !rectInside(desc_, rect) || widthStride < rect.width * desc_.channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const size_t rowSize = widthStride * opgraph_element_size(desc_.type);
+    for (int32_t y = 0; y < rect.height; ++y) {
+        copyRow<false>(desc_, buffers_->data, rect.x, rect.y + y, rect.width, (uint8_t *)data + y * rowSize);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode MappedImage::WriteRect(const OpRect &rect, int32_t widthStride, const void *data)
+{
+    if (buffers_ == NULL || !writable_ || data == nullptr || !rectInside(desc_, rect) || widthStride < rect.width * desc_.channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const size_t rowSize = widthStride * opgraph_element_size(desc_.type);
+    for (int32_t y = 0; y < rect.height; ++y) {
+        copyRow<true>(desc_, buffers_->data, rect.x, rect.y + y, rect.width, (uint8_t *)data + y * rowSize);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+void MappedImage::Prefetch(const OpRect &rect) const
+{
+    if (buffers_ == NULL || !rectInside(desc_, rect)) {
+        return;
+    }
+    const size_t elemSize  = opgraph_element_size(desc_.type);
+    const size_t pixelSize = desc_.channels * elemSize;
+    if (desc_.layout == MAPPED_LAYOUT_TILED) {
+        const int32_t ts       = desc_.tileSize;
+        const size_t tilesX    = (desc_.width + ts - 1) / ts;
+        const size_t tileBytes = (size_t)ts * ts * pixelSize;
+        for (int32_t ty = rect.y / ts; ty <= (rect.y + rect.height - 1) / ts; ++ty) {
+            const size_t first = ty * tilesX + rect.x / ts;
+            const size_t last  = ty * tilesX + (rect.x + rect.width - 1) / ts;
+            willNeed(buffers_, first * tileBytes, (last + 1) * tileBytes);
+        }
+        return;
+    }
+    const int32_t planes   = desc_.layout == MAPPED_LAYOUT_PLANAR ? desc_.channels : 1;
+    const size_t rowSize   = desc_.layout == MAPPED_LAYOUT_PLANAR ? desc_.width * elemSize : desc_.width * pixelSize;
+    const size_t planeSize = (size_t)desc_.height * rowSize;
+    const size_t unit      = rowSize / desc_.width;
+    for (int32_t c = 0; c < planes; ++c) {
+        if (rect.width == desc_.width) {
+            willNeed(buffers_, c * planeSize + rect.y * rowSize, c * planeSize + (rect.y + rect.height) * rowSize);
+            continue;
+        }
+        for (int32_t y = rect.y; y < rect.y + rect.height; ++y) {
+            const size_t row = c * planeSize + y * rowSize;
+            willNeed(buffers_, row + rect.x * unit, row + (rect.x + rect.width) * unit);
+        }
+    }
+}
+
+::ppl::common::RetCode ExecuteTiled(
+    const OpGraph &graph,
+    const MappedImage &src,
+    MappedImage &dst,
+    const TiledExecutorParams &params)
+{
+    const MappedImageDesc &sd = src.Desc();
+    const MappedImageDesc &dd = dst.Desc();
+    if (sd.height != graph.InputHeight() || sd.width != graph.InputWidth() || sd.channels != graph.InputChannels() ||
+        sd.type != graph.InputDataType()) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (dd.height != graph.OutputHeight() || dd.width != graph.OutputWidth() || dd.channels != graph.OutputChannels() ||
+        dd.type != graph.OutputDataType() || !dst.Writable()) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    // the chroma plane of NV12 has no place in the layouts of a mapped image
+    if (!graph.Nodes().empty() && graph.Nodes()[0].type == OP_NV122BGR) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (params.tileSize < 16 || params.prefetchTiles < 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int32_t ts       = params.tileSize;
+    const int32_t tilesX   = (dd.width + ts - 1) / ts;
+    const int32_t tilesY   = (dd.height + ts - 1) / ts;
+    const int32_t numTiles = tilesX * tilesY;
+    const int32_t n        = (int32_t)graph.Nodes().size();
+    const size_t inElem    = opgraph_element_size(graph.InputDataType());
+    const size_t outElem   = opgraph_element_size(graph.OutputDataType());
+
+    std::vector<int32_t> results(numTiles, ppl::common::RC_SUCCESS);
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t t = 0; t < numTiles; ++t) {
+        std::vector<OpRect> rects(n + 1);
+        for (int32_t p = 1; p <= params.prefetchTiles && t + p < numTiles; ++p) {
+            OpRect out;
+            out.x      = (t + p) % tilesX * ts;
+            out.y      = (t + p) / tilesX * ts;
+            out.width  = std::min(ts, dd.width - out.x);
+            out.height = std::min(ts, dd.height - out.y);
+            opgraph_tile_rects(graph, out, &rects[0]);
+            src.Prefetch(rects[0]);
+        }
+
+        OpRect out;
+        out.x      = t % tilesX * ts;
+        out.y      = t / tilesX * ts;
+        out.width  = std::min(ts, dd.width - out.x);
+        out.height = std::min(ts, dd.height - out.y);
+        opgraph_tile_rects(graph, out, &rects[0]);
+
+        // the source and destination tiles and the intermediate images are the only memory of a tile
+        const size_t inSize      = (size_t)rects[0].width * rects[0].height * sd.channels * inElem;
+        const size_t outSize     = (size_t)out.width * out.height * dd.channels * outElem;
+        const size_t scratchSize = opgraph_tile_scratch_size(graph, &rects[0]);
+        uint8_t *memory          = (uint8_t *)ppl::common::AlignedAlloc(inSize + outSize + scratchSize + 128, 64);
+        if (memory == NULL) {
+            results[t] = ppl::common::RC_OUT_OF_MEMORY;
+            continue;
+        }
+        uint8_t *inTile  = memory;
+        uint8_t *outTile = memory + (inSize + 63) / 64 * 64;
+        uint8_t *scratch = outTile + (outSize + 63) / 64 * 64;
+
+        ::ppl::common::RetCode rc = src.ReadRect(rects[0], rects[0].width * sd.channels, inTile);
+        if (rc == ppl::common::RC_SUCCESS) {
+            rc = opgraph_run_tile(graph, &rects[0], rects[0].width * sd.channels, inTile, NULL, out.width * dd.channels, outTile, scratch);
+        }
+        if (rc == ppl::common::RC_SUCCESS) {
+            rc = dst.WriteRect(out, out.width * dd.channels, outTile);
+        }
+        results[t] = rc;
+        ppl::common::AlignedFree(memory);
+    }
+
+    for (int32_t t = 0; t < numTiles; ++t) {
+        if (results[t] != ppl::common::RC_SUCCESS) {
+            return (::ppl::common::RetCode)results[t];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
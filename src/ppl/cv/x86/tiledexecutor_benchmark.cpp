@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/tiledexecutor.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <memory>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// a 3-channel image stored with the given layout is blurred, halved and converted to gray tile by tile
+template <ppl::cv::x86::MappedImageLayout layout>
+void BM_ExecuteTiled_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    ppl::cv::x86::MappedImageDesc srcDesc;
+    srcDesc.height = height;
+    srcDesc.width = width;
+    srcDesc.channels = 3;
+    srcDesc.layout = layout;
+    char srcPath[] = "/tmp/ppl_cv_tiled_src_XXXXXX";
+    char dstPath[] = "/tmp/ppl_cv_tiled_dst_XXXXXX";
+    close(mkstemp(srcPath));
+    close(mkstemp(dstPath));
+    {
+        std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3]);
+        ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3, 0, 255);
+        ppl::cv::x86::MappedImage file;
+        file.Create(srcPath, srcDesc);
+        ppl::cv::x86::OpRect all = {0, 0, width, height};
+        file.WriteRect(all, width * 3, src.get());
+    }
+
+    ppl::cv::x86::OpGraph graph(height, width, 3, ppl::cv::x86::OP_DATA_UINT8);
+    graph.AddGaussianBlur(5, 1.2f);
+    graph.AddResizeLinear(height / 2, width / 2);
+    graph.AddBGR2GRAY();
+    ppl::cv::x86::MappedImageDesc dstDesc;
+    dstDesc.height = graph.OutputHeight();
+    dstDesc.width = graph.OutputWidth();
+    ppl::cv::x86::MappedImage srcImage, dstImage;
+    srcImage.Open(srcPath, srcDesc);
+    dstImage.Create(dstPath, dstDesc);
+    ppl::cv::x86::TiledExecutorParams params;
+    for (auto _ : state) {
+        ppl::cv::x86::ExecuteTiled(graph, srcImage, dstImage, params);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+    srcImage.Close();
+    dstImage.Close();
+    remove(srcPath);
+    remove(dstPath);
+}
+}
+
+BENCHMARK_TEMPLATE(BM_ExecuteTiled_ppl_x86, ppl::cv::x86::MAPPED_LAYOUT_INTERLEAVED)->Args({4096, 4096})->Args({8192, 8192});
+BENCHMARK_TEMPLATE(BM_ExecuteTiled_ppl_x86, ppl::cv::x86::MAPPED_LAYOUT_PLANAR)->Args({4096, 4096})->Args({8192, 8192});
+BENCHMARK_TEMPLATE(BM_ExecuteTiled_ppl_x86, ppl::cv::x86::MAPPED_LAYOUT_TILED)->Args({4096, 4096})->Args({8192, 8192});
@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/tiledexecutor.h"
+#include "ppl/cv/x86/gaussianblur.h"
+#include "ppl/cv/x86/boxfilter.h"
+#include "ppl/cv/x86/resize.h"
+#include "ppl/cv/x86/warpaffine.h"
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+static std::string TempImagePath()
+{
+    char path[] = "/tmp/ppl_cv_tiled_XXXXXX";
+    int fd      = mkstemp(path);
+    if (fd >= 0) {
+        close(fd);
+    }
+    return path;
+}
+
+// the reference runs the same operations on the whole image in memory, resizes use ResizeLinear
+template <typename T>
+static void RunInMemory(const ppl::cv::x86::OpGraph& graph, const std::vector<T>& src, std::vector<T>& dst)
+{
+    dst = src;
+    const std::vector<ppl::cv::x86::OpNode>& nodes = graph.Nodes();
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const ppl::cv::x86::OpNode& n = nodes[i];
+        std::vector<T> out((size_t)n.outHeight * n.outWidth * n.outChannels);
+        const int32_t inStride = n.inWidth * n.inChannels, outStride = n.outWidth * n.outChannels;
+        if (n.type == ppl::cv::x86::OP_GAUSSIAN_BLUR) {
+            ppl::cv::x86::GaussianBlur<T, 3>(n.inHeight, n.inWidth, inStride, dst.data(), n.kernelSize, n.sigma, outStride, out.data(), n.border);
+        } else if (n.type == ppl::cv::x86::OP_BOX_FILTER) {
+            ppl::cv::x86::BoxFilter<T, 3>(n.inHeight, n.inWidth, inStride, dst.data(), n.kernelSize, n.kernelSize, true, outStride, out.data(), n.border);
+        } else if (n.type == ppl::cv::x86::OP_RESIZE_LINEAR) {
+            ppl::cv::x86::ResizeLinear<T, 3>(n.inHeight, n.inWidth, inStride, dst.data(), n.outHeight, n.outWidth, outStride, out.data());
+        } else if (n.type == ppl::cv::x86::OP_WARP_AFFINE_LINEAR) {
+            ppl::cv::x86::WarpAffineLinear<T, 3>(n.inHeight, n.inWidth, inStride, dst.data(), n.outHeight, n.outWidth, outStride, out.data(), n.affine, n.border, (T)n.borderValue);
+        } else if (n.type == ppl::cv::x86::OP_BGR2GRAY) {
+            ppl::cv::x86::BGR2GRAY<T>(n.inHeight, n.inWidth, inStride, dst.data(), outStride, out.data());
+        } else {
+            ppl::cv::x86::GRAY2BGR<T>(n.inHeight, n.inWidth, inStride, dst.data(), outStride, out.data());
+        }
+        dst.swap(out);
+    }
+}
+
+// blur, rotation and downscale of a 3-channel image, converted to gray at the end when toGray is set
+template <typename T>
+void TiledExecutorTest(int32_t height, int32_t width, ppl::cv::x86::MappedImageLayout srcLayout, ppl::cv::x86::MappedImageLayout dstLayout, bool warp, bool toGray, float diff)
+{
+    const ppl::cv::x86::OpDataType type = sizeof(T) == 1 ? ppl::cv::x86::OP_DATA_UINT8 : ppl::cv::x86::OP_DATA_FLOAT32;
+    ppl::cv::x86::OpGraph graph(height, width, 3, type);
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddGaussianBlur(7, 1.5f));
+    ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddBoxFilter(5, ppl::cv::BORDER_TYPE_REFLECT));
+    if (warp) {
+        // rotation by 10 degrees around the center, the corners fall outside of the source
+        const double c = 0.984807753, s = 0.173648178;
+        const double M[6] = {c, -s, (1 - c) * width / 2 + s * height / 2, s, c, -s * width / 2 + (1 - c) * height / 2};
+        ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddWarpAffineLinear(height, width, M, ppl::cv::BORDER_TYPE_CONSTANT, 20.f));
+        ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddResizeLinear(height / 3, width * 2 / 5));
+    }
+    if (toGray) {
+        ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddBGR2GRAY());
+        ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddGRAY2BGR());
+        ASSERT_EQ(ppl::common::RC_SUCCESS, graph.AddBGR2GRAY());
+    }
+
+    std::vector<T> src((size_t)height * width * 3);
+    ppl::cv::debug::randomFill<T>(src.data(), src.size(), 0, 255);
+    std::vector<T> expected;
+    RunInMemory<T>(graph, src, expected);
+
+    ppl::cv::x86::MappedImageDesc srcDesc;
+    srcDesc.height   = height;
+    srcDesc.width    = width;
+    srcDesc.channels = 3;
+    srcDesc.type     = type;
+    srcDesc.layout   = srcLayout;
+    srcDesc.tileSize = 200;
+    srcDesc.offset   = 100;
+    const std::string srcPath = TempImagePath(), dstPath = TempImagePath();
+    {
+        ppl::cv::x86::MappedImage file;
+        ASSERT_EQ(ppl::common::RC_SUCCESS, file.Create(srcPath.c_str(), srcDesc));
+        ppl::cv::x86::OpRect all = {0, 0, width, height};
+        ASSERT_EQ(ppl::common::RC_SUCCESS, file.WriteRect(all, width * 3, src.data()));
+    }
+
+    ppl::cv::x86::MappedImage srcImage, dstImage;
+    ASSERT_EQ(ppl::common::RC_SUCCESS, srcImage.Open(srcPath.c_str(), srcDesc));
+    ppl::cv::x86::MappedImageDesc dstDesc;
+    dstDesc.height   = graph.OutputHeight();
+    dstDesc.width    = graph.OutputWidth();
+    dstDesc.channels = graph.OutputChannels();
+    dstDesc.type     = type;
+    dstDesc.layout   = dstLayout;
+    dstDesc.tileSize = 96;
+    ASSERT_EQ(ppl::common::RC_SUCCESS, dstImage.Create(dstPath.c_str(), dstDesc));
+
+    ppl::cv::x86::TiledExecutorParams params;
+    params.tileSize = 128;
+    ASSERT_EQ(ppl::common::RC_SUCCESS, ppl::cv::x86::ExecuteTiled(graph, srcImage, dstImage, params));
+
+    std::vector<T> dst(expected.size());
+    ppl::cv::x86::OpRect all = {0, 0, dstDesc.width, dstDesc.height};
+    ASSERT_EQ(ppl::common::RC_SUCCESS, dstImage.ReadRect(all, dstDesc.width * dstDesc.channels, dst.data()));
+    srcImage.Close();
+    dstImage.Close();
+    remove(srcPath.c_str());
+    remove(dstPath.c_str());
+    if (dstDesc.channels == 1) {
+        checkResult<T, 1>(expected.data(), dst.data(), dstDesc.height, dstDesc.width, dstDesc.width, dstDesc.width, diff);
+    } else {
+        checkResult<T, 3>(expected.data(), dst.data(), dstDesc.height, dstDesc.width, dstDesc.width * 3, dstDesc.width * 3, diff);
+    }
+}
+
+TEST(TiledExecutor_UINT8, x86)
+{
+    // the filters match the whole image exactly, the warp and the resize can each be off by 1
+    TiledExecutorTest<uint8_t>(1501, 2003, ppl::cv::x86::MAPPED_LAYOUT_INTERLEAVED, ppl::cv::x86::MAPPED_LAYOUT_INTERLEAVED, false, false, 0.01f);
+    TiledExecutorTest<uint8_t>(1501, 2003, ppl::cv::x86::MAPPED_LAYOUT_PLANAR, ppl::cv::x86::MAPPED_LAYOUT_TILED, false, true, 0.01f);
+    TiledExecutorTest<uint8_t>(1501, 2003, ppl::cv::x86::MAPPED_LAYOUT_TILED, ppl::cv::x86::MAPPED_LAYOUT_PLANAR, true, false, 2.01f);
+    TiledExecutorTest<uint8_t>(3000, 4000, ppl::cv::x86::MAPPED_LAYOUT_TILED, ppl::cv::x86::MAPPED_LAYOUT_INTERLEAVED, true, true, 2.01f);
+}
+
+TEST(TiledExecutor_FP32, x86)
+{
+    TiledExecutorTest<float>(1501, 2003, ppl::cv::x86::MAPPED_LAYOUT_INTERLEAVED, ppl::cv::x86::MAPPED_LAYOUT_TILED, false, true, 1e-3f);
+    TiledExecutorTest<float>(1501, 2003, ppl::cv::x86::MAPPED_LAYOUT_PLANAR, ppl::cv::x86::MAPPED_LAYOUT_INTERLEAVED, true, false, 1e-1f);
+}
+
+TEST(TiledExecutor_InvalidParams, x86)
+{
+    ppl::cv::x86::OpGraph graph(64, 64, 3, ppl::cv::x86::OP_DATA_UINT8);
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddGaussianBlur(4, 1.f));
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddGRAY2BGR());
+    const double M[6] = {1, 0, 0, 0, 1, 0};
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, graph.AddWarpAffineLinear(64, 64, M, ppl::cv::BORDER_TYPE_REFLECT));
+    EXPECT_EQ(ppl::common::RC_SUCCESS, graph.AddBGR2GRAY());
+    EXPECT_EQ(1, graph.OutputChannels());
+
+    ppl::cv::x86::MappedImage image;
+    ppl::cv::x86::MappedImageDesc desc;
+    desc.height = 64;
+    desc.width  = 64;
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, image.Open("/nonexistent/ppl_cv_tiled", desc));
+    ppl::cv::x86::MappedImage dst;
+    EXPECT_EQ(ppl::common::RC_INVALID_VALUE, ppl::cv::x86::ExecuteTiled(graph, image, dst, ppl::cv::x86::TiledExecutorParams()));
+}
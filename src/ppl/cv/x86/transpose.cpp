@@ -53,6 +53,71 @@ template <typename T>
     return ppl::common::RC_SUCCESS;
 }
 
+// 8x8 blocks of uint16_t are transposed in registers, the right and bottom remainders fall back to the scalar loop
+static ::ppl::common::RetCode transpose_u16c1(
+    const uint16_t *src,
+    int height,
+    int width,
+    int inWidthStride,
+    int outWidthStride,
+    uint16_t *dst)
+{
+    const int h8 = height & ~7;
+    const int w8 = width & ~7;
+    for (int i = 0; i < h8; i += 8) {
+        for (int j = 0; j < w8; j += 8) {
+            const uint16_t *s = src + i * inWidthStride + j;
+            __m128i r0 = _mm_loadu_si128((const __m128i *)(s + 0 * inWidthStride));
+            __m128i r1 = _mm_loadu_si128((const __m128i *)(s + 1 * inWidthStride));
+            __m128i r2 = _mm_loadu_si128((const __m128i *)(s + 2 * inWidthStride));
+            __m128i r3 = _mm_loadu_si128((const __m128i *)(s + 3 * inWidthStride));
+            __m128i r4 = _mm_loadu_si128((const __m128i *)(s + 4 * inWidthStride));
+            __m128i r5 = _mm_loadu_si128((const __m128i *)(s + 5 * inWidthStride));
+            __m128i r6 = _mm_loadu_si128((const __m128i *)(s + 6 * inWidthStride));
+            __m128i r7 = _mm_loadu_si128((const __m128i *)(s + 7 * inWidthStride));
+
+            __m128i a0 = _mm_unpacklo_epi16(r0, r1);
+            __m128i a1 = _mm_unpackhi_epi16(r0, r1);
+            __m128i a2 = _mm_unpacklo_epi16(r2, r3);
+            __m128i a3 = _mm_unpackhi_epi16(r2, r3);
+            __m128i a4 = _mm_unpacklo_epi16(r4, r5);
+            __m128i a5 = _mm_unpackhi_epi16(r4, r5);
+            __m128i a6 = _mm_unpacklo_epi16(r6, r7);
+            __m128i a7 = _mm_unpackhi_epi16(r6, r7);
+
+            __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+            __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+            __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+            __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+            __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+            __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+            __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+            __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+            uint16_t *d = dst + j * outWidthStride + i;
+            _mm_storeu_si128((__m128i *)(d + 0 * outWidthStride), _mm_unpacklo_epi64(b0, b4));
+            _mm_storeu_si128((__m128i *)(d + 1 * outWidthStride), _mm_unpackhi_epi64(b0, b4));
+            _mm_storeu_si128((__m128i *)(d + 2 * outWidthStride), _mm_unpacklo_epi64(b1, b5));
+            _mm_storeu_si128((__m128i *)(d + 3 * outWidthStride), _mm_unpackhi_epi64(b1, b5));
+            _mm_storeu_si128((__m128i *)(d + 4 * outWidthStride), _mm_unpacklo_epi64(b2, b6));
+            _mm_storeu_si128((__m128i *)(d + 5 * outWidthStride), _mm_unpackhi_epi64(b2, b6));
+            _mm_storeu_si128((__m128i *)(d + 6 * outWidthStride), _mm_unpacklo_epi64(b3, b7));
+            _mm_storeu_si128((__m128i *)(d + 7 * outWidthStride), _mm_unpackhi_epi64(b3, b7));
+        }
+        for (int ii = i; ii < i + 8; ++ii) {
+            for (int j = w8; j < width; ++j) {
+                dst[j * outWidthStride + ii] = src[ii * inWidthStride + j];
+            }
+        }
+    }
+    for (int i = h8; i < height; ++i) {
+        for (int j = 0; j < width; ++j) {
+            dst[j * outWidthStride + i] = src[i * inWidthStride + j];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
 template <>
 ::ppl::common::RetCode Transpose<float, 1>(int height, int width, int inWidthStride, const float *inData, int outWidthStride, float *outData)
 {
@@ -89,6 +154,24 @@ template <>
     return transpose<uint8_t>(inData, 4, height, width, inWidthStride, outWidthStride, outData);
 }
 
+template <>
+::ppl::common::RetCode Transpose<uint16_t, 1>(int height, int width, int inWidthStride, const uint16_t *inData, int outWidthStride, uint16_t *outData)
+{
+    return transpose_u16c1(inData, height, width, inWidthStride, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode Transpose<uint16_t, 3>(int height, int width, int inWidthStride, const uint16_t *inData, int outWidthStride, uint16_t *outData)
+{
+    return transpose<uint16_t>(inData, 3, height, width, inWidthStride, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode Transpose<uint16_t, 4>(int height, int width, int inWidthStride, const uint16_t *inData, int outWidthStride, uint16_t *outData)
+{
+    return transpose<uint16_t>(inData, 4, height, width, inWidthStride, outWidthStride, outData);
+}
+
 }
 }
 } // namespace ppl::cv::x86
@@ -52,3 +52,10 @@ TEST(Transpose_UINT8, x86)
     TransposeTest<uint8_t, 3>(720, 1080, 1.01f);
     TransposeTest<uint8_t, 4>(720, 1080, 1.01f);
 }
+
+TEST(Transpose_UINT16, x86)
+{
+    TransposeTest<uint16_t, 1>(720, 1080, 1.01f);
+    TransposeTest<uint16_t, 3>(720, 1080, 1.01f);
+    TransposeTest<uint16_t, 4>(720, 1080, 1.01f);
+}
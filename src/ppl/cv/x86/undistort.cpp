@@ -0,0 +1,620 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/undistort.h"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <limits>
+#include <limits.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define UNDISTORT_INTER_TAB_SIZE (1 << UNDISTORT_INTER_BITS)
+#define UNDISTORT_BAND_ROWS      16
+
+struct UndistortModel {
+    bool fisheye;
+    bool rational;
+    bool tilted;
+    double ir[9];
+    float fx, fy, cx, cy;
+    float k[12];
+    float tilt[9];
+};
+
+static void multiply3x3(const double* a, const double* b, double* c)
+{
+    for (int32_t i = 0; i < 3; ++i) {
+        for (int32_t j = 0; j < 3; ++j) {
+            c[i * 3 + j] = a[i * 3] * b[j] + a[i * 3 + 1] * b[3 + j] + a[i * 3 + 2] * b[6 + j];
+        }
+    }
+}
+
+static bool invert3x3(const double* a, double* b)
+{
+    double c0  = a[4] * a[8] - a[5] * a[7];
+    double c1  = a[5] * a[6] - a[3] * a[8];
+    double c2  = a[3] * a[7] - a[4] * a[6];
+    double det = a[0] * c0 + a[1] * c1 + a[2] * c2;
+    if (det == 0) {
+        return false;
+    }
+    double s = 1. / det;
+    b[0]     = c0 * s;
+    b[1]     = (a[2] * a[7] - a[1] * a[8]) * s;
+    b[2]     = (a[1] * a[5] - a[2] * a[4]) * s;
+    b[3]     = c1 * s;
+    b[4]     = (a[0] * a[8] - a[2] * a[6]) * s;
+    b[5]     = (a[2] * a[3] - a[0] * a[5]) * s;
+    b[6]     = c2 * s;
+    b[7]     = (a[1] * a[6] - a[0] * a[7]) * s;
+    b[8]     = (a[0] * a[4] - a[1] * a[3]) * s;
+    return true;
+}
+
+// same as cv::detail::computeTiltProjectionMatrix
+static void computeTiltMatrix(double tauX, double tauY, float* tilt)
+{
+    double cX = std::cos(tauX), sX = std::sin(tauX);
+    double cY = std::cos(tauY), sY = std::sin(tauY);
+    double rotX[9] = {1, 0, 0, 0, cX, sX, 0, -sX, cX};
+    double rotY[9] = {cY, 0, -sY, 0, 1, 0, sY, 0, cY};
+    double rotXY[9], result[9];
+    multiply3x3(rotY, rotX, rotXY);
+    double projZ[9] = {rotXY[8], 0, -rotXY[2], 0, rotXY[8], -rotXY[5], 0, 0, 1};
+    multiply3x3(projZ, rotXY, result);
+    for (int32_t i = 0; i < 9; ++i) {
+        tilt[i] = (float)result[i];
+    }
+}
+
+static bool initUndistortModel(
+    const double* cameraMatrix,
+    int32_t distCoeffsNum,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    bool fisheye,
+    UndistortModel& m)
+{
+    static const double identity[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+    double kr[9];
+    multiply3x3(newCameraMatrix ? newCameraMatrix : identity, R ? R : identity, kr);
+    if (!invert3x3(kr, m.ir)) {
+        return false;
+    }
+    m.fisheye  = fisheye;
+    m.fx       = (float)cameraMatrix[0];
+    m.fy       = (float)cameraMatrix[4];
+    m.cx       = (float)cameraMatrix[2];
+    m.cy       = (float)cameraMatrix[5];
+    m.rational = distCoeffsNum >= 8;
+    m.tilted   = false;
+    memset(m.k, 0, sizeof(m.k));
+    for (int32_t i = 0; i < std::min(distCoeffsNum, 12); ++i) {
+        m.k[i] = (float)distCoeffs[i];
+    }
+    if (distCoeffsNum == 14 && (distCoeffs[12] != 0 || distCoeffs[13] != 0)) {
+        m.tilted = true;
+        computeTiltMatrix(distCoeffs[12], distCoeffs[13], m.tilt);
+    }
+    return true;
+}
+
+static inline void pinholeProject(const UndistortModel& m, __m128 x, __m128 y, __m128& u, __m128& v)
+{
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 two = _mm_set1_ps(2.f);
+    __m128 x2        = _mm_mul_ps(x, x);
+    __m128 y2        = _mm_mul_ps(y, y);
+    __m128 r2        = _mm_add_ps(x2, y2);
+    __m128 xy2       = _mm_mul_ps(two, _mm_mul_ps(x, y));
+    __m128 r4        = _mm_mul_ps(r2, r2);
+
+    __m128 kr = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.k[4]), r2), _mm_set1_ps(m.k[1]));
+    kr        = _mm_add_ps(_mm_mul_ps(kr, r2), _mm_set1_ps(m.k[0]));
+    kr        = _mm_add_ps(_mm_mul_ps(kr, r2), one);
+    if (m.rational) {
+        __m128 kd = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.k[7]), r2), _mm_set1_ps(m.k[6]));
+        kd        = _mm_add_ps(_mm_mul_ps(kd, r2), _mm_set1_ps(m.k[5]));
+        kd        = _mm_add_ps(_mm_mul_ps(kd, r2), one);
+        kr        = _mm_div_ps(kr, kd);
+    }
+    const __m128 p1 = _mm_set1_ps(m.k[2]);
+    const __m128 p2 = _mm_set1_ps(m.k[3]);
+    __m128 xd       = _mm_add_ps(_mm_mul_ps(x, kr), _mm_mul_ps(p1, xy2));
+    xd              = _mm_add_ps(xd, _mm_mul_ps(p2, _mm_add_ps(r2, _mm_mul_ps(two, x2))));
+    xd              = _mm_add_ps(xd, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.k[8]), r2), _mm_mul_ps(_mm_set1_ps(m.k[9]), r4)));
+    __m128 yd       = _mm_add_ps(_mm_mul_ps(y, kr), _mm_mul_ps(p2, xy2));
+    yd              = _mm_add_ps(yd, _mm_mul_ps(p1, _mm_add_ps(r2, _mm_mul_ps(two, y2))));
+    yd              = _mm_add_ps(yd, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.k[10]), r2), _mm_mul_ps(_mm_set1_ps(m.k[11]), r4)));
+
+    if (m.tilted) {
+        const float* t = m.tilt;
+        __m128 tx      = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t[0]), xd), _mm_mul_ps(_mm_set1_ps(t[1]), yd)), _mm_set1_ps(t[2]));
+        __m128 ty      = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t[3]), xd), _mm_mul_ps(_mm_set1_ps(t[4]), yd)), _mm_set1_ps(t[5]));
+        __m128 tz      = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t[6]), xd), _mm_mul_ps(_mm_set1_ps(t[7]), yd)), _mm_set1_ps(t[8]));
+        __m128 inv     = _mm_div_ps(one, tz);
+        inv            = _mm_blendv_ps(inv, one, _mm_cmpeq_ps(tz, _mm_setzero_ps()));
+        xd             = _mm_mul_ps(tx, inv);
+        yd             = _mm_mul_ps(ty, inv);
+    }
+    u = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.fx), xd), _mm_set1_ps(m.cx));
+    v = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.fy), yd), _mm_set1_ps(m.cy));
+}
+
+static inline void fisheyeProject(const UndistortModel& m, __m128 x, __m128 y, __m128& u, __m128& v)
+{
+    __m128 r      = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+    __m128 theta  = v_atan_ps(r);
+    __m128 theta2 = _mm_mul_ps(theta, theta);
+    __m128 poly   = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.k[3]), theta2), _mm_set1_ps(m.k[2]));
+    poly          = _mm_add_ps(_mm_mul_ps(poly, theta2), _mm_set1_ps(m.k[1]));
+    poly          = _mm_add_ps(_mm_mul_ps(poly, theta2), _mm_set1_ps(m.k[0]));
+    poly          = _mm_add_ps(_mm_mul_ps(poly, theta2), _mm_set1_ps(1.f));
+    __m128 scale  = _mm_div_ps(_mm_mul_ps(theta, poly), r);
+    scale         = _mm_blendv_ps(scale, _mm_set1_ps(1.f), _mm_cmpeq_ps(r, _mm_setzero_ps()));
+    u             = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.fx), _mm_mul_ps(x, scale)), _mm_set1_ps(m.cx));
+    v             = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.fy), _mm_mul_ps(y, scale)), _mm_set1_ps(m.cy));
+}
+
+// source coordinates of a row of the undistorted image, u and v are padded to a multiple of 4
+static void computeRowCoords(const UndistortModel& m, int32_t row, int32_t width, float* u, float* v)
+{
+    const double* ir    = m.ir;
+    const __m128 baseX  = _mm_set1_ps((float)(row * ir[1] + ir[2]));
+    const __m128 baseY  = _mm_set1_ps((float)(row * ir[4] + ir[5]));
+    const __m128 baseW  = _mm_set1_ps((float)(row * ir[7] + ir[8]));
+    const __m128 stepX  = _mm_set1_ps((float)ir[0]);
+    const __m128 stepY  = _mm_set1_ps((float)ir[3]);
+    const __m128 stepW  = _mm_set1_ps((float)ir[6]);
+    const __m128 inf    = _mm_set1_ps(std::numeric_limits<float>::infinity());
+    const __m128 signs  = _mm_set1_ps(-0.f);
+    __m128 col          = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+    for (int32_t j = 0; j < width; j += 4) {
+        __m128 wx = _mm_add_ps(baseX, _mm_mul_ps(col, stepX));
+        __m128 wy = _mm_add_ps(baseY, _mm_mul_ps(col, stepY));
+        __m128 ww = _mm_add_ps(baseW, _mm_mul_ps(col, stepW));
+        __m128 iw = _mm_div_ps(_mm_set1_ps(1.f), ww);
+        __m128 x  = _mm_mul_ps(wx, iw);
+        __m128 y  = _mm_mul_ps(wy, iw);
+        __m128 mu, mv;
+        if (m.fisheye) {
+            fisheyeProject(m, x, y, mu, mv);
+            // points behind the camera go to infinity on the opposite side, as OpenCV does
+            __m128 behind = _mm_cmple_ps(ww, _mm_setzero_ps());
+            __m128 ux     = _mm_or_ps(inf, _mm_andnot_ps(_mm_cmple_ps(wx, _mm_setzero_ps()), signs));
+            __m128 vy     = _mm_or_ps(inf, _mm_andnot_ps(_mm_cmple_ps(wy, _mm_setzero_ps()), signs));
+            mu            = _mm_blendv_ps(mu, ux, behind);
+            mv            = _mm_blendv_ps(mv, vy, behind);
+        } else {
+            pinholeProject(m, x, y, mu, mv);
+        }
+        _mm_storeu_ps(u + j, mu);
+        _mm_storeu_ps(v + j, mv);
+        col = _mm_add_ps(col, _mm_set1_ps(4.f));
+    }
+}
+
+// rounds the coordinates to 1 / UNDISTORT_INTER_TAB_SIZE pixel
+static void quantizeRowCoords(const float* u, const float* v, int32_t width, int32_t* iu, int32_t* iv)
+{
+    const __m128 scale = _mm_set1_ps((float)UNDISTORT_INTER_TAB_SIZE);
+    for (int32_t j = 0; j < width; j += 4) {
+        _mm_storeu_si128((__m128i*)(iu + j), _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(u + j), scale)));
+        _mm_storeu_si128((__m128i*)(iv + j), _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(v + j), scale)));
+    }
+}
+
+static void storeFixedRow(const int32_t* iu, const int32_t* iv, int32_t width, int16_t* xy, uint16_t* fxy)
+{
+    const __m128i mask = _mm_set1_epi32(UNDISTORT_INTER_TAB_SIZE - 1);
+    int32_t j          = 0;
+    for (; j <= width - 4; j += 4) {
+        __m128i u  = _mm_loadu_si128((const __m128i*)(iu + j));
+        __m128i v  = _mm_loadu_si128((const __m128i*)(iv + j));
+        __m128i x  = _mm_srai_epi32(u, UNDISTORT_INTER_BITS);
+        __m128i y  = _mm_srai_epi32(v, UNDISTORT_INTER_BITS);
+        __m128i f  = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, mask), UNDISTORT_INTER_BITS), _mm_and_si128(u, mask));
+        __m128i pt = _mm_packs_epi32(_mm_unpacklo_epi32(x, y), _mm_unpackhi_epi32(x, y));
+        _mm_storeu_si128((__m128i*)(xy + 2 * j), pt);
+        _mm_storel_epi64((__m128i*)(fxy + j), _mm_packus_epi32(f, f));
+    }
+    for (; j < width; ++j) {
+        int32_t x     = iu[j] >> UNDISTORT_INTER_BITS;
+        int32_t y     = iv[j] >> UNDISTORT_INTER_BITS;
+        xy[2 * j]     = (int16_t)std::min(std::max(x, (int32_t)SHRT_MIN), (int32_t)SHRT_MAX);
+        xy[2 * j + 1] = (int16_t)std::min(std::max(y, (int32_t)SHRT_MIN), (int32_t)SHRT_MAX);
+        fxy[j]        = (uint16_t)(((iv[j] & (UNDISTORT_INTER_TAB_SIZE - 1)) << UNDISTORT_INTER_BITS) + (iu[j] & (UNDISTORT_INTER_TAB_SIZE - 1)));
+    }
+}
+
+static void buildFloatMaps(const UndistortModel& m, int32_t height, int32_t width, float* mapX, float* mapY)
+{
+    const int32_t padded   = (width + 3) & ~3;
+    const int32_t numBands = (height + UNDISTORT_BAND_ROWS - 1) / UNDISTORT_BAND_ROWS;
+#pragma omp parallel for schedule(static)
+    for (int32_t band = 0; band < numBands; ++band) {
+        std::vector<float> buffer(2 * padded);
+        const int32_t yEnd = std::min(height, (band + 1) * UNDISTORT_BAND_ROWS);
+        for (int32_t i = band * UNDISTORT_BAND_ROWS; i < yEnd; ++i) {
+            computeRowCoords(m, i, width, &buffer[0], &buffer[padded]);
+            memcpy(mapX + (size_t)i * width, &buffer[0], width * sizeof(float));
+            memcpy(mapY + (size_t)i * width, &buffer[padded], width * sizeof(float));
+        }
+    }
+}
+
+static void buildFixedMaps(const UndistortModel& m, int32_t height, int32_t width, int16_t* mapXY, uint16_t* mapFXY)
+{
+    const int32_t padded   = (width + 3) & ~3;
+    const int32_t numBands = (height + UNDISTORT_BAND_ROWS - 1) / UNDISTORT_BAND_ROWS;
+#pragma omp parallel for schedule(static)
+    for (int32_t band = 0; band < numBands; ++band) {
+        std::vector<float> buffer(2 * padded);
+        std::vector<int32_t> fixed(2 * padded);
+        const int32_t yEnd = std::min(height, (band + 1) * UNDISTORT_BAND_ROWS);
+        for (int32_t i = band * UNDISTORT_BAND_ROWS; i < yEnd; ++i) {
+            computeRowCoords(m, i, width, &buffer[0], &buffer[padded]);
+            quantizeRowCoords(&buffer[0], &buffer[padded], width, &fixed[0], &fixed[padded]);
+            storeFixedRow(&fixed[0], &fixed[padded], width, mapXY + (size_t)i * width * 2, mapFXY + (size_t)i * width);
+        }
+    }
+}
+
+template <typename T>
+struct UndistortInterp;
+
+template <>
+struct UndistortInterp<uint8_t> {
+    static inline uint8_t blend(int32_t s00, int32_t s01, int32_t s10, int32_t s11, int32_t fx, int32_t fy)
+    {
+        const int32_t n = UNDISTORT_INTER_TAB_SIZE;
+        int32_t top     = s00 * (n - fx) + s01 * fx;
+        int32_t bottom  = s10 * (n - fx) + s11 * fx;
+        return (uint8_t)((top * (n - fy) + bottom * fy + (1 << (2 * UNDISTORT_INTER_BITS - 1))) >> (2 * UNDISTORT_INTER_BITS));
+    }
+};
+
+template <>
+struct UndistortInterp<float> {
+    static inline float blend(float s00, float s01, float s10, float s11, int32_t fx, int32_t fy)
+    {
+        const float scale = 1.f / UNDISTORT_INTER_TAB_SIZE;
+        float ax = fx * scale, ay = fy * scale;
+        float bx = 1.f - ax, by = 1.f - ay;
+        return s00 * (by * bx) + s01 * (by * ax) + s10 * (ay * bx) + s11 * (ay * ax);
+    }
+};
+
+template <typename T, int32_t nc, BorderType borderMode>
+static void sampleRow(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* src,
+    const int32_t* iu,
+    const int32_t* iv,
+    T* dst,
+    T borderValue)
+{
+    typedef UndistortInterp<T> Interp;
+    T border[nc];
+    for (int32_t c = 0; c < nc; ++c) {
+        border[c] = borderValue;
+    }
+    for (int32_t j = 0; j < width; ++j, dst += nc) {
+        int32_t sx = iu[j] >> UNDISTORT_INTER_BITS;
+        int32_t sy = iv[j] >> UNDISTORT_INTER_BITS;
+        int32_t fx = iu[j] & (UNDISTORT_INTER_TAB_SIZE - 1);
+        int32_t fy = iv[j] & (UNDISTORT_INTER_TAB_SIZE - 1);
+        const T *p00, *p01, *p10, *p11;
+        if ((uint32_t)sx < (uint32_t)(width - 1) && (uint32_t)sy < (uint32_t)(height - 1)) {
+            p00 = src + sy * inWidthStride + sx * nc;
+            p01 = p00 + nc;
+            p10 = p00 + inWidthStride;
+            p11 = p10 + nc;
+        } else if (borderMode == BORDER_TYPE_CONSTANT) {
+            if (sx >= width || sx < -1 || sy >= height || sy < -1) {
+                for (int32_t c = 0; c < nc; ++c) {
+                    dst[c] = borderValue;
+                }
+                continue;
+            }
+            bool x0 = sx >= 0, x1 = sx + 1 < width, y0 = sy >= 0, y1 = sy + 1 < height;
+            const T* row0 = src + sy * inWidthStride;
+            const T* row1 = row0 + inWidthStride;
+            p00 = x0 && y0 ? row0 + sx * nc : border;
+            p01 = x1 && y0 ? row0 + (sx + 1) * nc : border;
+            p10 = x0 && y1 ? row1 + sx * nc : border;
+            p11 = x1 && y1 ? row1 + (sx + 1) * nc : border;
+        } else {
+            int32_t x0 = std::min(std::max(sx, 0), width - 1);
+            int32_t x1 = std::min(std::max(sx + 1, 0), width - 1);
+            int32_t y0 = std::min(std::max(sy, 0), height - 1);
+            int32_t y1 = std::min(std::max(sy + 1, 0), height - 1);
+            p00        = src + y0 * inWidthStride + x0 * nc;
+            p01        = src + y0 * inWidthStride + x1 * nc;
+            p10        = src + y1 * inWidthStride + x0 * nc;
+            p11        = src + y1 * inWidthStride + x1 * nc;
+        }
+        for (int32_t c = 0; c < nc; ++c) {
+            dst[c] = Interp::blend(p00[c], p01[c], p10[c], p11[c], fx, fy);
+        }
+    }
+}
+
+template <typename T, int32_t nc, BorderType borderMode>
+static void undistortImage(
+    const UndistortModel& m,
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    T borderValue)
+{
+    const int32_t padded   = (width + 3) & ~3;
+    const int32_t numBands = (height + UNDISTORT_BAND_ROWS - 1) / UNDISTORT_BAND_ROWS;
+#pragma omp parallel for schedule(static)
+    for (int32_t band = 0; band < numBands; ++band) {
+        std::vector<float> buffer(2 * padded);
+        std::vector<int32_t> fixed(2 * padded);
+        const int32_t yEnd = std::min(height, (band + 1) * UNDISTORT_BAND_ROWS);
+        for (int32_t i = band * UNDISTORT_BAND_ROWS; i < yEnd; ++i) {
+            computeRowCoords(m, i, width, &buffer[0], &buffer[padded]);
+            quantizeRowCoords(&buffer[0], &buffer[padded], width, &fixed[0], &fixed[padded]);
+            sampleRow<T, nc, borderMode>(height, width, inWidthStride, inData, &fixed[0], &fixed[padded], outData + (size_t)i * outWidthStride, borderValue);
+        }
+    }
+}
+
+static bool validDistCoeffs(int32_t distCoeffsNum, const double* distCoeffs)
+{
+    bool validNum = distCoeffsNum == 0 || distCoeffsNum == 4 || distCoeffsNum == 5 || distCoeffsNum == 8 ||
+                    distCoeffsNum == 12 || distCoeffsNum == 14;
+    return validNum && (distCoeffsNum == 0 || distCoeffs != nullptr);
+}
+
+static void centeredCameraMatrix(const double* cameraMatrix, int32_t height, int32_t width, double* result)
+{
+    memcpy(result, cameraMatrix, 9 * sizeof(double));
+    result[2] = (width - 1) * 0.5;
+    result[5] = (height - 1) * 0.5;
+}
+
+::ppl::common::RetCode InitUndistortRectifyMap(
+    int32_t height,
+    int32_t width,
+    const double* cameraMatrix,
+    int32_t distCoeffsNum,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    float* mapX,
+    float* mapY)
+{
+    if (cameraMatrix == nullptr || mapX == nullptr || mapY == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || !validDistCoeffs(distCoeffsNum, distCoeffs)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    double centered[9];
+    if (newCameraMatrix == nullptr) {
+        centeredCameraMatrix(cameraMatrix, height, width, centered);
+        newCameraMatrix = centered;
+    }
+    UndistortModel m;
+    if (!initUndistortModel(cameraMatrix, distCoeffsNum, distCoeffs, R, newCameraMatrix, false, m)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    buildFloatMaps(m, height, width, mapX, mapY);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode InitUndistortRectifyMap(
+    int32_t height,
+    int32_t width,
+    const double* cameraMatrix,
+    int32_t distCoeffsNum,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    int16_t* mapXY,
+    uint16_t* mapFXY)
+{
+    if (cameraMatrix == nullptr || mapXY == nullptr || mapFXY == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || !validDistCoeffs(distCoeffsNum, distCoeffs)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    double centered[9];
+    if (newCameraMatrix == nullptr) {
+        centeredCameraMatrix(cameraMatrix, height, width, centered);
+        newCameraMatrix = centered;
+    }
+    UndistortModel m;
+    if (!initUndistortModel(cameraMatrix, distCoeffsNum, distCoeffs, R, newCameraMatrix, false, m)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    buildFixedMaps(m, height, width, mapXY, mapFXY);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode FisheyeInitUndistortRectifyMap(
+    int32_t height,
+    int32_t width,
+    const double* cameraMatrix,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    float* mapX,
+    float* mapY)
+{
+    if (cameraMatrix == nullptr || distCoeffs == nullptr || mapX == nullptr || mapY == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    UndistortModel m;
+    if (!initUndistortModel(cameraMatrix, 4, distCoeffs, R, newCameraMatrix, true, m)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    buildFloatMaps(m, height, width, mapX, mapY);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode FisheyeInitUndistortRectifyMap(
+    int32_t height,
+    int32_t width,
+    const double* cameraMatrix,
+    const double* distCoeffs,
+    const double* R,
+    const double* newCameraMatrix,
+    int16_t* mapXY,
+    uint16_t* mapFXY)
+{
+    if (cameraMatrix == nullptr || distCoeffs == nullptr || mapXY == nullptr || mapFXY == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    UndistortModel m;
+    if (!initUndistortModel(cameraMatrix, 4, distCoeffs, R, newCameraMatrix, true, m)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    buildFixedMaps(m, height, width, mapXY, mapFXY);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t nc>
+static ::ppl::common::RetCode undistortDispatch(
+    const UndistortModel& m,
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    BorderType border_type,
+    T borderValue)
+{
+    if (border_type == BORDER_TYPE_CONSTANT) {
+        undistortImage<T, nc, BORDER_TYPE_CONSTANT>(m, height, width, inWidthStride, inData, outWidthStride, outData, borderValue);
+    } else {
+        undistortImage<T, nc, BORDER_TYPE_REPLICATE>(m, height, width, inWidthStride, inData, outWidthStride, outData, borderValue);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t nc>
+::ppl::common::RetCode Undistort(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    const double* cameraMatrix,
+    int32_t distCoeffsNum,
+    const double* distCoeffs,
+    const double* newCameraMatrix,
+    BorderType border_type,
+    T borderValue)
+{
+    if (inData == nullptr || outData == nullptr || cameraMatrix == nullptr || inData == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * nc || outWidthStride < width * nc) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (!validDistCoeffs(distCoeffsNum, distCoeffs)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type != BORDER_TYPE_CONSTANT && border_type != BORDER_TYPE_REPLICATE) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    UndistortModel m;
+    if (!initUndistortModel(cameraMatrix, distCoeffsNum, distCoeffs, nullptr, newCameraMatrix ? newCameraMatrix : cameraMatrix, false, m)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return undistortDispatch<T, nc>(m, height, width, inWidthStride, inData, outWidthStride, outData, border_type, borderValue);
+}
+
+template <typename T, int32_t nc>
+::ppl::common::RetCode FisheyeUndistort(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData,
+    const double* cameraMatrix,
+    const double* distCoeffs,
+    const double* newCameraMatrix,
+    BorderType border_type,
+    T borderValue)
+{
+    if (inData == nullptr || outData == nullptr || cameraMatrix == nullptr || distCoeffs == nullptr || inData == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * nc || outWidthStride < width * nc) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type != BORDER_TYPE_CONSTANT && border_type != BORDER_TYPE_REPLICATE) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    UndistortModel m;
+    if (!initUndistortModel(cameraMatrix, 4, distCoeffs, nullptr, newCameraMatrix ? newCameraMatrix : cameraMatrix, true, m)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return undistortDispatch<T, nc>(m, height, width, inWidthStride, inData, outWidthStride, outData, border_type, borderValue);
+}
+
+template ::ppl::common::RetCode Undistort<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t* inData, int32_t outWidthStride, uint8_t* outData, const double* cameraMatrix, int32_t distCoeffsNum, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode Undistort<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t* inData, int32_t outWidthStride, uint8_t* outData, const double* cameraMatrix, int32_t distCoeffsNum, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode Undistort<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t* inData, int32_t outWidthStride, uint8_t* outData, const double* cameraMatrix, int32_t distCoeffsNum, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode Undistort<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, int32_t outWidthStride, float* outData, const double* cameraMatrix, int32_t distCoeffsNum, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, float borderValue);
+template ::ppl::common::RetCode Undistort<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, int32_t outWidthStride, float* outData, const double* cameraMatrix, int32_t distCoeffsNum, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, float borderValue);
+template ::ppl::common::RetCode Undistort<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, int32_t outWidthStride, float* outData, const double* cameraMatrix, int32_t distCoeffsNum, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, float borderValue);
+
+template ::ppl::common::RetCode FisheyeUndistort<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t* inData, int32_t outWidthStride, uint8_t* outData, const double* cameraMatrix, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode FisheyeUndistort<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t* inData, int32_t outWidthStride, uint8_t* outData, const double* cameraMatrix, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode FisheyeUndistort<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t* inData, int32_t outWidthStride, uint8_t* outData, const double* cameraMatrix, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode FisheyeUndistort<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, int32_t outWidthStride, float* outData, const double* cameraMatrix, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, float borderValue);
+template ::ppl::common::RetCode FisheyeUndistort<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, int32_t outWidthStride, float* outData, const double* cameraMatrix, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, float borderValue);
+template ::ppl::common::RetCode FisheyeUndistort<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float* inData, int32_t outWidthStride, float* outData, const double* cameraMatrix, const double* distCoeffs, const double* newCameraMatrix, BorderType border_type, float borderValue);
+
+}
+}
+} // namespace ppl::cv::x86
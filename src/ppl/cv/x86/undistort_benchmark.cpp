@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/undistort.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/calib3d.hpp>
+
+namespace {
+
+static const double kCameraMatrix[9] = {520., 0., 318.5, 0., 515., 242.3, 0., 0., 1.};
+static const double kDistCoeffs[5]   = {-0.28, 0.09, 0.001, -0.0015, -0.01};
+
+void BM_InitUndistortRectifyMap_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<float[]> mapX(new float[width * height]);
+    std::unique_ptr<float[]> mapY(new float[width * height]);
+    for (auto _ : state) {
+        ppl::cv::x86::InitUndistortRectifyMap(height, width, kCameraMatrix, 5, kDistCoeffs, nullptr, kCameraMatrix, mapX.get(), mapY.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_InitUndistortRectifyMapFixed_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<int16_t[]> mapXY(new int16_t[width * height * 2]);
+    std::unique_ptr<uint16_t[]> mapFXY(new uint16_t[width * height]);
+    for (auto _ : state) {
+        ppl::cv::x86::InitUndistortRectifyMap(height, width, kCameraMatrix, 5, kDistCoeffs, nullptr, kCameraMatrix, mapXY.get(), mapFXY.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T, int32_t channels>
+void BM_Undistort_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * channels]);
+    std::unique_ptr<T[]> dst(new T[width * height * channels]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * channels, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::Undistort<T, channels>(height, width, width * channels, src.get(), width * channels, dst.get(), kCameraMatrix, 5, kDistCoeffs);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK(BM_InitUndistortRectifyMap_ppl_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK(BM_InitUndistortRectifyMapFixed_ppl_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Undistort_ppl_x86, uint8_t, c1)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Undistort_ppl_x86, uint8_t, c3)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Undistort_ppl_x86, float, c1)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+static void BM_InitUndistortRectifyMap_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    cv::Mat K(3, 3, CV_64F, (void*)kCameraMatrix);
+    cv::Mat D(1, 5, CV_64F, (void*)kDistCoeffs);
+    cv::Mat mapX, mapY;
+    for (auto _ : state) {
+        cv::initUndistortRectifyMap(K, D, cv::Mat(), K, cv::Size(width, height), CV_32FC1, mapX, mapY);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+static void BM_InitUndistortRectifyMapFixed_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    cv::Mat K(3, 3, CV_64F, (void*)kCameraMatrix);
+    cv::Mat D(1, 5, CV_64F, (void*)kDistCoeffs);
+    cv::Mat mapXY, mapFXY;
+    for (auto _ : state) {
+        cv::initUndistortRectifyMap(K, D, cv::Mat(), K, cv::Size(width, height), CV_16SC2, mapXY, mapFXY);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T, int32_t channels>
+static void BM_Undistort_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * channels]);
+    std::unique_ptr<T[]> dst(new T[width * height * channels]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * channels, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, channels), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, channels), dst.get());
+    cv::Mat K(3, 3, CV_64F, (void*)kCameraMatrix);
+    cv::Mat D(1, 5, CV_64F, (void*)kDistCoeffs);
+    for (auto _ : state) {
+        cv::undistort(srcMat, dstMat, K, D);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK(BM_InitUndistortRectifyMap_opencv_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK(BM_InitUndistortRectifyMapFixed_opencv_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Undistort_opencv_x86, uint8_t, c1)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Undistort_opencv_x86, uint8_t, c3)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Undistort_opencv_x86, float, c1)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! PPLCV_BENCHMARK_OPENCV
+}
@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/undistort.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <string.h>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+#include <opencv2/calib3d.hpp>
+
+static const double kCameraMatrix[9]    = {520., 0., 318.5, 0., 515., 242.3, 0., 0., 1.};
+static const double kNewCameraMatrix[9] = {480., 0., 330., 0., 470., 235., 0., 0., 1.};
+static const double kDistCoeffs[14]     = {-0.28, 0.09, 0.001, -0.0015, -0.01, 0.05, 0.01, 0.002, 0.001, -0.0005, 0.0007, 0.0002, 0.01, -0.02};
+static const double kFisheyeMatrix[9]   = {300., 0., 322., 0., 298., 238., 0., 0., 1.};
+static const double kFisheyeCoeffs[4]   = {0.05, -0.01, 0.002, -0.0005};
+
+static void rectification(double* R)
+{
+    cv::Mat rvec = (cv::Mat_<double>(3, 1) << 0.02, -0.03, 0.01);
+    cv::Mat rmat;
+    cv::Rodrigues(rvec, rmat);
+    memcpy(R, rmat.ptr<double>(), 9 * sizeof(double));
+}
+
+// the fixed-point coordinates may differ by one step where the single precision result lies next to a rounding boundary
+static void checkFixedMaps(const int16_t* xy, const uint16_t* fxy, const cv::Mat& refXY, const cv::Mat& refFXY, int32_t height, int32_t width)
+{
+    const int32_t mask = (1 << UNDISTORT_INTER_BITS) - 1;
+    int32_t maxDiff    = 0;
+    for (int32_t i = 0; i < height; ++i) {
+        const int16_t* rxy   = refXY.ptr<int16_t>(i);
+        const uint16_t* rfxy = refFXY.ptr<uint16_t>(i);
+        for (int32_t j = 0; j < width; ++j) {
+            int32_t k  = i * width + j;
+            int32_t x  = (xy[2 * k] << UNDISTORT_INTER_BITS) + (fxy[k] & mask);
+            int32_t y  = (xy[2 * k + 1] << UNDISTORT_INTER_BITS) + (fxy[k] >> UNDISTORT_INTER_BITS);
+            int32_t rx = (rxy[2 * j] << UNDISTORT_INTER_BITS) + (rfxy[j] & mask);
+            int32_t ry = (rxy[2 * j + 1] << UNDISTORT_INTER_BITS) + (rfxy[j] >> UNDISTORT_INTER_BITS);
+            maxDiff    = std::max(maxDiff, std::max(std::abs(x - rx), std::abs(y - ry)));
+        }
+    }
+    EXPECT_LE(maxDiff, 1);
+}
+
+void InitUndistortRectifyMapTest(int32_t height, int32_t width, int32_t distCoeffsNum, bool rectify)
+{
+    double R[9];
+    rectification(R);
+    std::vector<float> mapX(width * height), mapY(width * height);
+    std::vector<int16_t> mapXY(width * height * 2);
+    std::vector<uint16_t> mapFXY(width * height);
+    const double* r  = rectify ? R : nullptr;
+    const double* nk = rectify ? kNewCameraMatrix : nullptr;
+    ppl::cv::x86::InitUndistortRectifyMap(height, width, kCameraMatrix, distCoeffsNum, kDistCoeffs, r, nk, mapX.data(), mapY.data());
+    ppl::cv::x86::InitUndistortRectifyMap(height, width, kCameraMatrix, distCoeffsNum, kDistCoeffs, r, nk, mapXY.data(), mapFXY.data());
+
+    cv::Mat K(3, 3, CV_64F, (void*)kCameraMatrix);
+    cv::Mat D(1, distCoeffsNum, CV_64F, (void*)kDistCoeffs);
+    cv::Mat RMat = rectify ? cv::Mat(3, 3, CV_64F, R) : cv::Mat();
+    cv::Mat NK   = rectify ? cv::Mat(3, 3, CV_64F, (void*)kNewCameraMatrix) : cv::Mat();
+    cv::Mat refX, refY, refXY, refFXY;
+    cv::initUndistortRectifyMap(K, D, RMat, NK, cv::Size(width, height), CV_32FC1, refX, refY);
+    cv::initUndistortRectifyMap(K, D, RMat, NK, cv::Size(width, height), CV_16SC2, refXY, refFXY);
+
+    checkResult<float, 1>(mapX.data(), refX.ptr<float>(), height, width, width, width, 1e-2f);
+    checkResult<float, 1>(mapY.data(), refY.ptr<float>(), height, width, width, width, 1e-2f);
+    checkFixedMaps(mapXY.data(), mapFXY.data(), refXY, refFXY, height, width);
+}
+
+void FisheyeInitUndistortRectifyMapTest(int32_t height, int32_t width, bool rectify)
+{
+    double R[9], P[9];
+    rectification(R);
+    memcpy(P, kFisheyeMatrix, sizeof(P));
+    P[0] *= 0.6;
+    P[4] *= 0.6;
+    std::vector<float> mapX(width * height), mapY(width * height);
+    std::vector<int16_t> mapXY(width * height * 2);
+    std::vector<uint16_t> mapFXY(width * height);
+    const double* r = rectify ? R : nullptr;
+    ppl::cv::x86::FisheyeInitUndistortRectifyMap(height, width, kFisheyeMatrix, kFisheyeCoeffs, r, P, mapX.data(), mapY.data());
+    ppl::cv::x86::FisheyeInitUndistortRectifyMap(height, width, kFisheyeMatrix, kFisheyeCoeffs, r, P, mapXY.data(), mapFXY.data());
+
+    cv::Mat K(3, 3, CV_64F, (void*)kFisheyeMatrix);
+    cv::Mat D(1, 4, CV_64F, (void*)kFisheyeCoeffs);
+    cv::Mat RMat = rectify ? cv::Mat(3, 3, CV_64F, R) : cv::Mat::eye(3, 3, CV_64F);
+    cv::Mat PMat(3, 3, CV_64F, P);
+    cv::Mat refX, refY, refXY, refFXY;
+    cv::fisheye::initUndistortRectifyMap(K, D, RMat, PMat, cv::Size(width, height), CV_32FC1, refX, refY);
+    cv::fisheye::initUndistortRectifyMap(K, D, RMat, PMat, cv::Size(width, height), CV_16SC2, refXY, refFXY);
+
+    checkResult<float, 1>(mapX.data(), refX.ptr<float>(), height, width, width, width, 1e-2f);
+    checkResult<float, 1>(mapY.data(), refY.ptr<float>(), height, width, width, width, 1e-2f);
+    checkFixedMaps(mapXY.data(), mapFXY.data(), refXY, refFXY, height, width);
+}
+
+// the fused version must give the same result as remapping with its own fixed-point maps
+template <typename T, int32_t nc, bool fisheye>
+void UndistortTest(int32_t height, int32_t width, ppl::cv::BorderType border_type, float diff)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::vector<int16_t> mapXY(width * height * 2);
+    std::vector<uint16_t> mapFXY(width * height);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    if (fisheye) {
+        ppl::cv::x86::FisheyeUndistort<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), kFisheyeMatrix, kFisheyeCoeffs, kNewCameraMatrix, border_type);
+        ppl::cv::x86::FisheyeInitUndistortRectifyMap(height, width, kFisheyeMatrix, kFisheyeCoeffs, nullptr, kNewCameraMatrix, mapXY.data(), mapFXY.data());
+    } else {
+        ppl::cv::x86::Undistort<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), kCameraMatrix, 5, kDistCoeffs, nullptr, border_type);
+        ppl::cv::x86::InitUndistortRectifyMap(height, width, kCameraMatrix, 5, kDistCoeffs, nullptr, kCameraMatrix, mapXY.data(), mapFXY.data());
+    }
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    cv::Mat xyMat(height, width, CV_16SC2, mapXY.data());
+    cv::Mat fxyMat(height, width, CV_16UC1, mapFXY.data());
+    int cv_border = border_type == ppl::cv::BORDER_TYPE_CONSTANT ? cv::BORDER_CONSTANT : cv::BORDER_REPLICATE;
+    cv::remap(srcMat, dstMat, xyMat, fxyMat, cv::INTER_LINEAR, cv_border);
+    checkResult<T, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, diff);
+}
+
+TEST(INIT_UNDISTORT_RECTIFY_MAP, x86)
+{
+    InitUndistortRectifyMapTest(480, 640, 4, false);
+    InitUndistortRectifyMapTest(480, 640, 5, true);
+    InitUndistortRectifyMapTest(720, 1280, 8, false);
+    InitUndistortRectifyMapTest(241, 323, 12, true);
+    InitUndistortRectifyMapTest(480, 640, 14, true);
+}
+
+TEST(FISHEYE_INIT_UNDISTORT_RECTIFY_MAP, x86)
+{
+    FisheyeInitUndistortRectifyMapTest(480, 640, false);
+    FisheyeInitUndistortRectifyMapTest(241, 323, true);
+}
+
+TEST(UNDISTORT_UINT8, x86)
+{
+    UndistortTest<uint8_t, 1, false>(480, 640, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+    UndistortTest<uint8_t, 3, false>(480, 640, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+    UndistortTest<uint8_t, 4, false>(241, 323, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+    UndistortTest<uint8_t, 1, true>(480, 640, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+    UndistortTest<uint8_t, 3, true>(241, 323, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+}
+
+TEST(UNDISTORT_FP32, x86)
+{
+    UndistortTest<float, 1, false>(480, 640, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+    UndistortTest<float, 3, false>(241, 323, ppl::cv::BORDER_TYPE_REPLICATE, 1e-3f);
+    UndistortTest<float, 4, false>(480, 640, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+    UndistortTest<float, 1, true>(241, 323, ppl::cv::BORDER_TYPE_REPLICATE, 1e-3f);
+    UndistortTest<float, 4, true>(480, 640, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+}
@@ -23,6 +23,9 @@
 #include <vector>
 #include <cstring>
 #include <cassert>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace ppl {
 namespace cv {
@@ -71,6 +74,24 @@ inline void Map(T *out_data, const T *in_data0, const T *in_data1, float alpha,
     }
 }
 
+inline int32_t get_max_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int32_t get_thread_num()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
 static inline int32_t borderInterpolate(int32_t p, int32_t len)
 {
     if (len == 1) {
@@ -353,6 +353,58 @@ template ::ppl::common::RetCode WarpAffineNearestPoint<uint8_t, 4>(
     BorderType border_type,
     uint8_t border_value);
 
+template ::ppl::common::RetCode WarpAffineNearestPoint<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    const double* affineMatrix,
+    BorderType border_type,
+    uint16_t border_value);
+
+template ::ppl::common::RetCode WarpAffineNearestPoint<uint16_t, 2>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    const double* affineMatrix,
+    BorderType border_type,
+    uint16_t border_value);
+
+template ::ppl::common::RetCode WarpAffineNearestPoint<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    const double* affineMatrix,
+    BorderType border_type,
+    uint16_t border_value);
+
+template ::ppl::common::RetCode WarpAffineNearestPoint<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    const double* affineMatrix,
+    BorderType border_type,
+    uint16_t border_value);
+
 template <typename T, int32_t nc>
 ::ppl::common::RetCode WarpAffineLinear(
     int32_t inHeight,
@@ -491,6 +543,58 @@ template ::ppl::common::RetCode WarpAffineLinear<uint8_t, 4>(
     BorderType border_type,
     uint8_t border_value);
 
+template ::ppl::common::RetCode WarpAffineLinear<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    const double* affineMatrix,
+    BorderType border_type,
+    uint16_t border_value);
+
+template ::ppl::common::RetCode WarpAffineLinear<uint16_t, 2>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    const double* affineMatrix,
+    BorderType border_type,
+    uint16_t border_value);
+
+template ::ppl::common::RetCode WarpAffineLinear<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    const double* affineMatrix,
+    BorderType border_type,
+    uint16_t border_value);
+
+template ::ppl::common::RetCode WarpAffineLinear<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    const double* affineMatrix,
+    BorderType border_type,
+    uint16_t border_value);
+
 }
 }
 } // namespace ppl::cv::x86
@@ -81,34 +81,53 @@ R(WARPAFFINE_FP32_C4_NEAREST_BORDER_TYPE_CONSTANT, float, 4, ppl::cv::INTERPOLAT
 R(WARPAFFINE_U8_C1_NEAREST_BORDER_TYPE_CONSTANT, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
 R(WARPAFFINE_U8_C3_NEAREST_BORDER_TYPE_CONSTANT, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
 R(WARPAFFINE_U8_C4_NEAREST_BORDER_TYPE_CONSTANT, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPAFFINE_U16_C1_NEAREST_BORDER_TYPE_CONSTANT, uint16_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPAFFINE_U16_C3_NEAREST_BORDER_TYPE_CONSTANT, uint16_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPAFFINE_U16_C4_NEAREST_BORDER_TYPE_CONSTANT, uint16_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
 R(WARPAFFINE_FP32_C1_NEAREST_BORDER_TYPE_REPLICATE, float, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_FP32_C3_NEAREST_BORDER_TYPE_REPLICATE, float, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_FP32_C4_NEAREST_BORDER_TYPE_REPLICATE, float, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_U8_C1_NEAREST_BORDER_TYPE_REPLICATE, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_U8_C3_NEAREST_BORDER_TYPE_REPLICATE, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_U8_C4_NEAREST_BORDER_TYPE_REPLICATE, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPAFFINE_U16_C1_NEAREST_BORDER_TYPE_REPLICATE, uint16_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPAFFINE_U16_C3_NEAREST_BORDER_TYPE_REPLICATE, uint16_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPAFFINE_U16_C4_NEAREST_BORDER_TYPE_REPLICATE, uint16_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_FP32_C1_NEAREST_BORDER_TYPE_TRANSPARENT, float, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_FP32_C3_NEAREST_BORDER_TYPE_TRANSPARENT, float, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_FP32_C4_NEAREST_BORDER_TYPE_TRANSPARENT, float, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_U8_C1_NEAREST_BORDER_TYPE_TRANSPARENT, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_U8_C3_NEAREST_BORDER_TYPE_TRANSPARENT, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_U8_C4_NEAREST_BORDER_TYPE_TRANSPARENT, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPAFFINE_U16_C1_NEAREST_BORDER_TYPE_TRANSPARENT, uint16_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPAFFINE_U16_C3_NEAREST_BORDER_TYPE_TRANSPARENT, uint16_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPAFFINE_U16_C4_NEAREST_BORDER_TYPE_TRANSPARENT, uint16_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 
+// OpenCV quantizes 16-bit source coordinates to 1/32 pixel, so linear results move by a few levels
 R(WARPAFFINE_FP32_C1_LINEAR_BORDER_TYPE_CONSTANT, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
 R(WARPAFFINE_FP32_C3_LINEAR_BORDER_TYPE_CONSTANT, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
 R(WARPAFFINE_FP32_C4_LINEAR_BORDER_TYPE_CONSTANT, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
 R(WARPAFFINE_U8_C1_LINEAR_BORDER_TYPE_CONSTANT, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
 R(WARPAFFINE_U8_C3_LINEAR_BORDER_TYPE_CONSTANT, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
 R(WARPAFFINE_U8_C4_LINEAR_BORDER_TYPE_CONSTANT, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPAFFINE_U16_C1_LINEAR_BORDER_TYPE_CONSTANT, uint16_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 8.01f);
+R(WARPAFFINE_U16_C3_LINEAR_BORDER_TYPE_CONSTANT, uint16_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 8.01f);
+R(WARPAFFINE_U16_C4_LINEAR_BORDER_TYPE_CONSTANT, uint16_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 8.01f);
 R(WARPAFFINE_FP32_C1_LINEAR_BORDER_TYPE_REPLICATE, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_FP32_C3_LINEAR_BORDER_TYPE_REPLICATE, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_FP32_C4_LINEAR_BORDER_TYPE_REPLICATE, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_U8_C1_LINEAR_BORDER_TYPE_REPLICATE, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_U8_C3_LINEAR_BORDER_TYPE_REPLICATE, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
 R(WARPAFFINE_U8_C4_LINEAR_BORDER_TYPE_REPLICATE, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPAFFINE_U16_C1_LINEAR_BORDER_TYPE_REPLICATE, uint16_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 8.01f);
+R(WARPAFFINE_U16_C3_LINEAR_BORDER_TYPE_REPLICATE, uint16_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 8.01f);
+R(WARPAFFINE_U16_C4_LINEAR_BORDER_TYPE_REPLICATE, uint16_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 8.01f);
 R(WARPAFFINE_FP32_C1_LINEAR_BORDER_TYPE_TRANSPARENT, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_FP32_C3_LINEAR_BORDER_TYPE_TRANSPARENT, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_FP32_C4_LINEAR_BORDER_TYPE_TRANSPARENT, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_U8_C1_LINEAR_BORDER_TYPE_TRANSPARENT, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_U8_C3_LINEAR_BORDER_TYPE_TRANSPARENT, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
 R(WARPAFFINE_U8_C4_LINEAR_BORDER_TYPE_TRANSPARENT, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPAFFINE_U16_C1_LINEAR_BORDER_TYPE_TRANSPARENT, uint16_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 8.01f);
+R(WARPAFFINE_U16_C3_LINEAR_BORDER_TYPE_TRANSPARENT, uint16_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 8.01f);
+R(WARPAFFINE_U16_C4_LINEAR_BORDER_TYPE_TRANSPARENT, uint16_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 8.01f);
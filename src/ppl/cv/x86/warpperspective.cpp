@@ -16,7 +16,6 @@
 // under the License.
 
 #include "ppl/cv/x86/warpperspective.h"
-#include "ppl/cv/x86/avx/internal_avx.hpp"
 #include "ppl/cv/x86/fma/internal_fma.hpp"
 #include "ppl/cv/types.h"
 #include "ppl/common/sys.h"
@@ -25,7 +24,6 @@
 #include <string.h>
 #include <cmath>
 #include <algorithm>
-#include <vector>
 #include <limits.h>
 #include <immintrin.h>
 
@@ -33,70 +31,329 @@ namespace ppl {
 namespace cv {
 namespace x86 {
 
+#define WARP_INTER_BITS     5
+#define WARP_INTER_TAB_SIZE (1 << WARP_INTER_BITS)
+#define WARP_BLOCK_SIZE     64
+#define WARP_BAND_ROWS      16
+
 template <typename T>
 static inline T clip(T x, T a, T b)
 {
     return std::max(a, std::min(x, b));
 }
-template <typename Tsrc, typename Tdst>
-static inline float cvtScale()
+
+// maps one block of a destination row into the source image. x, y and w are stepped four pixels at a
+// time from a double precision anchor taken at the start of the block, 1/w comes from the approximate
+// reciprocal refined by one Newton step. The coordinates are rounded to 1/2^bits pixel like OpenCV does,
+// split into integer and fractional parts, and every pixel is flagged whether its (sx, sy) lies in
+// [0, limX) x [0, limY), i.e. whether it can be sampled without any border handling.
+// fma::warpperspective_project_block_fma is the 8-lane version of it
+template <int32_t bits>
+static void project_block(
+    const double M[][3],
+    int32_t i,
+    int32_t j0,
+    int32_t len,
+    int32_t limX,
+    int32_t limY,
+    int32_t* sx,
+    int32_t* sy,
+    int32_t* fx,
+    int32_t* fy,
+    uint8_t* inside)
 {
-    return 1.f;
+    const __m128 seq   = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 m00   = _mm_set1_ps(M[0][0]);
+    const __m128 m10   = _mm_set1_ps(M[1][0]);
+    const __m128 m20   = _mm_set1_ps(M[2][0]);
+    const __m128 two   = _mm_set1_ps(2.0f);
+    const __m128 scale = _mm_set1_ps((float)(1 << bits));
+    const __m128 lo    = _mm_set1_ps(-(float)(1 << 30));
+    const __m128 hi    = _mm_set1_ps((float)(1 << 30));
+    const __m128i fmask = _mm_set1_epi32((1 << bits) - 1);
+    const __m128i smin  = _mm_set1_epi32(SHRT_MIN);
+    const __m128i smax  = _mm_set1_epi32(SHRT_MAX);
+    const __m128i vlimX = _mm_set1_epi32(limX);
+    const __m128i vlimY = _mm_set1_epi32(limY);
+    const __m128i neg1  = _mm_set1_epi32(-1);
+
+    __m128 vx = _mm_add_ps(_mm_set1_ps(M[0][0] * j0 + M[0][1] * i + M[0][2]), _mm_mul_ps(m00, seq));
+    __m128 vy = _mm_add_ps(_mm_set1_ps(M[1][0] * j0 + M[1][1] * i + M[1][2]), _mm_mul_ps(m10, seq));
+    __m128 vw = _mm_add_ps(_mm_set1_ps(M[2][0] * j0 + M[2][1] * i + M[2][2]), _mm_mul_ps(m20, seq));
+    const __m128 stepX = _mm_set1_ps(M[0][0] * 4);
+    const __m128 stepY = _mm_set1_ps(M[1][0] * 4);
+    const __m128 stepW = _mm_set1_ps(M[2][0] * 4);
+    for (int32_t k = 0; k < len; k += 4) {
+        // OpenCV maps the points with w == 0 to the origin
+        __m128 r = _mm_rcp_ps(vw);
+        r        = _mm_mul_ps(r, _mm_sub_ps(two, _mm_mul_ps(vw, r)));
+        r        = _mm_andnot_ps(_mm_cmpeq_ps(vw, _mm_setzero_ps()), _mm_mul_ps(r, scale));
+        __m128 x = _mm_min_ps(_mm_max_ps(_mm_mul_ps(vx, r), lo), hi);
+        __m128 y = _mm_min_ps(_mm_max_ps(_mm_mul_ps(vy, r), lo), hi);
+        __m128i ix = _mm_cvttps_epi32(_mm_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        __m128i iy = _mm_cvttps_epi32(_mm_round_ps(y, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        if (bits > 0) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(fx + k), _mm_and_si128(ix, fmask));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(fy + k), _mm_and_si128(iy, fmask));
+        }
+        ix = _mm_min_epi32(_mm_max_epi32(_mm_srai_epi32(ix, bits), smin), smax);
+        iy = _mm_min_epi32(_mm_max_epi32(_mm_srai_epi32(iy, bits), smin), smax);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(sx + k), ix);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(sy + k), iy);
+        __m128i in = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(ix, neg1), _mm_cmpgt_epi32(vlimX, ix)),
+                                   _mm_and_si128(_mm_cmpgt_epi32(iy, neg1), _mm_cmpgt_epi32(vlimY, iy)));
+        in             = _mm_packs_epi16(_mm_packs_epi32(in, in), in);
+        int32_t packed = _mm_cvtsi128_si32(in);
+        memcpy(inside + k, &packed, sizeof(packed));
+        vx = _mm_add_ps(vx, stepX);
+        vy = _mm_add_ps(vy, stepY);
+        vw = _mm_add_ps(vw, stepW);
+    }
 }
-template <>
-inline float cvtScale<unsigned char, float>()
+
+// interleaves the channels of the two horizontal neighbours of both source rows, so that one madd per row
+// applies the pair of horizontal weights
+static const int8_t kInterleaveMask[4][16] = {
+    {0, 1, -1, -1, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1, -1, -1},
+    {0, 2, 1, 3, -1, -1, -1, -1, 8, 10, 9, 11, -1, -1, -1, -1},
+    {0, 3, 1, 4, 2, 5, -1, -1, 8, 11, 9, 12, 10, 13, -1, -1},
+    {0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15},
+};
+
+// s0 and s1 point at the top-left pixel of the 2x2 neighbourhood in the upper and the lower source row.
+// The fixed-point weights sum up to 2^(2 * WARP_INTER_BITS) exactly, which makes the result bit-exact
+// with the 16-bit tables of OpenCV
+static inline int32_t load_u16(const uint8_t* p)
 {
-    return 1. / 255;
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
 }
-template <>
-inline float cvtScale<float, unsigned char>()
+
+// loads the two horizontal neighbours into the low 2 * nc bytes, without touching any byte past them
+template <int32_t nc>
+static inline __m128i load_pair(const uint8_t* p)
 {
-    return 255.f;
+    if (nc == 4) {
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+    }
+    int32_t tail = load_u16(p + 2 * nc - 2);
+    if (nc == 1) {
+        return _mm_cvtsi32_si128(tail);
+    }
+    int32_t head;
+    memcpy(&head, p, sizeof(head));
+    return _mm_insert_epi16(_mm_cvtsi32_si128(head), tail, nc - 1);
 }
-template <>
-inline float cvtScale<unsigned short, float>()
+
+template <int32_t nc>
+static inline void bilinear_pixel(const uint8_t* s0, const uint8_t* s1, int32_t fx, int32_t fy, uint8_t* dst)
 {
-    return 1. / 255;
+    __m128i v   = _mm_shuffle_epi8(_mm_unpacklo_epi64(load_pair<nc>(s0), load_pair<nc>(s1)),
+                                 _mm_loadu_si128(reinterpret_cast<const __m128i*>(kInterleaveMask[nc - 1])));
+    int32_t ax  = WARP_INTER_TAB_SIZE - fx;
+    int32_t ay  = WARP_INTER_TAB_SIZE - fy;
+    __m128i w01 = _mm_set1_epi32(((fx * ay) << 16) | (ax * ay));
+    __m128i w23 = _mm_set1_epi32(((fx * fy) << 16) | (ax * fy));
+    __m128i sum = _mm_add_epi32(_mm_madd_epi16(_mm_cvtepu8_epi16(v), w01),
+                                _mm_madd_epi16(_mm_unpackhi_epi8(v, _mm_setzero_si128()), w23));
+    sum            = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << (2 * WARP_INTER_BITS - 1))), 2 * WARP_INTER_BITS);
+    sum            = _mm_packus_epi16(_mm_packs_epi32(sum, sum), sum);
+    int32_t packed = _mm_cvtsi128_si32(sum);
+    memcpy(dst, &packed, nc);
 }
-template <>
-inline float cvtScale<float, unsigned short>()
+
+template <int32_t nc>
+static inline void bilinear_pixel(const float* s0, const float* s1, int32_t fx, int32_t fy, float* dst)
 {
-    return 255.f;
+    const float kx1 = fx * (1.0f / WARP_INTER_TAB_SIZE);
+    const float ky1 = fy * (1.0f / WARP_INTER_TAB_SIZE);
+    const float kx0 = 1.0f - kx1;
+    const float ky0 = 1.0f - ky1;
+    const float w0  = ky0 * kx0;
+    const float w1  = ky0 * kx1;
+    const float w2  = ky1 * kx0;
+    const float w3  = ky1 * kx1;
+    if (nc == 4) {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(s0), _mm_set1_ps(w0));
+        sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(s0 + nc), _mm_set1_ps(w1)));
+        sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(s1), _mm_set1_ps(w2)));
+        sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(s1 + nc), _mm_set1_ps(w3)));
+        _mm_storeu_ps(dst, sum);
+    } else {
+        for (int32_t c = 0; c < nc; ++c) {
+            dst[c] = s0[c] * w0 + s0[c + nc] * w1 + s1[c] * w2 + s1[c + nc] * w3;
+        }
+    }
 }
 
-template <typename Tsrc, typename Tdst>
-inline Tdst bilinear_sample(Tsrc t[][2], float u, float v);
+// blends a span of interior pixels. Single channel pixels are handled four at a time, their horizontal
+// pairs are gathered with one load each and weighted per lane
+template <typename T, int32_t nc>
+static inline void bilinear_span(
+    int32_t inWidthStride,
+    const T* src,
+    const int32_t* sx,
+    const int32_t* sy,
+    const int32_t* fx,
+    const int32_t* fy,
+    int32_t len,
+    T* dst)
+{
+    for (int32_t k = 0; k < len; ++k) {
+        const T* s0 = src + sy[k] * inWidthStride + sx[k] * nc;
+        bilinear_pixel<nc>(s0, s0 + inWidthStride, fx[k], fy[k], dst + k * nc);
+    }
+}
 
 template <>
-inline float bilinear_sample<uint8_t, float>(uint8_t t[][2], float u, float v)
+inline void bilinear_span<uint8_t, 1>(
+    int32_t inWidthStride,
+    const uint8_t* src,
+    const int32_t* sx,
+    const int32_t* sy,
+    const int32_t* fx,
+    const int32_t* fy,
+    int32_t len,
+    uint8_t* dst)
 {
-    float a0 = (1.0f - u) * (1.0f - v);
-    float a1 = u * (1.0f - v);
-    float a2 = (1.0f - u) * v;
-    float a3 = u * v;
-    return (t[0][0] * a0 + t[1][0] * a1 + t[0][1] * a2 + t[1][1] * a3) * cvtScale<uint8_t, float>();
+    const __m128i tab   = _mm_set1_epi32(WARP_INTER_TAB_SIZE);
+    const __m128i delta = _mm_set1_epi32(1 << (2 * WARP_INTER_BITS - 1));
+    int32_t k           = 0;
+    for (; k <= len - 4; k += 4) {
+        const uint8_t* s0 = src + sy[k] * inWidthStride + sx[k];
+        const uint8_t* s1 = src + sy[k + 1] * inWidthStride + sx[k + 1];
+        const uint8_t* s2 = src + sy[k + 2] * inWidthStride + sx[k + 2];
+        const uint8_t* s3 = src + sy[k + 3] * inWidthStride + sx[k + 3];
+        __m128i v         = _mm_cvtsi32_si128(load_u16(s0));
+        v                 = _mm_insert_epi16(v, load_u16(s1), 1);
+        v                 = _mm_insert_epi16(v, load_u16(s2), 2);
+        v                 = _mm_insert_epi16(v, load_u16(s3), 3);
+        v                 = _mm_insert_epi16(v, load_u16(s0 + inWidthStride), 4);
+        v                 = _mm_insert_epi16(v, load_u16(s1 + inWidthStride), 5);
+        v                 = _mm_insert_epi16(v, load_u16(s2 + inWidthStride), 6);
+        v                 = _mm_insert_epi16(v, load_u16(s3 + inWidthStride), 7);
+        __m128i bx  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fx + k));
+        __m128i by  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fy + k));
+        __m128i ax  = _mm_sub_epi32(tab, bx);
+        __m128i ay  = _mm_sub_epi32(tab, by);
+        __m128i w01 = _mm_or_si128(_mm_mullo_epi16(ax, ay), _mm_slli_epi32(_mm_mullo_epi16(bx, ay), 16));
+        __m128i w23 = _mm_or_si128(_mm_mullo_epi16(ax, by), _mm_slli_epi32(_mm_mullo_epi16(bx, by), 16));
+        __m128i sum = _mm_add_epi32(_mm_madd_epi16(_mm_cvtepu8_epi16(v), w01),
+                                    _mm_madd_epi16(_mm_unpackhi_epi8(v, _mm_setzero_si128()), w23));
+        sum            = _mm_srai_epi32(_mm_add_epi32(sum, delta), 2 * WARP_INTER_BITS);
+        sum            = _mm_packus_epi16(_mm_packs_epi32(sum, sum), sum);
+        int32_t packed = _mm_cvtsi128_si32(sum);
+        memcpy(dst + k, &packed, sizeof(packed));
+    }
+    for (; k < len; ++k) {
+        const uint8_t* s0 = src + sy[k] * inWidthStride + sx[k];
+        bilinear_pixel<1>(s0, s0 + inWidthStride, fx[k], fy[k], dst + k);
+    }
 }
 
 template <>
-inline float bilinear_sample<float, float>(float t[][2], float u, float v)
+inline void bilinear_span<float, 1>(
+    int32_t inWidthStride,
+    const float* src,
+    const int32_t* sx,
+    const int32_t* sy,
+    const int32_t* fx,
+    const int32_t* fy,
+    int32_t len,
+    float* dst)
 {
-    float a0 = (1.0f - u) * (1.0f - v);
-    float a1 = u * (1.0f - v);
-    float a2 = (1.0f - u) * v;
-    float a3 = u * v;
-    return (t[0][0] * a0 + t[1][0] * a1 + t[0][1] * a2 + t[1][1] * a3) * cvtScale<float, float>();
+    const __m128 tab = _mm_set1_ps(1.0f / WARP_INTER_TAB_SIZE);
+    const __m128 one = _mm_set1_ps(1.0f);
+    int32_t k        = 0;
+    for (; k <= len - 4; k += 4) {
+        const float* s0 = src + sy[k] * inWidthStride + sx[k];
+        const float* s1 = src + sy[k + 1] * inWidthStride + sx[k + 1];
+        const float* s2 = src + sy[k + 2] * inWidthStride + sx[k + 2];
+        const float* s3 = src + sy[k + 3] * inWidthStride + sx[k + 3];
+        __m128 t01      = _mm_loadh_pi(_mm_loadl_pi(one, reinterpret_cast<const __m64*>(s0)), reinterpret_cast<const __m64*>(s1));
+        __m128 t23      = _mm_loadh_pi(_mm_loadl_pi(one, reinterpret_cast<const __m64*>(s2)), reinterpret_cast<const __m64*>(s3));
+        __m128 b01      = _mm_loadh_pi(_mm_loadl_pi(one, reinterpret_cast<const __m64*>(s0 + inWidthStride)), reinterpret_cast<const __m64*>(s1 + inWidthStride));
+        __m128 b23      = _mm_loadh_pi(_mm_loadl_pi(one, reinterpret_cast<const __m64*>(s2 + inWidthStride)), reinterpret_cast<const __m64*>(s3 + inWidthStride));
+        __m128 kx1      = _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(fx + k))), tab);
+        __m128 ky1      = _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(fy + k))), tab);
+        __m128 kx0      = _mm_sub_ps(one, kx1);
+        __m128 ky0      = _mm_sub_ps(one, ky1);
+        __m128 sum      = _mm_mul_ps(_mm_shuffle_ps(t01, t23, _MM_SHUFFLE(2, 0, 2, 0)), _mm_mul_ps(ky0, kx0));
+        sum             = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(t01, t23, _MM_SHUFFLE(3, 1, 3, 1)), _mm_mul_ps(ky0, kx1)));
+        sum             = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(b01, b23, _MM_SHUFFLE(2, 0, 2, 0)), _mm_mul_ps(ky1, kx0)));
+        sum             = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(b01, b23, _MM_SHUFFLE(3, 1, 3, 1)), _mm_mul_ps(ky1, kx1)));
+        _mm_storeu_ps(dst + k, sum);
+    }
+    for (; k < len; ++k) {
+        const float* s0 = src + sy[k] * inWidthStride + sx[k];
+        bilinear_pixel<1>(s0, s0 + inWidthStride, fx[k], fy[k], dst + k);
+    }
 }
 
-template <>
-inline uint8_t bilinear_sample<uint8_t, uint8_t>(uint8_t t[][2], float u, float v)
+// gathers the 2x2 neighbourhood through the border mode and blends it like an interior pixel
+template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
+static inline void bilinear_border_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* src,
+    int32_t sx,
+    int32_t sy,
+    int32_t fx,
+    int32_t fy,
+    T* dst,
+    T delta)
 {
-    float a0 = (1.0f - u) * (1.0f - v);
-    float a1 = u * (1.0f - v);
-    float a2 = (1.0f - u) * v;
-    float a3 = u * v;
-    return std::min(std::max(static_cast<int32_t>((t[0][0] * a0 + t[1][0] * a1 + t[0][1] * a2 + t[1][1] * a3) * cvtScale<uint8_t, uint8_t>()), 0), 255);
+    if (borderMode == ppl::cv::BORDER_TYPE_TRANSPARENT) {
+        return;
+    }
+    T corners[2][2 * nc];
+    for (int32_t r = 0; r < 2; ++r) {
+        for (int32_t k = 0; k < 2; ++k) {
+            int32_t x  = sx + k;
+            int32_t y  = sy + r;
+            const T* p = nullptr;
+            if (borderMode == ppl::cv::BORDER_TYPE_REPLICATE) {
+                p = src + clip(y, 0, inHeight - 1) * inWidthStride + clip(x, 0, inWidth - 1) * nc;
+            } else if (x >= 0 && x < inWidth && y >= 0 && y < inHeight) {
+                p = src + y * inWidthStride + x * nc;
+            }
+            for (int32_t c = 0; c < nc; ++c) {
+                corners[r][k * nc + c] = p ? p[c] : delta;
+            }
+        }
+    }
+    bilinear_pixel<nc>(corners[0], corners[1], fx, fy, dst);
 }
 
+template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
+static inline void nearest_border_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* src,
+    int32_t sx,
+    int32_t sy,
+    T* dst,
+    T delta)
+{
+    if (borderMode == ppl::cv::BORDER_TYPE_CONSTANT) {
+        for (int32_t c = 0; c < nc; ++c) {
+            dst[c] = delta;
+        }
+    } else if (borderMode == ppl::cv::BORDER_TYPE_REPLICATE) {
+        const T* p = src + clip(sy, 0, inHeight - 1) * inWidthStride + clip(sx, 0, inWidth - 1) * nc;
+        for (int32_t c = 0; c < nc; ++c) {
+            dst[c] = p[c];
+        }
+    }
+}
+
+// Every destination row is cut into blocks, the coordinates of a block are computed with SIMD, and the
+// block is then walked as alternating spans of pixels that lie completely inside the source image and
+// pixels that need the border mode, so the inner loops do not test the border per pixel. Bands of rows
+// are scheduled dynamically, as the share of border pixels varies strongly between the rows of a warp
 template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
 ::ppl::common::RetCode warpperspective_nearest(
     int32_t inHeight,
@@ -110,43 +367,39 @@ template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
     const double M[][3],
     T delta = 0)
 {
-    for (int32_t i = 0; i < outHeight; i++) {
-        float baseW = M[2][1] * i + M[2][2];
-        float baseX = M[0][1] * i + M[0][2];
-        float baseY = M[1][1] * i + M[1][2];
-        for (int32_t j = 0; j < outWidth; j++) {
-            float w    = M[2][0] * j + baseW;
-            float x    = M[0][0] * j + baseX;
-            float y    = M[1][0] * j + baseY;
-            int32_t sy = static_cast<int32_t>(std::round(y / w));
-            int32_t sx = static_cast<int32_t>(std::round(x / w));
-            if (borderMode == ppl::cv::BORDER_TYPE_CONSTANT) {
-                int32_t idxSrc = sy * inWidthStride + sx * nc;
-                int32_t idxDst = i * outWidthStride + j * nc;
-                if (sx >= 0 && sx < inWidth && sy >= 0 && sy < inHeight) {
-                    for (int32_t i = 0; i < nc; i++)
-                        dst[idxDst + i] = src[idxSrc + i];
+    const bool useFMA   = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t bands = (outHeight + WARP_BAND_ROWS - 1) / WARP_BAND_ROWS;
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t b = 0; b < bands; ++b) {
+        int32_t sx[WARP_BLOCK_SIZE], sy[WARP_BLOCK_SIZE], fx[WARP_BLOCK_SIZE], fy[WARP_BLOCK_SIZE];
+        uint8_t inside[WARP_BLOCK_SIZE];
+        const int32_t rowEnd = std::min(outHeight, (b + 1) * WARP_BAND_ROWS);
+        for (int32_t i = b * WARP_BAND_ROWS; i < rowEnd; ++i) {
+            T* drow = dst + i * outWidthStride;
+            for (int32_t j0 = 0; j0 < outWidth; j0 += WARP_BLOCK_SIZE) {
+                const int32_t len = std::min(WARP_BLOCK_SIZE, outWidth - j0);
+                if (useFMA) {
+                    fma::warpperspective_project_block_fma(M, i, j0, len, 0, inWidth, inHeight, sx, sy, fx, fy, inside);
                 } else {
-                    for (int32_t i = 0; i < nc; i++) {
-                        dst[idxDst + i] = delta;
-                    }
+                    project_block<0>(M, i, j0, len, inWidth, inHeight, sx, sy, fx, fy, inside);
                 }
-            } else if (borderMode == ppl::cv::BORDER_TYPE_REPLICATE) {
-                sx             = clip(sx, 0, inWidth - 1);
-                sy             = clip(sy, 0, inHeight - 1);
-                int32_t idxSrc = sy * inWidthStride + sx * nc;
-                int32_t idxDst = i * outWidthStride + j * nc;
-                for (int32_t i = 0; i < nc; i++) {
-                    dst[idxDst + i] = src[idxSrc + i];
-                }
-            } else if (borderMode == ppl::cv::BORDER_TYPE_TRANSPARENT) {
-                if (sx >= 0 && sx < inWidth && sy >= 0 && sy < inHeight) {
-                    int32_t idxSrc = sy * inWidthStride + sx * nc;
-                    int32_t idxDst = i * outWidthStride + j * nc;
-                    for (int32_t i = 0; i < nc; i++)
-                        dst[idxDst + i] = src[idxSrc + i];
-                } else {
-                    continue;
+                for (int32_t k = 0; k < len;) {
+                    int32_t end = k + 1;
+                    if (inside[k]) {
+                        while (end < len && inside[end]) {
+                            ++end;
+                        }
+                        for (; k < end; ++k) {
+                            memcpy(drow + (j0 + k) * nc, src + sy[k] * inWidthStride + sx[k] * nc, nc * sizeof(T));
+                        }
+                    } else {
+                        while (end < len && !inside[end]) {
+                            ++end;
+                        }
+                        for (; k < end; ++k) {
+                            nearest_border_pixel<T, nc, borderMode>(inHeight, inWidth, inWidthStride, src, sx[k], sy[k], drow + (j0 + k) * nc, delta);
+                        }
+                    }
                 }
             }
         }
@@ -167,87 +420,38 @@ template <typename T, int32_t nc, ppl::cv::BorderType borderMode>
     const double M[][3],
     T delta = 0)
 {
-    for (int32_t i = 0; i < outHeight; i++) {
-        float baseW = M[2][1] * i + M[2][2];
-        float baseX = M[0][1] * i + M[0][2];
-        float baseY = M[1][1] * i + M[1][2];
-        for (int32_t j = 0; j < outWidth; j++) {
-            float w     = (M[2][0] * j + baseW);
-            float x     = M[0][0] * j + baseX;
-            float y     = M[1][0] * j + baseY;
-            y           = y / w;
-            x           = x / w;
-            int32_t sx0 = (int32_t)x;
-            int32_t sy0 = (int32_t)y;
-            float u     = x - sx0;
-            float v     = y - sy0;
-
-            float tab[4];
-            float taby[2], tabx[2];
-            float v0, v1, v2, v3;
-            taby[0] = 1.0f - 1.0f * v;
-            taby[1] = v;
-            tabx[0] = 1.0f - u;
-            tabx[1] = u;
-
-            tab[0] = taby[0] * tabx[0];
-            tab[1] = taby[0] * tabx[1];
-            tab[2] = taby[1] * tabx[0];
-            tab[3] = taby[1] * tabx[1];
-
-            int32_t idxDst = (i * outWidthStride + j * nc);
-
-            if (borderMode == ppl::cv::BORDER_TYPE_CONSTANT) {
-                bool flag0 = (sx0 >= 0 && sx0 < inWidth && sy0 >= 0 && sy0 < inHeight);
-                bool flag1 = (sx0 + 1 >= 0 && sx0 + 1 < inWidth && sy0 >= 0 && sy0 < inHeight);
-                bool flag2 = (sx0 >= 0 && sx0 < inWidth && sy0 + 1 >= 0 && sy0 + 1 < inHeight);
-                bool flag3 = (sx0 + 1 >= 0 && sx0 + 1 < inWidth && sy0 + 1 >= 0 && sy0 + 1 < inHeight);
-                for (int32_t k = 0; k < nc; k++) {
-                    int32_t position1 = (sy0 * inWidthStride + sx0 * nc);
-                    int32_t position2 = ((sy0 + 1) * inWidthStride + sx0 * nc);
-                    v0                = flag0 ? src[position1 + k] : delta;
-                    v1                = flag1 ? src[position1 + nc + k] : delta;
-                    v2                = flag2 ? src[position2 + k] : delta;
-                    v3                = flag3 ? src[position2 + nc + k] : delta;
-                    float sum         = 0;
-                    sum += v0 * tab[0] + v1 * tab[1] + v2 * tab[2] + v3 * tab[3];
-                    dst[idxDst + k] = static_cast<T>(sum);
-                }
-            } else if (borderMode == ppl::cv::BORDER_TYPE_REPLICATE) {
-                int32_t sx1 = sx0 + 1;
-                int32_t sy1 = sy0 + 1;
-                sx0         = clip(sx0, 0, inWidth - 1);
-                sx1         = clip(sx1, 0, inWidth - 1);
-                sy0         = clip(sy0, 0, inHeight - 1);
-                sy1         = clip(sy1, 0, inHeight - 1);
-                const T* t0 = src + sy0 * inWidthStride + sx0 * nc;
-                const T* t1 = src + sy0 * inWidthStride + sx1 * nc;
-                const T* t2 = src + sy1 * inWidthStride + sx0 * nc;
-                const T* t3 = src + sy1 * inWidthStride + sx1 * nc;
-                for (int32_t k = 0; k < nc; ++k) {
-                    float sum = 0;
-                    sum += t0[k] * tab[0] + t1[k] * tab[1] + t2[k] * tab[2] + t3[k] * tab[3];
-                    dst[idxDst + k] = static_cast<T>(sum);
+    const bool useFMA   = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t bands = (outHeight + WARP_BAND_ROWS - 1) / WARP_BAND_ROWS;
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t b = 0; b < bands; ++b) {
+        int32_t sx[WARP_BLOCK_SIZE], sy[WARP_BLOCK_SIZE], fx[WARP_BLOCK_SIZE], fy[WARP_BLOCK_SIZE];
+        uint8_t inside[WARP_BLOCK_SIZE];
+        const int32_t rowEnd = std::min(outHeight, (b + 1) * WARP_BAND_ROWS);
+        for (int32_t i = b * WARP_BAND_ROWS; i < rowEnd; ++i) {
+            T* drow = dst + i * outWidthStride;
+            for (int32_t j0 = 0; j0 < outWidth; j0 += WARP_BLOCK_SIZE) {
+                const int32_t len = std::min(WARP_BLOCK_SIZE, outWidth - j0);
+                if (useFMA) {
+                    fma::warpperspective_project_block_fma(M, i, j0, len, WARP_INTER_BITS, inWidth - 1, inHeight - 1, sx, sy, fx, fy, inside);
+                } else {
+                    project_block<WARP_INTER_BITS>(M, i, j0, len, inWidth - 1, inHeight - 1, sx, sy, fx, fy, inside);
                 }
-            } else if (borderMode == ppl::cv::BORDER_TYPE_TRANSPARENT) {
-                bool flag0 = (sx0 >= 0 && sx0 < inWidth && sy0 >= 0 && sy0 < inHeight);
-                bool flag1 = (sx0 + 1 >= 0 && sx0 + 1 < inWidth && sy0 >= 0 && sy0 < inHeight);
-                bool flag2 = (sx0 >= 0 && sx0 < inWidth && sy0 + 1 >= 0 && sy0 + 1 < inHeight);
-                bool flag3 = (sx0 + 1 >= 0 && sx0 + 1 < inWidth && sy0 + 1 >= 0 && sy0 + 1 < inHeight);
-                if (flag0 && flag1 && flag2 && flag3) {
-                    for (int32_t k = 0; k < nc; k++) {
-                        int32_t position1 = (sy0 * inWidthStride + sx0 * nc);
-                        int32_t position2 = ((sy0 + 1) * inWidthStride + sx0 * nc);
-                        v0                = src[position1 + k];
-                        v1                = src[position1 + nc + k];
-                        v2                = src[position2 + k];
-                        v3                = src[position2 + nc + k];
-                        float sum         = 0;
-                        sum += v0 * tab[0] + v1 * tab[1] + v2 * tab[2] + v3 * tab[3];
-                        dst[idxDst + k] = static_cast<T>(sum);
+                for (int32_t k = 0; k < len;) {
+                    int32_t end = k + 1;
+                    if (inside[k]) {
+                        while (end < len && inside[end]) {
+                            ++end;
+                        }
+                        bilinear_span<T, nc>(inWidthStride, src, sx + k, sy + k, fx + k, fy + k, end - k, drow + (j0 + k) * nc);
+                        k = end;
+                    } else {
+                        while (end < len && !inside[end]) {
+                            ++end;
+                        }
+                        for (; k < end; ++k) {
+                            bilinear_border_pixel<T, nc, borderMode>(inHeight, inWidth, inWidthStride, src, sx[k], sy[k], fx[k], fy[k], drow + (j0 + k) * nc, delta);
+                        }
                     }
-                } else {
-                    continue;
                 }
             }
         }
@@ -279,22 +483,12 @@ template <typename T, int32_t nc>
     M[2][0] = affineMatrix[6];
     M[2][1] = affineMatrix[7];
     M[2][2] = affineMatrix[8];
-    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
-        if (border_type == ppl::cv::BORDER_TYPE_CONSTANT) {
-            fma::warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_CONSTANT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        } else if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
-            fma::warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_REPLICATE>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        } else if (border_type == ppl::cv::BORDER_TYPE_TRANSPARENT) {
-            fma::warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_TRANSPARENT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        }
-    } else {
-        if (border_type == ppl::cv::BORDER_TYPE_CONSTANT) {
-            warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_CONSTANT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        } else if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
-            warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_REPLICATE>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        } else if (border_type == ppl::cv::BORDER_TYPE_TRANSPARENT) {
-            warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_TRANSPARENT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        }
+    if (border_type == ppl::cv::BORDER_TYPE_CONSTANT) {
+        warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_CONSTANT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
+    } else if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
+        warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_REPLICATE>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
+    } else if (border_type == ppl::cv::BORDER_TYPE_TRANSPARENT) {
+        warpperspective_nearest<T, nc, ppl::cv::BORDER_TYPE_TRANSPARENT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
     }
     return ppl::common::RC_SUCCESS;
 }
@@ -323,22 +517,12 @@ template <typename T, int32_t nc>
     M[2][0] = affineMatrix[6];
     M[2][1] = affineMatrix[7];
     M[2][2] = affineMatrix[8];
-    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
-        if (border_type == ppl::cv::BORDER_TYPE_CONSTANT) {
-            fma::warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_CONSTANT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        } else if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
-            fma::warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_REPLICATE>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        } else if (border_type == ppl::cv::BORDER_TYPE_TRANSPARENT) {
-            fma::warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_TRANSPARENT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        }
-    } else {
-        if (border_type == ppl::cv::BORDER_TYPE_CONSTANT) {
-            warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_CONSTANT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        } else if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
-            warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_REPLICATE>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        } else if (border_type == ppl::cv::BORDER_TYPE_TRANSPARENT) {
-            warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_TRANSPARENT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
-        }
+    if (border_type == ppl::cv::BORDER_TYPE_CONSTANT) {
+        warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_CONSTANT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
+    } else if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
+        warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_REPLICATE>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
+    } else if (border_type == ppl::cv::BORDER_TYPE_TRANSPARENT) {
+        warpperspective_linear<T, nc, ppl::cv::BORDER_TYPE_TRANSPARENT>(inHeight, inWidth, inWidthStride, outHeight, outWidth, outWidthStride, outData, inData, M, border_value);
     }
     return ppl::common::RC_SUCCESS;
 }
@@ -146,3 +146,34 @@ TEST(WarpPerspectiveNearest_UCHAR_BORDER_TRANSPARENT, x86)
     WarpPerspectiveTest<uchar, 3>(640, 720, 640, 720, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT);
     WarpPerspectiveTest<uchar, 4>(640, 720, 640, 720, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT);
 }
+
+// a rectification-like homography on a smooth image, where the fixed-point sampling should track OpenCV closely
+template <typename T, int channels>
+void WarpPerspectiveRectifyTest(int inHeight, int inWidth, int outHeight, int outWidth, float diff)
+{
+    std::unique_ptr<float[]> noise(new float[inWidth * inHeight * channels]);
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * channels]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * channels]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * channels]);
+    ppl::cv::debug::randomFill<float>(noise.get(), channels * inWidth * inHeight, 0, 255);
+    cv::Mat noiseMat(inHeight, inWidth, CV_MAKETYPE(CV_32F, channels), noise.get(), sizeof(float) * inWidth * channels);
+    cv::Mat srcMat(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), src.get(), sizeof(T) * inWidth * channels);
+    cv::GaussianBlur(noiseMat, noiseMat, cv::Size(0, 0), 3);
+    noiseMat.convertTo(srcMat, srcMat.type());
+    double affine_matrix[9] = {1.02, 0.03, -20.0, -0.02, 0.98, 15.0, 1.5e-5, -1e-5, 1.0};
+    cv::Mat dstMat(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dst_ref.get(), sizeof(T) * outWidth * channels);
+    cv::Mat affineMat(3, 3, CV_64FC1, affine_matrix);
+    ppl::cv::x86::WarpPerspectiveLinear<T, channels>(inHeight, inWidth, inWidth * channels, src.get(), outHeight, outWidth, outWidth * channels, dst.get(), affine_matrix, ppl::cv::BORDER_TYPE_REPLICATE);
+    cv::warpPerspective(srcMat, dstMat, affineMat, cv::Size(outWidth, outHeight), cv::INTER_LINEAR | cv::WARP_INVERSE_MAP, cv::BORDER_REPLICATE);
+    checkResult<T, channels>(dst.get(), dst_ref.get(), outHeight, outWidth, outWidth * channels, outWidth * channels, diff);
+}
+
+TEST(WarpPerspectiveLinear_Rectify, x86)
+{
+    WarpPerspectiveRectifyTest<uchar, 1>(481, 643, 477, 651, 1.01f);
+    WarpPerspectiveRectifyTest<uchar, 3>(481, 643, 477, 651, 1.01f);
+    WarpPerspectiveRectifyTest<uchar, 4>(481, 643, 477, 651, 1.01f);
+    WarpPerspectiveRectifyTest<float, 1>(481, 643, 477, 651, 0.5f);
+    WarpPerspectiveRectifyTest<float, 3>(481, 643, 477, 651, 0.5f);
+    WarpPerspectiveRectifyTest<float, 4>(481, 643, 477, 651, 0.5f);
+}
@@ -0,0 +1,302 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/warppolar.h"
+#include "ppl/cv/x86/remap.hpp"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define WARPPOLAR_BAND_ROWS 16
+#define WARPPOLAR_TWO_PI    6.283185307179586476925286766559
+
+template <typename T, int32_t nc, BorderType borderMode, bool isLinear>
+static inline void samplePixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* src,
+    float x,
+    float y,
+    T* dst,
+    T borderValue)
+{
+    if (isLinear) {
+        remap_linear_pixel<T, nc, borderMode>(inHeight, inWidth, inWidthStride, src, x, y, dst, borderValue);
+    } else {
+        remap_nearest_pixel<T, nc, borderMode>(inHeight, inWidth, inWidthStride, src, x, y, dst, borderValue);
+    }
+}
+
+// cartesian to polar: every output row is an angle, and every column a radius shared by all rows
+template <typename T, int32_t nc, BorderType borderMode, bool isLinear>
+static void warpPolarForward(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    float centerX,
+    float centerY,
+    double maxRadius,
+    WarpPolarMode mode,
+    T borderValue)
+{
+    const int32_t padded = (outWidth + 3) & ~3;
+    std::vector<float> rho(padded, 0.f);
+    if (mode == WARP_POLAR_LOG) {
+        double kmag = std::log(maxRadius) / outWidth;
+        for (int32_t j = 0; j < outWidth; ++j) {
+            rho[j] = (float)(std::exp(j * kmag) - 1.0);
+        }
+    } else {
+        double kmag = maxRadius / outWidth;
+        for (int32_t j = 0; j < outWidth; ++j) {
+            rho[j] = (float)(j * kmag);
+        }
+    }
+    const double kangle    = WARPPOLAR_TWO_PI / outHeight;
+    const int32_t numBands = (outHeight + WARPPOLAR_BAND_ROWS - 1) / WARPPOLAR_BAND_ROWS;
+#pragma omp parallel for schedule(static)
+    for (int32_t band = 0; band < numBands; ++band) {
+        std::vector<float> buffer(2 * padded);
+        float* bufX        = &buffer[0];
+        float* bufY        = &buffer[padded];
+        const int32_t iEnd = std::min(outHeight, (band + 1) * WARPPOLAR_BAND_ROWS);
+        for (int32_t i = band * WARPPOLAR_BAND_ROWS; i < iEnd; ++i) {
+            const __m128 cp = _mm_set1_ps((float)std::cos(i * kangle));
+            const __m128 sp = _mm_set1_ps((float)std::sin(i * kangle));
+            const __m128 cx = _mm_set1_ps(centerX);
+            const __m128 cy = _mm_set1_ps(centerY);
+            for (int32_t j = 0; j < outWidth; j += 4) {
+                __m128 r = _mm_loadu_ps(&rho[j]);
+                _mm_storeu_ps(bufX + j, _mm_add_ps(cx, _mm_mul_ps(r, cp)));
+                _mm_storeu_ps(bufY + j, _mm_add_ps(cy, _mm_mul_ps(r, sp)));
+            }
+            T* dst = outData + i * outWidthStride;
+            for (int32_t j = 0; j < outWidth; ++j) {
+                samplePixel<T, nc, borderMode, isLinear>(inHeight, inWidth, inWidthStride, inData, bufX[j], bufY[j], dst + j * nc, borderValue);
+            }
+        }
+    }
+}
+
+// polar to cartesian: the input rows are angles, so the last and the first rows are neighbours
+template <typename T, int32_t nc, BorderType borderMode, bool isLinear>
+static void warpPolarInverse(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    float centerX,
+    float centerY,
+    double maxRadius,
+    WarpPolarMode mode,
+    T borderValue)
+{
+    const bool isLog     = mode == WARP_POLAR_LOG;
+    const float kangle   = (float)(inHeight / WARPPOLAR_TWO_PI);
+    const float kmag     = (float)(isLog ? inWidth / std::log(maxRadius) : inWidth / maxRadius);
+    const float seamY    = (float)(inHeight - 1);
+    const int32_t padded = (outWidth + 3) & ~3;
+
+    // rows inHeight - 1 and 0 side by side, to interpolate across the seam of the angle axis
+    const int32_t seamStride = inWidth * nc;
+    std::vector<T> seam(2 * seamStride);
+    memcpy(&seam[0], inData + (inHeight - 1) * inWidthStride, seamStride * sizeof(T));
+    memcpy(&seam[seamStride], inData, seamStride * sizeof(T));
+
+    const int32_t numBands = (outHeight + WARPPOLAR_BAND_ROWS - 1) / WARPPOLAR_BAND_ROWS;
+#pragma omp parallel for schedule(static)
+    for (int32_t band = 0; band < numBands; ++band) {
+        std::vector<float> buffer(2 * padded);
+        float* bufX        = &buffer[0];
+        float* bufY        = &buffer[padded];
+        const __m128 one   = _mm_set1_ps(1.f);
+        const __m128 twoPi = _mm_set1_ps((float)WARPPOLAR_TWO_PI);
+        const __m128 vmag  = _mm_set1_ps(kmag);
+        const __m128 vang  = _mm_set1_ps(kangle);
+        const int32_t iEnd = std::min(outHeight, (band + 1) * WARPPOLAR_BAND_ROWS);
+        for (int32_t i = band * WARPPOLAR_BAND_ROWS; i < iEnd; ++i) {
+            const __m128 dy = _mm_set1_ps((float)i - centerY);
+            __m128 dx       = _mm_sub_ps(_mm_setr_ps(0.f, 1.f, 2.f, 3.f), _mm_set1_ps(centerX));
+            for (int32_t j = 0; j < outWidth; j += 4) {
+                __m128 mag   = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+                __m128 angle = v_atan2_ps(dy, dx);
+                angle        = _mm_add_ps(angle, _mm_and_ps(_mm_cmplt_ps(angle, _mm_setzero_ps()), twoPi));
+                if (isLog) {
+                    mag = v_log_ps(_mm_add_ps(mag, one));
+                }
+                _mm_storeu_ps(bufX + j, _mm_mul_ps(mag, vmag));
+                _mm_storeu_ps(bufY + j, _mm_mul_ps(angle, vang));
+                dx = _mm_add_ps(dx, _mm_set1_ps(4.f));
+            }
+            T* dst = outData + i * outWidthStride;
+            for (int32_t j = 0; j < outWidth; ++j) {
+                if (bufY[j] >= seamY) {
+                    samplePixel<T, nc, borderMode, isLinear>(2, inWidth, seamStride, &seam[0], bufX[j], bufY[j] - seamY, dst + j * nc, borderValue);
+                } else {
+                    samplePixel<T, nc, borderMode, isLinear>(inHeight, inWidth, inWidthStride, inData, bufX[j], bufY[j], dst + j * nc, borderValue);
+                }
+            }
+        }
+    }
+}
+
+template <typename T, int32_t nc, BorderType borderMode, bool isLinear>
+static void warpPolarDirection(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    float centerX,
+    float centerY,
+    double maxRadius,
+    WarpPolarMode mode,
+    bool inverseMap,
+    T borderValue)
+{
+    if (inverseMap) {
+        warpPolarInverse<T, nc, borderMode, isLinear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, centerX, centerY, maxRadius, mode, borderValue);
+    } else {
+        warpPolarForward<T, nc, borderMode, isLinear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, centerX, centerY, maxRadius, mode, borderValue);
+    }
+}
+
+template <typename T, int32_t nc, bool isLinear>
+static ::ppl::common::RetCode warpPolar(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    float centerX,
+    float centerY,
+    double maxRadius,
+    WarpPolarMode mode,
+    bool inverseMap,
+    BorderType border_type,
+    T borderValue)
+{
+    if (inData == nullptr || outData == nullptr || inData == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * nc || outHeight <= 0 || outWidth <= 0 || outWidthStride < outWidth * nc) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mode != WARP_POLAR_LINEAR && mode != WARP_POLAR_LOG) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (!(maxRadius > 0) || (mode == WARP_POLAR_LOG && !(maxRadius > 1))) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type == BORDER_TYPE_CONSTANT) {
+        warpPolarDirection<T, nc, BORDER_TYPE_CONSTANT, isLinear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, centerX, centerY, maxRadius, mode, inverseMap, borderValue);
+    } else if (border_type == BORDER_TYPE_REPLICATE) {
+        warpPolarDirection<T, nc, BORDER_TYPE_REPLICATE, isLinear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, centerX, centerY, maxRadius, mode, inverseMap, borderValue);
+    } else if (border_type == BORDER_TYPE_TRANSPARENT) {
+        warpPolarDirection<T, nc, BORDER_TYPE_TRANSPARENT, isLinear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, centerX, centerY, maxRadius, mode, inverseMap, borderValue);
+    } else {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t nc>
+::ppl::common::RetCode WarpPolarLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    float centerX,
+    float centerY,
+    double maxRadius,
+    WarpPolarMode mode,
+    bool inverseMap,
+    BorderType border_type,
+    T borderValue)
+{
+    return warpPolar<T, nc, true>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, centerX, centerY, maxRadius, mode, inverseMap, border_type, borderValue);
+}
+
+template <typename T, int32_t nc>
+::ppl::common::RetCode WarpPolarNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    float centerX,
+    float centerY,
+    double maxRadius,
+    WarpPolarMode mode,
+    bool inverseMap,
+    BorderType border_type,
+    T borderValue)
+{
+    return warpPolar<T, nc, false>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, centerX, centerY, maxRadius, mode, inverseMap, border_type, borderValue);
+}
+
+template ::ppl::common::RetCode WarpPolarLinear<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode WarpPolarLinear<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode WarpPolarLinear<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode WarpPolarLinear<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, float borderValue);
+template ::ppl::common::RetCode WarpPolarLinear<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, float borderValue);
+template ::ppl::common::RetCode WarpPolarLinear<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, float borderValue);
+
+template ::ppl::common::RetCode WarpPolarNearestPoint<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode WarpPolarNearestPoint<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode WarpPolarNearestPoint<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, uint8_t borderValue);
+template ::ppl::common::RetCode WarpPolarNearestPoint<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, float borderValue);
+template ::ppl::common::RetCode WarpPolarNearestPoint<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, float borderValue);
+template ::ppl::common::RetCode WarpPolarNearestPoint<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float* inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float* outData, float centerX, float centerY, double maxRadius, WarpPolarMode mode, bool inverseMap, BorderType border_type, float borderValue);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/warppolar.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+
+namespace {
+
+template <typename T, int32_t channels, ppl::cv::WarpPolarMode mode>
+void BM_WarpPolar_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t radii = std::min(width, height) / 2;
+    int32_t angles = 720;
+    std::unique_ptr<T[]> src(new T[width * height * channels]);
+    std::unique_ptr<T[]> dst(new T[radii * angles * channels]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * channels, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::WarpPolarLinear<T, channels>(height, width, width * channels, src.get(), angles, radii, radii * channels, dst.get(), width / 2.f, height / 2.f, radii, mode);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_WarpPolar_ppl_x86, uint8_t, c1, ppl::cv::WARP_POLAR_LINEAR)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPolar_ppl_x86, uint8_t, c3, ppl::cv::WARP_POLAR_LINEAR)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPolar_ppl_x86, uint8_t, c1, ppl::cv::WARP_POLAR_LOG)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPolar_ppl_x86, float, c1, ppl::cv::WARP_POLAR_LINEAR)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template <typename T, int32_t channels, ppl::cv::WarpPolarMode mode>
+static void BM_WarpPolar_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t radii = std::min(width, height) / 2;
+    int32_t angles = 720;
+    std::unique_ptr<T[]> src(new T[width * height * channels]);
+    std::unique_ptr<T[]> dst(new T[radii * angles * channels]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * channels, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, channels), src.get());
+    cv::Mat dstMat(angles, radii, CV_MAKETYPE(cv::DataType<T>::depth, channels), dst.get());
+    int flags = cv::INTER_LINEAR | cv::WARP_FILL_OUTLIERS | (mode == ppl::cv::WARP_POLAR_LOG ? cv::WARP_POLAR_LOG : cv::WARP_POLAR_LINEAR);
+    for (auto _ : state) {
+        cv::warpPolar(srcMat, dstMat, cv::Size(radii, angles), cv::Point2f(width / 2.f, height / 2.f), radii, flags);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_WarpPolar_opencv_x86, uint8_t, c1, ppl::cv::WARP_POLAR_LINEAR)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPolar_opencv_x86, uint8_t, c3, ppl::cv::WARP_POLAR_LINEAR)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPolar_opencv_x86, uint8_t, c1, ppl::cv::WARP_POLAR_LOG)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPolar_opencv_x86, float, c1, ppl::cv::WARP_POLAR_LINEAR)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#endif //! PPLCV_BENCHMARK_OPENCV
+}
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/warppolar.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/imgproc.hpp>
+
+// OpenCV rounds the interpolated value and quantizes the coordinates to 1/32 pixel, while ppl.cv truncates and
+// interpolates with the exact coordinates. With nearest neighbour, a few coordinates of the inverse transform fall
+// on the other side of a rounding boundary, so the mean difference is checked besides the maximum one
+template <typename T, int32_t nc>
+static void checkPolarResult(const T* data, const cv::Mat& ref, int32_t height, int32_t width, float meanThr, float maxThr)
+{
+    double sum = 0, maxDiff = 0;
+    for (int32_t i = 0; i < height; ++i) {
+        const T* r = ref.ptr<T>(i);
+        for (int32_t j = 0; j < width * nc; ++j) {
+            double diff = std::fabs((double)data[i * width * nc + j] - (double)r[j]);
+            sum += diff;
+            maxDiff = std::max(maxDiff, diff);
+        }
+    }
+    EXPECT_LT(sum / ((double)height * width * nc), meanThr);
+    EXPECT_LT(maxDiff, maxThr);
+}
+
+template <typename T, int32_t nc, bool isLinear>
+void WarpPolarTest(int32_t height, int32_t width, int32_t angles, int32_t radii, ppl::cv::WarpPolarMode mode, float meanThr, float maxThr)
+{
+    const float centerX    = width * 0.5f + 1.5f;
+    const float centerY    = height * 0.5f - 1.75f;
+    const double maxRadius = std::min(height, width) * 0.6;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> polar(new T[radii * angles * nc]);
+    std::unique_ptr<T[]> cartesian(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    // a smooth image, so that the differences of the coordinates stay small in the values
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::GaussianBlur(srcMat, srcMat, cv::Size(0, 0), 3);
+
+    int flags = (isLinear ? cv::INTER_LINEAR : cv::INTER_NEAREST) | cv::WARP_FILL_OUTLIERS |
+                (mode == ppl::cv::WARP_POLAR_LOG ? cv::WARP_POLAR_LOG : cv::WARP_POLAR_LINEAR);
+    cv::Mat polarRef, cartesianRef;
+    cv::warpPolar(srcMat, polarRef, cv::Size(radii, angles), cv::Point2f(centerX, centerY), maxRadius, flags);
+    cv::warpPolar(polarRef, cartesianRef, cv::Size(width, height), cv::Point2f(centerX, centerY), maxRadius, flags | cv::WARP_INVERSE_MAP);
+
+    if (isLinear) {
+        ppl::cv::x86::WarpPolarLinear<T, nc>(height, width, width * nc, src.get(), angles, radii, radii * nc, polar.get(), centerX, centerY, maxRadius, mode, false);
+        ppl::cv::x86::WarpPolarLinear<T, nc>(angles, radii, radii * nc, polarRef.ptr<T>(), height, width, width * nc, cartesian.get(), centerX, centerY, maxRadius, mode, true);
+    } else {
+        ppl::cv::x86::WarpPolarNearestPoint<T, nc>(height, width, width * nc, src.get(), angles, radii, radii * nc, polar.get(), centerX, centerY, maxRadius, mode, false);
+        ppl::cv::x86::WarpPolarNearestPoint<T, nc>(angles, radii, radii * nc, polarRef.ptr<T>(), height, width, width * nc, cartesian.get(), centerX, centerY, maxRadius, mode, true);
+    }
+    checkPolarResult<T, nc>(polar.get(), polarRef, angles, radii, meanThr, maxThr);
+    checkPolarResult<T, nc>(cartesian.get(), cartesianRef, height, width, meanThr, maxThr);
+}
+
+TEST(WARPPOLAR_LINEAR_UINT8, x86)
+{
+    WarpPolarTest<uint8_t, 1, true>(480, 640, 720, 300, ppl::cv::WARP_POLAR_LINEAR, 0.75f, 8.f);
+    WarpPolarTest<uint8_t, 3, true>(480, 640, 720, 300, ppl::cv::WARP_POLAR_LOG, 0.75f, 8.f);
+    WarpPolarTest<uint8_t, 4, true>(241, 323, 361, 97, ppl::cv::WARP_POLAR_LINEAR, 0.75f, 8.f);
+}
+
+TEST(WARPPOLAR_LINEAR_FP32, x86)
+{
+    WarpPolarTest<float, 1, true>(480, 640, 720, 300, ppl::cv::WARP_POLAR_LOG, 0.25f, 8.f);
+    WarpPolarTest<float, 3, true>(241, 323, 361, 97, ppl::cv::WARP_POLAR_LINEAR, 0.25f, 8.f);
+    WarpPolarTest<float, 4, true>(480, 640, 720, 300, ppl::cv::WARP_POLAR_LINEAR, 0.25f, 8.f);
+}
+
+TEST(WARPPOLAR_NEAREST_POINT, x86)
+{
+    WarpPolarTest<uint8_t, 1, false>(480, 640, 720, 300, ppl::cv::WARP_POLAR_LINEAR, 0.1f, 256.f);
+    WarpPolarTest<uint8_t, 3, false>(241, 323, 361, 97, ppl::cv::WARP_POLAR_LOG, 0.1f, 256.f);
+    WarpPolarTest<float, 1, false>(480, 640, 720, 300, ppl::cv::WARP_POLAR_LOG, 0.1f, 256.f);
+    WarpPolarTest<float, 4, false>(241, 323, 361, 97, ppl::cv::WARP_POLAR_LINEAR, 0.1f, 256.f);
+}